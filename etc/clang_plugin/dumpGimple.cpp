@@ -365,7 +365,8 @@ namespace llvm
    }
 
    DumpGimpleRaw::DumpGimpleRaw(const std::string& _outdir_name, const std::string& _InFile, bool _onlyGlobals,
-                                std::map<std::string, std::vector<std::string>>* _fun2params, bool early)
+                                std::map<std::string, std::vector<std::string>>* _fun2params, bool early,
+                                bool _binary)
        :
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wnull-dereference"
@@ -392,6 +393,7 @@ namespace llvm
          moduleContext(nullptr),
          last_used_index(0),
          column(0),
+         binary(_binary),
          PtoSets_AA(nullptr),
          SignedPointerTypeReference(0),
          last_memory_ssa_vers(std::numeric_limits<int>::max()),
@@ -4058,6 +4060,8 @@ namespace llvm
 
    void DumpGimpleRaw::serialize_new_line()
    {
+      if(binary)
+         return;
       snprintf(buffer, LOCAL_BUFFER_LEN, "\n%*s", SOL_COLUMN, "");
       stream << buffer;
       column = SOL_COLUMN;
@@ -4067,6 +4071,10 @@ namespace llvm
    {
       int extra;
 
+      /* The binary stream has no layout.  */
+      if(binary)
+         return;
+
       /* See if we need a new line. */
       if(column > EOL_COLUMN)
          serialize_new_line();
@@ -4081,19 +4089,101 @@ namespace llvm
 
    void DumpGimpleRaw::serialize_pointer(const char* field, const void* ptr)
    {
+      if(binary)
+      {
+         snprintf(buffer, LOCAL_BUFFER_LEN, "%llx", (unsigned long long)ptr);
+         binary_keyword(field);
+         binary_number(buffer);
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s: %-8llx ", field, (unsigned long long)ptr);
       stream << buffer;
       column += 15;
    }
 
+   void DumpGimpleRaw::binary_varint(unsigned long long value)
+   {
+      while(value >= 0x80)
+      {
+         stream << static_cast<char>((value & 0x7f) | 0x80);
+         value >>= 7;
+      }
+      stream << static_cast<char>(value);
+   }
+
+   /* Return the index of STR in the string table of the binary stream, defining it the first time it is used.  */
+   unsigned int DumpGimpleRaw::binary_intern(const std::string& str)
+   {
+      const auto it = binaryStringTable.find(str);
+      if(it != binaryStringTable.end())
+         return it->second;
+      const auto index = static_cast<unsigned int>(binaryStringTable.size());
+      binaryStringTable.emplace(str, index);
+      stream << static_cast<char>(BT_DEFINE);
+      binary_varint(str.size());
+      stream << str;
+      return index;
+   }
+
+   void DumpGimpleRaw::binary_keyword(const char* keyword)
+   {
+      const auto index = binary_intern(keyword);
+      stream << static_cast<char>(BT_KEYWORD);
+      binary_varint(index);
+   }
+
+   void DumpGimpleRaw::binary_int(long long value)
+   {
+      stream << static_cast<char>(BT_INT);
+      binary_varint((static_cast<unsigned long long>(value) << 1) ^ static_cast<unsigned long long>(value >> 63));
+   }
+
+   void DumpGimpleRaw::binary_number(const std::string& number)
+   {
+      const auto index = binary_intern(number);
+      stream << static_cast<char>(BT_NUMBER);
+      binary_varint(index);
+   }
+
+   /* Emit a string token; LEXEME is the string as it would appear in the textual dump, double quotes included.  */
+   void DumpGimpleRaw::binary_string(const std::string& lexeme)
+   {
+      const auto index = binary_intern(lexeme);
+      stream << static_cast<char>(BT_STRING);
+      binary_varint(index);
+   }
+
+   void DumpGimpleRaw::binary_srcp(const char* file, int line, int col)
+   {
+      binary_keyword("srcp");
+      binary_string("\"" + std::string(file) + "\"");
+      binary_int(line);
+      binary_int(col);
+   }
+
    void DumpGimpleRaw::DumpVersion(llvm::raw_fd_ostream& stream)
    {
+      if(binary)
+      {
+         stream.write(BINARY_IR_MAGIC, sizeof(BINARY_IR_MAGIC) - 1);
+         binary_keyword("COMPILER_VERSION");
+         binary_string("\"Clang " __clang_version__ "\"");
+         binary_keyword("PLUGIN_VERSION");
+         binary_string("\"" PANDA_PLUGIN_VERSION "\"");
+         return;
+      }
       stream << "COMPILER_VERSION: \"Clang " __clang_version__ "\"\nPLUGIN_VERSION: \"" PANDA_PLUGIN_VERSION "\"\n";
    }
 
    void DumpGimpleRaw::serialize_int(const char* field, int i)
    {
+      if(binary)
+      {
+         binary_keyword(field);
+         binary_int(i);
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s: %-7d ", field, i);
       stream << buffer;
@@ -4103,6 +4193,12 @@ namespace llvm
    /* Serialize wide integer i using FIELD to identify it.  */
    void DumpGimpleRaw::serialize_int_cst(const char* field, const std::string& i)
    {
+      if(binary)
+      {
+         binary_keyword(field);
+         binary_number(i);
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN,
                "%-4s: "
@@ -4193,25 +4289,17 @@ namespace llvm
       }*/
       assert(reinterpret_cast<const llvm::ConstantFP*>(t)->getValueID() == llvm::Value::ConstantFPVal);
       const llvm::APFloat& d = reinterpret_cast<const llvm::ConstantFP*>(t)->getValueAPF();
+      std::string valr;
+      std::string valx;
       if(d.isInfinity())
       {
-         snprintf(buffer, LOCAL_BUFFER_LEN, "valr: %-7s ", "\"Inf\"");
-         stream << buffer;
-         if(d.isNegative())
-            snprintf(buffer, LOCAL_BUFFER_LEN, "valx: %-7s ", "\"-Inf\"");
-         else
-            snprintf(buffer, LOCAL_BUFFER_LEN, "valx: %-7s ", "\"Inf\"");
-         stream << buffer;
+         valr = "\"Inf\"";
+         valx = d.isNegative() ? "\"-Inf\"" : "\"Inf\"";
       }
       else if(d.isNaN())
       {
-         snprintf(buffer, LOCAL_BUFFER_LEN, "valr: %-7s ", "\"Nan\"");
-         stream << buffer;
-         if(d.isNegative())
-            snprintf(buffer, LOCAL_BUFFER_LEN, "valx: %-7s ", "\"-Nan\"");
-         else
-            snprintf(buffer, LOCAL_BUFFER_LEN, "valx: %-7s ", "\"Nan\"");
-         stream << buffer;
+         valr = "\"Nan\"";
+         valx = d.isNegative() ? "\"-Nan\"" : "\"Nan\"";
       }
       else
       {
@@ -4223,28 +4311,46 @@ namespace llvm
             literalReal = literalReal + ".";
          if(!isDouble && literalReal.find('e') == std::string::npos)
             literalReal = literalReal + "f";
-         stream << "valr: \"" << literalReal << "\" ";
+         valr = "\"" + literalReal + "\"";
 
-         stream << "valx: \"";
          real_to_hexadecimal(buffer, LOCAL_BUFFER_LEN, d);
-         stream << std::string(buffer);
-         stream << "\"";
+         valx = "\"" + std::string(buffer) + "\"";
+      }
+      if(binary)
+      {
+         binary_keyword("valr");
+         binary_string(valr);
+         binary_keyword("valx");
+         binary_string(valx);
+         return;
+      }
+      if(d.isInfinity() || d.isNaN())
+      {
+         snprintf(buffer, LOCAL_BUFFER_LEN, "valr: %-7s ", valr.c_str());
+         stream << buffer;
+         snprintf(buffer, LOCAL_BUFFER_LEN, "valx: %-7s ", valx.c_str());
+         stream << buffer;
+      }
+      else
+      {
+         stream << "valr: " << valr << " ";
+         stream << "valx: " << valx;
       }
       column += 21;
    }
 
-   int DumpGimpleRaw::serialize_with_double_quote(const char* input, int length)
+   int DumpGimpleRaw::serialize_with_double_quote(llvm::raw_ostream& os, const char* input, int length)
    {
       int new_length;
-      stream << "\"";
-      new_length = serialize_with_escape(input, length);
-      stream << "\"";
+      os << "\"";
+      new_length = serialize_with_escape(os, input, length);
+      os << "\"";
       return new_length + 2;
    }
 
    /* Add a backslash before an escape sequence to serialize the string
       with the escape sequence */
-   int DumpGimpleRaw::serialize_with_escape(const char* input, int length)
+   int DumpGimpleRaw::serialize_with_escape(llvm::raw_ostream& os, const char* input, int length)
    {
       int i;
       int k = 0;
@@ -4255,94 +4361,94 @@ namespace llvm
             case '\n':
             {
                /* new line*/
-               stream << "\\";
-               stream << "n";
+               os << "\\";
+               os << "n";
                k += 2;
                break;
             }
             case '\t':
             {
                /* horizontal tab */
-               stream << "\\";
-               stream << "t";
+               os << "\\";
+               os << "t";
                k += 2;
                break;
             }
             case '\v':
             {
                /* vertical tab */
-               stream << "\\";
-               stream << "v";
+               os << "\\";
+               os << "v";
                k += 2;
                break;
             }
             case '\b':
             {
                /* backspace */
-               stream << "\\";
-               stream << "b";
+               os << "\\";
+               os << "b";
                k += 2;
                break;
             }
             case '\r':
             {
                /* carriage return */
-               stream << "\\";
-               stream << "r";
+               os << "\\";
+               os << "r";
                k += 2;
                break;
             }
             case '\f':
             {
                /* jump page */
-               stream << "\\";
-               stream << "f";
+               os << "\\";
+               os << "f";
                k += 2;
                break;
             }
             case '\a':
             {
                /* alarm */
-               stream << "\\";
-               stream << "a";
+               os << "\\";
+               os << "a";
                k += 2;
                break;
             }
             case '\\':
             {
                /* backslash */
-               stream << "\\";
-               stream << "\\";
+               os << "\\";
+               os << "\\";
                k += 2;
                break;
             }
             case '\"':
             {
                /* double quote */
-               stream << "\\";
-               stream << "\"";
+               os << "\\";
+               os << "\"";
                k += 2;
                break;
             }
             case '\'':
             {
                /* quote */
-               stream << "\\";
-               stream << "\'";
+               os << "\\";
+               os << "\'";
                k += 2;
                break;
             }
             case '\0':
             {
                /* null */
-               stream << "\\";
-               stream << "0";
+               os << "\\";
+               os << "0";
                k += 2;
                break;
             }
             default:
             {
-               stream << input[i];
+               os << input[i];
                k++;
             }
          }
@@ -4353,6 +4459,11 @@ namespace llvm
    /* Serialize the string S.  */
    void DumpGimpleRaw::serialize_string(const char* string)
    {
+      if(binary)
+      {
+         binary_keyword(string);
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN, "%-13s ", string);
       stream << buffer;
@@ -4366,11 +4477,20 @@ namespace llvm
    void DumpGimpleRaw::serialize_string_field(const char* field, const char* str)
    {
       int length;
+      if(binary)
+      {
+         std::string lexeme;
+         llvm::raw_string_ostream os(lexeme);
+         serialize_with_double_quote(os, str, static_cast<int>(std::strlen(str)));
+         binary_keyword(field);
+         binary_string(os.str());
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s: ", field);
       stream << buffer;
       length = std::strlen(str);
-      length = serialize_with_double_quote(str, length);
+      length = serialize_with_double_quote(stream, str, length);
       if(length > 7)
          column += 6 + length + 1;
       else
@@ -4380,12 +4500,39 @@ namespace llvm
    void DumpGimpleRaw::serialize_string_cst(const char* field, const char* str, int length, unsigned int precision)
    {
       int new_length;
+      if(binary)
+      {
+         std::string lexeme;
+         llvm::raw_string_ostream os(lexeme);
+         binary_keyword(field);
+         if(precision == 8)
+         {
+            serialize_with_double_quote(os, str, length - 1);
+            binary_string(os.str());
+            serialize_int("lngt", length);
+         }
+         else
+         {
+            const unsigned int* string = (const unsigned int*)str;
+            unsigned int i, lngt = length / 4 - 1;
+            os << "\"";
+            for(i = 0; i < lngt; i++)
+            {
+               snprintf(buffer, LOCAL_BUFFER_LEN, "\\x%x", string[i]);
+               os << buffer;
+            }
+            os << "\"";
+            binary_string(os.str());
+            serialize_int("lngt", lngt + 1);
+         }
+         return;
+      }
       serialize_maybe_newline();
       if(precision == 8)
       {
          snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s: ", field);
          stream << buffer;
-         new_length = serialize_with_double_quote(str, length - 1);
+         new_length = serialize_with_double_quote(stream, str, length - 1);
          if(new_length > 7)
             column += 6 + new_length + 1;
          else
@@ -4427,6 +4574,12 @@ namespace llvm
          /* If we haven't, add it to the queue.  */
          index = queue(t);
       }
+      if(binary)
+      {
+         binary_keyword(field);
+         serialize_index(index);
+         return;
+      }
       serialize_maybe_newline();
       snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s: ", field);
       stream << buffer;
@@ -4436,6 +4589,12 @@ namespace llvm
 
    void DumpGimpleRaw::serialize_index(unsigned int index)
    {
+      if(binary)
+      {
+         stream << static_cast<char>(BT_NODE);
+         binary_varint(index);
+         return;
+      }
       snprintf(buffer, LOCAL_BUFFER_LEN, "@%-6u ", index);
       stream << buffer;
       column += 8;
@@ -4509,8 +4668,13 @@ namespace llvm
       /* Print the node index.  */
       serialize_index(index);
 
-      snprintf(buffer, LOCAL_BUFFER_LEN, "%-16s ", code_name);
-      stream << buffer;
+      if(binary)
+         binary_keyword(code_name);
+      else
+      {
+         snprintf(buffer, LOCAL_BUFFER_LEN, "%-16s ", code_name);
+         stream << buffer;
+      }
       column = 25;
       serialize_child("scpe", getGimpleScpe(g));
       serialize_int("bb_index", getGimple_bb_index(g));
@@ -4525,7 +4689,10 @@ namespace llvm
          snprintf(buffer, LOCAL_BUFFER_LEN, "srcp: \"%s\":%-d:%-6d ", xloc.file, xloc.line, xloc.column);
          if(xloc.file && xloc.file[0])
          {
-            stream << buffer;
+            if(binary)
+               binary_srcp(xloc.file, xloc.line, xloc.column);
+            else
+               stream << buffer;
             column += 12 + strlen(xloc.file) + 8;
          }
       }
@@ -4802,7 +4969,8 @@ namespace llvm
       }
 
       /* Terminate the line.  */
-      stream << "\n";
+      if(!binary)
+         stream << "\n";
    }
 
    void DumpGimpleRaw::dequeue_and_serialize_statement(const void* t)
@@ -4815,8 +4983,13 @@ namespace llvm
       /* Print the node index.  */
       serialize_index(index);
 
-      snprintf(buffer, LOCAL_BUFFER_LEN, "%-16s ", code_name);
-      stream << buffer;
+      if(binary)
+         binary_keyword(code_name);
+      else
+      {
+         snprintf(buffer, LOCAL_BUFFER_LEN, "%-16s ", code_name);
+         stream << buffer;
+      }
       column = 25;
 
       /* In case of basic blocks the function print:
@@ -4883,8 +5056,16 @@ namespace llvm
          {
             serialize_maybe_newline();
             field = "pred: ENTRY";
-            snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s ", field);
-            stream << buffer;
+            if(binary)
+            {
+               binary_keyword("pred");
+               binary_keyword("ENTRY");
+            }
+            else
+            {
+               snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s ", field);
+               stream << buffer;
+            }
             column += 14;
          }
          else
@@ -4904,8 +5085,16 @@ namespace llvm
          {
             serialize_maybe_newline();
             field = "succ: EXIT";
-            snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s ", field);
-            stream << buffer;
+            if(binary)
+            {
+               binary_keyword("succ");
+               binary_keyword("EXIT");
+            }
+            else
+            {
+               snprintf(buffer, LOCAL_BUFFER_LEN, "%-4s ", field);
+               stream << buffer;
+            }
             column += 14;
          }
          else
@@ -4958,7 +5147,8 @@ namespace llvm
             serialize_gimple_child("stmt", createGimpleLabelStmt(&BB));
       }
       /* Terminate the line.  */
-      stream << "\n";
+      if(!binary)
+         stream << "\n";
    }
 
    std::string DumpGimpleRaw::getHeaderForBuiltin(const void* t)
@@ -5058,8 +5248,13 @@ namespace llvm
       tree_codes code = TREE_CODE(t);
       const char* code_name = GET_TREE_CODE_NAME(code);
       LLVM_DEBUG(llvm::dbgs() << "|" << code_name << "\n");
-      snprintf(buffer, LOCAL_BUFFER_LEN, "%-16s ", code_name);
-      stream << buffer;
+      if(binary)
+         binary_keyword(code_name);
+      else
+      {
+         snprintf(buffer, LOCAL_BUFFER_LEN, "%-16s ", code_name);
+         stream << buffer;
+      }
       column = 25;
 
       tree_codes_class code_class = TREE_CODE_CLASS(code);
@@ -5115,20 +5310,19 @@ namespace llvm
          {
             serialize_maybe_newline();
             /// with clang/llvm there is no type definition
-            snprintf(buffer, LOCAL_BUFFER_LEN, "srcp: \"");
-            stream << buffer;
+            std::string srcpFile = InFile;
             if(code == GT(FUNCTION_DECL) && is_builtin_fn(t) && reinterpret_cast<const llvm::Function*>(t)->empty())
             {
                auto headerFile = getHeaderForBuiltin(t);
                if(headerFile != "")
-                  stream << headerFile;
+                  srcpFile = headerFile;
                else
-                  stream << "<built-in>";
+                  srcpFile = "<built-in>";
             }
+            if(binary)
+               binary_srcp(srcpFile.c_str(), 0, 0);
             else
-               stream << InFile;
-            snprintf(buffer, LOCAL_BUFFER_LEN, "\":0:0 ");
-            stream << buffer;
+               stream << "srcp: \"" << srcpFile << "\":0:0 ";
             column += 12 + InFile.size() + 8;
          }
          else
@@ -5138,8 +5332,13 @@ namespace llvm
             if(xloc.file)
             {
                serialize_maybe_newline();
-               snprintf(buffer, LOCAL_BUFFER_LEN, "srcp: \"%s\":%-d:%-6d ", xloc.file, xloc.line, xloc.column);
-               stream << buffer;
+               if(binary)
+                  binary_srcp(xloc.file, xloc.line, xloc.column);
+               else
+               {
+                  snprintf(buffer, LOCAL_BUFFER_LEN, "srcp: \"%s\":%-d:%-6d ", xloc.file, xloc.line, xloc.column);
+                  stream << buffer;
+               }
                column += 12 + strlen(xloc.file) + 8;
             }
          }
@@ -5500,12 +5699,16 @@ namespace llvm
             /* There are no additional fields to print.  */
             break;
       }
-      stream << "\n";
+      if(!binary)
+         stream << "\n";
    }
 
    void DumpGimpleRaw::SerializeGimpleFunctionHeader(const void* obj)
    {
       assert(TREE_CODE(obj) == GT(FUNCTION_DECL));
+      /* Comments have no counterpart in the binary stream.  */
+      if(binary)
+         return;
       const llvm::Function* fd = reinterpret_cast<const llvm::Function*>(obj);
       stream << "\n;; Function " << getName(fd) << "(" << getName(fd) << ")\n\n";
       stream << ";; " << getName(fd) << "(";
@@ -148,6 +148,8 @@ namespace llvm
                                 cl::value_desc("filename path"), cl::OneOrMore, cl::CommaSeparated);
    cl::opt<std::string> CostTable("panda-cost-table", cl::desc("Specify the cost per operation"),
                                   cl::value_desc("cost table"));
+   cl::opt<bool> BinaryIR("panda-binary-ir", cl::desc("Write the gimple raw file as a binary token stream"),
+                          cl::init(false));
 
    struct CLANG_VERSION_SYMBOL_DUMP_SSA : public ModulePass
 #if __clang_major__ >= 13
@@ -238,7 +240,7 @@ namespace llvm
             }
          }
 
-         DumpGimpleRaw gimpleRawWriter(outdir_name, first_filename, false, &Fun2Params, earlyAnalysis);
+         DumpGimpleRaw gimpleRawWriter(outdir_name, first_filename, false, &Fun2Params, earlyAnalysis, BinaryIR);
          auto res = gimpleRawWriter.exec(M, TopFunctionNames, GetTLI, GetTTI, GetDomTree, GetLI, GetMSSA, GetLVI, GetAC,
 #if __clang_major__ > 5
                                          GetORE,
@@ -78,6 +78,10 @@
 #define GT(code) tree_codes::code
 #define LOCAL_BUFFER_LEN 512
 
+/// magic number opening a binary IR file; keep in sync with src/parser/compiler/treeLexer.hpp
+#define BINARY_IR_MAGIC "\x7f" \
+                        "BIR0001"
+
 namespace llvm
 {
    class AllocaInst;
@@ -260,6 +264,12 @@ namespace llvm
       /// serialization data
       int column;
 
+      /// when true the nodes are serialized as a binary token stream instead of text
+      const bool binary;
+
+      /// strings already interned in the binary token stream and their index
+      std::map<std::string, unsigned int> binaryStringTable;
+
       /// internal identifier table
       std::set<std::string> identifierTable;
       /// unsigned integer constant table
@@ -709,6 +719,34 @@ namespace llvm
       const void* CASE_HIGH(const void* t);
       const void* CASE_LABEL(const void* t);
 
+      /**
+       * Tags of the binary token stream; keep in sync with src/parser/compiler/treeLexer.hpp.
+       * Every tag but BT_DEFINE is followed by a varint and produces one token of the textual format.
+       */
+      enum binary_tag : unsigned char
+      {
+         BT_NODE = 1,    /**< node id (@N) */
+         BT_KEYWORD = 2, /**< index of the interned keyword (node kind or field name) */
+         BT_INT = 3,     /**< zigzag encoded integer */
+         BT_NUMBER = 4,  /**< index of the interned textual number, used for wide integers */
+         BT_STRING = 5,  /**< index of the interned quoted string */
+         BT_DEFINE = 6   /**< length and bytes of the next interned string */
+      };
+
+      void binary_varint(unsigned long long value);
+
+      unsigned int binary_intern(const std::string& str);
+
+      void binary_keyword(const char* keyword);
+
+      void binary_int(long long value);
+
+      void binary_number(const std::string& number);
+
+      void binary_string(const std::string& lexeme);
+
+      void binary_srcp(const char* file, int line, int col);
+
       void DumpVersion(llvm::raw_fd_ostream& stream);
 
       void serialize_new_line();
@@ -723,9 +761,9 @@ namespace llvm
 
       void serialize_real(const void* t);
 
-      int serialize_with_double_quote(const char* input, int length);
+      int serialize_with_double_quote(llvm::raw_ostream& os, const char* input, int length);
 
-      int serialize_with_escape(const char* input, int length);
+      int serialize_with_escape(llvm::raw_ostream& os, const char* input, int length);
 
       void serialize_string(const char* string);
 
@@ -778,7 +816,7 @@ namespace llvm
 
     public:
       DumpGimpleRaw(const std::string& _outdir_name, const std::string& _InFile, bool onlyGlobals,
-                    std::map<std::string, std::vector<std::string>>* fun2params, bool early);
+                    std::map<std::string, std::vector<std::string>>* fun2params, bool early, bool binary = false);
 
       bool exec(llvm::Module& M, const std::vector<std::string>& _TopFunctionName,
                 llvm::function_ref<llvm::TargetLibraryInfo&(llvm::Function&)> GetTLI,
@@ -50,9 +50,12 @@ EXTERN_C EXPORT int m_fini();
 
 EXTERN_C EXPORT int m_read(unsigned char id, svLogicVecVal* data, unsigned short bitsize, ptr_t addr,
                            unsigned char shift);
+EXTERN_C EXPORT int m_read_burst(unsigned char id, svLogicVecVal* data, unsigned short bitsize, ptr_t addr,
+                                 unsigned short beat_size);
 EXTERN_C EXPORT int m_write(unsigned char id, CONSTARG svLogicVecVal* data, unsigned short bitsize, ptr_t addr,
                             unsigned char shift);
 EXTERN_C EXPORT int m_state(unsigned char id, int data);
 EXTERN_C EXPORT void m_builtin_exit(int status);
+EXTERN_C EXPORT const char* m_results_filename(const char* default_filename);
 
 #endif // __MDPI_H
@@ -50,6 +50,10 @@
 #define __M_IPC_SIM_CMD_ENV "M_IPC_SIM_CMD"
 #endif
 
+#ifndef __M_IPC_FILENAME_ENV
+#define __M_IPC_FILENAME_ENV "M_IPC_FILENAME_OVERRIDE"
+#endif
+
 #define IPC_STRUCT_ATTR __attribute__((aligned(8), packed))
 
 #include "mdpi_debug.h"
@@ -134,6 +138,12 @@ static inline __attribute__((always_inline)) void mdpi_op_init(mdpi_op_t* op)
    op->type = MDPI_OP_TYPE_NONE;
 }
 
+/**
+ * @brief Handler of a posted operation, returns non-zero on failure
+ *
+ */
+typedef int (*mdpi_ipc_handler_t)(mdpi_op_t* op);
+
 static void __ipc_wait(mdpi_ipc_state_t state);
 
 static void __ipc_reserve();
@@ -152,11 +162,25 @@ static void __ipc_init1();
 
 static void __ipc_fini(mdpi_entity_t init);
 
+static void __ipc_wait_request(mdpi_ipc_handler_t handler);
+
+static const char* __ipc_filename();
+
 #define __M_IPC_BACKEND_ATOMIC 1
 #define __M_IPC_BACKEND_SIG 2
+#define __M_IPC_BACKEND_RING 3
 
 #ifndef __M_IPC_BACKEND
-#define __M_IPC_BACKEND __M_IPC_BACKEND_SIG
+#define __M_IPC_BACKEND __M_IPC_BACKEND_RING
+#endif
+
+/* Backends supporting posted operations, i.e. operations the simulator does not wait for */
+#define __M_IPC_HAS_POSTED (__M_IPC_BACKEND == __M_IPC_BACKEND_RING)
+
+#if __M_IPC_HAS_POSTED
+static mdpi_op_t* __ipc_post_reserve();
+
+static void __ipc_post_commit();
 #endif
 
 #if __M_IPC_BACKEND == __M_IPC_BACKEND_ATOMIC
@@ -167,4 +191,25 @@ static void __ipc_fini(mdpi_entity_t init);
 #include "mdpi_ipc_sig.h"
 #endif
 
+#if __M_IPC_BACKEND == __M_IPC_BACKEND_RING
+#include "mdpi_ipc_ring.h"
+#endif
+
+#if !__M_IPC_HAS_POSTED
+static void __ipc_wait_request(__attribute__((unused)) mdpi_ipc_handler_t handler)
+{
+   __ipc_wait(MDPI_IPC_STATE_REQUEST);
+}
+#endif
+
+/**
+ * @brief Returns the IPC file name. The environment may override the one selected at build time, so that multiple
+ * instances of the same compiled simulation can run side by side.
+ */
+static const char* __ipc_filename()
+{
+   const char* filename = getenv(__M_IPC_FILENAME_ENV);
+   return filename && *filename ? filename : __M_IPC_FILENAME;
+}
+
 #endif // __MDPI_IPC_H
\ No newline at end of file
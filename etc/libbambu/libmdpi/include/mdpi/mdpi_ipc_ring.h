@@ -0,0 +1,382 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2023-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file mdpi_ipc_ring.h
+ *
+ * @author agent <agent@local>
+ * $Revision$
+ * $Date$
+ * Last modified by $Author$
+ *
+ */
+
+/*
+ * Never include this file directly; use <mdpi/mdpi_ipc.h> instead.
+ */
+
+#ifndef __MDPI_IPC_RING_H
+#define __MDPI_IPC_RING_H
+
+#define __USE_FILE_OFFSET64
+#define _FILE_OFFSET_BITS 64
+
+#ifndef __cplusplus
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#else
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#define _Atomic(X) std::atomic<X>
+#endif
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*
+ * The request/response mailbox is kept for operations whose result is needed by the simulator, while operations
+ * that do not produce a result (memory writes) are posted on a single-producer single-consumer ring and are
+ * consumed by the driver in order, before any following mailbox request. Each side busy waits for a while and then
+ * sleeps on its own futex word, which the other side bumps on each notification.
+ */
+
+#ifndef __M_IPC_BACKEND_RING_SIZE
+#define __M_IPC_BACKEND_RING_SIZE 128
+#endif
+#ifndef __M_IPC_BACKEND_RING_SPIN
+#define __M_IPC_BACKEND_RING_SPIN 4096
+#endif
+#ifndef __M_IPC_BACKEND_RING_TIMEOUT
+#define __M_IPC_BACKEND_RING_TIMEOUT 1
+#endif
+
+#if(__M_IPC_BACKEND_RING_SIZE & (__M_IPC_BACKEND_RING_SIZE - 1)) != 0
+#error "IPC ring size must be a power of two"
+#endif
+
+#define __M_IPC_RING_CLOSED 1U
+#define __M_IPC_RING_FAILED 2U
+
+typedef struct
+{
+   _Atomic(mdpi_ipc_state_t) handle;
+   _Atomic(uint32_t) status;
+   _Atomic(uint32_t) bell[MDPI_ENTITY_COUNT];
+   _Atomic(uint32_t) sleeping[MDPI_ENTITY_COUNT];
+   _Atomic(uint32_t) ring_head __attribute__((aligned(64)));
+   _Atomic(uint32_t) ring_tail __attribute__((aligned(64)));
+   mdpi_op_t operation __attribute__((aligned(64)));
+   mdpi_op_t ring[__M_IPC_BACKEND_RING_SIZE];
+} __attribute__((aligned(64))) mdpi_ipc_file_t;
+
+static mdpi_ipc_file_t* __m_ipc_file = NULL;
+
+// Busy waiting only pays off when the remote side is running on another processor
+static unsigned int __m_ipc_spin = __M_IPC_BACKEND_RING_SPIN;
+
+#define __m_ipc_operation (__m_ipc_file->operation)
+
+#if defined(__x86_64__) || defined(__i386__)
+#define __ipc_cpu_relax() __builtin_ia32_pause()
+#else
+#define __ipc_cpu_relax()
+#endif
+
+static void __ipc_sleep(uint32_t bell)
+{
+   static const struct timespec tv = {__M_IPC_BACKEND_RING_TIMEOUT, 0};
+   if(syscall(SYS_futex, (uint32_t*)&__m_ipc_file->bell[__LOCAL_ENTITY], FUTEX_WAIT, bell, &tv, NULL, 0) == -1)
+   {
+      if(errno != EAGAIN && errno != EINTR && errno != ETIMEDOUT)
+      {
+         error("Unable to wait on IPC futex.\n");
+         perror("futex wait failed");
+         abort();
+      }
+   }
+}
+
+static void __ipc_notify()
+{
+   atomic_fetch_add(&__m_ipc_file->bell[1 - __LOCAL_ENTITY], 1U);
+   if(atomic_load(&__m_ipc_file->sleeping[1 - __LOCAL_ENTITY]))
+   {
+      syscall(SYS_futex, (uint32_t*)&__m_ipc_file->bell[1 - __LOCAL_ENTITY], FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+   }
+}
+
+/*
+ * Spin on cond for a while, then sleep until the remote side notifies a change. The sleeping flag is raised before
+ * the condition is checked again, thus either the remote side sees the flag and wakes us up, or we see its update.
+ */
+#define __ipc_wait_until(cond)                                                  \
+   do                                                                           \
+   {                                                                            \
+      unsigned int __spin;                                                      \
+      for(__spin = 0; !(cond); ++__spin)                                        \
+      {                                                                         \
+         if(__spin < __m_ipc_spin)                                              \
+         {                                                                      \
+            __ipc_cpu_relax();                                                  \
+            continue;                                                           \
+         }                                                                      \
+         uint32_t __bell = atomic_load(&__m_ipc_file->bell[__LOCAL_ENTITY]);    \
+         atomic_store(&__m_ipc_file->sleeping[__LOCAL_ENTITY], 1U);             \
+         if(!(cond))                                                            \
+         {                                                                      \
+            __ipc_sleep(__bell);                                                \
+         }                                                                      \
+         atomic_store(&__m_ipc_file->sleeping[__LOCAL_ENTITY], 0U);             \
+      }                                                                         \
+   } while(0)
+
+static void __ipc_check_posted()
+{
+   if(atomic_load(&__m_ipc_file->status) & __M_IPC_RING_FAILED)
+   {
+      error("A posted operation failed on the driver side.\n");
+      abort();
+   }
+}
+
+static void __ipc_wait(mdpi_ipc_state_t state)
+{
+   __ipc_wait_until(atomic_load(&__m_ipc_file->handle) == state);
+}
+
+static void __ipc_reserve()
+{
+   mdpi_ipc_state_t expected;
+   __ipc_check_posted();
+   do
+   {
+      expected = MDPI_IPC_STATE_FREE;
+      __ipc_wait(expected);
+   } while(!atomic_compare_exchange_strong(&__m_ipc_file->handle, &expected, MDPI_IPC_STATE_LOCKED));
+}
+
+static void __ipc_request()
+{
+#ifndef NDEBUG
+   mdpi_ipc_state_t expected = MDPI_IPC_STATE_LOCKED;
+   atomic_compare_exchange_strong(&__m_ipc_file->handle, &expected, MDPI_IPC_STATE_REQUEST);
+   assert(expected == MDPI_IPC_STATE_LOCKED && "Illegal IPC commit operation.");
+#else
+   atomic_store(&__m_ipc_file->handle, MDPI_IPC_STATE_REQUEST);
+#endif
+   __ipc_notify();
+}
+
+static void __ipc_response()
+{
+#ifndef NDEBUG
+   mdpi_ipc_state_t expected = MDPI_IPC_STATE_REQUEST;
+   atomic_compare_exchange_strong(&__m_ipc_file->handle, &expected, MDPI_IPC_STATE_RESPONSE);
+   assert(expected == MDPI_IPC_STATE_REQUEST && "Illegal IPC complete operation.");
+#else
+   atomic_store(&__m_ipc_file->handle, MDPI_IPC_STATE_RESPONSE);
+#endif
+   __ipc_notify();
+}
+
+static void __ipc_release()
+{
+   atomic_store(&__m_ipc_file->handle, MDPI_IPC_STATE_FREE);
+   __ipc_notify();
+}
+
+static void __ipc_exit(mdpi_ipc_state_t ipc_state, mdpi_state_t state, uint8_t retval)
+{
+   mdpi_ipc_state_t expected;
+   // Posted operations issued after this point would never be consumed
+   atomic_fetch_or(&__m_ipc_file->status, __M_IPC_RING_CLOSED);
+   // Wait for the other side to leave the mailbox, then take it over from whatever state it was left in
+   do
+   {
+      __ipc_wait_until((expected = atomic_load(&__m_ipc_file->handle)) != MDPI_IPC_STATE_LOCKED);
+   } while(!atomic_compare_exchange_strong(&__m_ipc_file->handle, &expected, MDPI_IPC_STATE_LOCKED));
+   __m_ipc_operation.type = MDPI_OP_TYPE_STATE_CHANGE;
+   __m_ipc_operation.payload.sc.state = state;
+   __m_ipc_operation.payload.sc.retval = retval;
+   atomic_store(&__m_ipc_file->handle, ipc_state);
+   __ipc_notify();
+}
+
+static mdpi_op_t* __ipc_post_reserve()
+{
+   static mdpi_op_t dropped;
+   const uint32_t head = atomic_load(&__m_ipc_file->ring_head);
+   __ipc_check_posted();
+   __ipc_wait_until((head - atomic_load(&__m_ipc_file->ring_tail)) < __M_IPC_BACKEND_RING_SIZE ||
+                    (atomic_load(&__m_ipc_file->status) & __M_IPC_RING_CLOSED));
+   if(atomic_load(&__m_ipc_file->status) & __M_IPC_RING_CLOSED)
+   {
+      return &dropped;
+   }
+   return &__m_ipc_file->ring[head & (__M_IPC_BACKEND_RING_SIZE - 1)];
+}
+
+static void __ipc_post_commit()
+{
+   if(atomic_load(&__m_ipc_file->status) & __M_IPC_RING_CLOSED)
+   {
+      return;
+   }
+   atomic_fetch_add(&__m_ipc_file->ring_head, 1U);
+   __ipc_notify();
+}
+
+static void __ipc_post_drain(mdpi_ipc_handler_t handler)
+{
+   uint32_t tail = atomic_load(&__m_ipc_file->ring_tail);
+   const uint32_t head = atomic_load(&__m_ipc_file->ring_head);
+   if(tail == head)
+   {
+      return;
+   }
+   for(; tail != head; ++tail)
+   {
+      if(handler(&__m_ipc_file->ring[tail & (__M_IPC_BACKEND_RING_SIZE - 1)]))
+      {
+         atomic_fetch_or(&__m_ipc_file->status, __M_IPC_RING_FAILED);
+      }
+   }
+   atomic_store(&__m_ipc_file->ring_tail, tail);
+   __ipc_notify();
+}
+
+static void __ipc_wait_request(mdpi_ipc_handler_t handler)
+{
+   int requested;
+   do
+   {
+      __ipc_wait_until(atomic_load(&__m_ipc_file->handle) == MDPI_IPC_STATE_REQUEST ||
+                       atomic_load(&__m_ipc_file->ring_tail) != atomic_load(&__m_ipc_file->ring_head));
+      // Operations posted before the request must be completed before the request itself is served
+      requested = atomic_load(&__m_ipc_file->handle) == MDPI_IPC_STATE_REQUEST;
+      __ipc_post_drain(handler);
+   } while(!requested);
+}
+
+#undef __ipc_wait_until
+
+static void __ipc_init(mdpi_entity_t init)
+{
+   int ipc_descriptor, i;
+
+   debug("IPC memory mapping on file %s\n", __ipc_filename());
+   ipc_descriptor = open(__ipc_filename(), O_RDWR | O_CREAT, 0664);
+   if(ipc_descriptor < 0)
+   {
+      error("Error opening IPC file: %s\n", __ipc_filename());
+      perror("MDPI library initialization error");
+      abort();
+   }
+
+   if(sysconf(_SC_NPROCESSORS_ONLN) < 2)
+   {
+      __m_ipc_spin = 0;
+   }
+
+   if(init == MDPI_ENTITY_DRIVER)
+   {
+      // Ensure that the file will hold enough space
+      lseek(ipc_descriptor, sizeof(mdpi_ipc_file_t), SEEK_SET);
+      if(write(ipc_descriptor, "", 1) < 1)
+      {
+         error("Error writing IPC file: %s\n", __ipc_filename());
+         perror("MDPI library initialization error");
+         abort();
+      }
+      lseek(ipc_descriptor, 0, SEEK_SET);
+   }
+
+   __m_ipc_file =
+       (mdpi_ipc_file_t*)mmap(NULL, sizeof(mdpi_ipc_file_t), PROT_READ | PROT_WRITE, MAP_SHARED, ipc_descriptor, 0);
+
+   if(__m_ipc_file == MAP_FAILED)
+   {
+      error("An error occurred while mapping IPC address range.\n");
+      perror("MDPI library initialization error");
+      abort();
+   }
+   debug("IPC file memory-mapping completed.\n");
+
+   if(init == MDPI_ENTITY_DRIVER)
+   {
+      atomic_store(&__m_ipc_file->handle, MDPI_IPC_STATE_FREE);
+      atomic_store(&__m_ipc_file->status, 0U);
+      for(i = 0; i < MDPI_ENTITY_COUNT; ++i)
+      {
+         atomic_store(&__m_ipc_file->bell[i], 0U);
+         atomic_store(&__m_ipc_file->sleeping[i], 0U);
+      }
+      atomic_store(&__m_ipc_file->ring_head, 0U);
+      atomic_store(&__m_ipc_file->ring_tail, 0U);
+      mdpi_op_init(&__m_ipc_operation);
+   }
+
+   close(ipc_descriptor);
+}
+
+static void __ipc_init1()
+{
+}
+
+static void __ipc_fini(__attribute__((unused)) mdpi_entity_t init)
+{
+   if(munmap(__m_ipc_file, sizeof(mdpi_ipc_file_t)))
+   {
+      error("An error occurred while unmapping IPC address range.\n");
+      perror("MDPI library finalization error");
+   }
+   if(init == MDPI_ENTITY_DRIVER)
+   {
+      remove(__ipc_filename());
+   }
+}
+
+#undef __ipc_cpu_relax
+
+#endif // __MDPI_IPC_RING_H
@@ -194,11 +194,11 @@ static void __ipc_init(mdpi_entity_t init)
    int ipc_descriptor, i;
    sigset_t sset;
 
-   debug("IPC memory mapping on file " __M_IPC_FILENAME "\n");
-   ipc_descriptor = open(__M_IPC_FILENAME, O_RDWR | O_CREAT, 0664);
+   debug("IPC memory mapping on file %s\n", __ipc_filename());
+   ipc_descriptor = open(__ipc_filename(), O_RDWR | O_CREAT, 0664);
    if(ipc_descriptor < 0)
    {
-      error("Error opening IPC file: %s\n", __M_IPC_FILENAME);
+      error("Error opening IPC file: %s\n", __ipc_filename());
       perror("MDPI library initialization error");
       abort();
    }
@@ -209,7 +209,7 @@ static void __ipc_init(mdpi_entity_t init)
       lseek(ipc_descriptor, sizeof(mdpi_ipc_file_t), SEEK_SET);
       if(write(ipc_descriptor, "", 1) < 1)
       {
-         error("Error writing IPC file: %s\n", __M_IPC_FILENAME);
+         error("Error writing IPC file: %s\n", __ipc_filename());
          perror("MDPI library initialization error");
          abort();
       }
@@ -262,7 +262,7 @@ static void __ipc_fini(__attribute__((unused)) mdpi_entity_t init)
 
    if(init == MDPI_ENTITY_DRIVER)
    {
-      remove(__M_IPC_FILENAME);
+      remove(__ipc_filename());
    }
 }
 
@@ -55,6 +55,9 @@
 
 EXTERN_C void m_param_alloc(uint8_t idx, size_t size);
 
+/* Returns non-zero if the test vector at the given index belongs to the shard assigned to this testbench */
+EXTERN_C int m_shard_selected(unsigned int index);
+
 #ifndef __cplusplus
 EXTERN_C float m_float_distancef(float, float) __attribute__((const));
 EXTERN_C double m_float_distance(double, double) __attribute__((const));
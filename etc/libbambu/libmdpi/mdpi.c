@@ -55,6 +55,7 @@
 #include <assert.h>
 #include <errno.h>
 #include <pthread.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
@@ -134,13 +135,13 @@ unsigned int m_next(unsigned int state)
    return (retval << 8) | (state_next & 0xFF);
 }
 
-int m_read(uint8_t id, svLogicVecVal* data, uint16_t bitsize, ptr_t addr, uint8_t shift)
+static int __m_read(uint8_t id, svLogicVecVal* data, uint16_t bitsize, ptr_t addr, mdpi_op_type_t type, int info)
 {
    int retval;
    __ipc_reserve();
-   __m_ipc_operation.type = shift ? MDPI_OP_TYPE_IF_POP : MDPI_OP_TYPE_IF_READ;
+   __m_ipc_operation.type = type;
    __m_ipc_operation.payload.interface.id = id;
-   __m_ipc_operation.payload.interface.info = 0;
+   __m_ipc_operation.payload.interface.info = info;
    __m_ipc_operation.payload.interface.addr = addr;
    __m_ipc_operation.payload.interface.bitsize = bitsize;
    __ipc_request();
@@ -185,17 +186,25 @@ int m_read(uint8_t id, svLogicVecVal* data, uint16_t bitsize, ptr_t addr, uint8_
    return retval;
 }
 
-int m_write(uint8_t id, CONSTARG svLogicVecVal* data, uint16_t bitsize, ptr_t addr, uint8_t shift)
+int m_read(uint8_t id, svLogicVecVal* data, uint16_t bitsize, ptr_t addr, uint8_t shift)
+{
+   return __m_read(id, data, bitsize, addr, shift ? MDPI_OP_TYPE_IF_POP : MDPI_OP_TYPE_IF_READ, 0);
+}
+
+int m_read_burst(uint8_t id, svLogicVecVal* data, uint16_t bitsize, ptr_t addr, uint16_t beat_size)
+{
+   return __m_read(id, data, bitsize, addr, MDPI_OP_TYPE_IF_READ, beat_size);
+}
+
+static void __m_write_payload(mdpi_op_interface_t* payload, uint8_t id, CONSTARG svLogicVecVal* data,
+                              uint16_t bitsize, ptr_t addr)
 {
-   int retval;
    uint16_t i;
    const uint16_t bsize = (bitsize / 8) + ((bitsize % 8) != 0);
-   __ipc_reserve();
-   __m_ipc_operation.type = shift ? MDPI_OP_TYPE_IF_PUSH : MDPI_OP_TYPE_IF_WRITE;
-   __m_ipc_operation.payload.interface.id = id;
-   __m_ipc_operation.payload.interface.info = 0;
-   __m_ipc_operation.payload.interface.addr = addr;
-   __m_ipc_operation.payload.interface.bitsize = bitsize;
+   payload->id = id;
+   payload->info = 0;
+   payload->addr = addr;
+   payload->bitsize = bitsize;
 #pragma unroll(4)
    for(i = 0; i < bsize; ++i)
    {
@@ -213,8 +222,28 @@ int m_write(uint8_t id, CONSTARG svLogicVecVal* data, uint16_t bitsize, ptr_t ad
                                               "the simulation");
       }
 #endif
-      __m_ipc_operation.payload.interface.buffer[i] = data[i / 4].aval >> byte_offset(i);
+      payload->buffer[i] = data[i / 4].aval >> byte_offset(i);
+   }
+}
+
+int m_write(uint8_t id, CONSTARG svLogicVecVal* data, uint16_t bitsize, ptr_t addr, uint8_t shift)
+{
+   int retval;
+#if __M_IPC_HAS_POSTED
+   if(!shift)
+   {
+      // The outcome of a plain write is not needed by the simulation: the driver reports failures later on
+      mdpi_op_t* op = __ipc_post_reserve();
+      op->type = MDPI_OP_TYPE_IF_WRITE;
+      __m_write_payload(&op->payload.interface, id, data, bitsize, addr);
+      __ipc_post_commit();
+      debug("Interface %u write posted.\n", id);
+      return 0;
    }
+#endif
+   __ipc_reserve();
+   __m_ipc_operation.type = shift ? MDPI_OP_TYPE_IF_PUSH : MDPI_OP_TYPE_IF_WRITE;
+   __m_write_payload(&__m_ipc_operation.payload.interface, id, data, bitsize, addr);
    __ipc_request();
    __ipc_wait(MDPI_IPC_STATE_RESPONSE);
 
@@ -287,3 +316,9 @@ void m_builtin_exit(int status)
    }
    __ipc_release();
 }
+
+const char* m_results_filename(const char* default_filename)
+{
+   const char* filename = getenv("M_RESULTS_FILENAME");
+   return filename && *filename ? filename : default_filename;
+}
@@ -766,13 +766,82 @@ void __m_param_alloc(uint8_t idx, size_t size)
    }
 }
 
+static void __m_interface_operation(mdpi_op_t* op)
+{
+   mdpi_op_interface_t& payload = op->payload.interface;
+   if(__m_interfaces.empty())
+   {
+      error("Operation on uninitialized interfaces' list.\n");
+      payload.id = MDPI_IF_IDX_EMPTY;
+   }
+   else if(__m_interfaces.size() <= payload.id)
+   {
+      error("Interface id out of bounds: %u.\n", payload.id);
+      payload.id = MDPI_IF_IDX_OUT_OF_BOUNDS;
+   }
+   else
+   {
+      const auto& if_manager = __m_interfaces.at(payload.id);
+      debug("Interface %u operation: ", payload.id);
+      if(op->type & MDPI_OP_TYPE_IF_READ)
+      {
+         debug_append("read %u bits at " PTR_FORMAT ".\n", payload.bitsize, payload.addr);
+         if(op->type == MDPI_OP_TYPE_IF_READ && payload.info > 0)
+         {
+            // Burst read: every beat is translated on its own, since consecutive beats may cross mapped regions
+            const uint16_t beat_bits = static_cast<uint16_t>(payload.info * 8);
+            int retval = interface::IF_OK;
+            for(uint16_t offset = 0; offset < payload.bitsize && retval >= 0; offset += beat_bits)
+            {
+               retval = if_manager->read(payload.buffer + offset / 8, beat_bits, payload.addr + offset / 8, false);
+            }
+            payload.info = retval;
+         }
+         else
+         {
+            payload.info = if_manager->read(payload.buffer, payload.bitsize, payload.addr,
+                                            (op->type & MDPI_OP_TYPE_IF_POP) == MDPI_OP_TYPE_IF_POP);
+         }
+      }
+      else if(op->type & MDPI_OP_TYPE_IF_WRITE)
+      {
+         debug_append("write %u bits at " PTR_FORMAT ".\n", payload.bitsize, payload.addr);
+         payload.info = if_manager->write(payload.buffer, payload.bitsize, payload.addr,
+                                          (op->type & MDPI_OP_TYPE_IF_PUSH) == MDPI_OP_TYPE_IF_PUSH);
+      }
+      else
+      {
+         debug_append("state (data: %u).\n", payload.info);
+         payload.info = if_manager->state(payload.info);
+      }
+   }
+}
+
+static int __m_posted_operation(mdpi_op_t* op)
+{
+   assert(op->type == MDPI_OP_TYPE_IF_WRITE && "Unexpected posted transaction type.");
+   const auto id = op->payload.interface.id;
+   __m_interface_operation(op);
+   if(op->payload.interface.info < 0)
+   {
+      error("Posted write operation error on interface %u: %d.\n", id, op->payload.interface.info);
+      return 1;
+   }
+   if(op->payload.interface.id == MDPI_IF_IDX_OUT_OF_BOUNDS)
+   {
+      error("Posted write operation on uninitialized interface %u.\n", id);
+      return 1;
+   }
+   return 0;
+}
+
 static void* __m_driver_loop(void*)
 {
    debug("IPC thread started.\n");
 
    while(true)
    {
-      __ipc_wait(MDPI_IPC_STATE_REQUEST);
+      __ipc_wait_request(__m_posted_operation);
       switch(__m_ipc_operation.type)
       {
          case MDPI_OP_TYPE_STATE_CHANGE:
@@ -783,46 +852,7 @@ static void* __m_driver_loop(void*)
          case MDPI_OP_TYPE_IF_POP:
          case MDPI_OP_TYPE_IF_PUSH:
          case MDPI_OP_TYPE_IF_INFO:
-            if(__m_interfaces.empty())
-            {
-               error("Operation on uninitialized interfaces' list.\n");
-               __m_ipc_operation.payload.interface.id = MDPI_IF_IDX_EMPTY;
-            }
-            else if(__m_interfaces.size() <= __m_ipc_operation.payload.interface.id)
-            {
-               error("Interface id out of bounds: %u.\n", __m_ipc_operation.payload.interface.id);
-               __m_ipc_operation.payload.interface.id = MDPI_IF_IDX_OUT_OF_BOUNDS;
-            }
-            else
-            {
-               debug("Interface %u operation: ", __m_ipc_operation.payload.interface.id);
-               if(__m_ipc_operation.type & MDPI_OP_TYPE_IF_READ)
-               {
-                  debug_append("read %u bits at " PTR_FORMAT ".\n", __m_ipc_operation.payload.interface.bitsize,
-                               __m_ipc_operation.payload.interface.addr);
-                  __m_ipc_operation.payload.interface.info =
-                      __m_interfaces.at(__m_ipc_operation.payload.interface.id)
-                          ->read(__m_ipc_operation.payload.interface.buffer,
-                                 __m_ipc_operation.payload.interface.bitsize, __m_ipc_operation.payload.interface.addr,
-                                 (__m_ipc_operation.type & MDPI_OP_TYPE_IF_POP) == MDPI_OP_TYPE_IF_POP);
-               }
-               else if(__m_ipc_operation.type & MDPI_OP_TYPE_IF_WRITE)
-               {
-                  debug_append("write %u bits at " PTR_FORMAT ".\n", __m_ipc_operation.payload.interface.bitsize,
-                               __m_ipc_operation.payload.interface.addr);
-                  __m_ipc_operation.payload.interface.info =
-                      __m_interfaces.at(__m_ipc_operation.payload.interface.id)
-                          ->write(__m_ipc_operation.payload.interface.buffer,
-                                  __m_ipc_operation.payload.interface.bitsize, __m_ipc_operation.payload.interface.addr,
-                                  (__m_ipc_operation.type & MDPI_OP_TYPE_IF_PUSH) == MDPI_OP_TYPE_IF_PUSH);
-               }
-               else
-               {
-                  debug_append("state (data: %u).\n", __m_ipc_operation.payload.interface.info);
-                  __m_ipc_operation.payload.interface.info = __m_interfaces.at(__m_ipc_operation.payload.interface.id)
-                                                                 ->state(__m_ipc_operation.payload.interface.info);
-               }
-            }
+            __m_interface_operation(&__m_ipc_operation);
             __ipc_response();
             break;
          case MDPI_OP_TYPE_IF_EXIT:
@@ -850,6 +880,17 @@ void m_param_alloc(uint8_t idx, size_t size)
    __m_params_size[idx] = size;
 }
 
+int m_shard_selected(unsigned int index)
+{
+   static const auto shard = []() {
+      const auto shard_env = getenv("M_TB_SHARD");
+      const auto shards_env = getenv("M_TB_SHARDS");
+      return std::make_pair(shard_env ? strtoul(shard_env, nullptr, 10) : 0UL,
+                            shards_env ? strtoul(shards_env, nullptr, 10) : 1UL);
+   }();
+   return shard.second <= 1 || (index % shard.second) == shard.first;
+}
+
 EXTERN_C float m_float_distancef(float a, float b)
 {
    return m_float_distance<float>(a, b);
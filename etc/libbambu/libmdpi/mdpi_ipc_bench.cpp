@@ -0,0 +1,205 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file mdpi_ipc_bench.cpp
+ * @brief Microbenchmark of the MDPI IPC transports between the simulator and the co-simulation driver.
+ *
+ * Build it once for each IPC backend and compare the reported accesses per second:
+ *    g++ -O2 -std=c++11 -D_GNU_SOURCE -D__M_IPC_BACKEND=<1|2|3> -Iinclude mdpi_ipc_bench.cpp -o mdpi_ipc_bench
+ *    ./mdpi_ipc_bench [accesses]
+ * where backends are 1 (atomic), 2 (signals), and 3 (ring).
+ *
+ * $Revision$
+ * $Date$
+ * Last modified by $Author$
+ *
+ */
+
+// Simulator-side DPI types are the Verilator ones, the simulator itself is not involved
+#define VERILATOR
+#define __M_IPC_FILENAME "/tmp/mdpi_ipc_bench"
+
+#include <mdpi/mdpi_types.h>
+
+static mdpi_entity_t __bench_entity = MDPI_ENTITY_DRIVER;
+#define __LOCAL_ENTITY __bench_entity
+
+#include <mdpi/mdpi_ipc.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define BENCH_MEMORY_SIZE (1 << 16)
+#define BENCH_ACCESS_BITS 64
+
+static byte_t __bench_memory[BENCH_MEMORY_SIZE];
+
+static const char* __bench_backend()
+{
+   return __M_IPC_BACKEND == __M_IPC_BACKEND_ATOMIC ? "atomic" :
+                                                      (__M_IPC_BACKEND == __M_IPC_BACKEND_SIG ? "signal" : "ring");
+}
+
+static void __bench_serve(mdpi_op_t* op)
+{
+   mdpi_op_interface_t& payload = op->payload.interface;
+   const auto offset = static_cast<size_t>(payload.addr % (BENCH_MEMORY_SIZE - sizeof(payload.buffer)));
+   if(op->type & MDPI_OP_TYPE_IF_READ)
+   {
+      memcpy(payload.buffer, __bench_memory + offset, payload.bitsize / 8);
+   }
+   else
+   {
+      memcpy(__bench_memory + offset, payload.buffer, payload.bitsize / 8);
+   }
+   payload.info = 0;
+}
+
+static int __bench_posted(mdpi_op_t* op)
+{
+   __bench_serve(op);
+   return 0;
+}
+
+static void __bench_fill(mdpi_op_t* op, mdpi_op_type_t type, ptr_t addr)
+{
+   op->type = type;
+   op->payload.interface.id = 0;
+   op->payload.interface.info = 0;
+   op->payload.interface.addr = addr;
+   op->payload.interface.bitsize = BENCH_ACCESS_BITS;
+}
+
+static void __bench_call(mdpi_op_type_t type, ptr_t addr)
+{
+   __ipc_reserve();
+   __bench_fill(&__m_ipc_operation, type, addr);
+   __ipc_request();
+   __ipc_wait(MDPI_IPC_STATE_RESPONSE);
+   __ipc_release();
+}
+
+static void __bench_report(const char* what, unsigned long accesses, std::chrono::steady_clock::time_point start)
+{
+   const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+   fprintf(stdout, "%-8s %-18s %12.0f accesses/s\n", __bench_backend(), what,
+           static_cast<double>(accesses) / elapsed.count());
+   fflush(stdout);
+}
+
+static void __bench_simulator(unsigned long accesses)
+{
+   auto start = std::chrono::steady_clock::now();
+   for(unsigned long i = 0; i < accesses; ++i)
+   {
+      __bench_call(MDPI_OP_TYPE_IF_READ, i * 8);
+   }
+   __bench_report("reads", accesses, start);
+
+   start = std::chrono::steady_clock::now();
+   for(unsigned long i = 0; i < accesses; ++i)
+   {
+      __bench_call(MDPI_OP_TYPE_IF_WRITE, i * 8);
+   }
+   __bench_report("blocking writes", accesses, start);
+
+#if __M_IPC_HAS_POSTED
+   start = std::chrono::steady_clock::now();
+   for(unsigned long i = 0; i < accesses; ++i)
+   {
+      __bench_fill(__ipc_post_reserve(), MDPI_OP_TYPE_IF_WRITE, i * 8);
+      __ipc_post_commit();
+   }
+   // A blocking access completes only after all the posted ones have been served
+   __bench_call(MDPI_OP_TYPE_IF_READ, 0);
+   __bench_report("posted writes", accesses, start);
+#endif
+
+   __ipc_reserve();
+   __m_ipc_operation.type = MDPI_OP_TYPE_STATE_CHANGE;
+   __m_ipc_operation.payload.sc.state = MDPI_STATE_END;
+   __ipc_request();
+   __ipc_wait(MDPI_IPC_STATE_RESPONSE);
+   __ipc_release();
+}
+
+static void __bench_driver()
+{
+   while(true)
+   {
+      __ipc_wait_request(__bench_posted);
+      if(__m_ipc_operation.type == MDPI_OP_TYPE_STATE_CHANGE)
+      {
+         __ipc_response();
+         break;
+      }
+      __bench_serve(&__m_ipc_operation);
+      __ipc_response();
+   }
+}
+
+int main(int argc, char* argv[])
+{
+   const unsigned long accesses = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000UL;
+   pid_t sim_pid;
+   int status;
+
+   __ipc_init(MDPI_ENTITY_DRIVER);
+   sim_pid = fork();
+   if(sim_pid == -1)
+   {
+      perror("fork");
+      return EXIT_FAILURE;
+   }
+   if(!sim_pid)
+   {
+      __bench_entity = MDPI_ENTITY_SIM;
+      __ipc_init(MDPI_ENTITY_SIM);
+      __bench_simulator(accesses);
+      __ipc_fini(MDPI_ENTITY_SIM);
+      _exit(EXIT_SUCCESS);
+   }
+   __ipc_init1();
+   __bench_driver();
+   if(waitpid(sim_pid, &status, 0) == -1 || !WIFEXITED(status) || WEXITSTATUS(status))
+   {
+      error("Benchmark simulator process failed.\n");
+      return EXIT_FAILURE;
+   }
+   __ipc_fini(MDPI_ENTITY_DRIVER);
+   return EXIT_SUCCESS;
+}
@@ -202,3 +202,37 @@ BOOST_AUTO_TEST_CASE(apint_minBitwidth)
    BOOST_REQUIRE_EQUAL(65, APInt(UINT64_MAX).minBitwidth(true));
    BOOST_REQUIRE_EQUAL(512, ((APInt(1) << 512) - 1).minBitwidth(false));
 }
+
+BOOST_AUTO_TEST_CASE(apint_wide)
+{
+   const APInt max128 = APInt::getSignedMaxValue(128);
+   const APInt min128 = APInt::getSignedMinValue(128);
+   const APInt umax128 = APInt::getMaxValue(128);
+
+   BOOST_REQUIRE_EQUAL(APInt("170141183460469231731687303715884105727"), max128);
+   BOOST_REQUIRE_EQUAL(APInt("-170141183460469231731687303715884105728"), min128);
+   BOOST_REQUIRE_EQUAL(APInt("340282366920938463463374607431768211455"), umax128);
+   BOOST_REQUIRE_EQUAL(APInt("170141183460469231731687303715884105728"), max128 + 1);
+   BOOST_REQUIRE_EQUAL(APInt("-170141183460469231731687303715884105729"), min128 - 1);
+   BOOST_REQUIRE_EQUAL(APInt("170141183460469231731687303715884105728"), -min128);
+   BOOST_REQUIRE_EQUAL(APInt("170141183460469231731687303715884105728"), min128.abs());
+   BOOST_REQUIRE_EQUAL(APInt("170141183460469231731687303715884105728"), min128 / -1);
+   BOOST_REQUIRE_EQUAL(0, min128 % -1);
+   BOOST_REQUIRE_EQUAL(umax128 + 1, (max128 + 1) * 2);
+   BOOST_REQUIRE_EQUAL(max128, (max128 + 1) - 1);
+   BOOST_REQUIRE_EQUAL(-1, umax128.extOrTrunc(128, true));
+   BOOST_REQUIRE_EQUAL(max128, umax128.extOrTrunc(127, false));
+   BOOST_REQUIRE_EQUAL(-1, umax128.extOrTrunc(127, true));
+   BOOST_REQUIRE_EQUAL(APInt(1) << 200, (APInt(1) << 200 << 100) >> 100);
+   BOOST_REQUIRE_EQUAL(-1, min128 >> 200);
+   BOOST_REQUIRE_LT(min128 - 1, min128);
+   BOOST_REQUIRE_LT(max128, max128 + 1);
+   BOOST_REQUIRE_LT(-(APInt(1) << 300), APInt(0));
+   BOOST_REQUIRE_GT(APInt(1) << 300, APInt(0));
+   BOOST_REQUIRE(umax128.bit_tst(127));
+   BOOST_REQUIRE(!umax128.bit_tst(128));
+   BOOST_REQUIRE(min128.bit_tst(300));
+   BOOST_REQUIRE_EQUAL(128, umax128.minBitwidth(false));
+   BOOST_REQUIRE_EQUAL(128, min128.minBitwidth(true));
+   BOOST_REQUIRE_EQUAL(129, (min128 - 1).minBitwidth(true));
+}
@@ -0,0 +1,318 @@
+#include "bit_lattice.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <deque>
+#include <random>
+#include <string>
+
+namespace
+{
+   const bit_lattice lattice_values[] = {bit_lattice::U, bit_lattice::ZERO, bit_lattice::ONE, bit_lattice::X};
+
+   /// Random bits: percent_constant of them are <0> or <1>, the others are <U> or <X>
+   std::deque<bit_lattice> random_bits(std::mt19937& generator, size_t size, unsigned int percent_constant)
+   {
+      std::deque<bit_lattice> res;
+      for(size_t i = 0; i < size; ++i)
+      {
+         const auto constant = generator() % 100 < percent_constant;
+         const auto value = generator() % 2;
+         res.push_back(constant ? lattice_values[1 + value] : lattice_values[3 * value]);
+      }
+      return res;
+   }
+
+   bit_lattice_string to_packed(const std::deque<bit_lattice>& bits)
+   {
+      bit_lattice_string res;
+      for(auto it = bits.rbegin(); it != bits.rend(); ++it)
+      {
+         res.push_front(*it);
+      }
+      return res;
+   }
+
+   std::string to_string(const std::deque<bit_lattice>& bits)
+   {
+      std::string res;
+      for(const auto bit : bits)
+      {
+         res.push_back("U01X"[static_cast<unsigned int>(bit)]);
+      }
+      return res;
+   }
+
+   /// Bit by bit implementation of the bitwise transfer functions
+   std::deque<bit_lattice> deque_bitwise(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b, size_t size,
+                                         const bit_lattice_table<bit_lattice_table<bit_lattice>>& table)
+   {
+      std::deque<bit_lattice> res;
+      auto a_it = a.rbegin();
+      auto b_it = b.rbegin();
+      for(size_t i = 0; i < size && a_it != a.rend() && b_it != b.rend(); ++i, ++a_it, ++b_it)
+      {
+         res.push_front(table.at(*a_it).at(*b_it));
+      }
+      return res;
+   }
+
+   /// Bit by bit implementation of the ripple carry transfer functions
+   std::deque<bit_lattice> deque_ripple(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
+                                        bit_lattice& carry, size_t size, const bit_lattice_adder_table& table)
+   {
+      std::deque<bit_lattice> res;
+      auto a_it = a.rbegin();
+      auto b_it = b.rbegin();
+      for(size_t i = 0; i < size && a_it != a.rend() && b_it != b.rend(); ++i, ++a_it, ++b_it)
+      {
+         res.push_front(table.at(*a_it).at(*b_it).at(carry).back());
+         carry = table.at(*a_it).at(*b_it).at(carry).front();
+      }
+      return res;
+   }
+} // namespace
+
+BOOST_AUTO_TEST_CASE(bit_lattice_sup_inf)
+{
+   for(const auto a : lattice_values)
+   {
+      BOOST_REQUIRE(bit_sup(a, a) == a);
+      BOOST_REQUIRE(bit_inf(a, a) == a);
+      BOOST_REQUIRE(bit_sup(a, bit_lattice::U) == a);
+      BOOST_REQUIRE(bit_sup(a, bit_lattice::X) == bit_lattice::X);
+      BOOST_REQUIRE(bit_inf(a, bit_lattice::X) == a);
+      BOOST_REQUIRE(bit_inf(a, bit_lattice::U) == bit_lattice::U);
+      for(const auto b : lattice_values)
+      {
+         BOOST_REQUIRE(bit_sup(a, b) == bit_sup(b, a));
+         BOOST_REQUIRE(bit_inf(a, b) == bit_inf(b, a));
+      }
+   }
+   BOOST_REQUIRE(bit_sup(bit_lattice::ZERO, bit_lattice::ONE) == bit_lattice::X);
+   BOOST_REQUIRE(bit_inf(bit_lattice::ZERO, bit_lattice::ONE) == bit_lattice::U);
+}
+
+BOOST_AUTO_TEST_CASE(bit_lattice_table_lookup)
+{
+   const bit_lattice_table<bit_lattice_table<bit_lattice>> not_and = {
+       {bit_lattice::ZERO, {{bit_lattice::ZERO, bit_lattice::ONE}, {bit_lattice::ONE, bit_lattice::ONE}}},
+       {bit_lattice::ONE, {{bit_lattice::ZERO, bit_lattice::ONE}, {bit_lattice::ONE, bit_lattice::ZERO}}},
+   };
+   BOOST_REQUIRE(not_and.at(bit_lattice::ZERO).at(bit_lattice::ZERO) == bit_lattice::ONE);
+   BOOST_REQUIRE(not_and.at(bit_lattice::ZERO).at(bit_lattice::ONE) == bit_lattice::ONE);
+   BOOST_REQUIRE(not_and.at(bit_lattice::ONE).at(bit_lattice::ZERO) == bit_lattice::ONE);
+   BOOST_REQUIRE(not_and.at(bit_lattice::ONE).at(bit_lattice::ONE) == bit_lattice::ZERO);
+}
+
+BOOST_AUTO_TEST_CASE(bit_lattice_bitstring)
+{
+   const auto a = string_to_bitstring("0U10");
+   const auto b = string_to_bitstring("0110");
+   const auto c = string_to_bitstring("0100");
+   BOOST_REQUIRE_EQUAL("UUU01", bitstring_to_string(sign_extend_bitstring(string_to_bitstring("U01"), true, 5)));
+   BOOST_REQUIRE_EQUAL("0000U", bitstring_to_string(sign_extend_bitstring(string_to_bitstring("0U"), false, 5)));
+   BOOST_REQUIRE_EQUAL("110", bitstring_to_string(sup(a, b, 4, false, false)));
+   BOOST_REQUIRE_EQUAL("1X0", bitstring_to_string(sup(b, c, 4, false, false)));
+   BOOST_REQUIRE_EQUAL("U10", bitstring_to_string(inf(a, b, 4, false, false)));
+   BOOST_REQUIRE_EQUAL("1U0", bitstring_to_string(inf(b, c, 4, false, false)));
+}
+
+BOOST_AUTO_TEST_CASE(bit_lattice_string_deque_interface)
+{
+   std::mt19937 generator(1);
+   std::deque<bit_lattice> reference;
+   bit_lattice_string packed;
+   for(unsigned int step = 0; step < 5000; ++step)
+   {
+      const auto bit = lattice_values[generator() % 4];
+      const auto count = generator() % 100;
+      const auto position = reference.empty() ? 0 : generator() % reference.size();
+      switch(generator() % 9)
+      {
+         case 0:
+            reference.push_front(bit);
+            packed.push_front(bit);
+            break;
+         case 1:
+            reference.push_back(bit);
+            packed.push_back(bit);
+            break;
+         case 2:
+            if(!reference.empty())
+            {
+               reference.pop_front();
+               packed.pop_front();
+            }
+            break;
+         case 3:
+            if(!reference.empty())
+            {
+               reference.pop_back();
+               packed.pop_back();
+            }
+            break;
+         case 4:
+            reference.insert(reference.begin() + static_cast<long>(position), count, bit);
+            packed.insert(packed.begin() + static_cast<long>(position), count, bit);
+            break;
+         case 5:
+         {
+            const auto source = random_bits(generator, count, 50);
+            const auto packed_source = to_packed(source);
+            reference.insert(reference.begin() + static_cast<long>(position), source.begin(), source.end());
+            packed.insert(packed.begin() + static_cast<long>(position), packed_source.begin(), packed_source.end());
+            break;
+         }
+         case 6:
+         {
+            const auto last = std::min(reference.size(), position + count);
+            reference.erase(reference.begin() + static_cast<long>(position), reference.begin() + static_cast<long>(last));
+            packed.erase(packed.begin() + static_cast<long>(position), packed.begin() + static_cast<long>(last));
+            break;
+         }
+         case 7:
+            if(!reference.empty())
+            {
+               reference[position] = bit;
+               packed.set(position, bit);
+            }
+            break;
+         default:
+            if(reference.size() > 300)
+            {
+               reference.clear();
+               packed.clear();
+            }
+            break;
+      }
+      BOOST_REQUIRE_EQUAL(reference.size(), packed.size());
+      BOOST_REQUIRE_EQUAL(to_string(reference), bitstring_to_string(packed));
+      BOOST_REQUIRE(packed == to_packed(reference));
+      if(position < reference.size())
+      {
+         BOOST_REQUIRE(reference.front() == packed.front());
+         BOOST_REQUIRE(reference.back() == packed.back());
+         BOOST_REQUIRE(reference.at(position) == packed.at(position));
+         BOOST_REQUIRE(*(reference.rbegin() + static_cast<long>(position)) ==
+                       *(packed.rbegin() + static_cast<long>(position)));
+      }
+   }
+   BOOST_REQUIRE(string_to_bitstring("0U1X") != string_to_bitstring("0U11"));
+   BOOST_REQUIRE(string_to_bitstring("0U1X") != string_to_bitstring("U1X"));
+   BOOST_REQUIRE(bitstring_constant(string_to_bitstring(std::string(100, '1') + "01")));
+   BOOST_REQUIRE(!bitstring_constant(string_to_bitstring(std::string(100, '1') + "0X")));
+   BOOST_REQUIRE(!bitstring_constant(string_to_bitstring("U" + std::string(100, '1'))));
+}
+
+BOOST_AUTO_TEST_CASE(bit_lattice_string_bitwise)
+{
+   for(const auto a : lattice_values)
+   {
+      for(const auto b : lattice_values)
+      {
+         const auto packed_a = bit_lattice_string(1, a);
+         const auto packed_b = bit_lattice_string(1, b);
+         BOOST_REQUIRE(bitstring_and(packed_a, packed_b, 1).front() == bit_and_expr_map.at(a).at(b));
+         BOOST_REQUIRE(bitstring_ior(packed_a, packed_b, 1).front() == bit_ior_expr_map.at(a).at(b));
+         BOOST_REQUIRE(bitstring_xor(packed_a, packed_b, 1).front() == bit_xor_expr_map.at(a).at(b));
+         BOOST_REQUIRE(bitstring_sup(packed_a, packed_b, 1).front() == bit_sup(a, b));
+         BOOST_REQUIRE(bitstring_inf(packed_a, packed_b, 1).front() == bit_inf(a, b));
+      }
+   }
+   std::mt19937 generator(2);
+   for(unsigned int i = 0; i < 500; ++i)
+   {
+      const auto a = random_bits(generator, 1 + generator() % 200, 50);
+      const auto b = random_bits(generator, 1 + generator() % 200, 50);
+      const auto size = 1 + generator() % 200;
+      BOOST_REQUIRE_EQUAL(to_string(deque_bitwise(a, b, size, bit_and_expr_map)),
+                          bitstring_to_string(bitstring_and(to_packed(a), to_packed(b), size)));
+      BOOST_REQUIRE_EQUAL(to_string(deque_bitwise(a, b, size, bit_ior_expr_map)),
+                          bitstring_to_string(bitstring_ior(to_packed(a), to_packed(b), size)));
+      BOOST_REQUIRE_EQUAL(to_string(deque_bitwise(a, b, size, bit_xor_expr_map)),
+                          bitstring_to_string(bitstring_xor(to_packed(a), to_packed(b), size)));
+   }
+}
+
+BOOST_AUTO_TEST_CASE(bit_lattice_string_ripple)
+{
+   std::mt19937 generator(3);
+   for(const auto percent_constant : {100U, 98U, 50U})
+   {
+      for(unsigned int i = 0; i < 500; ++i)
+      {
+         const auto a = random_bits(generator, 1 + generator() % 200, percent_constant);
+         const auto b = random_bits(generator, 1 + generator() % 200, percent_constant);
+         const auto size = 1 + generator() % 200;
+         const auto carry = lattice_values[generator() % 3];
+         for(const auto table : {&plus_expr_map, &minus_expr_map})
+         {
+            auto reference_carry = carry;
+            auto packed_carry = carry;
+            const auto reference = deque_ripple(a, b, reference_carry, size, *table);
+            const auto packed = table == &plus_expr_map ? bitstring_plus(to_packed(a), to_packed(b), packed_carry, size) :
+                                                          bitstring_minus(to_packed(a), to_packed(b), packed_carry, size);
+            BOOST_REQUIRE_EQUAL(to_string(reference), bitstring_to_string(packed));
+            BOOST_REQUIRE(reference_carry == packed_carry);
+         }
+      }
+   }
+}
+
+/**
+ * Compare the packed transfer functions with the bit by bit implementation on std::deque they replaced
+ */
+BOOST_AUTO_TEST_CASE(bit_lattice_string_benchmark)
+{
+   std::mt19937 generator(4);
+   std::vector<std::deque<bit_lattice>> operands;
+   for(unsigned int i = 0; i < 256; ++i)
+   {
+      operands.push_back(random_bits(generator, i % 3 ? 64 : 32, i % 2 ? 100 : 50));
+   }
+   std::vector<bit_lattice_string> packed_operands;
+   for(const auto& operand : operands)
+   {
+      packed_operands.push_back(to_packed(operand));
+   }
+   const auto rounds = 20U;
+
+   size_t reference_checksum = 0;
+   const auto reference_start = std::chrono::steady_clock::now();
+   for(unsigned int round = 0; round < rounds; ++round)
+   {
+      for(size_t i = 0; i + 1 < operands.size(); ++i)
+      {
+         auto carry = bit_lattice::ZERO;
+         const auto sum = deque_ripple(operands[i], operands[i + 1], carry, 64, plus_expr_map);
+         const auto masked = deque_bitwise(sum, operands[i], 64, bit_and_expr_map);
+         auto extended = masked;
+         extended.insert(extended.begin(), 128 - extended.size(), extended.front());
+         reference_checksum += extended.size() + static_cast<size_t>(extended.back());
+      }
+   }
+   const auto reference_time = std::chrono::steady_clock::now() - reference_start;
+
+   size_t packed_checksum = 0;
+   const auto packed_start = std::chrono::steady_clock::now();
+   for(unsigned int round = 0; round < rounds; ++round)
+   {
+      for(size_t i = 0; i + 1 < packed_operands.size(); ++i)
+      {
+         auto carry = bit_lattice::ZERO;
+         const auto sum = bitstring_plus(packed_operands[i], packed_operands[i + 1], carry, 64);
+         const auto masked = bitstring_and(sum, packed_operands[i], 64);
+         const auto extended = sign_extend_bitstring(masked, true, 128);
+         packed_checksum += extended.size() + static_cast<size_t>(extended.back());
+      }
+   }
+   const auto packed_time = std::chrono::steady_clock::now() - packed_start;
+
+   BOOST_REQUIRE_EQUAL(reference_checksum, packed_checksum);
+   BOOST_TEST_MESSAGE(
+       "bit_lattice std::deque: "
+       << std::chrono::duration_cast<std::chrono::microseconds>(reference_time).count() << "us, bit_lattice_string: "
+       << std::chrono::duration_cast<std::chrono::microseconds>(packed_time).count() << "us");
+}
@@ -0,0 +1,74 @@
+#include "interned_string.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+
+BOOST_AUTO_TEST_CASE(interned_string_identity)
+{
+   const interned_string a("clock"), b(std::string("clo") + "ck"), c("reset"), empty("");
+   BOOST_REQUIRE(a == b);
+   BOOST_REQUIRE(&a.str() == &b.str());
+   BOOST_REQUIRE(a != c);
+   BOOST_REQUIRE(a < c && !(c < a) && !(a < b));
+   BOOST_REQUIRE(empty == interned_string());
+   BOOST_REQUIRE(empty.empty());
+   const auto pool_size = interned_string::pool_size();
+   const interned_string d("clock");
+   BOOST_REQUIRE_EQUAL(interned_string::pool_size(), pool_size);
+   BOOST_REQUIRE_EQUAL(static_cast<const std::string&>(d), "clock");
+}
+
+BOOST_AUTO_TEST_CASE(interned_string_map_matches_std_map)
+{
+   std::mt19937 generator(42);
+   interned_string_map<unsigned int> map;
+   std::map<std::string, unsigned int> reference;
+   for(unsigned int i = 0; i < 20000; ++i)
+   {
+      const auto key = "sig_" + std::to_string(generator() % 5000);
+      switch(generator() % 4)
+      {
+         case 0:
+         {
+            BOOST_REQUIRE_EQUAL(map.erase(key), reference.erase(key) == 1);
+            break;
+         }
+         case 1:
+         {
+            const auto value = map.find(key);
+            const auto it = reference.find(key);
+            BOOST_REQUIRE_EQUAL(value != nullptr, it != reference.end());
+            if(value)
+            {
+               BOOST_REQUIRE_EQUAL(*value, it->second);
+            }
+            break;
+         }
+         default:
+         {
+            map.insert_or_assign(key, i);
+            reference[key] = i;
+            break;
+         }
+      }
+      BOOST_REQUIRE_EQUAL(map.size(), reference.size());
+   }
+   const interned_string_map<unsigned int> copy(map);
+   for(const auto& checked : {std::cref(map), std::cref(copy)})
+   {
+      const auto entries = checked.get().entries();
+      BOOST_REQUIRE_EQUAL(entries.size(), reference.size());
+      auto it = reference.begin();
+      for(const auto& entry : entries)
+      {
+         BOOST_REQUIRE_EQUAL(entry.first.str(), it->first);
+         BOOST_REQUIRE_EQUAL(entry.second, it->second);
+         ++it;
+      }
+      BOOST_REQUIRE(it == reference.end());
+   }
+}
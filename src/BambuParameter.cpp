@@ -225,6 +225,11 @@
 #define OPT_SHARED_INPUT_REGISTERS (1 + OPT_NANOXPLORE_BYPASS)
 #define OPT_INLINE_FUNCTIONS (1 + OPT_SHARED_INPUT_REGISTERS)
 #define OPT_AXI_BURST_TYPE (1 + OPT_INLINE_FUNCTIONS)
+#define OPT_HLS_JOBS (1 + OPT_AXI_BURST_TYPE)
+#define OPT_TECHNOLOGY_CACHE (1 + OPT_HLS_JOBS)
+#define OPT_SIMULATION_SHARDS (1 + OPT_TECHNOLOGY_CACHE)
+#define OPT_HLS_CACHE (1 + OPT_SIMULATION_SHARDS)
+#define OPT_MODULE_BINDING_JOBS (1 + OPT_HLS_CACHE)
 
 /// constant correspond to the "parametric list based option"
 #define PAR_LIST_BASED_OPT "parametric-list-based"
@@ -261,6 +266,12 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "            H - VHDL\n\n"
       << "    --no-mixed-design\n"
       << "        Avoid mixed output RTL language designs.\n\n"
+      << "    --hls-cache=<dir>\n"
+      << "        Store the synthesis results and the RTL modules of each function in\n"
+      << "        <dir>, keyed by a fingerprint of the function body, of its callees, of\n"
+      << "        the synthesis options and of the technology libraries. The functions\n"
+      << "        which are unchanged, apart from the top ones, are restored from <dir>\n"
+      << "        without running their HLS steps.\n\n"
       << "    --generate-tb=<file>\n"
       << "        Generate testbench using the given files.\n"
       << "        <file> must be a valid testbench XML file or a C/C++ file specifying\n"
@@ -305,6 +316,9 @@ void BambuParameter::PrintHelp(std::ostream& os) const
    os << "  Target:\n\n"
       << "    --target-file=file, -b<file>\n"
       << "        Specify an XML description of the target device.\n\n"
+      << "    --technology-cache=<dir>\n"
+      << "        Store binary images of the parsed device and technology library files in\n"
+      << "        <dir> and reuse them while the files are unchanged.\n\n"
       << "    --generate-interface=<type>\n"
       << "        Wrap the top level module with an external interface.\n"
       << "        Possible values for <type> and related interfaces:\n"
@@ -333,6 +347,20 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "        Perform scheduling by using speculative SDC.\n"
       << "        The speculative SDC is more conservative, in case \n"
       << "        --panda-parameter=enable-conservative-sdc=1 is passed.\n\n"
+      << "    --ilp-solver=<solver>\n"
+      << "        Set the solver used by the SDC scheduling. Possible values for the <solver>\n"
+      << "        argument are the following:\n"
+#if HAVE_GLPK
+      << "            GLPK     - GNU Linear Programming Kit (default)\n"
+#endif
+#if HAVE_COIN_OR
+      << "            COIN-OR  - COIN-OR branch and cut solver\n"
+#endif
+#if HAVE_LP_SOLVE
+      << "            LP_SOLVE - lp_solve solver\n"
+#endif
+      << "            SDC      - longest path solver dedicated to difference constraints,\n"
+      << "                       faster than general purpose solvers on large loops\n\n"
 #endif
       << "    --pipelining,-p\n"
       << "        Perform functional pipelining starting from the top function.\n\n"
@@ -389,6 +417,13 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "            BIPARTITE_MATCHING - solve the weighted clique covering problem\n"
       << "                                 exploiting the bipartite matching approach\n"
       << "            UNIQUE             - use a 1-to-1 binding algorithm\n\n"
+      << "    --module-binding-jobs=<N>\n"
+      << "        Solve the clique covering problems of the different functional unit\n"
+      << "        types on up to <N> threads. When this option is given, each problem is\n"
+      << "        built on the slacks and on the binding available at the beginning of the\n"
+      << "        binding iteration instead of the ones left by the previously solved\n"
+      << "        functional unit types; the results are merged in the same order and do\n"
+      << "        not depend on <N>.\n\n"
       << std::endl;
    os << "    --shared-input-registers\n"
       << "        The module bindings and the register binding try to share more resources by \n"
@@ -495,6 +530,10 @@ void BambuParameter::PrintHelp(std::ostream& os) const
       << "    --max-sim-cycles=<cycles>\n"
       << "        Specify the maximum number of cycles a HDL simulation may run.\n"
       << "        (default 200000000).\n\n"
+      << "    --simulation-shards=<N>\n"
+      << "        Split the generated test vectors in <N> shards and simulate them with <N>\n"
+      << "        concurrent instances of the same compiled model (Verilator only). Test\n"
+      << "        vectors must not depend on each other (default 1).\n\n"
       << "    --accept-nonzero-return\n"
       << "        Do not assume that application main must return 0.\n\n"
       << "    --generate-vcd\n"
@@ -809,6 +848,11 @@ void BambuParameter::PrintHelp(std::ostream& os) const
 #endif
    os << "    --disable-bitvalue-ipa\n"
       << "        Disable inter-procedural bitvalue analysis.\n\n";
+   os << "    --hls-jobs=<N>\n"
+      << "        Run up to <N> per-function synthesis steps (scheduling, binding, datapath and\n"
+      << "        controller creation) concurrently on functions which do not call each other\n"
+      << "        (default 1). The HDL descriptions of the modules are also written by up to\n"
+      << "        <N> threads.\n\n";
    os << "    --enable-function-proxy\n"
       << "        Enable function proxy. May reduce the resource usage.\n\n";
    os << "    --disable-function-proxy\n"
@@ -1106,6 +1150,11 @@ int BambuParameter::Exec()
       {"verilator-parallel", optional_argument, nullptr, OPT_VERILATOR_PARALLEL},
       {"shared-input-registers", no_argument, nullptr, OPT_SHARED_INPUT_REGISTERS},
       {"inline-fname", required_argument, nullptr, OPT_INLINE_FUNCTIONS},
+      {"hls-jobs", required_argument, nullptr, OPT_HLS_JOBS},
+      {"technology-cache", required_argument, nullptr, OPT_TECHNOLOGY_CACHE},
+      {"simulation-shards", required_argument, nullptr, OPT_SIMULATION_SHARDS},
+      {"hls-cache", required_argument, nullptr, OPT_HLS_CACHE},
+      {"module-binding-jobs", required_argument, nullptr, OPT_MODULE_BINDING_JOBS},
       GCC_LONG_OPTIONS,
       {nullptr, 0, nullptr, 0}
    };
@@ -1493,6 +1542,37 @@ int BambuParameter::Exec()
             setOption(OPT_gcc_defines, defines);
             break;
          }
+         case OPT_ILP_SOLVER:
+         {
+#if HAVE_GLPK
+            if(std::string(optarg) == "GLPK")
+            {
+               setOption(OPT_ilp_solver, meilp_solver::GLPK);
+               break;
+            }
+#endif
+#if HAVE_COIN_OR
+            if(std::string(optarg) == "COIN-OR")
+            {
+               setOption(OPT_ilp_solver, meilp_solver::COIN_OR);
+               break;
+            }
+#endif
+#if HAVE_LP_SOLVE
+            if(std::string(optarg) == "LP_SOLVE")
+            {
+               setOption(OPT_ilp_solver, meilp_solver::LP_SOLVE);
+               break;
+            }
+#endif
+            if(std::string(optarg) == "SDC")
+            {
+               setOption(OPT_ilp_solver, meilp_solver::SDC);
+               break;
+            }
+            THROW_ERROR("BadParameters: ilp solver not supported: " + std::string(optarg));
+            break;
+         }
 #endif
          case 'p':
          {
@@ -2029,6 +2109,31 @@ int BambuParameter::Exec()
             };
             break;
          }
+         case OPT_HLS_JOBS:
+         {
+            setOption(OPT_hls_jobs, CheckPositiveInteger("hls-jobs", optarg));
+            break;
+         }
+         case OPT_TECHNOLOGY_CACHE:
+         {
+            setOption(OPT_technology_cache, std::filesystem::absolute(optarg).string());
+            break;
+         }
+         case OPT_SIMULATION_SHARDS:
+         {
+            setOption(OPT_simulation_shards, CheckPositiveInteger("simulation-shards", optarg));
+            break;
+         }
+         case OPT_HLS_CACHE:
+         {
+            setOption(OPT_hls_cache, std::filesystem::absolute(optarg).string());
+            break;
+         }
+         case OPT_MODULE_BINDING_JOBS:
+         {
+            setOption(OPT_module_binding_jobs, CheckPositiveInteger("module-binding-jobs", optarg));
+            break;
+         }
          case OPT_ACCEPT_NONZERO_RETURN:
          {
             setOption(OPT_no_return_zero, true);
@@ -3654,6 +3759,7 @@ void BambuParameter::SetDefaults()
    /// ---------- HLS specification reference ----------- //
    setOption(OPT_generate_testbench, false);
    setOption(OPT_max_sim_cycles, 200000000);
+   setOption(OPT_simulation_shards, 1);
    setOption(OPT_chaining, true);
 
    /// High-level synthesis constraints dump -- //
@@ -3672,6 +3778,8 @@ void BambuParameter::SetDefaults()
    setOption(OPT_ilp_solver, meilp_solver::COIN_OR);
 #elif HAVE_LP_SOLVE
    setOption(OPT_ilp_solver, meilp_solver::LP_SOLVE);
+#else
+   setOption(OPT_ilp_solver, meilp_solver::SDC);
 #endif
 #endif
    /// speculative execution flag
@@ -64,6 +64,11 @@ ControllerCreatorBaseStep::ControllerCreatorBaseStep(const ParameterConstRef _Pa
 
 ControllerCreatorBaseStep::~ControllerCreatorBaseStep() = default;
 
+unsigned int ControllerCreatorBaseStep::GetLocalFunction() const
+{
+   return funId;
+}
+
 const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>>
 ControllerCreatorBaseStep::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
@@ -98,6 +98,12 @@ class ControllerCreatorBaseStep : public HLSFunctionStep
     */
    ~ControllerCreatorBaseStep() override;
 
+   /**
+    * Return the function synthesized by this step, since only the data structures of that function are modified
+    * @return the index of the function
+    */
+   unsigned int GetLocalFunction() const override;
+
  protected:
    /**
     * Initialize the step (i.e., like a constructor, but executed just before exec
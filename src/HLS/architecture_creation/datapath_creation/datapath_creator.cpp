@@ -58,6 +58,11 @@ datapath_creator::datapath_creator(const ParameterConstRef _Param, const HLS_man
 
 datapath_creator::~datapath_creator() = default;
 
+unsigned int datapath_creator::GetLocalFunction() const
+{
+   return funId;
+}
+
 const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>>
 datapath_creator::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
@@ -77,6 +77,12 @@ class datapath_creator : public HLSFunctionStep
     * Destructor.
     */
    ~datapath_creator() override;
+
+   /**
+    * Return the function synthesized by this step, since only the data structures of that function are modified
+    * @return the index of the function
+    */
+   unsigned int GetLocalFunction() const override;
 };
 /// refcount definition of the class
 using datapath_creatorRef = refcount<datapath_creator>;
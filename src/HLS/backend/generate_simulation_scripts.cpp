@@ -111,8 +111,8 @@ void GenerateSimulationScripts::ComputeRelationships(DesignFlowStepSet& design_f
    {
       case DEPENDENCE_RELATIONSHIP:
       {
-         const auto c_backend_factory =
-             GetPointer<const CBackendStepFactory>(design_flow_manager.lock()->CGetDesignFlowStepFactory("CBackend"));
+         const auto c_backend_factory = GetPointer<const CBackendStepFactory>(
+             design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::C_BACKEND));
 
          design_flow_step_set.insert(c_backend_factory->CreateCBackendStep(
              CBackendInformationConstRef(new CBackendInformation(CBackendInformation::CB_HLS, _c_testbench))));
@@ -63,6 +63,11 @@ conn_binding_creator::conn_binding_creator(const ParameterConstRef _Param, const
 
 conn_binding_creator::~conn_binding_creator() = default;
 
+unsigned int conn_binding_creator::GetLocalFunction() const
+{
+   return funId;
+}
+
 const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>>
 conn_binding_creator::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
@@ -101,5 +101,11 @@ class conn_binding_creator : public HLSFunctionStep
     * Destructor.
     */
    ~conn_binding_creator() override;
+
+   /**
+    * Return the function synthesized by this step, since only the data structures of that function are modified
+    * @return the index of the function
+    */
+   unsigned int GetLocalFunction() const override;
 };
 #endif
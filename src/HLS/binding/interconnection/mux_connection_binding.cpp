@@ -1165,10 +1165,8 @@ void mux_connection_binding::connect_to_registers(vertex op, const OpGraphConstR
             {
                THROW_ASSERT(HLS->storage_value_information->is_a_storage_value(previous, var),
                             "There is a live in variable without any register");
-               THROW_ASSERT(HLS->Rliv->get_live_in(previous).find(var) != HLS->Rliv->get_live_in(previous).end(),
-                            "The variable is not in live-in");
-               THROW_ASSERT(HLS->Rliv->get_live_out(previous).find(var) != HLS->Rliv->get_live_out(previous).end(),
-                            "The variable is not in live-out");
+               THROW_ASSERT(HLS->Rliv->is_live_in(previous, var), "The variable is not in live-in");
+               THROW_ASSERT(HLS->Rliv->is_live_out(previous, var), "The variable is not in live-out");
                origin_idx = HLS->storage_value_information->get_storage_value_index(previous, var);
                target_idx = HLS->storage_value_information->get_storage_value_index(target, var);
                origin_reg_idx = HLS->Rreg->get_register(origin_idx);
@@ -2200,7 +2198,8 @@ unsigned int mux_connection_binding::mux_interconnection()
 unsigned int mux_connection_binding::input_logic(const conn_binding::ConnectionSources& srcs, const generic_objRef tgt,
                                                  unsigned int op, unsigned int port_index, unsigned int iteration)
 {
-   static unsigned int used_mux = 0;
+   /// only the number of muxes allocated by this call is returned, so each thread can keep its own counter
+   thread_local unsigned int used_mux = 0;
    unsigned int starting_value = used_mux;
 
    /// if it's a one-to-one connection, a directed link can be used
@@ -212,9 +212,9 @@ std::string CDFCModuleBindingSpecialization::GetKindText() const
    return CliqueCovering_AlgorithmToString(clique_covering_algorithm);
 }
 
-std::string CDFCModuleBindingSpecialization::GetSignature() const
+unsigned int CDFCModuleBindingSpecialization::GetSignatureContext() const
 {
-   return STR(static_cast<unsigned int>(clique_covering_algorithm));
+   return static_cast<unsigned int>(clique_covering_algorithm);
 }
 
 void cdfc_module_binding::initialize_connection_relation(connection_relation& con_rel,
@@ -926,6 +926,22 @@ static inline bool compute_condition2(bool cond1, unsigned long long fu_prec, do
    return cond2;
 }
 
+/// The clique covering computed for the operations which can be bound to a functional unit type
+struct partition_solution
+{
+   /// the solver storing the cliques
+   refcount<clique_covering<vertex>> module_clique;
+
+   /// the precision of the functional unit
+   unsigned long long fu_prec;
+
+   /// the estimated delay of the controller
+   double controller_delay;
+
+   /// true if the cliques have not been filtered on the slacks
+   bool disabling_slack_based_binding;
+};
+
 DesignFlowStep_Status cdfc_module_binding::InternalExec()
 {
    long step_time = 0;
@@ -1420,16 +1436,18 @@ DesignFlowStep_Status cdfc_module_binding::InternalExec()
          if(parameters->getOption<HLSFlowStep_Type>(OPT_register_allocation_algorithm) ==
             HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING)
          {
-            regb =
-                GetPointer<const HLSFlowStepFactory>(design_flow_manager.lock()->CGetDesignFlowStepFactory("HLS"))
-                    ->CreateHLSFlowStep(
-                        HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING, funId,
-                        HLSFlowStepSpecializationConstRef(new WeightedCliqueRegisterBindingSpecialization(
-                            parameters->getOption<CliqueCovering_Algorithm>(OPT_weighted_clique_register_algorithm))));
+            regb = GetPointer<const HLSFlowStepFactory>(
+                       design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::HLS))
+                       ->CreateHLSFlowStep(
+                           HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING, funId,
+                           HLSFlowStepSpecializationConstRef(new WeightedCliqueRegisterBindingSpecialization(
+                               parameters->getOption<CliqueCovering_Algorithm>(
+                                   OPT_weighted_clique_register_algorithm))));
          }
          else
          {
-            regb = GetPointer<const HLSFlowStepFactory>(design_flow_manager.lock()->CGetDesignFlowStepFactory("HLS"))
+            regb = GetPointer<const HLSFlowStepFactory>(
+                       design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::HLS))
                        ->CreateHLSFlowStep(parameters->getOption<HLSFlowStep_Type>(OPT_register_allocation_algorithm),
                                            funId);
          }
@@ -1842,357 +1860,390 @@ DesignFlowStep_Status cdfc_module_binding::InternalExec()
       double total_area_muxes_best = 0;
       double total_DSPs_best = 0;
 
-      for(unsigned int iteration = 0; iteration < number_of_iterations; ++iteration)
-      {
-         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Running iteration " + STR(iteration));
-         if(iteration > 0)
-         {
-            if(iteration > 1 && total_resource_area == total_resource_area_prev && total_DSPs == total_DSPs_prev &&
-               total_area_muxes == total_area_muxes_prev)
-            {
-               break;
-            }
-            numModule = numModule_initial;
-            total_modules_allocated = total_modules_allocated_initial;
-            total_resource_area_prev = total_resource_area;
-            total_resource_area = total_resource_area_initial;
-            total_DSPs_prev = total_DSPs;
-            total_DSPs = total_DSPs_initial;
-            slack_time = slack_time_initial;
-            starting_time = starting_time_initial;
-            total_area_muxes_prev = total_area_muxes;
-            total_area_muxes = total_area_muxes_initial;
+      /// build and solve the clique covering problem of the operations which can be bound to a functional unit type
+      const auto solve_partition = [&](decltype(partitions)::const_reference partition) -> partition_solution {
+         THROW_ASSERT(partition.second.size() > 1, "bad projection");
+         auto vert_it_end = partition.second.end();
+         const double mux_time =
+             MODULE_BINDING_MUX_MARGIN * allocation_information->estimate_mux_time(partition.first);
+         double controller_delay = allocation_information->EstimateControllerDelay();
+         double resource_area = allocation_information->compute_normalized_area(partition.first);
+         auto fu_prec = allocation_information->get_prec(partition.first);
 
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                        "---controller_delay: " + STR(controller_delay) +
+                            " resource normalized area=" + STR(resource_area));
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                        "---mux_time: " + STR(mux_time) +
+                            " area_mux=" + STR(allocation_information->estimate_mux_area(partition.first)));
+
+         const auto disabling_slack_cond0 =
+             ((allocation_information->get_number_channels(partition.first) >= 1) and
+              (!allocation_information->is_readonly_memory_unit(partition.first) ||
+               (!parameters->isOption(OPT_rom_duplication) || !parameters->getOption<bool>(OPT_rom_duplication))));
+         const auto clique_covering_method = [&]() {
+            if(disabling_slack_cond0)
             {
-               DesignFlowStepRef regb;
-               // if(iteration%2)
-               if(parameters->getOption<HLSFlowStep_Type>(OPT_register_allocation_algorithm) ==
-                  HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING)
-               {
-                  regb =
-                      GetPointer<const HLSFlowStepFactory>(design_flow_manager.lock()->CGetDesignFlowStepFactory("HLS"))
-                          ->CreateHLSFlowStep(
-                              HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING, funId,
-                              HLSFlowStepSpecializationConstRef(new WeightedCliqueRegisterBindingSpecialization(
-                                  parameters->getOption<CliqueCovering_Algorithm>(
-                                      OPT_weighted_clique_register_algorithm))));
-               }
-               else
-               {
-                  regb =
-                      GetPointer<const HLSFlowStepFactory>(design_flow_manager.lock()->CGetDesignFlowStepFactory("HLS"))
-                          ->CreateHLSFlowStep(
-                              parameters->getOption<HLSFlowStep_Type>(OPT_register_allocation_algorithm), funId);
-               }
-               regb->Initialize();
-               regb->Exec();
+               PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
+                             "DISABLING STD clique covering algorithm. Forced to BIPARTITE_MATCHING");
+               return CliqueCovering_Algorithm::BIPARTITE_MATCHING;
             }
-         }
-
-         if(output_level >= OUTPUT_LEVEL_VERBOSE)
+            return GetPointer<const CDFCModuleBindingSpecialization>(hls_flow_step_specialization)
+                ->clique_covering_algorithm;
+         }();
+
+         const auto res_name = allocation_information->get_fu_name(partition.first).first;
+         const auto lib_name = HLS->HLS_D->get_technology_manager()->get_library(res_name);
+         const auto disabling_slack_based_binding =
+             disabling_slack_cond0 || lib_name == WORK_LIBRARY || lib_name == PROXY_LIBRARY ||
+             allocation_information->get_number_fu(partition.first) != INFINITE_UINT;
+         THROW_ASSERT(lib_name != PROXY_LIBRARY || 1 == allocation_information->get_number_fu(partition.first),
+                      "unexpected condition");
+
+         /// build the clique covering solver
+         auto module_clique = clique_covering<vertex>::create_solver(clique_covering_method,
+                                                                     static_cast<unsigned>(partition.second.size()));
+         /// add vertex to the clique covering solver
+         for(const auto v : partition.second)
          {
-            START_TIME(clique_iteration_cputime);
+            const auto el1_name = GET_NAME(sdg, c2s[boost::get(boost::vertex_index, *CG, v)]) + "(" +
+                                  sdg->CGetOpNodeInfo(c2s[boost::get(boost::vertex_index, *CG, v)])->GetOperation() +
+                                  ")";
+            module_clique->add_vertex(c2s[boost::get(boost::vertex_index, *CG, v)], el1_name);
          }
-         for(const auto& partition : partitions)
-         {
-            THROW_ASSERT(partition.second.size() > 1, "bad projection");
-            auto vert_it_end = partition.second.end();
-            const double mux_time =
-                MODULE_BINDING_MUX_MARGIN * allocation_information->estimate_mux_time(partition.first);
-            double controller_delay = allocation_information->EstimateControllerDelay();
-            double resource_area = allocation_information->compute_normalized_area(partition.first);
-            auto fu_prec = allocation_information->get_prec(partition.first);
 
-            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                           "---controller_delay: " + STR(controller_delay) +
-                               " resource normalized area=" + STR(resource_area));
-            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                           "---mux_time: " + STR(mux_time) +
-                               " area_mux=" + STR(allocation_information->estimate_mux_area(partition.first)));
-
-            const auto disabling_slack_cond0 =
-                ((allocation_information->get_number_channels(partition.first) >= 1) and
-                 (!allocation_information->is_readonly_memory_unit(partition.first) ||
-                  (!parameters->isOption(OPT_rom_duplication) || !parameters->getOption<bool>(OPT_rom_duplication))));
-            const auto clique_covering_method = [&]() {
-               if(disabling_slack_cond0)
-               {
-                  PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
-                                "DISABLING STD clique covering algorithm. Forced to BIPARTITE_MATCHING");
-                  return CliqueCovering_Algorithm::BIPARTITE_MATCHING;
-               }
-               return GetPointer<const CDFCModuleBindingSpecialization>(hls_flow_step_specialization)
-                   ->clique_covering_algorithm;
-            }();
-
-            const auto res_name = allocation_information->get_fu_name(partition.first).first;
-            const auto lib_name = HLS->HLS_D->get_technology_manager()->get_library(res_name);
-            const auto disabling_slack_based_binding =
-                disabling_slack_cond0 || lib_name == WORK_LIBRARY || lib_name == PROXY_LIBRARY ||
-                allocation_information->get_number_fu(partition.first) != INFINITE_UINT;
-            THROW_ASSERT(lib_name != PROXY_LIBRARY || 1 == allocation_information->get_number_fu(partition.first),
-                         "unexpected condition");
-
-            /// build the clique covering solver
-            auto module_clique = clique_covering<vertex>::create_solver(clique_covering_method,
-                                                                        static_cast<unsigned>(partition.second.size()));
-            /// add vertex to the clique covering solver
+         if(clique_covering_method == CliqueCovering_Algorithm::BIPARTITE_MATCHING)
+         {
+            CustomUnorderedMap<vertex, size_t> v2id;
+            size_t max_id = 0, curr_id;
             for(const auto v : partition.second)
             {
-               const auto el1_name = GET_NAME(sdg, c2s[boost::get(boost::vertex_index, *CG, v)]) + "(" +
-                                     sdg->CGetOpNodeInfo(c2s[boost::get(boost::vertex_index, *CG, v)])->GetOperation() +
-                                     ")";
-               module_clique->add_vertex(c2s[boost::get(boost::vertex_index, *CG, v)], el1_name);
-            }
-
-            if(clique_covering_method == CliqueCovering_Algorithm::BIPARTITE_MATCHING)
-            {
-               CustomUnorderedMap<vertex, size_t> v2id;
-               size_t max_id = 0, curr_id;
-               for(const auto v : partition.second)
+               const auto& running_states =
+                   HLS->Rliv->get_state_where_run(c2s[boost::get(boost::vertex_index, *CG, v)]);
+               for(const auto state : running_states)
                {
-                  const auto& running_states =
-                      HLS->Rliv->get_state_where_run(c2s[boost::get(boost::vertex_index, *CG, v)]);
-                  for(const auto state : running_states)
+                  const auto v2id_it = v2id.find(state);
+                  if(v2id_it == v2id.end())
                   {
-                     const auto v2id_it = v2id.find(state);
-                     if(v2id_it == v2id.end())
-                     {
-                        curr_id = max_id;
-                        v2id[state] = max_id;
-                        ++max_id;
-                     }
-                     else
-                     {
-                        curr_id = v2id_it->second;
-                     }
-                     module_clique->add_subpartitions(curr_id, c2s[boost::get(boost::vertex_index, *CG, v)]);
+                     curr_id = max_id;
+                     v2id[state] = max_id;
+                     ++max_id;
+                  }
+                  else
+                  {
+                     curr_id = v2id_it->second;
                   }
+                  module_clique->add_subpartitions(curr_id, c2s[boost::get(boost::vertex_index, *CG, v)]);
                }
             }
-            double local_mux_time =
-                (disabling_slack_based_binding ? -std::numeric_limits<double>::infinity() : mux_time);
-            const auto cond1 = compute_condition1(lib_name, allocation_information, local_mux_time, partition.first);
-            const auto cond2 = compute_condition2(cond1, fu_prec, resource_area, small_normalized_resource_area);
-
-            /// add the edges
-            cdfc_edge_iterator cg_ei, cg_ei_end;
-            const cdfc_graphConstRef CG_subgraph(new cdfc_graph(
-                *cdfc_bulk_graph, cdfc_graph_edge_selector<boost_cdfc_graph>(COMPATIBILITY_EDGE, &*cdfc_bulk_graph),
-                cdfc_graph_vertex_selector<boost_cdfc_graph>(&partition.second)));
-            for(boost::tie(cg_ei, cg_ei_end) = boost::edges(*CG_subgraph); cg_ei != cg_ei_end; ++cg_ei)
-            {
-               vertex src = c2s[boost::get(boost::vertex_index, *CG_subgraph, boost::source(*cg_ei, *CG_subgraph))];
-               vertex tgt = c2s[boost::get(boost::vertex_index, *CG_subgraph, boost::target(*cg_ei, *CG_subgraph))];
+         }
+         double local_mux_time =
+             (disabling_slack_based_binding ? -std::numeric_limits<double>::infinity() : mux_time);
+         const auto cond1 = compute_condition1(lib_name, allocation_information, local_mux_time, partition.first);
+         const auto cond2 = compute_condition2(cond1, fu_prec, resource_area, small_normalized_resource_area);
+
+         /// add the edges
+         cdfc_edge_iterator cg_ei, cg_ei_end;
+         const cdfc_graphConstRef CG_subgraph(new cdfc_graph(
+             *cdfc_bulk_graph, cdfc_graph_edge_selector<boost_cdfc_graph>(COMPATIBILITY_EDGE, &*cdfc_bulk_graph),
+             cdfc_graph_vertex_selector<boost_cdfc_graph>(&partition.second)));
+         for(boost::tie(cg_ei, cg_ei_end) = boost::edges(*CG_subgraph); cg_ei != cg_ei_end; ++cg_ei)
+         {
+            vertex src = c2s[boost::get(boost::vertex_index, *CG_subgraph, boost::source(*cg_ei, *CG_subgraph))];
+            vertex tgt = c2s[boost::get(boost::vertex_index, *CG_subgraph, boost::target(*cg_ei, *CG_subgraph))];
 #if HAVE_UNORDERED
-               if(src > tgt)
-               {
+            if(src > tgt)
+            {
 #else
-               if(GET_NAME(dfg, src) > GET_NAME(dfg, tgt))
-               {
+            if(GET_NAME(dfg, src) > GET_NAME(dfg, tgt))
+            {
 #endif
-                  continue; /// only one edge is needed to build the undirected compatibility graph
-               }
-               _w = weight_computation(cond1, cond2, src, tgt, local_mux_time, dfg, fu, slack_time, starting_time,
+               continue; /// only one edge is needed to build the undirected compatibility graph
+            }
+            const auto weight =
+                weight_computation(cond1, cond2, src, tgt, local_mux_time, dfg, fu, slack_time, starting_time,
 #ifdef HC_APPROACH
-                                       hc,
+                                   hc,
 #endif
-                                       con_rel, controller_delay, fu_prec);
-               if(_w > 0)
-               {
-                  module_clique->add_edge(src, tgt, _w);
-               }
-               else
-               {
-                  THROW_ASSERT(!disabling_slack_based_binding, "unexpected condition");
-               }
-            }
-            if(parameters->getOption<bool>(OPT_print_dot))
+                                   con_rel, controller_delay, fu_prec);
+            if(weight > 0)
             {
-               const auto output_directory =
-                   parameters->getOption<std::filesystem::path>(OPT_dot_directory) / functionName;
-               std::filesystem::create_directories(output_directory);
-               const auto file_name =
-                   output_directory / ("MB_" + allocation_information->get_string_name(partition.first) + ".dot");
-               module_clique->writeDot(file_name);
+               module_clique->add_edge(src, tgt, weight);
             }
-
-            if(allocation_information->get_number_fu(partition.first) != INFINITE_UINT)
+            else
             {
-               THROW_ASSERT(allocation_information->get_number_channels(partition.first) == 0 ||
-                                allocation_information->get_number_channels(partition.first) ==
-                                    allocation_information->get_number_fu(partition.first),
-                            "unexpected condition");
-               PRINT_DBG_MEX(
-                   DEBUG_LEVEL_VERBOSE, debug_level,
-                   "Defining resource constraints for  : " + allocation_information->get_string_name(partition.first) +
-                       " to " + STR(allocation_information->get_number_fu(partition.first)));
-               module_clique->suggest_min_resources(allocation_information->get_number_channels(partition.first));
-               if(allocation_information->get_number_channels(partition.first) > 0)
-               {
-                  module_clique->max_resources(allocation_information->get_number_channels(partition.first));
-               }
+               THROW_ASSERT(!disabling_slack_based_binding, "unexpected condition");
             }
+         }
+         if(parameters->getOption<bool>(OPT_print_dot))
+         {
+            const auto output_directory =
+                parameters->getOption<std::filesystem::path>(OPT_dot_directory) / functionName;
+            std::filesystem::create_directories(output_directory);
+            const auto file_name =
+                output_directory / ("MB_" + allocation_information->get_string_name(partition.first) + ".dot");
+            module_clique->writeDot(file_name);
+         }
 
-            /// Specify the minimum number of resources in case we have to use all the memory ports.
-            /// That is relevant for memories attached to the bus
-            /// Private memories should use the minimum number of ports to minimize the total area.
-            unsigned var = allocation_information->is_direct_access_memory_unit(partition.first) ?
-                               (allocation_information->is_memory_unit(partition.first) ?
-                                    allocation_information->get_memory_var(partition.first) :
-                                    allocation_information->get_proxy_memory_var(partition.first)) :
-                               0;
-            if(var && !HLSMgr->Rmem->is_private_memory(var))
+         if(allocation_information->get_number_fu(partition.first) != INFINITE_UINT)
+         {
+            THROW_ASSERT(allocation_information->get_number_channels(partition.first) == 0 ||
+                             allocation_information->get_number_channels(partition.first) ==
+                                 allocation_information->get_number_fu(partition.first),
+                         "unexpected condition");
+            PRINT_DBG_MEX(
+                DEBUG_LEVEL_VERBOSE, debug_level,
+                "Defining resource constraints for  : " + allocation_information->get_string_name(partition.first) +
+                    " to " + STR(allocation_information->get_number_fu(partition.first)));
+            module_clique->suggest_min_resources(allocation_information->get_number_channels(partition.first));
+            if(allocation_information->get_number_channels(partition.first) > 0)
             {
-               module_clique->min_resources(allocation_information->get_number_channels(partition.first));
+               module_clique->max_resources(allocation_information->get_number_channels(partition.first));
             }
+         }
 
-            INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                           "Starting clique covering on a graph with " + STR(partition.second.size()) +
-                               " vertices for " + allocation_information->get_string_name(partition.first));
+         /// Specify the minimum number of resources in case we have to use all the memory ports.
+         /// That is relevant for memories attached to the bus
+         /// Private memories should use the minimum number of ports to minimize the total area.
+         unsigned var = allocation_information->is_direct_access_memory_unit(partition.first) ?
+                            (allocation_information->is_memory_unit(partition.first) ?
+                                 allocation_information->get_memory_var(partition.first) :
+                                 allocation_information->get_proxy_memory_var(partition.first)) :
+                            0;
+         if(var && !HLSMgr->Rmem->is_private_memory(var))
+         {
+            module_clique->min_resources(allocation_information->get_number_channels(partition.first));
+         }
+
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                        "Starting clique covering on a graph with " + STR(partition.second.size()) +
+                            " vertices for " + allocation_information->get_string_name(partition.first));
 
-            /// performing clique covering
-            if(disabling_slack_based_binding)
+         /// performing clique covering
+         if(disabling_slack_based_binding)
+         {
+            PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Disabled slack based clique covering for: " + res_name);
             {
-               PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Disabled slack based clique covering for: " + res_name);
+               no_check_clique<vertex> cq;
+               module_clique->exec(no_filter_clique<vertex>(), cq);
+            }
+            INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
+                           "Number of cliques covering the graph: " + STR(module_clique->num_vertices()) + " for " +
+                               allocation_information->get_string_name(partition.first));
+            if(module_clique->num_vertices() == 0 ||
+               (allocation_information->get_number_channels(partition.first) >= 1 &&
+                module_clique->num_vertices() > allocation_information->get_number_channels(partition.first)))
+            {
+               if(disabling_slack_cond0)
                {
-                  no_check_clique<vertex> cq;
-                  module_clique->exec(no_filter_clique<vertex>(), cq);
+                  PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Restarting with WEIGHTED_COLORING: " + res_name);
                }
-               INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
-                              "Number of cliques covering the graph: " + STR(module_clique->num_vertices()) + " for " +
-                                  allocation_information->get_string_name(partition.first));
-               if(module_clique->num_vertices() == 0 ||
-                  (allocation_information->get_number_channels(partition.first) >= 1 &&
-                   module_clique->num_vertices() > allocation_information->get_number_channels(partition.first)))
+               else
                {
-                  if(disabling_slack_cond0)
-                  {
-                     PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Restarting with WEIGHTED_COLORING: " + res_name);
-                  }
-                  else
-                  {
-                     PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Restarting with BIPARTITE_MATCHING: " + res_name);
-                  }
-                  module_clique = clique_covering<vertex>::create_solver(
-                      (disabling_slack_cond0 ? CliqueCovering_Algorithm::WEIGHTED_COLORING :
-                                               CliqueCovering_Algorithm::BIPARTITE_MATCHING),
-                      static_cast<unsigned>(partition.second.size()));
-                  for(auto vert_it = partition.second.begin(); vert_it != vert_it_end; ++vert_it)
-                  {
-                     const auto el1_name =
-                         GET_NAME(sdg, c2s[boost::get(boost::vertex_index, *CG, *vert_it)]) + "(" +
-                         sdg->CGetOpNodeInfo(c2s[boost::get(boost::vertex_index, *CG, *vert_it)])->GetOperation() + ")";
-                     module_clique->add_vertex(c2s[boost::get(boost::vertex_index, *CG, *vert_it)], el1_name);
-                  }
+                  PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Restarting with BIPARTITE_MATCHING: " + res_name);
+               }
+               module_clique = clique_covering<vertex>::create_solver(
+                   (disabling_slack_cond0 ? CliqueCovering_Algorithm::WEIGHTED_COLORING :
+                                            CliqueCovering_Algorithm::BIPARTITE_MATCHING),
+                   static_cast<unsigned>(partition.second.size()));
+               for(auto vert_it = partition.second.begin(); vert_it != vert_it_end; ++vert_it)
+               {
+                  const auto el1_name =
+                      GET_NAME(sdg, c2s[boost::get(boost::vertex_index, *CG, *vert_it)]) + "(" +
+                      sdg->CGetOpNodeInfo(c2s[boost::get(boost::vertex_index, *CG, *vert_it)])->GetOperation() + ")";
+                  module_clique->add_vertex(c2s[boost::get(boost::vertex_index, *CG, *vert_it)], el1_name);
+               }
+               {
+                  CustomUnorderedMap<vertex, size_t> v2id;
+                  size_t max_id = 0, curr_id;
+                  for(const auto v : partition.second)
                   {
-                     CustomUnorderedMap<vertex, size_t> v2id;
-                     size_t max_id = 0, curr_id;
-                     for(const auto v : partition.second)
+                     const CustomOrderedSet<vertex>& running_states =
+                         HLS->Rliv->get_state_where_run(c2s[boost::get(boost::vertex_index, *CG, v)]);
+                     for(const auto state : running_states)
                      {
-                        const CustomOrderedSet<vertex>& running_states =
-                            HLS->Rliv->get_state_where_run(c2s[boost::get(boost::vertex_index, *CG, v)]);
-                        for(const auto state : running_states)
+                        const auto v2di_it = v2id.find(state);
+                        if(v2di_it == v2id.end())
                         {
-                           const auto v2di_it = v2id.find(state);
-                           if(v2di_it == v2id.end())
-                           {
-                              curr_id = max_id;
-                              v2id[state] = max_id;
-                              ++max_id;
-                           }
-                           else
-                           {
-                              curr_id = v2di_it->second;
-                           }
-                           module_clique->add_subpartitions(curr_id, c2s[boost::get(boost::vertex_index, *CG, v)]);
+                           curr_id = max_id;
+                           v2id[state] = max_id;
+                           ++max_id;
                         }
+                        else
+                        {
+                           curr_id = v2di_it->second;
+                        }
+                        module_clique->add_subpartitions(curr_id, c2s[boost::get(boost::vertex_index, *CG, v)]);
                      }
                   }
-                  const cdfc_graphConstRef CG_subgraph0(
-                      new cdfc_graph(*cdfc_bulk_graph,
-                                     cdfc_graph_edge_selector<boost_cdfc_graph>(COMPATIBILITY_EDGE, &*cdfc_bulk_graph),
-                                     cdfc_graph_vertex_selector<boost_cdfc_graph>(&partition.second)));
-                  for(boost::tie(cg_ei, cg_ei_end) = boost::edges(*CG_subgraph0); cg_ei != cg_ei_end; ++cg_ei)
-                  {
-                     const auto src =
-                         c2s[boost::get(boost::vertex_index, *CG_subgraph0, boost::source(*cg_ei, *CG_subgraph0))];
-                     const auto tgt =
-                         c2s[boost::get(boost::vertex_index, *CG_subgraph0, boost::target(*cg_ei, *CG_subgraph0))];
+               }
+               const cdfc_graphConstRef CG_subgraph0(
+                   new cdfc_graph(*cdfc_bulk_graph,
+                                  cdfc_graph_edge_selector<boost_cdfc_graph>(COMPATIBILITY_EDGE, &*cdfc_bulk_graph),
+                                  cdfc_graph_vertex_selector<boost_cdfc_graph>(&partition.second)));
+               for(boost::tie(cg_ei, cg_ei_end) = boost::edges(*CG_subgraph0); cg_ei != cg_ei_end; ++cg_ei)
+               {
+                  const auto src =
+                      c2s[boost::get(boost::vertex_index, *CG_subgraph0, boost::source(*cg_ei, *CG_subgraph0))];
+                  const auto tgt =
+                      c2s[boost::get(boost::vertex_index, *CG_subgraph0, boost::target(*cg_ei, *CG_subgraph0))];
 #if HAVE_UNORDERED
-                     if(src > tgt)
+                  if(src > tgt)
 #else
-                     if(GET_NAME(dfg, src) > GET_NAME(dfg, tgt))
+                  if(GET_NAME(dfg, src) > GET_NAME(dfg, tgt))
 #endif
-                     {
-                        continue; /// only one edge is needed to build the undirected compatibility graph
-                     }
-                     _w = weight_computation(cond1, cond2, src, tgt, local_mux_time, dfg, fu, slack_time, starting_time,
+                  {
+                     continue; /// only one edge is needed to build the undirected compatibility graph
+                  }
+                  const auto weight =
+                      weight_computation(cond1, cond2, src, tgt, local_mux_time, dfg, fu, slack_time, starting_time,
 #ifdef HC_APPROACH
-                                             hc,
+                                         hc,
 #endif
-                                             con_rel, controller_delay, fu_prec);
-                     if(_w > 0)
-                     {
-                        module_clique->add_edge(src, tgt, _w);
-                     }
-                     else
-                     {
-                        THROW_ERROR("unexpected condition");
-                     }
-                  }
-                  if(allocation_information->get_number_fu(partition.first) != INFINITE_UINT)
+                                         con_rel, controller_delay, fu_prec);
+                  if(weight > 0)
                   {
-                     THROW_ASSERT(allocation_information->get_number_channels(partition.first) == 0 ||
-                                      allocation_information->get_number_channels(partition.first) ==
-                                          allocation_information->get_number_fu(partition.first),
-                                  "unexpected condition");
-
-                     module_clique->suggest_min_resources(allocation_information->get_number_channels(partition.first));
-                     if(allocation_information->get_number_channels(partition.first) > 0)
-                     {
-                        module_clique->max_resources(allocation_information->get_number_channels(partition.first));
-                     }
+                     module_clique->add_edge(src, tgt, weight);
                   }
-
-                  /// Specify the minimum number of resources in case we have to use all the memory ports.
-                  /// That is relevant for memories attached to the bus
-                  /// Private memories should use the minimum number of ports to minimize the total area.
-                  if(var && !HLSMgr->Rmem->is_private_memory(var))
+                  else
                   {
-                     module_clique->min_resources(allocation_information->get_number_channels(partition.first));
+                     THROW_ERROR("unexpected condition");
                   }
+               }
+               if(allocation_information->get_number_fu(partition.first) != INFINITE_UINT)
+               {
+                  THROW_ASSERT(allocation_information->get_number_channels(partition.first) == 0 ||
+                                   allocation_information->get_number_channels(partition.first) ==
+                                       allocation_information->get_number_fu(partition.first),
+                               "unexpected condition");
+
+                  module_clique->suggest_min_resources(allocation_information->get_number_channels(partition.first));
+                  if(allocation_information->get_number_channels(partition.first) > 0)
                   {
-                     no_check_clique<vertex> cq;
-                     module_clique->exec(no_filter_clique<vertex>(), cq);
+                     module_clique->max_resources(allocation_information->get_number_channels(partition.first));
                   }
-                  if(allocation_information->get_number_fu(partition.first) != INFINITE_UINT)
+               }
+
+               /// Specify the minimum number of resources in case we have to use all the memory ports.
+               /// That is relevant for memories attached to the bus
+               /// Private memories should use the minimum number of ports to minimize the total area.
+               if(var && !HLSMgr->Rmem->is_private_memory(var))
+               {
+                  module_clique->min_resources(allocation_information->get_number_channels(partition.first));
+               }
+               {
+                  no_check_clique<vertex> cq;
+                  module_clique->exec(no_filter_clique<vertex>(), cq);
+               }
+               if(allocation_information->get_number_fu(partition.first) != INFINITE_UINT)
+               {
+                  THROW_ASSERT(allocation_information->get_number_channels(partition.first) == 0 ||
+                                   allocation_information->get_number_channels(partition.first) ==
+                                       allocation_information->get_number_fu(partition.first),
+                               "unexpected condition");
+                  if(allocation_information->get_number_channels(partition.first) > 0 &&
+                     module_clique->num_vertices() > allocation_information->get_number_channels(partition.first) &&
+                     !allocation_information->is_readonly_memory_unit(partition.first))
                   {
-                     THROW_ASSERT(allocation_information->get_number_channels(partition.first) == 0 ||
-                                      allocation_information->get_number_channels(partition.first) ==
-                                          allocation_information->get_number_fu(partition.first),
-                                  "unexpected condition");
-                     if(allocation_information->get_number_channels(partition.first) > 0 &&
-                        module_clique->num_vertices() > allocation_information->get_number_channels(partition.first) &&
-                        !allocation_information->is_readonly_memory_unit(partition.first))
-                     {
-                        THROW_ERROR("Something of wrong happen: no feasible solution exist for module binding: " +
-                                    res_name + "[" + STR(module_clique->num_vertices()) + "]");
-                     }
+                     THROW_ERROR("Something of wrong happen: no feasible solution exist for module binding: " +
+                                 res_name + "[" + STR(module_clique->num_vertices()) + "]");
                   }
                }
             }
-            else
+         }
+         else
+         {
+            const auto area_resource = allocation_information->get_area(partition.first) +
+                                       100 * allocation_information->get_DSPs(partition.first);
+            module_register_binding_spec mrbs;
+            module_binding_check<vertex> cq(fu_prec, area_resource, HLS, HLSMgr, slack_time, starting_time,
+                                            controller_delay, mrbs);
+            module_clique->exec(slack_based_filtering(slack_time, starting_time, controller_delay, fu_prec, HLS,
+                                                      HLSMgr, area_resource, con_rel),
+                                cq);
+         }
+         return partition_solution{module_clique, fu_prec, controller_delay, disabling_slack_based_binding};
+      };
+      std::vector<decltype(partitions)::const_pointer> ordered_partitions;
+      for(const auto& partition : partitions)
+      {
+         ordered_partitions.push_back(&partition);
+      }
+      const auto solve_in_advance = parameters->isOption(OPT_module_binding_jobs);
+      /// debug messages share the global indentation and would be interleaved
+      const auto jobs = solve_in_advance && debug_level < DEBUG_LEVEL_VERY_PEDANTIC &&
+                                parameters->getOption<int>(OPT_debug_level) < DEBUG_LEVEL_VERY_PEDANTIC ?
+                            parameters->getOption<size_t>(OPT_module_binding_jobs) :
+                            1;
+
+      for(unsigned int iteration = 0; iteration < number_of_iterations; ++iteration)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Running iteration " + STR(iteration));
+         if(iteration > 0)
+         {
+            if(iteration > 1 && total_resource_area == total_resource_area_prev && total_DSPs == total_DSPs_prev &&
+               total_area_muxes == total_area_muxes_prev)
+            {
+               break;
+            }
+            numModule = numModule_initial;
+            total_modules_allocated = total_modules_allocated_initial;
+            total_resource_area_prev = total_resource_area;
+            total_resource_area = total_resource_area_initial;
+            total_DSPs_prev = total_DSPs;
+            total_DSPs = total_DSPs_initial;
+            slack_time = slack_time_initial;
+            starting_time = starting_time_initial;
+            total_area_muxes_prev = total_area_muxes;
+            total_area_muxes = total_area_muxes_initial;
+
             {
-               const auto area_resource = allocation_information->get_area(partition.first) +
-                                          100 * allocation_information->get_DSPs(partition.first);
-               module_register_binding_spec mrbs;
-               module_binding_check<vertex> cq(fu_prec, area_resource, HLS, HLSMgr, slack_time, starting_time,
-                                               controller_delay, mrbs);
-               module_clique->exec(slack_based_filtering(slack_time, starting_time, controller_delay, fu_prec, HLS,
-                                                         HLSMgr, area_resource, con_rel),
-                                   cq);
+               DesignFlowStepRef regb;
+               // if(iteration%2)
+               if(parameters->getOption<HLSFlowStep_Type>(OPT_register_allocation_algorithm) ==
+                  HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING)
+               {
+                  regb = GetPointer<const HLSFlowStepFactory>(
+                             design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::HLS))
+                             ->CreateHLSFlowStep(
+                                 HLSFlowStep_Type::WEIGHTED_CLIQUE_REGISTER_BINDING, funId,
+                                 HLSFlowStepSpecializationConstRef(new WeightedCliqueRegisterBindingSpecialization(
+                                     parameters->getOption<CliqueCovering_Algorithm>(
+                                         OPT_weighted_clique_register_algorithm))));
+               }
+               else
+               {
+                  regb = GetPointer<const HLSFlowStepFactory>(
+                             design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::HLS))
+                             ->CreateHLSFlowStep(
+                                 parameters->getOption<HLSFlowStep_Type>(OPT_register_allocation_algorithm), funId);
+               }
+               regb->Initialize();
+               regb->Exec();
             }
+         }
+
+         if(output_level >= OUTPUT_LEVEL_VERBOSE)
+         {
+            START_TIME(clique_iteration_cputime);
+         }
+         /// when the problems are solved in advance, all of them are built on the state at the beginning of the
+         /// iteration; the solutions are then merged in the partition order, so the result does not depend on the jobs
+         std::vector<partition_solution> solutions;
+         if(solve_in_advance)
+         {
+            solutions.resize(ordered_partitions.size());
+            ParallelFor(ordered_partitions.size(), jobs,
+                        [&](size_t index) { solutions[index] = solve_partition(*ordered_partitions[index]); });
+         }
+         size_t partition_index = 0;
+         for(const auto& partition : partitions)
+         {
+            const auto solution = solve_in_advance ? solutions[partition_index++] : solve_partition(partition);
+            const auto& module_clique = solution.module_clique;
+            const auto fu_prec = solution.fu_prec;
+            const auto controller_delay = solution.controller_delay;
+            const auto disabling_slack_based_binding = solution.disabling_slack_based_binding;
             INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
                            "Number of cliques covering the graph: " + STR(module_clique->num_vertices()) + " for " +
                                allocation_information->get_string_name(partition.first));
@@ -91,7 +91,7 @@ class CDFCModuleBindingSpecialization : public HLSFlowStepSpecialization
    /**
     * Return the contribution to the signature of a step given by the specialization
     */
-   std::string GetSignature() const override;
+   unsigned int GetSignatureContext() const override;
 };
 
 /// Predicate functor object used to select the proper set of vertices
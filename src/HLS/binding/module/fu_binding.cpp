@@ -55,6 +55,7 @@
 #include "memory.hpp"
 #include "memory_allocation.hpp"
 #include "memory_cs.hpp"
+#include "memory_image.hpp"
 #include "memory_symbol.hpp"
 #include "omp_functions.hpp"
 #include "reg_binding.hpp"
@@ -2432,14 +2433,10 @@ void fu_binding::specialize_memory_unit(const HLS_managerRef HLSMgr, const hlsRe
    fu_module->SetParameter("READ_ONLY_MEMORY", HLSMgr->Rmem->is_read_only_variable(ar) ? "1" : "0");
 }
 
-void fu_binding::fill_array_ref_memory(std::ostream& init_file_a, std::ostream& init_file_b, unsigned int ar,
-                                       unsigned long long& vec_size, unsigned long long& elts_size, const memoryRef mem,
-                                       tree_managerConstRef TM, bool is_sds, unsigned long long bitsize_align)
+memory_image fu_binding::get_array_ref_image(unsigned int ar, unsigned long long& vec_size,
+                                             unsigned long long& elts_size, unsigned long long& element_align,
+                                             const memoryRef mem, tree_managerConstRef TM, bool is_sds)
 {
-   init_file_b.put(0);
-   const auto is_memory_splitted = init_file_b.good();
-   init_file_b.seekp(std::ios_base::beg);
-
    const auto ar_node = TM->CGetTreeReindex(ar);
    tree_nodeRef init_node;
    const auto vd = GetPointer<const var_decl>(GET_CONST_NODE(ar_node));
@@ -2452,7 +2449,7 @@ void fu_binding::fill_array_ref_memory(std::ostream& init_file_a, std::ostream&
       init_node = ar_node;
    }
    const auto array_type_node = tree_helper::CGetType(ar_node);
-   unsigned long long element_align = 0;
+   element_align = 0;
    if(tree_helper::IsArrayEquivType(array_type_node))
    {
       std::vector<unsigned long long> dims;
@@ -2486,254 +2483,112 @@ void fu_binding::fill_array_ref_memory(std::ostream& init_file_a, std::ostream&
       THROW_ERROR("Type not supported: " + GET_CONST_NODE(array_type_node)->get_kind_text());
    }
    THROW_ASSERT(elts_size && vec_size, "");
-   if(is_sds)
-   {
-      bitsize_align = elts_size;
-   }
-   else
+   if(!is_sds)
    {
       elts_size = get_aligned_bitsize(elts_size, 8ULL);
    }
 
-   const auto nbyte_on_memory = bitsize_align / 8;
-
+   memory_image image;
    if(init_node &&
       ((GetPointer<constructor>(GET_NODE(init_node)) &&
         GetPointerS<constructor>(GET_NODE(init_node))->list_of_idx_valu.size()) ||
        (GetPointer<string_cst>(GET_NODE(init_node)) && GetPointerS<string_cst>(GET_NODE(init_node))->strg.size()) ||
        (!GetPointer<constructor>(GET_NODE(init_node)) && !GetPointer<string_cst>(GET_NODE(init_node)))))
    {
-      std::vector<std::string> init_string;
-      write_init(TM, ar_node, init_node, init_string, mem, element_align);
-      if(is_sds && (element_align == 0 || elts_size == element_align))
-      {
-         THROW_ASSERT(!is_memory_splitted, "unexpected condition");
-         for(const auto& init_value : init_string)
-         {
-            THROW_ASSERT(elts_size, "unexpected condition");
-            if(elts_size != init_value.size() && (init_value.size() % elts_size == 0))
-            {
-               const auto n_elmts = init_value.size() / elts_size;
-               for(auto index = 0u; index < n_elmts; ++index)
-               {
-                  init_file_a << init_value.substr(init_value.size() - elts_size - index * elts_size, elts_size)
-                              << std::endl;
-               }
-            }
-            else
-            {
-               init_file_a << init_value << std::endl;
-            }
-         }
-      }
-      else
-      {
-         std::vector<std::string> eightbit_string;
-         std::string bits_offset = "";
-         for(unsigned int l = 0; l < init_string.size(); ++l)
-         {
-            if(init_string[l].size() < 8 && init_string.size() == 1)
-            {
-               std::string res = init_string[l];
-               while(res.size() < 8)
-               {
-                  res = "0" + res;
-               }
-               eightbit_string.push_back(res);
-            }
-            else
-            {
-               std::string local_binary_string;
-               size_t local_data_bitsize;
-               size_t data_bitsize = init_string[l].size();
-               if(bits_offset.size())
-               {
-                  if(static_cast<int>(data_bitsize) - 8 + static_cast<int>(bits_offset.size()) >= 0)
-                  {
-                     local_data_bitsize = data_bitsize - (8 - bits_offset.size());
-                     eightbit_string.push_back(
-                         init_string[l].substr(data_bitsize - (8 - bits_offset.size()), 8 - bits_offset.size()) +
-                         bits_offset);
-                     local_binary_string = init_string[l].substr(0, local_data_bitsize);
-                     bits_offset = "";
-                  }
-                  else
-                  {
-                     local_data_bitsize = 0;
-                     bits_offset = init_string[l] + bits_offset;
-                  }
-               }
-               else
-               {
-                  local_binary_string = init_string[l];
-                  local_data_bitsize = data_bitsize;
-               }
-               for(unsigned int base_index = 0; base_index < local_data_bitsize; base_index = base_index + 8)
-               {
-                  if((static_cast<int>(local_data_bitsize) - 8 - static_cast<int>(base_index)) >= 0)
-                  {
-                     eightbit_string.push_back(local_binary_string.substr(local_data_bitsize - 8 - base_index, 8));
-                  }
-                  else
-                  {
-                     bits_offset = local_binary_string.substr(0, local_data_bitsize - base_index);
-                  }
-               }
-            }
-         }
-         if(bits_offset.size())
-         {
-            std::string tail_padding;
-            for(auto tail_padding_ind = bits_offset.size(); tail_padding_ind < 8; ++tail_padding_ind)
-            {
-               tail_padding += "0";
-            }
-            tail_padding = tail_padding + bits_offset;
-            eightbit_string.push_back(tail_padding);
-         }
-         if(eightbit_string.size() % nbyte_on_memory != 0)
-         {
-            for(size_t l = eightbit_string.size() % nbyte_on_memory; l < nbyte_on_memory; ++l)
-            {
-               eightbit_string.push_back("00000000");
-            }
-         }
-         if(static_cast<size_t>(tree_helper::Size(array_type_node) / 8) > eightbit_string.size())
-         {
-            size_t tail_bytes = static_cast<size_t>(tree_helper::Size(array_type_node) / 8) - eightbit_string.size();
-            for(size_t l = 0; l < tail_bytes; ++l)
-            {
-               eightbit_string.push_back("00000000");
-            }
-         }
+      write_init(TM, ar_node, init_node, image, mem, element_align);
+   }
+   return image;
+}
 
-         std::string str_bit;
-         bool is_even = true;
-         unsigned int counter;
-         for(unsigned int l = 0; l < eightbit_string.size();)
-         {
-            str_bit = "";
-            for(counter = 0; counter < nbyte_on_memory && l < eightbit_string.size(); counter++, l++)
-            {
-               str_bit = eightbit_string[l] + str_bit;
-            }
-            if(is_even || !is_memory_splitted)
-            {
-               init_file_a << str_bit << std::endl;
-            }
-            else
-            {
-               init_file_b << str_bit << std::endl;
-            }
-            is_even = !is_even;
-         }
-         if(!is_even && is_memory_splitted)
-         {
-            bool need_newline_b = false;
-            for(unsigned int l = 0; l < (nbyte_on_memory * 8); ++l)
-            {
-               init_file_b << "0";
-               need_newline_b = true;
-            }
-            if(need_newline_b)
-            {
-               init_file_b << std::endl;
-            }
-         }
-      }
+void fu_binding::align_array_ref_image(memory_image& image, unsigned int ar, unsigned long long vec_size,
+                                       unsigned long long elts_size, tree_managerConstRef TM,
+                                       unsigned long long bitsize_align)
+{
+   if(image.empty())
+   {
+      image.append_zeros(vec_size * elts_size);
+      image.align(bitsize_align);
+      return;
    }
-   else
+   image.align(8);
+   image.align(bitsize_align);
+   const auto type_bitsize = tree_helper::Size(tree_helper::CGetType(TM->CGetTreeReindex(ar))) / 8 * 8;
+   if(type_bitsize > image.size())
+   {
+      image.append_zeros(type_bitsize - image.size());
+   }
+}
+
+void fu_binding::fill_array_ref_memory(std::ostream& init_file_a, std::ostream& init_file_b, unsigned int ar,
+                                       unsigned long long& vec_size, unsigned long long& elts_size, const memoryRef mem,
+                                       tree_managerConstRef TM, bool is_sds, unsigned long long bitsize_align)
+{
+   init_file_b.put(0);
+   const auto is_memory_splitted = init_file_b.good();
+   init_file_b.seekp(std::ios_base::beg);
+
+   unsigned long long element_align;
+   auto image = get_array_ref_image(ar, vec_size, elts_size, element_align, mem, TM, is_sds);
+   if(is_sds)
    {
-      if(is_sds)
+      bitsize_align = elts_size;
+   }
+
+   if(is_sds && (image.empty() || element_align == 0 || elts_size == element_align))
+   {
+      /// one memory word per element
+      THROW_ASSERT(!is_memory_splitted, "unexpected condition");
+      if(image.empty())
       {
-         THROW_ASSERT(!is_memory_splitted, "unexpected condition");
-         for(unsigned int i = 0; i < vec_size; ++i)
+         const std::string zero_word(elts_size, '0');
+         for(auto i = 0ULL; i < vec_size; ++i)
          {
-            for(unsigned int j = 0; j < elts_size; ++j)
-            {
-               init_file_a << "0";
-            }
-            init_file_a << std::endl;
+            init_file_a << zero_word << "\n";
          }
+         return;
       }
-      else
+      unsigned long long offset = 0;
+      for(const auto& run : image.get_elements())
       {
-         unsigned int counter = 0;
-         bool is_even = true;
-         bool need_newline_a = false;
-         bool need_newline_b = false;
-         for(unsigned int i = 0; i < vec_size; ++i)
+         for(auto i = 0ULL; i < run.count; ++i, offset += run.bitsize)
          {
-            for(unsigned int j = 0; j < elts_size; ++j)
+            if(elts_size != run.bitsize && (run.bitsize % elts_size == 0))
             {
-               if(is_even || !is_memory_splitted)
+               for(auto index = 0ULL; index < run.bitsize; index += elts_size)
                {
-                  init_file_a << "0";
-                  need_newline_a = true;
-               }
-               else
-               {
-                  init_file_b << "0";
-                  need_newline_b = true;
-               }
-               counter++;
-               if(counter % (nbyte_on_memory * 8) == 0)
-               {
-                  if(is_even || !is_memory_splitted)
-                  {
-                     init_file_a << std::endl;
-                     need_newline_a = false;
-                  }
-                  else
-                  {
-                     init_file_b << std::endl;
-                     need_newline_b = false;
-                  }
-                  is_even = !is_even;
-               }
-            }
-         }
-         if(counter % (nbyte_on_memory * 8) != 0)
-         {
-            for(auto l = counter % (nbyte_on_memory * 8); l < (nbyte_on_memory * 8); ++l)
-            {
-               if(is_even || !is_memory_splitted)
-               {
-                  init_file_a << "0";
-                  need_newline_a = true;
-               }
-               else
-               {
-                  init_file_b << "0";
-                  need_newline_b = true;
+                  image.write_bits(init_file_a, offset + index, elts_size);
+                  init_file_a << "\n";
                }
             }
-            is_even = !is_even;
-         }
-         if(!is_even && is_memory_splitted)
-         {
-            for(unsigned int l = 0; l < (nbyte_on_memory * 8); ++l)
+            else
             {
-               init_file_b << "0";
-               need_newline_b = true;
+               image.write_bits(init_file_a, offset, run.bitsize);
+               init_file_a << "\n";
             }
          }
-         if(need_newline_a)
-         {
-            init_file_a << std::endl;
-         }
-         if(need_newline_b)
-         {
-            init_file_b << std::endl;
-         }
       }
+      return;
+   }
+
+   /// memory words, least significant word first; odd words go to the second bank when the memory is split
+   align_array_ref_image(image, ar, vec_size, elts_size, TM, bitsize_align);
+   bool is_even = true;
+   for(auto offset = 0ULL; offset < image.size(); offset += bitsize_align)
+   {
+      auto& init_file = (is_even || !is_memory_splitted) ? init_file_a : init_file_b;
+      image.write_bits(init_file, offset, std::min(bitsize_align, image.size() - offset));
+      init_file << "\n";
+      is_even = !is_even;
+   }
+   if(!is_even && is_memory_splitted)
+   {
+      init_file_b << std::string(bitsize_align, '0') << "\n";
    }
 }
 
 void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_node, tree_nodeRef _init_node,
-                            std::vector<std::string>& init_file, const memoryRef mem, unsigned long long element_align)
+                            memory_image& init_file, const memoryRef mem, unsigned long long element_align)
 {
-   std::string trimmed_value;
    THROW_ASSERT(!var_node || var_node->get_kind() == tree_reindex_K, "");
    const auto init_node = GET_CONST_NODE(_init_node);
    switch(init_node->get_kind())
@@ -2742,25 +2597,18 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
       {
          auto precision = tree_helper::Size(tree_helper::CGetType(_init_node));
          const auto rc = GetPointerS<const real_cst>(init_node);
-         std::string C_value = rc->valr;
-         trimmed_value = convert_fp_to_string(C_value, precision);
-         init_file.push_back(trimmed_value);
+         init_file.append(convert_fp_to_string(rc->valr, precision));
          break;
       }
       case integer_cst_K:
       {
          const auto ull_value = tree_helper::GetConstValue(init_node);
-         trimmed_value = "";
          auto precision = std::max(8ull, tree_helper::Size(tree_helper::CGetType(_init_node)));
          if(element_align)
          {
             precision = std::min(precision, element_align);
          }
-         for(auto ind = 1U; ind <= precision; ind++)
-         {
-            trimmed_value.push_back(((integer_cst_t(1) << (precision - ind)) & ull_value) ? '1' : '0');
-         }
-         init_file.push_back(trimmed_value);
+         init_file.append(ull_value, precision);
          break;
       }
       case complex_cst_K:
@@ -2884,7 +2732,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
                   if(nbits)
                   {
                      /// add padding
-                     init_file.push_back(std::string(nbits, '0'));
+                     init_file.append_zeros(nbits);
                   }
                }
             }
@@ -2941,7 +2789,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
                   if(nbits)
                   {
                      /// add padding
-                     init_file.push_back(std::string(nbits, '0'));
+                     init_file.append_zeros(nbits);
                   }
                }
                else if(is_union)
@@ -2954,7 +2802,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
                   if(nbits)
                   {
                      /// add padding
-                     init_file.push_back(std::string(nbits, '0'));
+                     init_file.append_zeros(nbits);
                   }
                }
             }
@@ -2977,7 +2825,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
             }
             THROW_ASSERT(num_elements >= static_cast<unsigned long long>(co->list_of_idx_valu.size()), "");
             num_elements -= static_cast<unsigned long long>(co->list_of_idx_valu.size());
-            init_file.insert(init_file.end(), num_elements, std::string(size_of_data, '0'));
+            init_file.append_zeros(size_of_data, num_elements);
          }
          break;
       }
@@ -3021,16 +2869,10 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
          }
          for(const auto j : string_value)
          {
-            auto ull_value = static_cast<unsigned long int>(j);
-            trimmed_value = "";
-            for(auto ind = 0U; ind < elmt_bitsize; ++ind)
-            {
-               trimmed_value = trimmed_value + (((1LLU << (elmt_bitsize - ind - 1)) & ull_value) ? '1' : '0');
-            }
-            init_file.push_back(trimmed_value);
+            init_file.append(static_cast<unsigned char>(j), elmt_bitsize);
          }
          // String terminator
-         init_file.push_back(std::string(elmt_bitsize, '0'));
+         init_file.append_zeros(elmt_bitsize);
 
          const auto type_n = tree_helper::CGetType(var_node);
          THROW_ASSERT(GetPointer<const array_type>(GET_CONST_NODE(type_n)), "expected an array_type");
@@ -3047,7 +2889,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
                         STR(string_value.size() + 1) + "-" + STR(num_elements));
          }
          num_elements -= string_value.size() + 1;
-         init_file.insert(init_file.end(), num_elements, std::string(size_of_data, '0'));
+         init_file.append_zeros(size_of_data, num_elements);
          break;
       }
       case view_convert_expr_K:
@@ -3269,11 +3111,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
                THROW_ERROR("addr_expr pattern not supported: " + std::string(addr_expr_op->get_kind_text()) + " @" +
                            STR(addr_expr_op_idx));
          }
-         for(unsigned int ind = 0; ind < precision; ind++)
-         {
-            trimmed_value = trimmed_value + (((1LLU << (precision - ind - 1)) & ull_value) ? '1' : '0');
-         }
-         init_file.push_back(trimmed_value);
+         init_file.append(ull_value, precision);
 
          break;
       }
@@ -3282,7 +3120,7 @@ void fu_binding::write_init(const tree_managerConstRef TreeM, tree_nodeRef var_n
          const auto field_decl_size = tree_helper::Size(tree_helper::CGetType(_init_node));
          if(field_decl_size)
          {
-            init_file.push_back(std::string(field_decl_size, '0'));
+            init_file.append_zeros(field_decl_size);
          }
          break;
       }
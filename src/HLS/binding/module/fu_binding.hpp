@@ -60,6 +60,7 @@
  */
 //@{
 class funit_obj;
+class memory_image;
 class module;
 REF_FORWARD_DECL(AllocationInformation);
 REF_FORWARD_DECL(fu_binding);
@@ -391,9 +392,46 @@ class fu_binding
                                      unsigned long long& vec_size, unsigned long long& elts_size, const memoryRef mem,
                                      tree_managerConstRef TM, bool is_sds, unsigned long long bitsize_align);
 
+   /**
+    * compute the initialization image of the array ref
+    * @param ar is the array ref variable declaration
+    * @param vec_size is the number of the element of the array
+    * @param elts_size is the element size in bits
+    * @param element_align is the bitsize of the vector elements, zero if the variable is not a vector
+    * @param mem is the memory reference
+    * @param TM is the tree manager reference
+    * @param is_sds is true if SDS memory alignment is required
+    * @return the initialization image, empty if the variable is not initialized
+    */
+   static memory_image get_array_ref_image(unsigned int ar, unsigned long long& vec_size,
+                                           unsigned long long& elts_size, unsigned long long& element_align,
+                                           const memoryRef mem, tree_managerConstRef TM, bool is_sds);
+
+   /**
+    * pad the initialization image of the array ref to a whole number of memory words; an empty image is replaced by a
+    * zero-filled one
+    * @param image is the image computed by get_array_ref_image
+    * @param ar is the array ref variable declaration
+    * @param vec_size is the number of the element of the array
+    * @param elts_size is the element size in bits
+    * @param TM is the tree manager reference
+    * @param bitsize_align is the memory alignment bitsize
+    */
+   static void align_array_ref_image(memory_image& image, unsigned int ar, unsigned long long vec_size,
+                                     unsigned long long elts_size, tree_managerConstRef TM,
+                                     unsigned long long bitsize_align);
+
+   /**
+    * append the value of an initializer to a memory image
+    * @param TreeM is the tree manager reference
+    * @param var_node is the initialized variable or field
+    * @param init_node is the initializer
+    * @param init_file is the image the initializer is appended to
+    * @param mem is the memory reference
+    * @param element_precision is the bitsize of the vector elements or of the bit-field being initialized, if any
+    */
    static void write_init(const tree_managerConstRef TreeM, tree_nodeRef var_node, tree_nodeRef init_node,
-                          std::vector<std::string>& init_file, const memoryRef mem,
-                          unsigned long long element_precision);
+                          memory_image& init_file, const memoryRef mem, unsigned long long element_precision);
 };
 
 /**
@@ -63,6 +63,11 @@ fu_binding_creator::fu_binding_creator(const ParameterConstRef _Param, const HLS
 
 fu_binding_creator::~fu_binding_creator() = default;
 
+unsigned int fu_binding_creator::GetLocalFunction() const
+{
+   return funId;
+}
+
 void fu_binding_creator::Initialize()
 {
    HLSFunctionStep::Initialize();
@@ -82,5 +82,11 @@ class fu_binding_creator : public HLSFunctionStep
     * Initialize the step (i.e., like a constructor, but executed just before exec
     */
    void Initialize() override;
+
+   /**
+    * Return the function synthesized by this step, since only the data structures of that function are modified
+    * @return the index of the function
+    */
+   unsigned int GetLocalFunction() const override;
 };
 #endif
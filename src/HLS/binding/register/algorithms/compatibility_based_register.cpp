@@ -49,11 +49,6 @@
 #include "Parameter.hpp"
 #include "dbgPrintHelper.hpp"
 
-#if BOOST_VERSION >= 106400
-#include <boost/serialization/array_wrapper.hpp>
-#endif
-#include <boost/numeric/ublas/matrix.hpp>
-
 /// HLS/binding/storage_value_insertion includes
 #include "storage_value_information.hpp"
 
@@ -75,49 +70,23 @@ void compatibility_based_register::create_compatibility_graph()
    THROW_ASSERT(HLS->Rliv, "Liveness analysis not yet computed");
    const auto CG_num_vertices = HLS->storage_value_information->get_number_of_storage_values();
    CG = new compatibility_graph(CG_num_vertices);
-   boost::numeric::ublas::matrix<bool> conflict_map(CG_num_vertices, CG_num_vertices);
-
-   boost::numeric::ublas::noalias(conflict_map) =
-       boost::numeric::ublas::zero_matrix<bool>(CG_num_vertices, CG_num_vertices);
    for(auto vi = 0U; vi < CG_num_vertices; ++vi)
    {
       verts.push_back(boost::vertex(vi, *CG));
    }
 
    /// compatibility graph creation
-   const auto& support = HLS->Rliv->get_support();
-   for(const auto v : support)
+   for(const auto v : HLS->Rliv->get_support())
    {
-      const auto& live = HLS->Rliv->get_live_in(v);
-      register_lower_bound = std::max(static_cast<unsigned int>(live.size()), register_lower_bound);
-      const auto k_end = live.cend();
-      for(auto k = live.cbegin(); k != k_end; ++k)
-      {
-         auto k_inner = k;
-         ++k_inner;
-         while(k_inner != k_end)
-         {
-            const auto tail = HLS->storage_value_information->get_storage_value_index(v, *k);
-            THROW_ASSERT(tail < CG_num_vertices, "wrong compatibility graph index");
-            const auto head = HLS->storage_value_information->get_storage_value_index(v, *k_inner);
-            THROW_ASSERT(head < CG_num_vertices, "wrong compatibility graph index");
-            if(tail < head)
-            {
-               conflict_map(tail, head) = true;
-            }
-            else if(tail > head)
-            {
-               conflict_map(head, tail) = true;
-            }
-            ++k_inner;
-         }
-      }
+      register_lower_bound =
+          std::max(static_cast<unsigned int>(HLS->Rliv->get_live_in_size(v)), register_lower_bound);
    }
+   const auto interference = HLS->Rliv->compute_storage_value_interference(HLS->storage_value_information);
    for(auto vj = 1U; vj < CG_num_vertices; ++vj)
    {
       for(auto vi = 0U; vi < vj; ++vi)
       {
-         if(!conflict_map(vi, vj) && HLS->storage_value_information->are_value_bitsize_compatible(vi, vj))
+         if(!interference[vi].test(vj) && HLS->storage_value_information->are_value_bitsize_compatible(vi, vj))
          {
             boost::graph_traits<compatibility_graph>::edge_descriptor e1;
             const auto edge_weight = HLS->storage_value_information->get_compatibility_weight(vi, vj);
@@ -77,28 +77,19 @@ void conflict_based_register::create_conflict_graph()
        boost::iterator_property_map<cg_vertices_size_type*, cg_vertex_index_map, cg_vertices_size_type,
                                     cg_vertices_size_type&>(&color_vec.front(), boost::get(boost::vertex_index, *cg));
    /// conflict graph creation
-   const std::list<vertex>& support = HLS->Rliv->get_support();
-
-   const auto vEnd = support.end();
-   for(auto vIt = support.begin(); vIt != vEnd; ++vIt)
+   for(const auto v : HLS->Rliv->get_support())
+   {
+      register_lower_bound =
+          std::max(static_cast<unsigned int>(HLS->Rliv->get_live_in_size(v)), register_lower_bound);
+   }
+   const auto interference = HLS->Rliv->compute_storage_value_interference(HLS->storage_value_information);
+   for(unsigned int tail = 0; tail < cg_num_vertices; ++tail)
    {
-      const CustomOrderedSet<unsigned int>& live = HLS->Rliv->get_live_in(*vIt);
-      register_lower_bound = std::max(static_cast<unsigned int>(live.size()), register_lower_bound);
-      const CustomOrderedSet<unsigned int>::const_iterator k_end = live.end();
-      for(auto k = live.begin(); k != k_end; ++k)
+      const auto& conflicts = interference[tail];
+      for(auto head = conflicts.find_next(tail); head != boost::dynamic_bitset<>::npos;
+          head = conflicts.find_next(head))
       {
-         auto k_inner = k;
-         ++k_inner;
-         while(k_inner != k_end)
-         {
-            boost::graph_traits<conflict_graph>::edge_descriptor e1;
-            unsigned int tail = HLS->storage_value_information->get_storage_value_index(*vIt, *k);
-            THROW_ASSERT(tail < cg_num_vertices, "wrong conflict graph index");
-            unsigned int head = HLS->storage_value_information->get_storage_value_index(*vIt, *k_inner);
-            THROW_ASSERT(head < cg_num_vertices, "wrong conflict graph index");
-            boost::add_edge(boost::vertex(tail, *cg), boost::vertex(head, *cg), *cg);
-            ++k_inner;
-         }
+         boost::add_edge(boost::vertex(tail, *cg), boost::vertex(head, *cg), *cg);
       }
    }
    /// variables of different size are in conflict
@@ -106,9 +97,8 @@ void conflict_based_register::create_conflict_graph()
    {
       for(unsigned int vi = 0; vi < vj; ++vi)
       {
-         if(!HLS->storage_value_information->are_value_bitsize_compatible(vi, vj))
+         if(!interference[vi].test(vj) && !HLS->storage_value_information->are_value_bitsize_compatible(vi, vj))
          {
-            boost::graph_traits<conflict_graph>::edge_descriptor e1;
             boost::add_edge(boost::vertex(vi, *cg), boost::vertex(vj, *cg), *cg);
          }
       }
@@ -79,9 +79,9 @@ std::string WeightedCliqueRegisterBindingSpecialization::GetKindText() const
    return CliqueCovering_AlgorithmToString(clique_covering_algorithm);
 }
 
-std::string WeightedCliqueRegisterBindingSpecialization::GetSignature() const
+unsigned int WeightedCliqueRegisterBindingSpecialization::GetSignatureContext() const
 {
-   return STR(static_cast<unsigned int>(clique_covering_algorithm));
+   return static_cast<unsigned int>(clique_covering_algorithm);
 }
 
 weighted_clique_register::weighted_clique_register(
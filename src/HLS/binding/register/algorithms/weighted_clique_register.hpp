@@ -66,7 +66,7 @@ class WeightedCliqueRegisterBindingSpecialization : public HLSFlowStepSpecializa
    /**
     * Return the contribution to the signature of a step given by the specialization
     */
-   std::string GetSignature() const override;
+   unsigned int GetSignatureContext() const override;
 };
 
 class weighted_clique_register : public compatibility_based_register
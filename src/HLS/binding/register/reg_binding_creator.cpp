@@ -69,6 +69,11 @@ reg_binding_creator::reg_binding_creator(const ParameterConstRef _Param, const H
 {
 }
 
+unsigned int reg_binding_creator::GetLocalFunction() const
+{
+   return funId;
+}
+
 const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>>
 reg_binding_creator::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
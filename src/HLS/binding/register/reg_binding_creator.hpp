@@ -75,6 +75,12 @@ class reg_binding_creator : public HLSFunctionStep
        const HLSFlowStepSpecializationConstRef hls_flow_step_specialization = HLSFlowStepSpecializationConstRef());
 
    DesignFlowStep_Status InternalExec() final;
+
+   /**
+    * Return the function synthesized by this step, since only the data structures of that function are modified
+    * @return the index of the function
+    */
+   unsigned int GetLocalFunction() const override;
 };
 /// refcount definition of the class
 using reg_binding_creatorRef = refcount<reg_binding_creator>;
@@ -42,10 +42,14 @@
 #include "Parameter.hpp"
 #include "SimulationInformation.hpp"
 #include "SimulationTool.hpp"
+#include "call_graph_manager.hpp"
 #include "custom_set.hpp"
 #include "dbgPrintHelper.hpp" // for DEBUG_LEVEL_
 #include "hls_manager.hpp"
+#include "tree_helper.hpp"
+#include "tree_manager.hpp"
 #include "utility.hpp"
+#include <algorithm>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -90,6 +94,35 @@ SimulationEvaluation::ComputeHLSRelationships(const DesignFlowStep::Relationship
    return ret;
 }
 
+unsigned int SimulationEvaluation::ComputeSimulationShards() const
+{
+   if(!parameters->isOption(OPT_simulation_shards))
+   {
+      return 1U;
+   }
+   const auto shards = parameters->getOption<unsigned int>(OPT_simulation_shards);
+   const auto& test_vectors = HLSMgr->RSim->test_vectors;
+   const auto top_symbols = parameters->getOption<std::vector<std::string>>(OPT_top_functions_names);
+   /// traces must come from a single simulation, while a user testbench does not select the test vectors of a shard
+   const auto is_traced = (parameters->isOption(OPT_generate_vcd) && parameters->getOption<bool>(OPT_generate_vcd)) ||
+                          (parameters->isOption(OPT_discrepancy) && parameters->getOption<bool>(OPT_discrepancy)) ||
+                          (parameters->isOption(OPT_discrepancy_hw) && parameters->getOption<bool>(OPT_discrepancy_hw));
+   /// the profiling components append to a single file, which would be written by all the shards at once
+   const auto TM = HLSMgr->get_tree_manager();
+   const auto library_functions = HLSMgr->CGetCallGraphManager()->GetReachedLibraryFunctions();
+   const auto is_profiled =
+       std::any_of(library_functions.begin(), library_functions.end(), [&](unsigned int function_id) {
+          const auto function_name = tree_helper::GetFunctionName(TM, TM->CGetTreeNode(function_id));
+          return function_name == "__builtin_bambu_time_start" || function_name == "__builtin_bambu_time_stop";
+       });
+   if(shards <= 1 || is_traced || is_profiled || test_vectors.size() <= 1 || top_symbols.size() != 1 ||
+      top_symbols.front() == "main")
+   {
+      return 1U;
+   }
+   return static_cast<unsigned int>(std::min<size_t>(shards, test_vectors.size()));
+}
+
 DesignFlowStep_Status SimulationEvaluation::Exec()
 {
    THROW_ASSERT(!already_executed, "simulation cannot be executed multiple times!");
@@ -97,7 +130,7 @@ DesignFlowStep_Status SimulationEvaluation::Exec()
    HLSMgr->RSim->sim_tool->CheckExecution();
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Executing simulation");
    unsigned long long tot_cycles = 0, num_executions = 0;
-   HLSMgr->RSim->sim_tool->Simulate(tot_cycles, num_executions);
+   HLSMgr->RSim->sim_tool->Simulate(tot_cycles, num_executions, ComputeSimulationShards());
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Executed simulation");
    if(!parameters->isOption(OPT_no_clean) && !parameters->getOption<bool>(OPT_no_clean))
    {
@@ -62,6 +62,11 @@ class SimulationEvaluation : public EvaluationBaseStep
 
    bool already_executed;
 
+   /**
+    * Return the number of concurrent simulations the test vectors can be split into
+    */
+   unsigned int ComputeSimulationShards() const;
+
  public:
    /**
     * Constructor of the class
@@ -135,26 +135,21 @@
 
 HLSFlowStepFactory::HLSFlowStepFactory(const DesignFlowManagerConstRef _design_flow_manager,
                                        const HLS_managerRef _HLS_mgr, const ParameterConstRef _parameters)
-    : DesignFlowStepFactory(_design_flow_manager, _parameters), HLS_mgr(_HLS_mgr)
+    : DesignFlowStepFactory(DesignFlowStep::HLS, _design_flow_manager, _parameters), HLS_mgr(_HLS_mgr)
 {
    debug_level = parameters->get_class_debug_level(GET_CLASS(*this));
 }
 
 HLSFlowStepFactory::~HLSFlowStepFactory() = default;
 
-const std::string HLSFlowStepFactory::GetPrefix() const
-{
-   return "HLS";
-}
-
 DesignFlowStepRef
 HLSFlowStepFactory::CreateHLSFlowStep(const HLSFlowStep_Type type, const unsigned int funId,
                                       const HLSFlowStepSpecializationConstRef hls_flow_step_specialization) const
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                   "-->Creating step " +
-                      (funId ? HLSFunctionStep::ComputeSignature(type, hls_flow_step_specialization, funId) :
-                               HLS_step::ComputeSignature(type, hls_flow_step_specialization)) +
+                      STR(funId ? HLSFunctionStep::ComputeSignature(type, hls_flow_step_specialization, funId) :
+                                  HLS_step::ComputeSignature(type, hls_flow_step_specialization)) +
                       " (" + HLS_step::EnumToName(type) + ")");
    DesignFlowStepRef design_flow_step = DesignFlowStepRef();
    switch(type)
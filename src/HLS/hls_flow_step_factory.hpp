@@ -79,10 +79,6 @@ class HLSFlowStepFactory : public DesignFlowStepFactory
     */
    ~HLSFlowStepFactory() override;
 
-   /**
-    * Return the prefix of the steps created by the factory
-    */
-   const std::string GetPrefix() const override;
 
    /**
     * Create a scheduling design flow step
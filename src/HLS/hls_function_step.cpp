@@ -77,6 +77,13 @@ bool HLSFunctionStep::HasToBeExecuted() const
    {
       return false;
    }
+   /// the modules of a function restored from the HLS cache are already in the work library; its HLS data structures
+   /// and the bit values of its IR are still computed since the memory allocation relies on them
+   if(hls_flow_step_type != HLSFlowStep_Type::INITIALIZE_HLS &&
+      hls_flow_step_type != HLSFlowStep_Type::HLS_FUNCTION_BIT_VALUE && HLSMgr->IsFunctionRestored(funId))
+   {
+      return false;
+   }
    auto FB = HLSMgr->GetFunctionBehavior(funId);
    if(bb_version == 0 or bb_version != FB->GetBBVersion())
    {
@@ -115,16 +122,31 @@ void HLSFunctionStep::Initialize()
    HLS = HLSMgr->get_HLS(funId);
 }
 
-std::string HLSFunctionStep::GetSignature() const
+bool HLSFunctionStep::IsConcurrentWith(const DesignFlowStep& other) const
+{
+   if(!HLS_step::IsConcurrentWith(other))
+   {
+      return false;
+   }
+   /// a caller reads the data structures of its callees
+   const auto other_function = other.GetLocalFunction();
+   const auto call_graph_manager = HLSMgr->CGetCallGraphManager();
+   return !call_graph_manager->GetReachedFunctionsFrom(funId).count(other_function) and
+          !call_graph_manager->GetReachedFunctionsFrom(other_function).count(funId);
+}
+
+DesignFlowStep::signature_t HLSFunctionStep::GetSignature() const
 {
    return ComputeSignature(hls_flow_step_type, hls_flow_step_specialization, funId);
 }
 
-std::string HLSFunctionStep::ComputeSignature(const HLSFlowStep_Type hls_flow_step_type,
-                                              const HLSFlowStepSpecializationConstRef hls_flow_step_specialization,
-                                              const unsigned int function_id)
+DesignFlowStep::signature_t
+HLSFunctionStep::ComputeSignature(const HLSFlowStep_Type hls_flow_step_type,
+                                  const HLSFlowStepSpecializationConstRef hls_flow_step_specialization,
+                                  const unsigned int function_id)
 {
-   return HLS_step::ComputeSignature(hls_flow_step_type, hls_flow_step_specialization) + "::" + STR(function_id);
+   /// the specialization context of HLS_step lives above bit 32, so the function index can fill the lower part
+   return HLS_step::ComputeSignature(hls_flow_step_type, hls_flow_step_specialization) | function_id;
 }
 
 std::string HLSFunctionStep::GetName() const
@@ -109,11 +109,18 @@ class HLSFunctionStep : public HLS_step
     */
    void Initialize() override;
 
+   /**
+    * Check if this step can be executed concurrently with another function-local step
+    * @param other is the other step
+    * @return true if the two steps work on functions which do not call each other
+    */
+   bool IsConcurrentWith(const DesignFlowStep& other) const override;
+
    /**
     * Return a unified identifier of this design step
     * @return the signature of the design step
     */
-   std::string GetSignature() const final;
+   signature_t GetSignature() const final;
 
    /**
     * Compute the signature of a hls flow step
@@ -122,7 +129,7 @@ class HLSFunctionStep : public HLS_step
     * @param function_id is the index of the function
     * @return the corresponding signature
     */
-   static std::string ComputeSignature(const HLSFlowStep_Type hls_flow_step_type,
+   static signature_t ComputeSignature(const HLSFlowStep_Type hls_flow_step_type,
                                        const HLSFlowStepSpecializationConstRef hls_flow_step_specialization,
                                        const unsigned int function_id);
 
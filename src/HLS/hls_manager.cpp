@@ -44,18 +44,34 @@
 
 #include "BackendFlow.hpp"
 #include "Parameter.hpp"
+#include "Range.hpp"
+#include "area_info.hpp"
 #include "behavioral_helper.hpp"
 #include "call_graph_manager.hpp"
+#include "dbgPrintHelper.hpp"
+#include "exceptions.hpp"
 #include "ext_tree_node.hpp"
+#include "fileIO.hpp"
 #include "function_behavior.hpp"
+#include "gimple_writer.hpp"
 #include "hls.hpp"
 #include "hls_constraints.hpp"
 #include "hls_device.hpp"
+#include "library_manager.hpp"
 #include "memory.hpp"
 #include "op_graph.hpp"
 #include "polixml.hpp"
+#include "simple_indent.hpp"
+#include "string_manipulation.hpp"
+#include "structural_manager.hpp"
+#include "structural_objects.hpp"
+#include "technology_manager.hpp"
+#include "technology_node.hpp"
+#include "time_info.hpp"
+#include "tree_basic_block.hpp"
 #include "tree_helper.hpp"
 #include "tree_manager.hpp"
+#include "tree_node.hpp"
 #include "tree_reindex.hpp"
 #include "utility.hpp"
 #include "xml_dom_parser.hpp"
@@ -65,6 +81,16 @@
 #include "aadl_information.hpp"
 #include "functions.hpp"
 #endif
+#include <boost/algorithm/string/replace.hpp>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <list>
+#include <set>
+#include <sstream>
+
 #define MAX_BITWIDTH_SIZE 4096
 
 #if defined(__clang__)
@@ -322,6 +348,531 @@ unsigned int HLS_manager::UpdateMemVersion()
    return memory_version;
 }
 
+std::string HLS_manager::ComputeFingerprint(std::istream& is)
+{
+   unsigned long long digest = 0xcbf29ce484222325ULL;
+   char buffer[1 << 16];
+   while(is.read(buffer, sizeof(buffer)) || is.gcount())
+   {
+      for(std::streamsize i = 0; i < is.gcount(); ++i)
+      {
+         digest = (digest ^ static_cast<unsigned char>(buffer[i])) * 0x100000001b3ULL;
+      }
+   }
+   std::stringstream ss;
+   ss << std::hex << std::setw(16) << std::setfill('0') << digest;
+   return ss.str();
+}
+
+/**
+ * Replaces the numbers which follow prefix in text with their order of appearance, so that text does not depend on the
+ * numbering of the tree nodes and of the ssa versions in the rest of the translation unit
+ */
+static std::string RenumberIndices(const std::string& text, const std::string& prefix,
+                                   std::map<std::string, size_t>& local_indices)
+{
+   std::string renumbered;
+   renumbered.reserve(text.size());
+   size_t position = 0;
+   for(auto found = text.find(prefix); found != std::string::npos; found = text.find(prefix, position))
+   {
+      const auto begin = found + prefix.size();
+      auto end = begin;
+      while(end < text.size() && std::isdigit(static_cast<unsigned char>(text[end])))
+      {
+         ++end;
+      }
+      renumbered.append(text, position, begin - position);
+      if(end != begin)
+      {
+         renumbered += STR(local_indices.emplace(text.substr(begin, end - begin), local_indices.size()).first->second);
+      }
+      position = end;
+   }
+   renumbered.append(text, position, std::string::npos);
+   return renumbered;
+}
+
+std::string HLS_manager::GetFunctionFingerprint(unsigned int funId)
+{
+   const auto fp_it = function_fingerprints.find(funId);
+   if(fp_it != function_fingerprints.end())
+   {
+      return fp_it->second;
+   }
+   if(context_fingerprint.empty())
+   {
+      /// options which do not affect the generated modules, or whose content is already captured by the function body
+      static const std::set<std::string> ignored_options = {"cat_args",
+                                                            "debug_level",
+                                                            "frontend_cache",
+                                                            "frontend_jobs",
+                                                            "frontend_function_jobs",
+                                                            "hls_cache",
+                                                            "hls_jobs",
+                                                            "input_file",
+                                                            "output_level",
+                                                            "output_temporary_directory",
+                                                            "profile_steps",
+                                                            "simulation_shards",
+                                                            "technology_cache"};
+      std::stringstream options;
+      Param->print(options);
+      std::stringstream context;
+      context << "revision: " << Param->getOption<std::string>(OPT_revision) << "\n";
+      std::string line;
+      while(std::getline(options, line))
+      {
+         const auto separator = line.find(": ");
+         if(separator == std::string::npos || ignored_options.count(line.substr(0, separator)))
+         {
+            continue;
+         }
+         context << line << "\n";
+         /// options referring to files (e.g., device or constraints descriptions) are identified by their content
+         const auto value = line.substr(separator + 2);
+         std::error_code ec;
+         if(!value.empty() && std::filesystem::is_regular_file(value, ec))
+         {
+            std::ifstream file(value, std::ios::binary);
+            context << "content: " << ComputeFingerprint(file) << "\n";
+         }
+      }
+      simple_indent PP(STD_OPENING_CHAR, STD_CLOSING_CHAR, XML_TAB_SIZE);
+      /// the memory allocation fixes the addresses embedded in the datapath of every function
+      if(Rmem)
+      {
+         xml_document document;
+         Rmem->xwrite(document.create_root_node("memory"));
+         std::stringstream memory;
+         document.print(memory, true, &PP);
+         std::map<std::string, size_t> local_indices;
+         context << RenumberIndices(memory.str(), "@", local_indices);
+      }
+      /// the characterization of the resource libraries drives allocation, scheduling and binding; the libraries filled
+      /// by the synthesis of the functions are not part of the context
+      const auto TechM = HLS_D ? HLS_D->get_technology_manager() : technology_managerRef();
+      if(TechM)
+      {
+         CustomOrderedSet<std::string> libraries;
+         for(const auto& library : TechM->get_library_list())
+         {
+            if(library != WORK_LIBRARY && library != PROXY_LIBRARY)
+            {
+               libraries.insert(library);
+            }
+         }
+         if(!libraries.empty())
+         {
+            xml_document document;
+            TechM->xwrite(document.create_root_node("technology"), libraries);
+            document.print(context, true, &PP);
+         }
+      }
+      context_fingerprint = ComputeFingerprint(context);
+   }
+
+   /// unnamed variables are printed as internal_<index>, ssa names as <variable>_<version>[_[<original version>]]
+   std::stringstream body;
+   GimpleWriter gimple_writer(body, false);
+   const auto fnode = TM->get_tree_node_const(funId);
+   fnode->visit(&gimple_writer);
+   std::map<std::string, size_t> local_indices, local_versions;
+   std::stringstream function;
+   function << "context: " << context_fingerprint << "\n";
+   function << RenumberIndices(RenumberIndices(body.str(), "_", local_indices), "_[", local_versions);
+   /// the bit values and the ranges, which may come from the call sites, size the datapath but are not part of the body
+   const auto fd = GetPointerS<const function_decl>(fnode);
+   function << "return: " << fd->bit_values;
+   if(fd->range)
+   {
+      function << " " << *fd->range;
+   }
+   function << "\n";
+   for(const auto& arg : fd->list_of_args)
+   {
+      const auto pd = GetPointerS<const parm_decl>(GET_CONST_NODE(arg));
+      function << "parm:";
+      if(pd->range)
+      {
+         function << " " << *pd->range;
+      }
+      function << "\n";
+   }
+   std::map<unsigned int, const ssa_name*> ssa_names;
+   const auto add_ssa = [&](const tree_nodeRef& tn) {
+      const auto sn = GetPointer<const ssa_name>(GET_CONST_NODE(tn));
+      if(sn && !sn->virtual_flag)
+      {
+         ssa_names[sn->vers] = sn;
+      }
+   };
+   THROW_ASSERT(fd->body, "Function " + STR(funId) + " has no body");
+   for(const auto& block : GetPointerS<const statement_list>(GET_CONST_NODE(fd->body))->list_of_bloc)
+   {
+      for(const auto& phi : block.second->CGetPhiList())
+      {
+         add_ssa(GetPointerS<const gimple_phi>(GET_CONST_NODE(phi))->res);
+         for(const auto& use : tree_helper::ComputeSsaUses(phi))
+         {
+            add_ssa(use.first);
+         }
+      }
+      for(const auto& stmt : block.second->CGetStmtList())
+      {
+         const auto ga = GetPointer<const gimple_assign>(GET_CONST_NODE(stmt));
+         if(ga)
+         {
+            add_ssa(ga->op0);
+         }
+         for(const auto& use : tree_helper::ComputeSsaUses(stmt))
+         {
+            add_ssa(use.first);
+         }
+      }
+   }
+   /// the versions are renumbered as in the body, and the lines are sorted so that their order does not depend on the
+   /// original versions
+   std::set<std::string> ssa_values;
+   for(const auto& ssa : ssa_names)
+   {
+      std::stringstream ssa_value;
+      ssa_value << "ssa _" << ssa.first << ": " << ssa.second->bit_values;
+      if(ssa.second->range)
+      {
+         ssa_value << " " << *ssa.second->range;
+      }
+      ssa_values.insert(RenumberIndices(ssa_value.str(), "_", local_indices));
+   }
+   for(const auto& ssa_value : ssa_values)
+   {
+      function << ssa_value << "\n";
+   }
+   const auto FB = CGetFunctionBehavior(funId);
+   const auto op_graph = FB->CGetOpGraph(FunctionBehavior::CFG);
+   /// the names of the operations contain the node indices, so only their kinds are considered
+   std::multiset<std::string> operations;
+   VertexIterator v, v_end;
+   for(boost::tie(v, v_end) = boost::vertices(*op_graph); v != v_end; ++v)
+   {
+      operations.insert(GET_OPERATION(op_graph, *v));
+   }
+   for(const auto& operation : operations)
+   {
+      function << "operation: " << operation << "\n";
+   }
+   const auto func_arch =
+       module_arch ? module_arch->GetArchitecture(FB->CGetBehavioralHelper()->GetMangledFunctionName()) : nullptr;
+   if(func_arch)
+   {
+      for(const auto& attr : func_arch->attrs)
+      {
+         function << "attr " << attr.first << ": " << attr.second << "\n";
+      }
+      for(const auto& parm : func_arch->parms)
+      {
+         for(const auto& attr : parm.second)
+         {
+            function << "parm " << parm.first << " " << attr.first << ": " << attr.second << "\n";
+         }
+      }
+      for(const auto& iface : func_arch->ifaces)
+      {
+         for(const auto& attr : iface.second)
+         {
+            function << "iface " << iface.first << " " << attr.first << ": " << attr.second << "\n";
+         }
+      }
+   }
+   /// a change in a called function makes all its callers dirty
+   for(const auto callee : CGetCallGraphManager()->get_called_by(funId))
+   {
+      if(callee != funId && CGetCallGraphManager()->GetReachedBodyFunctions().count(callee))
+      {
+         function << "callee: " << GetFunctionFingerprint(callee) << "\n";
+      }
+   }
+   return function_fingerprints[funId] = ComputeFingerprint(function);
+}
+
+/**
+ * Collects the memory initialization files referred by a module and by its components
+ */
+static void CollectMemoryInitFiles(const structural_objectRef& obj, std::set<std::string>& files)
+{
+   for(const auto& parameter : obj->GetParameters())
+   {
+      if(parameter.first.find("MEMORY_INIT_file") == 0)
+      {
+         auto file_name = parameter.second;
+         boost::replace_all(file_name, "\"", "");
+         if(std::filesystem::is_regular_file(file_name))
+         {
+            files.insert(file_name);
+         }
+      }
+   }
+   const auto mod = GetPointer<const module>(obj);
+   if(mod)
+   {
+      for(unsigned int i = 0; i < mod->get_internal_objects_size(); ++i)
+      {
+         const auto internal_object = mod->get_internal_object(i);
+         if(internal_object->get_kind() == component_o_K || internal_object->get_kind() == channel_o_K)
+         {
+            CollectMemoryInitFiles(internal_object, files);
+         }
+      }
+   }
+}
+
+/**
+ * Renames the memory initialization files referred by a module and by its components
+ */
+static void RenameMemoryInitFiles(const structural_objectRef& obj, const std::map<std::string, std::string>& renamed)
+{
+   for(const auto& parameter : obj->GetParameters())
+   {
+      if(parameter.first.find("MEMORY_INIT_file") == 0)
+      {
+         auto file_name = parameter.second;
+         boost::replace_all(file_name, "\"", "");
+         const auto new_name = renamed.find(file_name);
+         if(new_name != renamed.end())
+         {
+            auto value = parameter.second;
+            boost::replace_all(value, file_name, new_name->second);
+            obj->SetParameter(parameter.first, value);
+         }
+      }
+   }
+   const auto mod = GetPointer<const module>(obj);
+   if(mod)
+   {
+      for(unsigned int i = 0; i < mod->get_internal_objects_size(); ++i)
+      {
+         const auto internal_object = mod->get_internal_object(i);
+         if(internal_object->get_kind() == component_o_K || internal_object->get_kind() == channel_o_K)
+         {
+            RenameMemoryInitFiles(internal_object, renamed);
+         }
+      }
+   }
+}
+
+/**
+ * Publishes a file into the HLS cache: the file is written to a private name and then renamed, so that concurrent runs
+ * sharing the same cache never observe a partially written entry
+ */
+static void PublishCacheFile(const std::filesystem::path& entry, const std::function<void(const std::string&)>& write)
+{
+   const auto staging = unique_path(entry.string() + "-%%%%-%%%%");
+   write(staging.string());
+   std::error_code ec;
+   std::filesystem::rename(staging, entry, ec);
+   if(ec)
+   {
+      std::filesystem::remove(staging, ec);
+   }
+}
+
+bool HLS_manager::IsFunctionCacheable(unsigned int funId) const
+{
+   /// context switch, discrepancy analysis and signal tracing read the HLS data structures of every function
+   return Param->isOption(OPT_hls_cache) && !hasToBeInterfaced(funId) && !Param->isOption(OPT_context_switch) &&
+          !(Param->isOption(OPT_discrepancy) && Param->getOption<bool>(OPT_discrepancy)) &&
+          !(Param->isOption(OPT_generate_vcd) && Param->getOption<bool>(OPT_generate_vcd));
+}
+
+bool HLS_manager::IsFunctionRestored(unsigned int funId)
+{
+   const auto restored = restored_functions.find(funId);
+   if(restored != restored_functions.end())
+   {
+      return restored->second;
+   }
+   /// the fingerprint covers the memory allocation, so the cache can be queried only once it has been computed
+   if(!Rmem || !IsFunctionCacheable(funId))
+   {
+      return false;
+   }
+   return restored_functions[funId] = RestoreFunction(funId);
+}
+
+bool HLS_manager::RestoreFunction(unsigned int funId)
+{
+   const auto output_level = Param->getOption<int>(OPT_output_level);
+   const auto HLS = get_HLS(funId);
+   THROW_ASSERT(HLS, "Missing HLS initialization for function " + STR(funId));
+   const auto cache_directory = Param->getOption<std::filesystem::path>(OPT_hls_cache);
+   const auto fingerprint = GetFunctionFingerprint(funId);
+   const auto entry = cache_directory / (fingerprint + ".xml");
+   if(!std::filesystem::is_regular_file(entry))
+   {
+      return false;
+   }
+
+   std::string module_name;
+   bool registered_inputs = false;
+   unsigned int call_sites_number = 0;
+   unsigned int logical_type = 0;
+   bool bounded = false;
+   double execution_time = 0.0;
+   unsigned int cycles = 0;
+   unsigned int initiation_time = 0;
+   double stage_period = 0.0;
+   std::list<std::string> files;
+   structural_managerRef CM;
+   /// the entry is fully loaded before touching the technology library, so that a damaged entry is just a miss
+   try
+   {
+      XMLDomParser parser(entry.string());
+      parser.Exec();
+      if(!parser)
+      {
+         return false;
+      }
+      const auto root = parser.get_document()->get_root_node();
+      LOAD_XVFM(module_name, root, module);
+      LOAD_XVM(registered_inputs, root);
+      LOAD_XVM(call_sites_number, root);
+      LOAD_XVM(logical_type, root);
+      LOAD_XVM(bounded, root);
+      LOAD_XVM(execution_time, root);
+      LOAD_XVM(cycles, root);
+      LOAD_XVM(initiation_time, root);
+      LOAD_XVM(stage_period, root);
+      for(const auto& child : root->get_children())
+      {
+         const auto EnodeC = GetPointer<const xml_element>(child);
+         if(!EnodeC)
+         {
+            continue;
+         }
+         if(EnodeC->get_name() == "file")
+         {
+            std::string name;
+            LOAD_XVM(name, EnodeC);
+            if(!std::filesystem::is_regular_file(cache_directory / (fingerprint + "_" + name)))
+            {
+               return false;
+            }
+            files.push_back(name);
+         }
+         else if(EnodeC->get_name() == "circuit")
+         {
+            CM = structural_managerRef(new structural_manager(Param));
+            CM->set_top_info(module_name, structural_type_descriptorRef(new structural_type_descriptor(module_name)));
+            for(const auto& circuit_child : EnodeC->get_children())
+            {
+               const auto EnodeCC = GetPointer<const xml_element>(circuit_child);
+               if(EnodeCC && EnodeCC->get_name() == GET_CLASS_NAME(component_o))
+               {
+                  CM->get_circ()->xload(EnodeCC, CM->get_circ(), CM);
+               }
+            }
+         }
+      }
+   }
+   catch(...)
+   {
+      THROW_WARNING("Damaged HLS cache entry " + entry.string());
+      return false;
+   }
+   if(!CM)
+   {
+      return false;
+   }
+
+   /// the names of the memory initialization files contain the node indices of the run which stored the entry, so they
+   /// are restored under the name used in the cache to avoid clashes with the files written by the other functions
+   std::map<std::string, std::string> renamed_files;
+   for(const auto& file : files)
+   {
+      const auto restored_file = fingerprint + "_" + file;
+      std::filesystem::copy_file(cache_directory / restored_file, restored_file,
+                                 std::filesystem::copy_options::overwrite_existing);
+      renamed_files[file] = restored_file;
+   }
+   RenameMemoryInitFiles(CM->get_circ(), renamed_files);
+
+   /// the module is added to the work library exactly as add_library does after the synthesis of the function
+   const auto TechM = HLS_D->get_technology_manager();
+   for(const auto& proxy_name : {WRAPPED_PROXY_PREFIX + module_name, PROXY_PREFIX + module_name})
+   {
+      if(TechM->get_fu(proxy_name, PROXY_LIBRARY))
+      {
+         TechM->get_library_manager(PROXY_LIBRARY)->remove_fu(proxy_name);
+      }
+   }
+   TechM->add_resource(WORK_LIBRARY, module_name, CM);
+   const auto fu = GetPointerS<functional_unit>(TechM->get_fu(module_name, WORK_LIBRARY));
+   fu->set_clock_period(HLS->HLS_C->get_clock_period());
+   fu->set_clock_period_resource_fraction(HLS->HLS_C->get_clock_period_resource_fraction());
+   fu->logical_type = static_cast<functional_unit::type_t>(logical_type);
+   const auto function_name = CGetFunctionBehavior(funId)->CGetBehavioralHelper()->get_function_name();
+   TechM->add_operation(WORK_LIBRARY, module_name, function_name);
+   const auto op = GetPointerS<operation>(fu->get_operation(function_name));
+   op->primary_inputs_registered = registered_inputs;
+   op->bounded = bounded;
+   op->time_m = time_info::factory(Param);
+   op->time_m->set_execution_time(execution_time, cycles);
+   op->time_m->set_initiation_time(ControlStep(initiation_time));
+   op->time_m->set_stage_period(stage_period);
+   op->time_m->set_synthesis_dependent(true);
+   fu->area_m = area_info::factory(Param);
+   fu->area_m->set_area_value(2000); /// fake number to avoid sharing of functions
+
+   HLS->top = CM;
+   HLS->registered_inputs = registered_inputs;
+   HLS->call_sites_number = call_sites_number;
+   INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "---Function " + function_name + " restored from HLS cache");
+   return true;
+}
+
+void HLS_manager::StoreFunction(unsigned int funId)
+{
+   THROW_ASSERT(IsFunctionCacheable(funId), "Function " + STR(funId) + " cannot be cached");
+   const auto HLS = get_HLS(funId);
+   THROW_ASSERT(HLS && HLS->top, "Top has not been set");
+   const auto TechM = HLS_D->get_technology_manager();
+   const auto& module_name = HLS->top->get_circ()->get_typeRef()->id_type;
+   const auto fu = GetPointer<functional_unit>(TechM->get_fu(module_name, WORK_LIBRARY));
+   THROW_ASSERT(fu, "Module " + module_name + " is not in " + WORK_LIBRARY);
+   const auto function_name = CGetFunctionBehavior(funId)->CGetBehavioralHelper()->get_function_name();
+   const auto op = GetPointer<operation>(fu->get_operation(function_name));
+   THROW_ASSERT(op && op->time_m, "Operation " + function_name + " has not been characterized");
+
+   const auto cache_directory = Param->getOption<std::filesystem::path>(OPT_hls_cache);
+   const auto fingerprint = GetFunctionFingerprint(funId);
+   std::filesystem::create_directories(cache_directory);
+   xml_document document;
+   const auto root = document.create_root_node("hls_cache_entry");
+   WRITE_XNVM2("module", module_name, root);
+   WRITE_XNVM2("registered_inputs", STR(HLS->registered_inputs), root);
+   WRITE_XNVM2("call_sites_number", STR(HLS->call_sites_number), root);
+   WRITE_XNVM2("logical_type", STR(static_cast<unsigned int>(fu->logical_type)), root);
+   WRITE_XNVM2("bounded", STR(op->bounded), root);
+   WRITE_XNVM2("execution_time", STR(op->time_m->get_execution_time()), root);
+   WRITE_XNVM2("cycles", STR(op->time_m->get_cycles()), root);
+   WRITE_XNVM2("initiation_time", STR(from_strongtype_cast<unsigned int>(op->time_m->get_initiation_time())), root);
+   WRITE_XNVM2("stage_period", STR(op->time_m->get_stage_period()), root);
+   /// the memory initialization files are written by the binding of the function, so they are stored next to the entry
+   std::set<std::string> files;
+   CollectMemoryInitFiles(HLS->top->get_circ(), files);
+   for(const auto& file : files)
+   {
+      PublishCacheFile(cache_directory / (fingerprint + "_" + file), [&](const std::string& staging) {
+         std::filesystem::copy_file(file, staging, std::filesystem::copy_options::overwrite_existing);
+      });
+      WRITE_XNVM2("name", file, root->add_child_element("file"));
+   }
+   HLS->top->xwrite(root, technology_nodeRef());
+   /// the entry is published last, so that its presence implies the presence of the files it refers to
+   PublishCacheFile(cache_directory / (fingerprint + ".xml"),
+             [&](const std::string& staging) { document.write_to_file_formatted(staging); });
+}
+
 void HLS_manager::check_bitwidth(unsigned long long prec)
 {
    if(prec > MAX_BITWIDTH_SIZE)
@@ -50,6 +50,7 @@
 
 #include <boost/preprocessor/seq/for_each.hpp>
 
+#include <iosfwd>
 #include <map>
 #include <string>
 
@@ -170,6 +171,22 @@ class HLS_manager : public application_manager
    /// The version of memory representation on which this step was applied
    unsigned int memory_version;
 
+   /// map between the function id and its fingerprint
+   std::map<unsigned int, std::string> function_fingerprints;
+
+   /// the fingerprint of the synthesis context shared by all the functions
+   std::string context_fingerprint;
+
+   /// map between the function id and whether its synthesis results have been restored from the HLS cache
+   std::map<unsigned int, bool> restored_functions;
+
+   /**
+    * Restores the synthesis results of a function from the HLS cache entry corresponding to its fingerprint
+    * @param funId is the function identifier
+    * @return true if the entry exists and has been restored
+    */
+   bool RestoreFunction(unsigned int funId);
+
  public:
    /// base address for memory space addressing
    unsigned long long int base_address;
@@ -273,6 +290,49 @@ class HLS_manager : public application_manager
     */
    CustomOrderedSet<hlsRef> GetAllImplementations() const;
 
+   /**
+    * Returns the fingerprint of the synthesized implementation of a function.
+    * The fingerprint covers the body of the function together with the bit values and the ranges of its variables, its
+    * architecture attributes, the fingerprints of the called functions, the memory allocation, the technology libraries
+    * and the options which affect the synthesis, so that two runs producing the same fingerprint generate the same
+    * modules for the function. Tree node indices are renumbered by order of appearance, so that the fingerprint does
+    * not depend on the rest of the translation unit.
+    * @param funId is the function identifier
+    * @return the fingerprint as an hexadecimal string
+    */
+   std::string GetFunctionFingerprint(unsigned int funId);
+
+   /**
+    * Computes the fingerprint of the content of a stream
+    * @param is is the stream
+    * @return the FNV-1a hash of the content as an hexadecimal string
+    */
+   static std::string ComputeFingerprint(std::istream& is);
+
+   /**
+    * Checks if the synthesis results of a function can be stored into and restored from the HLS cache.
+    * Interfaced functions are excluded since their HLS data structures are used by the interface and backend steps.
+    * @param funId is the function identifier
+    * @return true if the HLS cache is enabled and the function is not interfaced
+    */
+   bool IsFunctionCacheable(unsigned int funId) const;
+
+   /**
+    * Checks if the synthesis results of a function have been restored from the HLS cache.
+    * The cache is queried the first time the function is checked after the memory allocation, and the HLS steps of a
+    * restored function are not executed.
+    * @param funId is the function identifier
+    * @return true if the function has been restored
+    */
+   bool IsFunctionRestored(unsigned int funId);
+
+   /**
+    * Stores the synthesis results of a function into the HLS cache: the module added to the work library, its timing
+    * characterization, and the memory initialization files it refers to
+    * @param funId is the function identifier
+    */
+   void StoreFunction(unsigned int funId);
+
    /**
     * Return if single write memory is exploited
     */
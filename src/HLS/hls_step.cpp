@@ -108,16 +108,21 @@ HLS_step::~HLS_step() = default;
 
 CustomUnorderedMap<std::string, HLSFlowStep_Type> HLS_step::command_line_name_to_enum;
 
-std::string HLS_step::GetSignature() const
+DesignFlowStep::signature_t HLS_step::GetSignature() const
 {
    return ComputeSignature(hls_flow_step_type, hls_flow_step_specialization);
 }
 
-const std::string HLS_step::ComputeSignature(const HLSFlowStep_Type hls_flow_step_type,
-                                             const HLSFlowStepSpecializationConstRef hls_flow_step_specialization)
+DesignFlowStep::signature_t
+HLS_step::ComputeSignature(const HLSFlowStep_Type hls_flow_step_type,
+                           const HLSFlowStepSpecializationConstRef hls_flow_step_specialization)
 {
-   return "HLS::" + EnumToName(hls_flow_step_type) +
-          (hls_flow_step_specialization ? "::" + hls_flow_step_specialization->GetSignature() : "");
+   /// zero is reserved to steps without specialization
+   const unsigned long long specialization_context =
+       hls_flow_step_specialization ? 1ULL + hls_flow_step_specialization->GetSignatureContext() : 0ULL;
+   THROW_ASSERT(specialization_context < 256, "Specialization context too large: " + STR(specialization_context));
+   return DesignFlowStep::ComputeSignature(HLS, static_cast<unsigned short>(hls_flow_step_type),
+                                           specialization_context << 32);
 }
 
 std::string HLS_step::GetName() const
@@ -326,7 +331,7 @@ void HLS_step::ComputeRelationships(DesignFlowStepSet& design_flow_step_set,
          case HLSFlowStep_Relationship::ALL_FUNCTIONS:
          {
             const auto frontend_flow_step_factory = GetPointer<const FrontendFlowStepFactory>(
-                design_flow_manager.lock()->CGetDesignFlowStepFactory("Frontend"));
+                design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::FRONTEND));
             const auto call_graph_computation_step = design_flow_manager.lock()->GetDesignFlowStep(
                 ApplicationFrontendFlowStep::ComputeSignature(COMPLETE_CALL_GRAPH));
             const auto cg_design_flow_step =
@@ -361,7 +366,7 @@ void HLS_step::ComputeRelationships(DesignFlowStepSet& design_flow_step_set,
          case HLSFlowStep_Relationship::TOP_FUNCTION:
          {
             const auto* frontend_flow_step_factory = GetPointer<const FrontendFlowStepFactory>(
-                design_flow_manager.lock()->CGetDesignFlowStepFactory("Frontend"));
+                design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::FRONTEND));
             const vertex call_graph_computation_step = design_flow_manager.lock()->GetDesignFlowStep(
                 ApplicationFrontendFlowStep::ComputeSignature(COMPLETE_CALL_GRAPH));
             const DesignFlowStepRef cg_design_flow_step =
@@ -406,5 +411,5 @@ void HLS_step::ComputeRelationships(DesignFlowStepSet& design_flow_step_set,
 
 DesignFlowStepFactoryConstRef HLS_step::CGetDesignFlowStepFactory() const
 {
-   return design_flow_manager.lock()->CGetDesignFlowStepFactory("HLS");
+   return design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::HLS);
 }
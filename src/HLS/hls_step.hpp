@@ -87,7 +87,7 @@ class HLSFlowStepSpecialization
    /**
     * Return the contribution to the signature of a step given by the specialization
     */
-   virtual std::string GetSignature() const = 0;
+   virtual unsigned int GetSignatureContext() const = 0;
 };
 /// const refcount definition of the class
 using HLSFlowStepSpecializationConstRef = refcount<const HLSFlowStepSpecialization>;
@@ -239,7 +239,7 @@ class HLS_step : public DesignFlowStep
     * Return a unified identifier of this design step
     * @return the signature of the design step
     */
-   std::string GetSignature() const override;
+   signature_t GetSignature() const override;
 
    /**
     * Return the name of this design step
@@ -278,8 +278,8 @@ class HLS_step : public DesignFlowStep
     * @param hls_flow_step_specialization is how the step has to be specialized
     * @return the corresponding signature
     */
-   static const std::string ComputeSignature(const HLSFlowStep_Type hls_flow_step_type,
-                                             const HLSFlowStepSpecializationConstRef hls_flow_step_specialization);
+   static signature_t ComputeSignature(const HLSFlowStep_Type hls_flow_step_type,
+                                       const HLSFlowStepSpecializationConstRef hls_flow_step_specialization);
 };
 /// refcount definition of the class
 using HLS_stepRef = refcount<HLS_step>;
@@ -55,6 +55,7 @@
 #include "hls_manager.hpp"
 #include "memory.hpp"
 #include "memory_allocation.hpp"
+#include "memory_image.hpp"
 #include "memory_symbol.hpp"
 #include "string_manipulation.hpp"
 #include "structural_manager.hpp"
@@ -475,10 +476,6 @@ void minimal_interface::build_wrapper(structural_objectRef wrappedObj, structura
             const auto& mem_vars = HLSMgr->Rmem->get_ext_memory_variables();
             auto nbyte_on_memory = (bram_bitsize / 8);
 
-            std::string init_v;
-            std::string current_bits;
-            unsigned int counter = 0;
-            bool is_even = true;
             std::list<std::pair<unsigned int, memory_symbolRef>> mem_variables;
             for(const auto& mem_var : mem_vars)
             {
@@ -486,69 +483,21 @@ void minimal_interface::build_wrapper(structural_objectRef wrappedObj, structura
             }
             mem_variables.sort(compareMemVarsPair);
 
+            memory_image shared_image;
             std::list<std::pair<unsigned int, memory_symbolRef>>::const_iterator m_next;
             for(auto m = mem_variables.begin(); m != mem_variables.end(); ++m)
             {
-               const auto splitted =
+               const auto var_image =
                    TestbenchGeneration::print_var_init(HLSMgr->get_tree_manager(), m->first, HLSMgr->Rmem);
-               unsigned int byte_allocated = 0;
+               THROW_ASSERT(var_image.size() % 8 == 0, "variable initializer is not byte aligned");
+               const auto byte_allocated = var_image.size() / 8;
                unsigned long long int actual_byte =
                    tree_helper::Size(HLSMgr->get_tree_manager()->CGetTreeReindex(m->first)) / 8;
-               std::vector<std::string> eightbit_string;
-               for(const auto& i : splitted)
-               {
-                  current_bits = i;
-                  for(unsigned int base_index = 0; base_index < current_bits.size();
-                      base_index = base_index + 8, ++byte_allocated)
-                  {
-                     eightbit_string.push_back(current_bits.substr(current_bits.size() - 8 - base_index, 8));
-                  }
-               }
-               std::string str_bit;
-               str_bit = "";
-               for(unsigned int l = 0; l < eightbit_string.size();)
-               {
-                  do
-                  {
-                     str_bit = eightbit_string[l] + str_bit;
-                     ++counter;
-                     ++l;
-                     if(counter % nbyte_on_memory == 0)
-                     {
-                        if(is_even || !is_memory_splitted)
-                        {
-                           init_file_a << str_bit << std::endl;
-                        }
-                        else
-                        {
-                           init_file_b << str_bit << std::endl;
-                        }
-                        str_bit = "";
-                        is_even = !is_even;
-                     }
-                  } while(l < eightbit_string.size());
-               }
+               shared_image.append(var_image);
                /// data padding
                if(actual_byte > byte_allocated)
                {
-                  for(unsigned int base_index = 0; base_index < actual_byte - byte_allocated; ++base_index)
-                  {
-                     str_bit = "00000000" + str_bit;
-                     counter++;
-                     if(counter % nbyte_on_memory == 0)
-                     {
-                        if(is_even || !is_memory_splitted)
-                        {
-                           init_file_a << str_bit << std::endl;
-                        }
-                        else
-                        {
-                           init_file_b << str_bit << std::endl;
-                        }
-                        str_bit = "";
-                        is_even = !is_even;
-                     }
-                  }
+                  shared_image.append_zeros(8, actual_byte - byte_allocated);
                }
                /// alignment padding
                m_next = m;
@@ -567,26 +516,19 @@ void minimal_interface::build_wrapper(structural_objectRef wrappedObj, structura
                THROW_ASSERT(object_offset >= actual_byte, "more allocated memory than expected");
                if(object_offset > actual_byte)
                {
-                  for(unsigned long long int base_index = 0; base_index < object_offset - actual_byte; ++base_index)
-                  {
-                     str_bit = "00000000" + str_bit;
-                     counter++;
-                     if(counter % nbyte_on_memory == 0)
-                     {
-                        if(is_even || !is_memory_splitted)
-                        {
-                           init_file_a << str_bit << std::endl;
-                        }
-                        else
-                        {
-                           init_file_b << str_bit << std::endl;
-                        }
-                        str_bit = "";
-                        is_even = !is_even;
-                     }
-                  }
+                  shared_image.append_zeros(8, object_offset - actual_byte);
                }
             }
+            /// only complete memory words are initialized
+            const auto word_bitsize = nbyte_on_memory * 8;
+            bool is_even = true;
+            for(auto offset = 0ULL; offset + word_bitsize <= shared_image.size(); offset += word_bitsize)
+            {
+               auto& init_file = (is_even || !is_memory_splitted) ? init_file_a : init_file_b;
+               shared_image.write_bits(init_file, offset, word_bitsize);
+               init_file << "\n";
+               is_even = !is_even;
+            }
 
             structural_objectRef clock_port, reset_port;
             structural_objectRef port_ck = shared_memory->find_member(CLOCK_PORT_NAME, port_o_K, shared_memory);
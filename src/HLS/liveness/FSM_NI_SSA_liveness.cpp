@@ -316,8 +316,8 @@ DesignFlowStep_Status FSM_NI_SSA_liveness::InternalExec()
                                  "---updating live out of : " + state_info->name + ", " + cloned_state_info->name);
                   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                                  "---adding live out of : " + target_state_info->name);
-                  HLS->Rliv->set_live_out(rosl, HLS->Rliv->get_live_out(target_state));
-                  HLS->Rliv->set_live_out(state_info->clonedState, HLS->Rliv->get_live_out(target_state));
+                  HLS->Rliv->set_live_out_from_live_out(rosl, target_state);
+                  HLS->Rliv->set_live_out_from_live_out(state_info->clonedState, target_state);
                   update_liveout_with_prev(HLSMgr, HLS, stg, data, state_info->clonedState, target_state);
                   update_liveout_with_prev(HLSMgr, HLS, stg, data, rosl, target_state);
                   found = true;
@@ -378,7 +378,7 @@ DesignFlowStep_Status FSM_NI_SSA_liveness::InternalExec()
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                         "---adding live out of " + stg->CGetStateInfo(prev_state)->name + " to live out of state " +
                             state_info->name);
-         HLS->Rliv->set_live_out(rosl, HLS->Rliv->get_live_out(prev_state));
+         HLS->Rliv->set_live_out_from_live_out(rosl, prev_state);
          update_liveout_with_prev(HLSMgr, HLS, stg, data, rosl, prev_state);
       }
       prev_state = rosl;
@@ -429,7 +429,7 @@ DesignFlowStep_Status FSM_NI_SSA_liveness::InternalExec()
             unsigned int target_bb_index = *target_state_info->BB_ids.begin();
             if(bb_index == target_bb_index && !target_state_info->is_duplicated)
             {
-               HLS->Rliv->set_live_in(target_state, HLS->Rliv->get_live_out(osl));
+               HLS->Rliv->set_live_in_from_live_out(target_state, osl);
                state_to_skip.insert(target_state);
             }
          }
@@ -451,7 +451,7 @@ DesignFlowStep_Status FSM_NI_SSA_liveness::InternalExec()
       }
       else
       {
-         HLS->Rliv->set_live_in(osl, HLS->Rliv->get_live_out(prev_state));
+         HLS->Rliv->set_live_in_from_live_out(osl, prev_state);
       }
       prev_state = osl;
       prev_bb_index = bb_index;
@@ -466,8 +466,8 @@ DesignFlowStep_Status FSM_NI_SSA_liveness::InternalExec()
       BOOST_FOREACH(EdgeDescriptor e, boost::in_edges(ds, *astg))
       {
          vertex src_state = boost::source(e, *astg);
-         HLS->Rliv->set_live_out(ds, HLS->Rliv->get_live_out(src_state));
-         HLS->Rliv->set_live_in(ds, HLS->Rliv->get_live_out(src_state));
+         HLS->Rliv->set_live_out_from_live_out(ds, src_state);
+         HLS->Rliv->set_live_in_from_live_out(ds, src_state);
          /// add all the uses of ds to src_state
          for(const auto& eo : state_info->executing_operations)
          {
@@ -531,7 +531,7 @@ DesignFlowStep_Status FSM_NI_SSA_liveness::InternalExec()
                   if(state_info->moved_op_def_set.find(tree_var) != state_info->moved_op_def_set.end() or
                      state_info->moved_op_use_set.find(written_phi) != state_info->moved_op_use_set.end())
                   {
-                     HLS->Rliv->set_live_out(rosl, HLS->Rliv->get_live_out(stg->CGetStateInfo(rosl)->clonedState));
+                     HLS->Rliv->set_live_out_from_live_out(rosl, stg->CGetStateInfo(rosl)->clonedState);
 
                      if(state_info->moved_op_use_set.find(written_phi) != state_info->moved_op_use_set.end())
                      {
@@ -663,7 +663,7 @@ DesignFlowStep_Status FSM_NI_SSA_liveness::InternalExec()
                BOOST_FOREACH(EdgeDescriptor e, boost::out_edges(rosl, *stg))
                {
                   vertex tgt_state = boost::target(e, *stg);
-                  if(HLS->Rliv->get_live_in(tgt_state).find(scalar_def) != HLS->Rliv->get_live_in(tgt_state).end())
+                  if(HLS->Rliv->is_live_in(tgt_state, scalar_def))
                   {
                      HLS->Rliv->add_state_out_for_var(scalar_def, eoc, rosl, tgt_state);
                   }
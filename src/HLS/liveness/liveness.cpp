@@ -66,6 +66,8 @@
 
 #include "state_transition_graph.hpp"
 #include "state_transition_graph_manager.hpp"
+#include "storage_value_information.hpp"
+#include "string_manipulation.hpp"
 
 liveness::liveness(const HLS_managerRef _HLSMgr, const ParameterConstRef _Param)
     : TreeM(_HLSMgr->get_tree_manager()), Param(_Param), null_vertex_string("NULL_VERTEX"), HLSMgr(_HLSMgr)
@@ -85,70 +87,261 @@ bool liveness::is_defined(unsigned int var) const
    return false;
 }
 
+size_t liveness::get_var_index(unsigned int var)
+{
+   const auto it = var_index.find(var);
+   if(it != var_index.end())
+   {
+      return it->second;
+   }
+   const auto index = index_var.size();
+   var_index.emplace(var, index);
+   index_var.push_back(var);
+   return index;
+}
+
+size_t liveness::get_state_row(const vertex& v)
+{
+   const auto it = state_row.find(v);
+   if(it != state_row.end())
+   {
+      return it->second;
+   }
+   const auto row = live_in.size();
+   state_row.emplace(v, row);
+   live_in.emplace_back();
+   live_out.emplace_back();
+   return row;
+}
+
+void liveness::merge_live(std::vector<boost::dynamic_bitset<>>& rows,
+                          CustomUnorderedMapStable<vertex, CustomOrderedSet<unsigned int>>& sets, const vertex& v,
+                          const boost::dynamic_bitset<>& vars)
+{
+   auto& live = rows[get_state_row(v)];
+   if(live.size() < index_var.size())
+   {
+      live.resize(index_var.size());
+   }
+   if(vars.size() == live.size())
+   {
+      live |= vars;
+   }
+   else
+   {
+      auto extended = vars;
+      extended.resize(live.size());
+      live |= extended;
+   }
+   const auto set = sets.find(v);
+   if(set != sets.end())
+   {
+      for(auto i = vars.find_first(); i != boost::dynamic_bitset<>::npos; i = vars.find_next(i))
+      {
+         set->second.insert(index_var[i]);
+      }
+   }
+}
+
+const CustomOrderedSet<unsigned int>&
+liveness::get_live(const std::vector<boost::dynamic_bitset<>>& rows,
+                   CustomUnorderedMapStable<vertex, CustomOrderedSet<unsigned int>>& sets, const vertex& v) const
+{
+   const auto set = sets.find(v);
+   if(set != sets.end())
+   {
+      return set->second;
+   }
+   const auto row = state_row.find(v);
+   if(row == state_row.end())
+   {
+      return empty_set;
+   }
+   auto& live = sets[v];
+   const auto& bits = rows[row->second];
+   for(auto i = bits.find_first(); i != boost::dynamic_bitset<>::npos; i = bits.find_next(i))
+   {
+      live.insert(index_var[i]);
+   }
+   return live;
+}
+
 void liveness::set_live_in(const vertex& v, unsigned int var)
 {
-   live_in[v].insert(var);
+   const auto index = get_var_index(var);
+   auto& live = live_in[get_state_row(v)];
+   if(live.size() <= index)
+   {
+      live.resize(index_var.size());
+   }
+   live.set(index);
+   const auto set = live_in_sets.find(v);
+   if(set != live_in_sets.end())
+   {
+      set->second.insert(var);
+   }
 }
 
 void liveness::set_live_in(const vertex& v, const CustomOrderedSet<unsigned int>& live_set)
 {
-   live_in[v].insert(live_set.begin(), live_set.end());
+   set_live_in(v, live_set.begin(), live_set.end());
 }
 
 void liveness::set_live_in(const vertex& v, const CustomOrderedSet<unsigned int>::const_iterator first,
                            const CustomOrderedSet<unsigned int>::const_iterator last)
 {
-   live_in[v].insert(first, last);
+   for(auto it = first; it != last; ++it)
+   {
+      set_live_in(v, *it);
+   }
 }
 
-void liveness::erase_el_live_in(const vertex& v, unsigned int var)
+void liveness::set_live_in_from_live_out(const vertex& v, const vertex& source)
 {
-   live_in[v].erase(var);
+   const auto row = state_row.find(source);
+   if(row != state_row.end())
+   {
+      /// copy the source row since merge_live may reallocate the live matrices
+      const auto vars = live_out[row->second];
+      merge_live(live_in, live_in_sets, v, vars);
+   }
 }
 
-const CustomOrderedSet<unsigned int>& liveness::get_live_in(const vertex& v) const
+void liveness::erase_el_live_in(const vertex& v, unsigned int var)
 {
-   if(live_in.find(v) != live_in.end())
+   const auto index = var_index.find(var);
+   const auto row = state_row.find(v);
+   if(index != var_index.end() && row != state_row.end() && index->second < live_in[row->second].size())
    {
-      return live_in.find(v)->second;
+      live_in[row->second].reset(index->second);
    }
-   else
+   const auto set = live_in_sets.find(v);
+   if(set != live_in_sets.end())
    {
-      return empty_set;
+      set->second.erase(var);
    }
 }
 
+const CustomOrderedSet<unsigned int>& liveness::get_live_in(const vertex& v) const
+{
+   return get_live(live_in, live_in_sets, v);
+}
+
+bool liveness::is_live_in(const vertex& v, unsigned int var) const
+{
+   const auto index = var_index.find(var);
+   const auto row = state_row.find(v);
+   return index != var_index.end() && row != state_row.end() && index->second < live_in[row->second].size() &&
+          live_in[row->second].test(index->second);
+}
+
+size_t liveness::get_live_in_size(const vertex& v) const
+{
+   const auto row = state_row.find(v);
+   return row != state_row.end() ? live_in[row->second].count() : 0;
+}
+
 void liveness::set_live_out(const vertex& v, unsigned int var)
 {
-   live_out[v].insert(var);
+   const auto index = get_var_index(var);
+   auto& live = live_out[get_state_row(v)];
+   if(live.size() <= index)
+   {
+      live.resize(index_var.size());
+   }
+   live.set(index);
+   const auto set = live_out_sets.find(v);
+   if(set != live_out_sets.end())
+   {
+      set->second.insert(var);
+   }
 }
 
 void liveness::set_live_out(const vertex& v, const CustomOrderedSet<unsigned int>& vars)
 {
-   live_out[v].insert(vars.begin(), vars.end());
+   set_live_out(v, vars.begin(), vars.end());
 }
 
 void liveness::set_live_out(const vertex& v, const CustomOrderedSet<unsigned int>::const_iterator first,
                             const CustomOrderedSet<unsigned int>::const_iterator last)
 {
-   live_out[v].insert(first, last);
+   for(auto it = first; it != last; ++it)
+   {
+      set_live_out(v, *it);
+   }
+}
+
+void liveness::set_live_out_from_live_out(const vertex& v, const vertex& source)
+{
+   const auto row = state_row.find(source);
+   if(row != state_row.end() && source != v)
+   {
+      /// copy the source row since merge_live may reallocate the live matrices
+      const auto vars = live_out[row->second];
+      merge_live(live_out, live_out_sets, v, vars);
+   }
 }
 
 void liveness::erase_el_live_out(const vertex& v, unsigned int var)
 {
-   live_out[v].erase(var);
+   const auto index = var_index.find(var);
+   const auto row = state_row.find(v);
+   if(index != var_index.end() && row != state_row.end() && index->second < live_out[row->second].size())
+   {
+      live_out[row->second].reset(index->second);
+   }
+   const auto set = live_out_sets.find(v);
+   if(set != live_out_sets.end())
+   {
+      set->second.erase(var);
+   }
 }
 
 const CustomOrderedSet<unsigned int>& liveness::get_live_out(const vertex& v) const
 {
-   if(live_out.find(v) != live_out.end())
+   return get_live(live_out, live_out_sets, v);
+}
+
+bool liveness::is_live_out(const vertex& v, unsigned int var) const
+{
+   const auto index = var_index.find(var);
+   const auto row = state_row.find(v);
+   return index != var_index.end() && row != state_row.end() && index->second < live_out[row->second].size() &&
+          live_out[row->second].test(index->second);
+}
+
+std::vector<boost::dynamic_bitset<>>
+liveness::compute_storage_value_interference(const StorageValueInformationRef& svi) const
+{
+   const auto sv_number = svi->get_number_of_storage_values();
+   std::vector<boost::dynamic_bitset<>> interference(sv_number, boost::dynamic_bitset<>(sv_number));
+   boost::dynamic_bitset<> live_svs(sv_number);
+   for(const auto& v : support_set)
    {
-      return live_out.find(v)->second;
+      const auto row = state_row.find(v);
+      if(row == state_row.end())
+      {
+         continue;
+      }
+      const auto& live = live_in[row->second];
+      live_svs.reset();
+      for(auto i = live.find_first(); i != boost::dynamic_bitset<>::npos; i = live.find_next(i))
+      {
+         const auto sv = svi->get_storage_value_index(v, index_var[i]);
+         THROW_ASSERT(sv < sv_number, "wrong storage value index");
+         live_svs.set(sv);
+      }
+      /// every storage value live in v interferes with all the others live in v
+      for(auto sv = live_svs.find_first(); sv != boost::dynamic_bitset<>::npos; sv = live_svs.find_next(sv))
+      {
+         interference[sv] |= live_svs;
+      }
    }
-   else
+   for(size_t sv = 0; sv < sv_number; ++sv)
    {
-      return empty_set;
+      interference[sv].reset(sv);
    }
+   return interference;
 }
 
 vertex liveness::get_op_where_defined(unsigned int var) const
@@ -165,71 +358,37 @@ bool liveness::has_op_where_defined(unsigned int var) const
 
 const CustomOrderedSet<vertex>& liveness::get_state_in(vertex state, vertex op, unsigned int var) const
 {
-   THROW_ASSERT(state_in_definitions.find(state) != state_in_definitions.end(), "state never used " + get_name(state));
-   THROW_ASSERT(state_in_definitions.find(state)->second.find(op) != state_in_definitions.find(state)->second.end(),
-                "op never used in state " + get_name(state));
-   THROW_ASSERT(state_in_definitions.find(state)->second.find(op)->second.find(var) !=
-                    state_in_definitions.find(state)->second.find(op)->second.end(),
-                "var never used in the given state. Var: " + std::to_string(var));
-   return state_in_definitions.find(state)->second.find(op)->second.find(var)->second;
+   const auto it = state_in_definitions.find(std::make_tuple(state, op, var));
+   THROW_ASSERT(it != state_in_definitions.end(), "var never used in state " + get_name(state) + ". Var: " + STR(var));
+   return it->second;
 }
 
 bool liveness::has_state_in(vertex state, vertex op, unsigned int var) const
 {
-   if(state_in_definitions.find(state) == state_in_definitions.end())
-   {
-      return false;
-   }
-   if(state_in_definitions.find(state)->second.find(op) == state_in_definitions.find(state)->second.end())
-   {
-      return false;
-   }
-   if(state_in_definitions.find(state)->second.find(op)->second.find(var) ==
-      state_in_definitions.find(state)->second.find(op)->second.end())
-   {
-      return false;
-   }
-   return true;
+   return state_in_definitions.find(std::make_tuple(state, op, var)) != state_in_definitions.end();
 }
 
 void liveness::add_state_in_for_var(unsigned int var, vertex op, vertex state, vertex state_in)
 {
-   state_in_definitions[state][op][var].insert(state_in);
+   state_in_definitions[std::make_tuple(state, op, var)].insert(state_in);
 }
 
 const CustomOrderedSet<vertex>& liveness::get_state_out(vertex state, vertex op, unsigned int var) const
 {
-   THROW_ASSERT(state_out_definitions.find(state) != state_out_definitions.end(),
-                "state never used " + get_name(state));
-   THROW_ASSERT(state_out_definitions.find(state)->second.find(op) != state_out_definitions.find(state)->second.end(),
-                "op never used in state " + get_name(state));
-   THROW_ASSERT(state_out_definitions.find(state)->second.find(op)->second.find(var) !=
-                    state_out_definitions.find(state)->second.find(op)->second.end(),
-                "var never used in the given state. Var: " + std::to_string(var));
-   return state_out_definitions.find(state)->second.find(op)->second.find(var)->second;
+   const auto it = state_out_definitions.find(std::make_tuple(state, op, var));
+   THROW_ASSERT(it != state_out_definitions.end(),
+                "var never defined in state " + get_name(state) + ". Var: " + STR(var));
+   return it->second;
 }
 
 bool liveness::has_state_out(vertex state, vertex op, unsigned int var) const
 {
-   if(state_out_definitions.find(state) == state_out_definitions.end())
-   {
-      return false;
-   }
-   if(state_out_definitions.find(state)->second.find(op) == state_out_definitions.find(state)->second.end())
-   {
-      return false;
-   }
-   if(state_out_definitions.find(state)->second.find(op)->second.find(var) ==
-      state_out_definitions.find(state)->second.find(op)->second.end())
-   {
-      return false;
-   }
-   return true;
+   return state_out_definitions.find(std::make_tuple(state, op, var)) != state_out_definitions.end();
 }
 
 void liveness::add_state_out_for_var(unsigned int var, vertex op, vertex state, vertex state_in)
 {
-   state_out_definitions[state][op][var].insert(state_in);
+   state_out_definitions[std::make_tuple(state, op, var)].insert(state_in);
 }
 
 const CustomOrderedSet<vertex>& liveness::get_state_where_end(vertex op) const
@@ -51,6 +51,10 @@
 /// STD include
 #include <list>
 #include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/dynamic_bitset.hpp>
 
 #include "custom_map.hpp"
 #include "custom_set.hpp"
@@ -67,6 +71,7 @@ REF_FORWARD_DECL(HLS_manager);
 CONSTREF_FORWARD_DECL(Parameter);
 CONSTREF_FORWARD_DECL(BBGraph);
 REF_FORWARD_DECL(tree_manager);
+REF_FORWARD_DECL(StorageValueInformation);
 //@}
 
 class liveness
@@ -78,11 +83,26 @@ class liveness
    /// class containing all the parameters
    const ParameterConstRef Param;
 
-   /// This is the map from each vertex to the set of variables live at the input of vertex.
-   std::map<vertex, CustomOrderedSet<unsigned int>> live_in;
+   /// The dense index associated with each variable stored in a live set
+   CustomUnorderedMap<unsigned int, size_t> var_index;
+
+   /// The variable associated with each dense index
+   std::vector<unsigned int> index_var;
+
+   /// The row of the live matrices associated with each vertex
+   CustomUnorderedMap<vertex, size_t> state_row;
+
+   /// For each row, the bit vector (indexed by dense variable index) of the variables live at the input of vertex
+   std::vector<boost::dynamic_bitset<>> live_in;
+
+   /// For each row, the bit vector (indexed by dense variable index) of the variables live at the output of vertex
+   std::vector<boost::dynamic_bitset<>> live_out;
+
+   /// Ordered view of the live in sets, built on demand by get_live_in and kept up to date afterwards
+   mutable CustomUnorderedMapStable<vertex, CustomOrderedSet<unsigned int>> live_in_sets;
 
-   /// This is the map from each vertex to the set of variables live at the output of vertex.
-   std::map<vertex, CustomOrderedSet<unsigned int>> live_out;
+   /// Ordered view of the live out sets, built on demand by get_live_out and kept up to date afterwards
+   mutable CustomUnorderedMapStable<vertex, CustomOrderedSet<unsigned int>> live_out_sets;
 
    /// null vertex string
    const std::string null_vertex_string;
@@ -102,11 +122,11 @@ class liveness
    /// store where an operation run and need its input
    std::map<vertex, CustomOrderedSet<vertex>> running_operations;
 
-   /// store where a variable comes from given a support state and an operation
-   std::map<vertex, std::map<vertex, std::map<unsigned int, CustomOrderedSet<vertex>>>> state_in_definitions;
+   /// store where a variable comes from given a support state and an operation: the key is (state, op, var)
+   CustomUnorderedMapStable<std::tuple<vertex, vertex, unsigned int>, CustomOrderedSet<vertex>> state_in_definitions;
 
-   /// store along which transitions the variable has to be stored
-   std::map<vertex, std::map<vertex, std::map<unsigned int, CustomOrderedSet<vertex>>>> state_out_definitions;
+   /// store along which transitions the variable has to be stored: the key is (state, op, var)
+   CustomUnorderedMapStable<std::tuple<vertex, vertex, unsigned int>, CustomOrderedSet<vertex>> state_out_definitions;
 
    /// store the name of each state
    std::map<vertex, std::string> names;
@@ -116,6 +136,39 @@ class liveness
 
    CustomOrderedSet<vertex> dummy_states;
 
+   /**
+    * Return the dense index of a variable, allocating it if needed
+    * @param var is the identifier of the variable
+    */
+   size_t get_var_index(unsigned int var);
+
+   /**
+    * Return the row of the live matrices associated with a vertex, allocating it if needed
+    * @param v is the vertex
+    */
+   size_t get_state_row(const vertex& v);
+
+   /**
+    * Add a set of variables to a live set, keeping the ordered view (if any) up to date
+    * @param rows is the live matrix to be updated
+    * @param sets is the ordered view of the live matrix
+    * @param v is the vertex
+    * @param vars is the bit vector of the variables to be added
+    */
+   void merge_live(std::vector<boost::dynamic_bitset<>>& rows,
+                   CustomUnorderedMapStable<vertex, CustomOrderedSet<unsigned int>>& sets, const vertex& v,
+                   const boost::dynamic_bitset<>& vars);
+
+   /**
+    * Return the ordered view of a live set
+    * @param rows is the live matrix
+    * @param sets is the ordered view of the live matrix
+    * @param v is the vertex
+    */
+   const CustomOrderedSet<unsigned int>&
+   get_live(const std::vector<boost::dynamic_bitset<>>& rows,
+            CustomUnorderedMapStable<vertex, CustomOrderedSet<unsigned int>>& sets, const vertex& v) const;
+
  public:
    /**
     * Constructor
@@ -189,6 +242,20 @@ class liveness
     */
    void erase_el_live_out(const vertex& v, unsigned int var);
 
+   /**
+    * Add to the variables alive at the input of a vertex all the variables alive at the output of another vertex
+    * @param v is the vertex whose live in is updated
+    * @param source is the vertex whose live out is merged
+    */
+   void set_live_in_from_live_out(const vertex& v, const vertex& source);
+
+   /**
+    * Add to the variables alive at the output of a vertex all the variables alive at the output of another vertex
+    * @param v is the vertex whose live out is updated
+    * @param source is the vertex whose live out is merged
+    */
+   void set_live_out_from_live_out(const vertex& v, const vertex& source);
+
    /**
     * Get the set of variables live at the input of a vertex
     * @param v is the vertex
@@ -196,6 +263,35 @@ class liveness
     */
    const CustomOrderedSet<unsigned int>& get_live_in(const vertex& v) const;
 
+   /**
+    * Check if a variable is alive at the input of a vertex
+    * @param v is the vertex
+    * @param var is the identifier of the variable
+    */
+   bool is_live_in(const vertex& v, unsigned int var) const;
+
+   /**
+    * Check if a variable is alive at the output of a vertex
+    * @param v is the vertex
+    * @param var is the identifier of the variable
+    */
+   bool is_live_out(const vertex& v, unsigned int var) const;
+
+   /**
+    * Return the number of variables alive at the input of a vertex
+    * @param v is the vertex
+    */
+   size_t get_live_in_size(const vertex& v) const;
+
+   /**
+    * Compute the interference among the storage values: two storage values interfere when the corresponding
+    * variables are alive at the input of the same support state
+    * @param svi is the storage value information of the function
+    * @return for each storage value, the bit vector (indexed by storage value) of the storage values interfering with
+    * it
+    */
+   std::vector<boost::dynamic_bitset<>> compute_storage_value_interference(const StorageValueInformationRef& svi) const;
+
    /**
     * Get the set of variables live at the output of a vertex
     * @param v is the vertex
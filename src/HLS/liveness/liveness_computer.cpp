@@ -59,6 +59,11 @@ liveness_computer::liveness_computer(const ParameterConstRef _Param, const HLS_m
 
 liveness_computer::~liveness_computer() = default;
 
+unsigned int liveness_computer::GetLocalFunction() const
+{
+   return funId;
+}
+
 const CustomUnorderedSet<std::tuple<HLSFlowStep_Type, HLSFlowStepSpecializationConstRef, HLSFlowStep_Relationship>>
 liveness_computer::ComputeHLSRelationships(const DesignFlowStep::RelationshipType relationship_type) const
 {
@@ -72,5 +72,11 @@ class liveness_computer : public HLSFunctionStep
     * Destructor
     */
    ~liveness_computer() override;
+
+   /**
+    * Return the function synthesized by this step, since only the data structures of that function are modified
+    * @return the index of the function
+    */
+   unsigned int GetLocalFunction() const override;
 };
 #endif
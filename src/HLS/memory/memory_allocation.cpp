@@ -126,10 +126,10 @@ std::string MemoryAllocationSpecialization::GetKindText() const
    return ret;
 }
 
-std::string MemoryAllocationSpecialization::GetSignature() const
+unsigned int MemoryAllocationSpecialization::GetSignatureContext() const
 {
-   return STR(static_cast<unsigned int>(memory_allocation_policy)) +
-          "::" + STR(static_cast<unsigned int>(memory_allocation_channels_type));
+   return static_cast<unsigned int>(memory_allocation_policy) * 16U +
+          static_cast<unsigned int>(memory_allocation_channels_type);
 }
 
 memory_allocation::memory_allocation(const ParameterConstRef _parameters, const HLS_managerRef _HLSMgr,
@@ -111,7 +111,7 @@ class MemoryAllocationSpecialization : public HLSFlowStepSpecialization
    /**
     * Return the contribution to the signature of a step given by the specialization
     */
-   std::string GetSignature() const override;
+   unsigned int GetSignatureContext() const override;
 };
 
 /**
@@ -0,0 +1,235 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file memory_image.cpp
+ * @brief Binary image of the initialization of a memory object
+ *
+ * @author agent <agent@local>
+ * $Revision$
+ * $Date$
+ * Last modified by $Author$
+ *
+ */
+#include "memory_image.hpp"
+
+#include "exceptions.hpp"
+
+#include <algorithm>
+#include <ostream>
+
+#define WORD_BITS 64ULL
+
+memory_image::memory_image() : bit_size(0)
+{
+}
+
+void memory_image::add_elements(unsigned long long bitsize, unsigned long long count)
+{
+   if(!count)
+   {
+      return;
+   }
+   if(elements.size() && elements.back().bitsize == bitsize)
+   {
+      elements.back().count += count;
+   }
+   else
+   {
+      elements.push_back(element_run{bitsize, count});
+   }
+}
+
+void memory_image::push_bits(uint64_t value, unsigned int bitsize)
+{
+   THROW_ASSERT(bitsize <= WORD_BITS, "");
+   if(!bitsize)
+   {
+      return;
+   }
+   if(bitsize < WORD_BITS)
+   {
+      value &= (UINT64_C(1) << bitsize) - 1;
+   }
+   const auto shift = static_cast<unsigned int>(bit_size % WORD_BITS);
+   if(shift == 0)
+   {
+      words.push_back(value);
+   }
+   else
+   {
+      words.back() |= value << shift;
+      if(shift + bitsize > WORD_BITS)
+      {
+         words.push_back(value >> (WORD_BITS - shift));
+      }
+   }
+   bit_size += bitsize;
+}
+
+void memory_image::append(const integer_cst_t& value, unsigned long long bitsize)
+{
+   if(bitsize <= WORD_BITS)
+   {
+      push_bits(static_cast<uint64_t>(value), static_cast<unsigned int>(bitsize));
+   }
+   else
+   {
+      const auto word_mask = (integer_cst_t(1) << WORD_BITS) - 1;
+      for(auto offset = 0ULL; offset < bitsize; offset += WORD_BITS)
+      {
+         const auto chunk = (value & (word_mask << offset)) >> offset;
+         push_bits(static_cast<uint64_t>(chunk), static_cast<unsigned int>(std::min(WORD_BITS, bitsize - offset)));
+      }
+   }
+   add_elements(bitsize, 1);
+}
+
+void memory_image::append(const std::string& bits)
+{
+   auto index = bits.size();
+   while(index)
+   {
+      const auto chunk_size = std::min(static_cast<size_t>(WORD_BITS), index);
+      uint64_t chunk = 0;
+      for(auto i = index - chunk_size; i < index; ++i)
+      {
+         THROW_ASSERT(bits[i] == '0' || bits[i] == '1', "unexpected bit value: " + bits);
+         chunk = (chunk << 1) | (bits[i] == '1');
+      }
+      push_bits(chunk, static_cast<unsigned int>(chunk_size));
+      index -= chunk_size;
+   }
+   add_elements(bits.size(), 1);
+}
+
+void memory_image::append(const memory_image& other)
+{
+   const auto other_size = other.bit_size;
+   for(auto offset = 0ULL; offset < other_size; offset += WORD_BITS)
+   {
+      const auto chunk_size = static_cast<unsigned int>(std::min(WORD_BITS, other_size - offset));
+      push_bits(other.words[offset / WORD_BITS], chunk_size);
+   }
+   for(const auto& run : other.elements)
+   {
+      add_elements(run.bitsize, run.count);
+   }
+}
+
+void memory_image::append_zeros(unsigned long long bitsize, unsigned long long count)
+{
+   auto total = bitsize * count;
+   THROW_ASSERT(!bitsize || total / bitsize == count, "memory image size overflow");
+   // Complete the current word, then append whole zero words at once
+   const auto shift = bit_size % WORD_BITS;
+   if(shift && total)
+   {
+      const auto head = std::min(WORD_BITS - shift, total);
+      bit_size += head;
+      total -= head;
+   }
+   words.resize(words.size() + static_cast<size_t>(total / WORD_BITS), 0);
+   bit_size += total - total % WORD_BITS;
+   push_bits(0, static_cast<unsigned int>(total % WORD_BITS));
+   add_elements(bitsize, count);
+}
+
+void memory_image::align(unsigned long long alignment)
+{
+   THROW_ASSERT(alignment, "");
+   if(bit_size % alignment)
+   {
+      append_zeros(alignment - bit_size % alignment);
+   }
+}
+
+unsigned long long memory_image::element_count() const
+{
+   unsigned long long count = 0;
+   for(const auto& run : elements)
+   {
+      count += run.count;
+   }
+   return count;
+}
+
+uint64_t memory_image::extract(unsigned long long offset, unsigned int bitsize) const
+{
+   THROW_ASSERT(bitsize <= WORD_BITS && offset + bitsize <= bit_size, "field out of the memory image bounds");
+   if(!bitsize)
+   {
+      return 0;
+   }
+   const auto index = static_cast<size_t>(offset / WORD_BITS);
+   const auto shift = static_cast<unsigned int>(offset % WORD_BITS);
+   auto value = words[index] >> shift;
+   if(shift && shift + bitsize > WORD_BITS)
+   {
+      value |= words[index + 1] << (WORD_BITS - shift);
+   }
+   return bitsize < WORD_BITS ? value & ((UINT64_C(1) << bitsize) - 1) : value;
+}
+
+void memory_image::write_bits(std::ostream& os, unsigned long long offset, unsigned long long bitsize) const
+{
+   THROW_ASSERT(offset + bitsize <= bit_size, "field out of the memory image bounds");
+   std::string line(static_cast<size_t>(bitsize), '0');
+   auto position = line.size();
+   for(auto field = offset; field < offset + bitsize; field += WORD_BITS)
+   {
+      const auto chunk_size = static_cast<unsigned int>(std::min(WORD_BITS, offset + bitsize - field));
+      auto chunk = extract(field, chunk_size);
+      for(auto i = 0U; i < chunk_size; ++i, chunk >>= 1)
+      {
+         line[--position] = static_cast<char>('0' + (chunk & 1));
+      }
+   }
+   os.write(line.data(), static_cast<std::streamsize>(line.size()));
+}
+
+void memory_image::write_bytes(std::ostream& os) const
+{
+   THROW_ASSERT(bit_size % 8 == 0, "memory image is not byte aligned");
+   const auto n_bytes = static_cast<size_t>(bit_size / 8);
+   std::vector<char> buffer;
+   buffer.reserve(std::min<size_t>(n_bytes, 1 << 16));
+   for(size_t i = 0; i < n_bytes; ++i)
+   {
+      buffer.push_back(static_cast<char>((words[i / 8] >> ((i % 8) * 8)) & 0xFF));
+      if(buffer.size() == buffer.capacity() || i + 1 == n_bytes)
+      {
+         os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+         buffer.clear();
+      }
+   }
+}
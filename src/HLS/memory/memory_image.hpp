@@ -0,0 +1,180 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file memory_image.hpp
+ * @brief Binary image of the initialization of a memory object
+ *
+ * @author agent <agent@local>
+ * $Revision$
+ * $Date$
+ * Last modified by $Author$
+ *
+ */
+#ifndef _MEMORY_IMAGE_HPP_
+#define _MEMORY_IMAGE_HPP_
+
+#include "panda_types.hpp"
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * Bit-level image of an initialized memory object.
+ * Initializer elements are appended one after the other as a little-endian bit stream: bit 0 of the first element is
+ * bit 0 of the first byte in memory. Bits are stored packed in 64-bit words, while element boundaries are kept
+ * run-length encoded, since initializers are mostly made of long sequences of elements of the same size.
+ */
+class memory_image
+{
+ public:
+   /**
+    * Run of consecutive elements of the same bitsize
+    */
+   struct element_run
+   {
+      /// bitsize of each element of the run
+      unsigned long long bitsize;
+
+      /// number of elements in the run
+      unsigned long long count;
+   };
+
+   memory_image();
+
+   /**
+    * Append an element made of the least significant bits of value (two's complement)
+    * @param value is the element value
+    * @param bitsize is the element bitsize
+    */
+   void append(const integer_cst_t& value, unsigned long long bitsize);
+
+   /**
+    * Append an element given as a string of '0'/'1' characters, most significant bit first
+    * @param bits is the element value
+    */
+   void append(const std::string& bits);
+
+   /**
+    * Append the bits of another image, preserving its element boundaries
+    * @param other is the appended image
+    */
+   void append(const memory_image& other);
+
+   /**
+    * Append zero-valued elements
+    * @param bitsize is the bitsize of each element
+    * @param count is the number of elements
+    */
+   void append_zeros(unsigned long long bitsize, unsigned long long count = 1);
+
+   /**
+    * Append a zero-valued padding element so that the image size becomes a multiple of alignment bits
+    * @param alignment is the required alignment in bits
+    */
+   void align(unsigned long long alignment);
+
+   /**
+    * @return the number of bits in the image
+    */
+   unsigned long long size() const
+   {
+      return bit_size;
+   }
+
+   /**
+    * @return true if no element has been appended
+    */
+   bool empty() const
+   {
+      return elements.empty();
+   }
+
+   /**
+    * @return the number of elements in the image
+    */
+   unsigned long long element_count() const;
+
+   /**
+    * @return the element sizes of the image, run-length encoded
+    */
+   const std::vector<element_run>& get_elements() const
+   {
+      return elements;
+   }
+
+   /**
+    * Extract a field of the image
+    * @param offset is the position of the least significant bit of the field
+    * @param bitsize is the bitsize of the field, at most 64
+    * @return the field value, zero-extended
+    */
+   uint64_t extract(unsigned long long offset, unsigned int bitsize) const;
+
+   /**
+    * Write a field of the image as a string of '0'/'1' characters, most significant bit first
+    * @param os is the output stream
+    * @param offset is the position of the least significant bit of the field
+    * @param bitsize is the bitsize of the field
+    */
+   void write_bits(std::ostream& os, unsigned long long offset, unsigned long long bitsize) const;
+
+   /**
+    * Write the image as raw little-endian bytes; the image size must be a multiple of 8 bits
+    * @param os is the output stream
+    */
+   void write_bytes(std::ostream& os) const;
+
+ private:
+   /// the image bits, packed least significant bit first
+   std::vector<uint64_t> words;
+
+   /// the number of valid bits in words
+   unsigned long long bit_size;
+
+   /// the element sizes, run-length encoded
+   std::vector<element_run> elements;
+
+   /**
+    * Record the boundaries of count elements of bitsize bits each
+    */
+   void add_elements(unsigned long long bitsize, unsigned long long count);
+
+   /**
+    * Append bitsize bits of value at the end of the bit stream, without recording any element boundary
+    */
+   void push_bits(uint64_t value, unsigned int bitsize);
+};
+
+#endif
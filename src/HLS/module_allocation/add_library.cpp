@@ -85,9 +85,9 @@ std::string AddLibrarySpecialization::GetKindText() const
    return interfaced ? "Interfaced" : "";
 }
 
-std::string AddLibrarySpecialization::GetSignature() const
+unsigned int AddLibrarySpecialization::GetSignatureContext() const
 {
-   return interfaced ? "Interfaced" : "";
+   return interfaced ? 1U : 0U;
 }
 
 add_library::add_library(const ParameterConstRef _parameters, const HLS_managerRef _HLSMgr, unsigned _funId,
@@ -292,6 +292,10 @@ DesignFlowStep_Status add_library::InternalExec()
    }
    fu->area_m = area_info::factory(parameters);
    fu->area_m->set_area_value(2000); /// fake number to avoid sharing of functions
+   if(!add_library_specialization->interfaced && HLSMgr->Rmem && HLSMgr->IsFunctionCacheable(funId))
+   {
+      HLSMgr->StoreFunction(funId);
+   }
 
    return DesignFlowStep_Status::SUCCESS;
 }
@@ -75,7 +75,7 @@ class AddLibrarySpecialization : public HLSFlowStepSpecialization
    /**
     * Return the contribution to the signature of a step given by the specialization
     */
-   std::string GetSignature() const override;
+   unsigned int GetSignatureContext() const override;
 };
 
 class add_library : public HLSFunctionStep
@@ -210,7 +210,7 @@ void allocation::ComputeRelationships(DesignFlowStepSet& relationship,
       if(!parameters->getOption<int>(OPT_gcc_openmp_simd))
       {
          const auto frontend_flow_step_factory = GetPointer<const FrontendFlowStepFactory>(
-             design_flow_manager.lock()->CGetDesignFlowStepFactory("Frontend"));
+             design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::FRONTEND));
          const auto frontend_step = design_flow_manager.lock()->GetDesignFlowStep(
              FunctionFrontendFlowStep::ComputeSignature(FrontendFlowStepType::BIT_VALUE, funId));
          const auto design_flow_graph = design_flow_manager.lock()->CGetDesignFlowGraph();
@@ -2529,6 +2529,8 @@ DesignFlowStep_Status allocation::InternalExec()
    {
       INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "");
    }
+   /// timings computed during the allocation refer to a partial binding of the operations
+   allocation_information->InvalidateTimingCache();
 
    return DesignFlowStep_Status::SUCCESS;
 }
@@ -75,6 +75,7 @@
 #include <algorithm>
 #include <cmath>  // for exp, ceil
 #include <limits> // for numeric_limits
+#include <mutex>  // for mutex, lock_guard
 #include <tuple>
 
 const std::pair<const CustomMap<unsigned long long, CustomUnorderedMapStable<unsigned int, double>>&,
@@ -83,6 +84,9 @@ AllocationInformation::InitializeMuxDB(const AllocationInformationConstRef alloc
 {
    static CustomMap<unsigned long long, CustomUnorderedMapStable<unsigned int, double>> mux_timing_db;
    static CustomMap<unsigned long long, CustomUnorderedMapStable<unsigned int, double>> mux_area_db;
+   /// the databases can be initialized by steps executed concurrently on different functions
+   static std::mutex mux_db_mutex;
+   const std::lock_guard<std::mutex> lock(mux_db_mutex);
    if(mux_timing_db.empty() || mux_area_db.empty())
    {
       // const unsigned int debug_level = 0;
@@ -220,6 +224,8 @@ AllocationInformation::InitializeDSPDB(const AllocationInformationConstRef alloc
 {
    static std::vector<unsigned int> DSP_x_db;
    static std::vector<unsigned int> DSP_y_db;
+   static std::mutex DSP_db_mutex;
+   const std::lock_guard<std::mutex> lock(DSP_db_mutex);
    if(!(DSP_x_db.size() || DSP_y_db.size()))
    {
       /// initialize DSP x and y db
@@ -251,6 +257,9 @@ AllocationInformation::AllocationInformation(const HLS_managerRef _hls_manager,
     : HLSFunctionIR(_hls_manager, _function_index, _parameters), address_bitsize(_hls_manager->Rget_address_bitsize())
 {
    debug_level = _parameters->get_class_debug_level(GET_CLASS(*this));
+   timing_cache_version = std::make_pair(0u, 0u);
+   timing_cache_hits = 0;
+   timing_cache_misses = 0;
 }
 
 AllocationInformation::~AllocationInformation() = default;
@@ -1101,6 +1110,17 @@ double AllocationInformation::estimate_muxNto1_delay(unsigned long long fu_prec,
    {
       fu_prec = 128;
    }
+   const auto key = std::make_pair(fu_prec, mux_ins);
+   {
+      std::lock_guard<std::mutex> lock(timing_cache_mutex);
+      const auto cached = muxNto1_delay_cache.find(key);
+      if(cached != muxNto1_delay_cache.end())
+      {
+         ++timing_cache_hits;
+         return cached->second;
+      }
+      ++timing_cache_misses;
+   }
    THROW_ASSERT(mux_timing_db.find(fu_prec) != mux_timing_db.end(),
                 STR(fu_prec) + " not found in mux database of " + STR(mux_timing_db.size()) + " elements");
    while(mux_timing_db.find(fu_prec)->second.find(mux_ins) == mux_timing_db.find(fu_prec)->second.end() &&
@@ -1113,6 +1133,8 @@ double AllocationInformation::estimate_muxNto1_delay(unsigned long long fu_prec,
    double ret = mux_timing_db.at(fu_prec).at(mux_ins) - get_setup_hold_time();
    // INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---delay of MUX with " + STR(mux_ins) + " inputs and with
    // " + STR(fu_prec) + " bits: " + STR(ret));
+   std::lock_guard<std::mutex> lock(timing_cache_mutex);
+   muxNto1_delay_cache[key] = ret;
    return ret;
 }
 
@@ -2016,6 +2038,28 @@ std::pair<double, double> AllocationInformation::GetTimeLatency(const unsigned i
    {
       return std::pair<double, double>(0.0, 0.0);
    }
+   const auto key = std::make_tuple(operation_index, functional_unit_type, stage);
+   {
+      std::lock_guard<std::mutex> lock(timing_cache_mutex);
+      CheckTimingCacheVersion();
+      const auto cached = time_latency_cache.find(key);
+      if(cached != time_latency_cache.end())
+      {
+         ++timing_cache_hits;
+         return cached->second;
+      }
+      ++timing_cache_misses;
+   }
+   const auto ret = ComputeTimeLatency(operation_index, functional_unit_type, stage);
+   std::lock_guard<std::mutex> lock(timing_cache_mutex);
+   time_latency_cache[key] = ret;
+   return ret;
+}
+
+std::pair<double, double> AllocationInformation::ComputeTimeLatency(const unsigned int operation_index,
+                                                                    const unsigned int functional_unit_type,
+                                                                    const unsigned int stage) const
+{
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Computing time latency of " + STR(operation_index));
 
    const unsigned int time_operation_index = [&]() -> unsigned int {
@@ -2470,6 +2514,27 @@ std::string AllocationInformation::get_latency_string(const std::string& lat) co
 #define ARRAY_CORRECTION 0
 double AllocationInformation::get_correction_time(unsigned int fu, const std::string& operation_name,
                                                   unsigned int n_ins) const
+{
+   auto key = std::make_tuple(fu, operation_name, n_ins);
+   {
+      std::lock_guard<std::mutex> lock(timing_cache_mutex);
+      CheckTimingCacheVersion();
+      const auto cached = correction_time_cache.find(key);
+      if(cached != correction_time_cache.end())
+      {
+         ++timing_cache_hits;
+         return cached->second;
+      }
+      ++timing_cache_misses;
+   }
+   const auto ret = compute_correction_time(fu, operation_name, n_ins);
+   std::lock_guard<std::mutex> lock(timing_cache_mutex);
+   correction_time_cache.emplace(std::move(key), ret);
+   return ret;
+}
+
+double AllocationInformation::compute_correction_time(unsigned int fu, const std::string& operation_name,
+                                                      unsigned int n_ins) const
 {
    double res_value = get_setup_hold_time();
    technology_nodeRef current_fu = get_fu(fu);
@@ -3055,6 +3120,7 @@ double AllocationInformation::GetClockPeriodMargin() const
 CustomSet<unsigned int> AllocationInformation::ComputeRoots(const unsigned int ssa, const AbsControlStep cs) const
 {
    const auto bb_version = hls_manager->CGetFunctionBehavior(function_index)->GetBBVersion();
+   std::unique_lock<std::mutex> lock(analysis_cache_mutex);
    if(ssa_bb_versions.find(ssa) != ssa_bb_versions.end() &&
       ssa_bb_versions.find(ssa)->second == std::pair<unsigned int, AbsControlStep>(bb_version, cs))
    {
@@ -3064,6 +3130,7 @@ CustomSet<unsigned int> AllocationInformation::ComputeRoots(const unsigned int s
    }
    else
    {
+      lock.unlock();
       const auto schedule = hls->Rsch;
       CustomSet<unsigned int> already_analyzed_ssas;
       CustomSet<unsigned int> ssa_to_be_analyzeds;
@@ -3172,8 +3239,10 @@ CustomSet<unsigned int> AllocationInformation::ComputeRoots(const unsigned int s
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Adding as root " + current_sn->ToString());
          roots.insert(current_tn_index);
       }
+      lock.lock();
       ssa_bb_versions[ssa] = std::pair<unsigned int, AbsControlStep>(bb_version, cs);
       ssa_roots[ssa] = roots;
+      lock.unlock();
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                      "<--Computed roots of " + STR(ssa) + " at version " + STR(bb_version) + ": " + STR(roots.size()) +
                          " elements");
@@ -3184,6 +3253,7 @@ CustomSet<unsigned int> AllocationInformation::ComputeRoots(const unsigned int s
 CustomSet<unsigned int> AllocationInformation::ComputeDrivenCondExpr(const unsigned int ssa) const
 {
    const auto bb_version = hls_manager->CGetFunctionBehavior(function_index)->GetBBVersion();
+   std::unique_lock<std::mutex> lock(analysis_cache_mutex);
    if(cond_expr_bb_versions.find(ssa) != cond_expr_bb_versions.end() &&
       cond_expr_bb_versions.find(ssa)->second == bb_version)
    {
@@ -3194,6 +3264,7 @@ CustomSet<unsigned int> AllocationInformation::ComputeDrivenCondExpr(const unsig
    }
    else
    {
+      lock.unlock();
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                      "-->Computing cond_exprs starting from " + STR(TreeM->CGetTreeNode(ssa)));
       CustomSet<unsigned int> cond_expr_ga_indices;
@@ -3295,8 +3366,10 @@ CustomSet<unsigned int> AllocationInformation::ComputeDrivenCondExpr(const unsig
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                         "<--Considered " + STR(TreeM->CGetTreeNode(current_tn_index)));
       }
+      lock.lock();
       cond_expr_bb_versions[ssa] = bb_version;
       ssa_cond_exprs[ssa] = cond_expr_ga_indices;
+      lock.unlock();
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                      "<--Computed cond_exprs starting from " + STR(TreeM->CGetTreeNode(ssa)));
       return cond_expr_ga_indices;
@@ -3318,6 +3391,27 @@ double AllocationInformation::GetConnectionTime(const unsigned int first_operati
    {
       return 0;
    }
+   const auto key = std::make_tuple(first_operation, second_operation, cs);
+   {
+      std::lock_guard<std::mutex> lock(timing_cache_mutex);
+      CheckTimingCacheVersion();
+      const auto cached = connection_time_cache.find(key);
+      if(cached != connection_time_cache.end())
+      {
+         ++timing_cache_hits;
+         return cached->second;
+      }
+      ++timing_cache_misses;
+   }
+   const auto ret = ComputeConnectionTime(first_operation, second_operation, cs);
+   std::lock_guard<std::mutex> lock(timing_cache_mutex);
+   connection_time_cache[key] = ret;
+   return ret;
+}
+
+double AllocationInformation::ComputeConnectionTime(const unsigned int first_operation,
+                                                    const unsigned int second_operation, const AbsControlStep cs) const
+{
    if(second_operation == 0)
    {
       if(first_operation == ENTRY_ID || first_operation == EXIT_ID)
@@ -3935,6 +4029,7 @@ void AllocationInformation::Initialize()
    mux_area_db = InitializeMuxDB(AllocationInformationConstRef(this, null_deleter())).second;
    DSP_x_db = std::get<0>(InitializeDSPDB(AllocationInformationConstRef(this, null_deleter())));
    DSP_y_db = std::get<1>(InitializeDSPDB(AllocationInformationConstRef(this, null_deleter())));
+   InvalidateTimingCache();
 }
 
 void AllocationInformation::Clear()
@@ -3971,10 +4066,42 @@ void AllocationInformation::Clear()
    precomputed_pipeline_unit.clear();
    single_bool_test_cond_expr_units.clear();
    simple_pointer_plus_expr.clear();
-   ssa_roots.clear();
-   ssa_bb_versions.clear();
-   ssa_cond_exprs.clear();
-   cond_expr_bb_versions.clear();
+   {
+      std::lock_guard<std::mutex> lock(analysis_cache_mutex);
+      ssa_roots.clear();
+      ssa_bb_versions.clear();
+      ssa_cond_exprs.clear();
+      cond_expr_bb_versions.clear();
+   }
+   InvalidateTimingCache();
+}
+
+void AllocationInformation::InvalidateTimingCache() const
+{
+   std::lock_guard<std::mutex> lock(timing_cache_mutex);
+   ClearTimingCache();
+}
+
+void AllocationInformation::ClearTimingCache() const
+{
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
+                  "---Invalidating timing caches - Hits: " + STR(timing_cache_hits) +
+                      " - Misses: " + STR(timing_cache_misses));
+   time_latency_cache.clear();
+   connection_time_cache.clear();
+   correction_time_cache.clear();
+   muxNto1_delay_cache.clear();
+}
+
+void AllocationInformation::CheckTimingCacheVersion() const
+{
+   const auto FB = hls_manager->CGetFunctionBehavior(function_index);
+   const auto current_version = std::make_pair(FB->GetBBVersion(), FB->GetBitValueVersion());
+   if(timing_cache_version != current_version)
+   {
+      ClearTimingCache();
+      timing_cache_version = current_version;
+   }
 }
 double AllocationInformation::GetToDspRegisterDelay(const unsigned int statement_index) const
 {
@@ -4057,6 +4184,7 @@ double AllocationInformation::GetToDspRegisterDelay(const unsigned int statement
 CustomSet<unsigned int> AllocationInformation::GetZeroDistanceOperations(const unsigned int statement_index) const
 {
    const auto bb_version = hls_manager->CGetFunctionBehavior(function_index)->GetBBVersion();
+   std::unique_lock<std::mutex> lock(analysis_cache_mutex);
    if(zero_distance_ops_bb_version.find(statement_index) != zero_distance_ops_bb_version.end() &&
       zero_distance_ops_bb_version.find(statement_index)->second == bb_version)
    {
@@ -4066,10 +4194,10 @@ CustomSet<unsigned int> AllocationInformation::GetZeroDistanceOperations(const u
    }
    else
    {
+      lock.unlock();
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                      "-->Computing Zero Distance Operations of " + STR(statement_index));
-      zero_distance_ops[statement_index].clear();
-      zero_distance_ops_bb_version[statement_index] = bb_version;
+      CustomSet<unsigned int> zero_distance_operations;
       CustomSet<unsigned int> to_be_analyzed_ops;
       CustomSet<unsigned int> already_analyzed;
       to_be_analyzed_ops.insert(statement_index);
@@ -4116,14 +4244,17 @@ CustomSet<unsigned int> AllocationInformation::GetZeroDistanceOperations(const u
                continue;
             }
             to_be_analyzed_ops.insert(use_stmt_index);
-            zero_distance_ops[statement_index].insert(use_stmt_index);
+            zero_distance_operations.insert(use_stmt_index);
          }
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                         "<--Considered " + STR(TreeM->CGetTreeNode(current_tn_index)));
       }
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                      "<--Computed Zero Distance Operations of " + STR(statement_index));
-      return zero_distance_ops[statement_index];
+      lock.lock();
+      zero_distance_ops_bb_version[statement_index] = bb_version;
+      zero_distance_ops[statement_index] = zero_distance_operations;
+      return zero_distance_operations;
    }
 }
 
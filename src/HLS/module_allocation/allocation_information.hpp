@@ -54,7 +54,10 @@
 
 #include <cstddef> // for size_t
 #include <iosfwd>  // for ostream
+#include <map>     // for map
+#include <mutex>   // for mutex
 #include <string>  // for string
+#include <tuple>   // for tuple
 #include <utility> // for pair
 
 CONSTREF_FORWARD_DECL(AllocationInformation);
@@ -238,6 +241,35 @@ class AllocationInformation : public HLSFunctionIR
    /// The bb_version on which the reachable delay zero operations
    mutable CustomMap<unsigned int, unsigned int> zero_distance_ops_bb_version;
 
+   /// The time latencies already computed: (operation, functional unit type, stage) -> (time, stage period)
+   mutable CustomMap<std::tuple<unsigned int, unsigned int, unsigned int>, std::pair<double, double>>
+       time_latency_cache;
+
+   /// The connection times already computed: (first operation, second operation, control step) -> connection time
+   mutable std::map<std::tuple<unsigned int, unsigned int, AbsControlStep>, double> connection_time_cache;
+
+   /// The correction times already computed: (functional unit, operation name, number of inputs) -> correction time
+   mutable CustomMap<std::tuple<unsigned int, std::string, unsigned int>, double> correction_time_cache;
+
+   /// The mux delays already computed: (precision, number of inputs) -> delay
+   mutable CustomMap<std::pair<unsigned long long, unsigned int>, double> muxNto1_delay_cache;
+
+   /// The bb_version and the bitvalue_version on which the timing caches have been computed
+   mutable std::pair<unsigned int, unsigned int> timing_cache_version;
+
+   /// The number of timing queries answered by the caches
+   mutable size_t timing_cache_hits;
+
+   /// The number of timing queries which had to be computed
+   mutable size_t timing_cache_misses;
+
+   /// Serializes the accesses to the timing caches, since module binding may query them from several threads
+   mutable std::mutex timing_cache_mutex;
+
+   /// Serializes the accesses to ssa_roots, ssa_cond_exprs, zero_distance_ops and their versions, which are filled
+   /// while computing the timing of operations queried by module binding from several threads
+   mutable std::mutex analysis_cache_mutex;
+
    /// store mux timing for the current technology
    CustomMap<unsigned long long, CustomUnorderedMapStable<unsigned int, double>> mux_timing_db;
 
@@ -355,6 +387,33 @@ class AllocationInformation : public HLSFunctionIR
     */
    CustomSet<unsigned int> GetZeroDistanceOperations(const unsigned int statement_index) const;
 
+   /**
+    * Drop the timing caches if the function has been modified since they were filled; timing_cache_mutex must be held
+    */
+   void CheckTimingCacheVersion() const;
+
+   /**
+    * Drop the timing caches; timing_cache_mutex must be held
+    */
+   void ClearTimingCache() const;
+
+   /**
+    * Compute the execution time of (a stage of) an operation; see GetTimeLatency
+    */
+   std::pair<double, double> ComputeTimeLatency(const unsigned int operation, const unsigned int functional_unit,
+                                                const unsigned int stage) const;
+
+   /**
+    * Compute the connection time for a couple of operations; see GetConnectionTime
+    */
+   double ComputeConnectionTime(const unsigned int first_operation, const unsigned int second_operation,
+                                const AbsControlStep cs) const;
+
+   /**
+    * Compute the correction time of an operation; see get_correction_time
+    */
+   double compute_correction_time(unsigned int fu, const std::string& operation_name, unsigned int n_ins) const;
+
  public:
    /**
     * Constructor
@@ -924,6 +983,21 @@ class AllocationInformation : public HLSFunctionIR
     */
    bool IsVariableExecutionTime(const unsigned int operation_index) const;
 
+   /**
+    * Drop all the cached time latencies, connection times, correction times and mux delays; it has to be called
+    * every time the allocation or the binding of the operations is changed
+    */
+   void InvalidateTimingCache() const;
+
+   /**
+    * Return the number of timing queries answered by the caches and the number of the ones which had to be computed
+    */
+   std::pair<size_t, size_t> GetTimingCacheStatistics() const
+   {
+      std::lock_guard<std::mutex> lock(timing_cache_mutex);
+      return std::make_pair(timing_cache_hits, timing_cache_misses);
+   }
+
    /**
     * @return the minimum slack of the component estimated by scheduling
     */
@@ -131,7 +131,7 @@ void HLSFunctionBitValue::ComputeRelationships(DesignFlowStepSet& relationship,
                    frontend_step != NULL_VERTEX ?
                        design_flow_graph->CGetDesignFlowStepInfo(frontend_step)->design_flow_step :
                        GetPointer<const FrontendFlowStepFactory>(
-                           design_flow_manager.lock()->CGetDesignFlowStepFactory("Frontend"))
+                           design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::FRONTEND))
                            ->CreateApplicationFrontendFlowStep(FrontendFlowStepType::BIT_VALUE_IPA);
                relationship.insert(design_flow_step);
             }
@@ -143,7 +143,7 @@ void HLSFunctionBitValue::ComputeRelationships(DesignFlowStepSet& relationship,
              frontend_step != NULL_VERTEX ?
                  design_flow_graph->CGetDesignFlowStepInfo(frontend_step)->design_flow_step :
                  GetPointer<const FrontendFlowStepFactory>(
-                     design_flow_manager.lock()->CGetDesignFlowStepFactory("Frontend"))
+                     design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::FRONTEND))
                      ->CreateFunctionFrontendFlowStep(FrontendFlowStepType::BIT_VALUE_OPT, funId);
          relationship.insert(design_flow_step);
       }
@@ -166,7 +166,8 @@ DesignFlowStep_Status HLSFunctionBitValue::InternalExec()
       const auto design_flow_step = frontend_step != NULL_VERTEX ?
                                         design_flow_graph->CGetDesignFlowStepInfo(frontend_step)->design_flow_step :
                                         GetPointer<const FrontendFlowStepFactory>(
-                                            design_flow_manager.lock()->CGetDesignFlowStepFactory("Frontend"))
+                                            design_flow_manager.lock()->CGetDesignFlowStepFactory(
+                                                DesignFlowStep::FRONTEND))
                                             ->CreateFunctionFrontendFlowStep(FrontendFlowStepType::BIT_VALUE, funId);
       HLSMgr->Rmem->set_enable_hls_bit_value(true);
       design_flow_step->Initialize();
@@ -230,6 +230,8 @@ reg [BITSIZE_burst-1:0] awburst_reg;
 reg [BITSIZE_counter-1:0] counter_reg, counter_next;
 reg write_done;
 reg wlast_reg, wlast_next;
+reg [4095:0] burst_data;
+reg burst_prefetched;
 
 if_utils #(index, BITSIZE_data) m_utils();
 
@@ -261,6 +263,8 @@ begin
   awsize_reg = 0;
   awlen_reg = 0;
   awburst_reg = 0;
+  burst_data = 0;
+  burst_prefetched = 0;
 end
 
 // Combinatorial logic for read transactions
@@ -398,6 +402,7 @@ always@(posedge clock)
 begin : read_seq
   automatic ptr_t currAddr;
   automatic ptr_t endAddr;
+  automatic integer unsigned beats, beat;
   rlast <= 0;
   test_addr_read <= 0;
   if(next_arqueue_size > 0 && next_arqueue[OFFSET_delay+:BITSIZE_delay] == 1)
@@ -417,7 +422,25 @@ begin : read_seq
     end
     test_addr_read <= currAddr;
     rid <= next_arqueue[OFFSET_id+:BITSIZE_id];
-    rdata <= m_utils.read_a(currAddr);
+    beats = next_arqueue[OFFSET_len+:BITSIZE_len] + 1;
+    beat = next_arqueue[OFFSET_counter+:BITSIZE_counter] - 1;
+    if(beat == 0)
+    begin
+      // Full-width incremental bursts are fetched with a single co-simulation request on their first beat
+      burst_prefetched = next_arqueue[OFFSET_burst+:BITSIZE_burst] == 2'b01 && beats > 1 && (8 << next_arqueue[OFFSET_size+:BITSIZE_size]) == BITSIZE_data && beats * BITSIZE_data <= 4096;
+      if(burst_prefetched)
+      begin
+        burst_data = m_utils.read_burst(beats * BITSIZE_data, currAddr);
+      end
+    end
+    if(burst_prefetched)
+    begin
+      rdata <= burst_data[beat*BITSIZE_data+:BITSIZE_data];
+    end
+    else
+    begin
+      rdata <= m_utils.read_a(currAddr);
+    end
     if(next_arqueue[OFFSET_counter+:BITSIZE_counter] >= (next_arqueue[OFFSET_len+:BITSIZE_len] + 1))
     begin
       rlast <= 1;
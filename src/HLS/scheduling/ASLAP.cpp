@@ -49,6 +49,7 @@
 #include "exceptions.hpp"
 #include "function_behavior.hpp"
 #include "graph.hpp"
+#include "graph_snapshot.hpp"
 #include "hls.hpp"
 #include "hls_constraints.hpp"
 #include "hls_manager.hpp"
@@ -111,6 +112,7 @@ ASLAP::ASLAP(const HLS_managerConstRef _hls_manager, const hlsRef HLS, const boo
    {
       beh_graph = _hls_manager->CGetFunctionBehavior(HLS->functionId)->CGetOpGraph(FunctionBehavior::FLSAODG);
    }
+   beh_snapshot = GraphSnapshotConstRef(new GraphSnapshot(*beh_graph));
    VertexIterator it, end_it;
    for(boost::tie(it, end_it) = boost::vertices(*beh_graph); !has_branching_blocks && it != end_it; it++)
    {
@@ -125,6 +127,7 @@ ASLAP::ASLAP(const HLS_managerConstRef _hls_manager, const hlsRef HLS, const boo
       if(_operations.find(l) != _operations.end())
       {
          levels.push_back(l);
+         level_indices.push_back(beh_snapshot->GetIndex(l));
       }
    }
 }
@@ -272,16 +275,12 @@ void ASLAP::add_constraints_to_ASAP()
 
 void ASLAP::compute_ASAP(const ScheduleConstRef partial_schedule)
 {
-   vertex vi;
-   InEdgeIterator ei, ei_end;
    // Store the current execution time
    double cur_start;
-   vertex2float finish_time; //
-   VertexIterator vI, vI_end;
-   boost::tie(vI, vI_end) = boost::vertices(*beh_graph);
+   /// finish time of each vertex of beh_snapshot
+   std::vector<double> finish_time(beh_snapshot->NumVertices(), 0.0);
 
    ASAP->clear();
-   finish_time.resize(vI, vI_end, 0); //
    min_tot_csteps = ControlStep(0u);
    if(partial_schedule)
    {
@@ -299,20 +298,18 @@ void ASLAP::compute_ASAP(const ScheduleConstRef partial_schedule)
       add_constraints_to_ASAP();
    }
 
-   for(auto level : levels)
+   for(size_t level_index = 0; level_index < levels.size(); ++level_index)
    {
+      const auto level = levels[level_index];
       const auto op_cycles = GetCycleLatency(level, Allocation_MinMax::MIN);
       cur_start = 0.0;
 
-      for(boost::tie(ei, ei_end) = boost::in_edges(level, *beh_graph); ei != ei_end; ei++)
+      for(const auto& arc : beh_snapshot->InArcs(level_indices[level_index]))
       {
-         vi = boost::source(*ei, *beh_graph);
-         cur_start = finish_time.at(vi) < cur_start ? cur_start : finish_time.at(vi);
-         //       PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, GET_NAME(beh_graph, vi) + " -> " +GET_NAME(beh_graph,
-         //       level) + " cur_start " + std::to_string(cur_start));
+         cur_start = finish_time[arc.vertex] < cur_start ? cur_start : finish_time[arc.vertex];
       }
 
-      finish_time.at(level) = cur_start + from_strongtype_cast<double>(op_cycles);
+      finish_time[level_indices[level_index]] = cur_start + from_strongtype_cast<double>(op_cycles);
       ControlStep curr_asap = ASAP->is_scheduled(level) ? ASAP->get_cstep(level).second : ControlStep(0u);
       curr_asap = ControlStep(static_cast<unsigned int>(cur_start / ctrl_step_multiplier)) > curr_asap ?
                       ControlStep(static_cast<unsigned int>(cur_start / ctrl_step_multiplier)) :
@@ -320,7 +317,7 @@ void ASLAP::compute_ASAP(const ScheduleConstRef partial_schedule)
       ASAP->set_execution(level, curr_asap);
       PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level,
                     GET_NAME(beh_graph, level) + " cur_start " + std::to_string(cur_start) + " finish_time[level] " +
-                        std::to_string(finish_time[level]));
+                        std::to_string(finish_time[level_indices[level_index]]));
       min_tot_csteps = min_tot_csteps < curr_asap ? curr_asap : min_tot_csteps;
       PRINT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level,
                     GET_NAME(beh_graph, level) + " - " + STR(ASAP->get_cstep(level).second));
@@ -501,31 +498,27 @@ void ASLAP::update_ALAP(const ControlStep maxc, bool* feasible, const ScheduleCo
 void ASLAP::compute_ALAP_fast(bool* feasible)
 {
    // This function is used both in fast case and
-   vertex vi;
-   OutEdgeIterator ei, ei_end;
    double cur_rev_start;
-   vertex2float Rev_finish_time;
-   VertexIterator vI, vI_end;
-   boost::tie(vI, vI_end) = boost::vertices(*beh_graph);
-   Rev_finish_time.resize(vI, vI_end, 0);
+   /// reverse finish time of each vertex of beh_snapshot
+   std::vector<double> Rev_finish_time(beh_snapshot->NumVertices(), 0.0);
 
-   auto i_end = levels.rend();
-   for(auto i = levels.rbegin(); i != i_end; ++i)
+   for(auto level_index = levels.size(); level_index-- > 0;)
    {
-      const auto op_cycles = GetCycleLatency(*i, Allocation_MinMax::MIN);
+      const auto i = levels[level_index];
+      const auto i_index = level_indices[level_index];
+      const auto op_cycles = GetCycleLatency(i, Allocation_MinMax::MIN);
       cur_rev_start = 0.0;
-      for(boost::tie(ei, ei_end) = boost::out_edges(*i, *beh_graph); ei != ei_end; ei++)
+      for(const auto& arc : beh_snapshot->OutArcs(i_index))
       {
-         vi = boost::target(*ei, *beh_graph);
-         cur_rev_start = Rev_finish_time.at(vi) < cur_rev_start ? cur_rev_start : Rev_finish_time.at(vi);
+         cur_rev_start = Rev_finish_time[arc.vertex] < cur_rev_start ? cur_rev_start : Rev_finish_time[arc.vertex];
       }
-      Rev_finish_time.at(*i) = cur_rev_start + from_strongtype_cast<double>(op_cycles);
+      Rev_finish_time[i_index] = cur_rev_start + from_strongtype_cast<double>(op_cycles);
 
-      ControlStep rev_curr_alap = ALAP->is_scheduled(*i) ? ALAP->get_cstep(*i).second : ControlStep(0u);
+      ControlStep rev_curr_alap = ALAP->is_scheduled(i) ? ALAP->get_cstep(i).second : ControlStep(0u);
       const auto rev_finish_time =
-          ControlStep(static_cast<unsigned int>((Rev_finish_time.at(*i) - 1) / ctrl_step_multiplier));
+          ControlStep(static_cast<unsigned int>((Rev_finish_time[i_index] - 1) / ctrl_step_multiplier));
       rev_curr_alap = rev_finish_time > rev_curr_alap ? rev_finish_time : rev_curr_alap;
-      ALAP->set_execution(*i, rev_curr_alap);
+      ALAP->set_execution(i, rev_curr_alap);
       max_tot_csteps = max_tot_csteps < rev_curr_alap ? rev_curr_alap : max_tot_csteps;
    }
 
@@ -45,6 +45,7 @@
 
 #include <deque>
 #include <iosfwd>
+#include <vector>
 
 #include "graph.hpp"
 #include "refcount.hpp"
@@ -57,6 +58,7 @@
  */
 //@{
 CONSTREF_FORWARD_DECL(AllocationInformation);
+CONSTREF_FORWARD_DECL(GraphSnapshot);
 REF_FORWARD_DECL(HLS_constraints);
 CONSTREF_FORWARD_DECL(Schedule);
 REF_FORWARD_DECL(Schedule);
@@ -90,10 +92,16 @@ class ASLAP
    /// the graph to be scheduled
    OpGraphConstRef beh_graph;
 
+   /// compressed snapshot of beh_graph traversed by the ASAP and ALAP computations
+   GraphSnapshotConstRef beh_snapshot;
+
    /// constant variable storing the reference to the array of vertexes sorted by topological order associated with
    /// the SDG(it can be used also for SG).
    std::deque<vertex> levels;
 
+   /// the index in beh_snapshot of each element of levels
+   std::vector<size_t> level_indices;
+
    /// is true if the beh_graph has at least one branching block
    bool has_branching_blocks;
 
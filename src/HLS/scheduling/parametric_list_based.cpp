@@ -310,9 +310,9 @@ std::string ParametricListBasedSpecialization::GetKindText() const
    return "";
 }
 
-std::string ParametricListBasedSpecialization::GetSignature() const
+unsigned int ParametricListBasedSpecialization::GetSignatureContext() const
 {
-   return GetKindText();
+   return static_cast<unsigned int>(parametric_list_based_metric);
 }
 
 parametric_list_based::parametric_list_based(const ParameterConstRef _parameters, const HLS_managerRef _HLSMgr,
@@ -334,6 +334,11 @@ parametric_list_based::parametric_list_based(const ParameterConstRef _parameters
 
 parametric_list_based::~parametric_list_based() = default;
 
+unsigned int parametric_list_based::GetLocalFunction() const
+{
+   return funId;
+}
+
 void parametric_list_based::Initialize()
 {
    Scheduling::Initialize();
@@ -135,7 +135,7 @@ class ParametricListBasedSpecialization : public HLSFlowStepSpecialization
    /**
     * Return the contribution to the signature of a step given by the specialization
     */
-   std::string GetSignature() const override;
+   unsigned int GetSignatureContext() const override;
 };
 
 /**
@@ -284,5 +284,11 @@ class parametric_list_based : public Scheduling
     * Initialize the step (i.e., like a constructor, but executed just before exec
     */
    void Initialize() override;
+
+   /**
+    * Return the function synthesized by this step, since only the data structures of that function are modified
+    * @return the index of the function
+    */
+   unsigned int GetLocalFunction() const override;
 };
 #endif
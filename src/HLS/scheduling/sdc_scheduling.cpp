@@ -511,7 +511,7 @@ void SDCScheduling::ComputeRelationships(DesignFlowStepSet& relationship,
                 frontend_step != NULL_VERTEX ?
                     design_flow_graph->CGetDesignFlowStepInfo(frontend_step)->design_flow_step :
                     GetPointer<const FrontendFlowStepFactory>(
-                        design_flow_manager.lock()->CGetDesignFlowStepFactory("Frontend"))
+                        design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::FRONTEND))
                         ->CreateFunctionFrontendFlowStep(FrontendFlowStepType::SDC_CODE_MOTION, funId);
             relationship.insert(design_flow_step);
          }
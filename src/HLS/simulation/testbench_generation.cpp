@@ -58,6 +58,7 @@
 #include "library_manager.hpp"
 #include "math_function.hpp"
 #include "memory.hpp"
+#include "memory_image.hpp"
 #include "memory_symbol.hpp"
 #include "structural_manager.hpp"
 #include "structural_objects.hpp"
@@ -785,10 +786,9 @@ typedef int unsigned ptr_t;
    return DesignFlowStep_Status::SUCCESS;
 }
 
-std::vector<std::string> TestbenchGeneration::print_var_init(const tree_managerConstRef TM, unsigned int var,
-                                                             const memoryRef mem)
+memory_image TestbenchGeneration::print_var_init(const tree_managerConstRef TM, unsigned int var, const memoryRef mem)
 {
-   std::vector<std::string> init_els;
+   memory_image init_els;
    const auto tn = TM->CGetTreeReindex(var);
    const auto init_node = [&]() -> tree_nodeRef {
       const auto vd = GetPointer<const var_decl>(GET_CONST_NODE(tn));
@@ -816,12 +816,12 @@ std::vector<std::string> TestbenchGeneration::print_var_init(const tree_managerC
          const auto type = tree_helper::CGetType(tn);
          const auto data_bitsize = tree_helper::GetArrayElementSize(type);
          const auto num_elements = tree_helper::GetArrayTotalSize(type);
-         init_els.insert(init_els.end(), num_elements, std::string(data_bitsize, '0'));
+         init_els.append_zeros(data_bitsize, num_elements);
       }
       else
       {
          const auto data_bitsize = tree_helper::Size(tn);
-         init_els.push_back(std::string(data_bitsize, '0'));
+         init_els.append_zeros(data_bitsize);
       }
    }
    return init_els;
@@ -831,33 +831,17 @@ unsigned long long TestbenchGeneration::generate_init_file(const std::string& da
                                                            const tree_managerConstRef TM, unsigned int var,
                                                            const memoryRef mem)
 {
-   std::stringstream init_bits;
-   std::ofstream useless;
-   unsigned long long vec_size = 0, elts_size = 0;
+   unsigned long long vec_size = 0, elts_size = 0, element_align = 0;
    const auto var_type = tree_helper::CGetType(TM->CGetTreeReindex(var));
    const auto bitsize_align = GetPointer<const type_node>(GET_CONST_NODE(var_type))->algn;
    THROW_ASSERT((bitsize_align % 8) == 0, "Alignement is not byte aligned.");
-   fu_binding::fill_array_ref_memory(init_bits, useless, var, vec_size, elts_size, mem, TM, false, bitsize_align);
+   auto image = fu_binding::get_array_ref_image(var, vec_size, elts_size, element_align, mem, TM, false);
+   fu_binding::align_array_ref_image(image, var, vec_size, elts_size, TM, bitsize_align);
 
+   // Memory is little-endian, which is the layout of the image bit stream
    std::ofstream init_dat(dat_filename, std::ios::binary);
-   while(!init_bits.eof())
-   {
-      std::string bitstring;
-      init_bits >> bitstring;
-      THROW_ASSERT(bitstring.size() % 8 == 0, "Memory word initializer is not aligned");
-      size_t i;
-      // Memory is little-endian, thus last byte goes in first
-      for(i = bitstring.size(); i >= 8; i -= 8)
-      {
-         char byteval = 0;
-         for(size_t k = 0; k < 8; ++k)
-         {
-            byteval = byteval | static_cast<char>((bitstring.at(i - k - 1U) != '0') << k);
-         }
-         init_dat.put(byteval);
-      }
-   }
-   unsigned long long bytes = static_cast<unsigned long long>(init_dat.tellp());
+   image.write_bytes(init_dat);
+   const auto bytes = image.size() / 8;
    THROW_ASSERT((bytes % (bitsize_align / 8)) == 0, "Memory initalization bytes not aligned");
    return bytes;
 }
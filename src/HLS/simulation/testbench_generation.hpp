@@ -47,6 +47,7 @@
 #include <string>
 #include <vector>
 
+class memory_image;
 class module;
 CONSTREF_FORWARD_DECL(tree_manager);
 REF_FORWARD_DECL(language_writer);
@@ -109,8 +110,7 @@ class TestbenchGeneration
 
    DesignFlowStep_Status Exec() override;
 
-   static std::vector<std::string> print_var_init(const tree_managerConstRef TreeM, unsigned int var,
-                                                  const memoryRef mem);
+   static memory_image print_var_init(const tree_managerConstRef TreeM, unsigned int var, const memoryRef mem);
 
    static unsigned long long generate_init_file(const std::string& dat_filename, const tree_managerConstRef TreeM,
                                                 unsigned int var, const memoryRef mem);
@@ -53,3 +53,8 @@ STG_creator::STG_creator(const ParameterConstRef _Param, const HLS_managerRef _H
 }
 
 STG_creator::~STG_creator() = default;
+
+unsigned int STG_creator::GetLocalFunction() const
+{
+   return funId;
+}
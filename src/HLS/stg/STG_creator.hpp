@@ -65,6 +65,12 @@ class STG_creator : public HLSFunctionStep
     * Destructor.
     */
    ~STG_creator() override;
+
+   /**
+    * Return the function synthesized by this step, since only the data structures of that function are modified
+    * @return the index of the function
+    */
+   unsigned int GetLocalFunction() const override;
 };
 /// refcount definition of the class
 using STG_creatorRef = refcount<STG_creator>;
@@ -147,16 +147,10 @@ static bool var_has_value_ones(const sig_variation& v)
    return all_ones(v.value);
 }
 
-static bool var_is_later_or_equal(const sig_variation& v, const unsigned long long time)
-{
-   return v >= time;
-}
-
-vcd_trace_head::vcd_trace_head(const DiscrepancyOpInfo& op, std::string signame, const std::list<sig_variation>& fv,
-                               const std::list<sig_variation>& ov, const std::list<sig_variation>& sv,
-                               unsigned int init_state_id, unsigned long long clock_p,
-                               const HLS_managerConstRef _HLSMgr, const tree_managerConstRef _TM,
-                               const bool _one_hot_fsm_encoding)
+vcd_trace_head::vcd_trace_head(const DiscrepancyOpInfo& op, std::string signame, const vcd_signal_trace& fv,
+                               const vcd_signal_trace& ov, const vcd_signal_trace& sv, unsigned int init_state_id,
+                               unsigned long long clock_p, const HLS_managerConstRef _HLSMgr,
+                               const tree_managerConstRef _TM, const bool _one_hot_fsm_encoding)
     : state(uninitialized),
       failed(fail_none),
       one_hot_fsm_encoding(_one_hot_fsm_encoding),
@@ -427,9 +421,11 @@ void vcd_trace_head::advance()
          return;
       }
    }
-   const auto& end = op_end_time;
-   const auto var_later_or_equal_than_end = [&end](const sig_variation& s) { return var_is_later_or_equal(s, end); };
-   out_var_it = std::find_if(out_var_it, out_var_end, var_later_or_equal_than_end);
+   /* only time stamps are needed to skip variations, so values are not decoded here */
+   while(out_var_it != out_var_end && out_var_it.time_stamp() < op_end_time)
+   {
+      ++out_var_it;
+   }
    --out_var_it;
    state = initialized;
 }
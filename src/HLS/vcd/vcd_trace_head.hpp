@@ -37,7 +37,6 @@
 #ifndef VCD_TRACE_HEAD_HPP
 #define VCD_TRACE_HEAD_HPP
 
-#include <list>
 #include <string>
 
 #include "sig_variation.hpp"
@@ -51,8 +50,8 @@ CONSTREF_FORWARD_DECL(tree_manager);
 struct vcd_trace_head
 {
  public:
-   vcd_trace_head(const DiscrepancyOpInfo& op_info, std::string signame, const std::list<sig_variation>& fv,
-                  const std::list<sig_variation>& ov, const std::list<sig_variation>& sv, unsigned int init_state_id,
+   vcd_trace_head(const DiscrepancyOpInfo& op_info, std::string signame, const vcd_signal_trace& fv,
+                  const vcd_signal_trace& ov, const vcd_signal_trace& sv, unsigned int init_state_id,
                   unsigned long long clock_period, const HLS_managerConstRef _HLSMgr, const tree_managerConstRef _TM,
                   const bool one_hot_fsm_encoding);
 
@@ -115,15 +114,15 @@ struct vcd_trace_head
    const HLS_managerConstRef HLSMgr;
    const tree_managerConstRef TM;
    const unsigned int initial_state_id;
-   const std::list<sig_variation>& fsm_vars;
-   std::list<sig_variation>::const_iterator fsm_ss_it; // start state iterator
-   std::list<sig_variation>::const_iterator fsm_end;
-   const std::list<sig_variation>& out_vars;
-   std::list<sig_variation>::const_iterator out_var_it;
-   std::list<sig_variation>::const_iterator out_var_end;
-   const std::list<sig_variation>& start_vars;
-   std::list<sig_variation>::const_iterator sp_var_it;
-   std::list<sig_variation>::const_iterator sp_var_end;
+   const vcd_signal_trace& fsm_vars;
+   vcd_signal_trace::const_iterator fsm_ss_it; // start state iterator
+   vcd_signal_trace::const_iterator fsm_end;
+   const vcd_signal_trace& out_vars;
+   vcd_signal_trace::const_iterator out_var_it;
+   vcd_signal_trace::const_iterator out_var_end;
+   const vcd_signal_trace& start_vars;
+   vcd_signal_trace::const_iterator sp_var_it;
+   vcd_signal_trace::const_iterator sp_var_end;
    const std::string fullsigname;
    unsigned long long op_start_time;
    unsigned long long op_end_time;
@@ -90,6 +90,7 @@
 #include "token_interface.hpp"
 #endif
 
+#include <charconv>
 #include <cstdlib>
 #include <filesystem>
 #include <iosfwd>
@@ -386,6 +387,18 @@ void Parameter::PrintUsage(std::ostream& os) const
    PrintHelp(os);
 }
 
+unsigned int Parameter::CheckPositiveInteger(const std::string& option, const std::string& value)
+{
+   unsigned int parsed = 0;
+   const auto last = value.data() + value.size();
+   const auto res = std::from_chars(value.data(), last, parsed);
+   if(value.empty() || res.ec != std::errc() || res.ptr != last || parsed < 1)
+   {
+      THROW_ERROR("BadParameters: --" + option + " requires a positive integer, got \"" + value + "\"");
+   }
+   return parsed;
+}
+
 bool Parameter::ManageDefaultOptions(int next_option, char* optarg_param, bool& exit_success)
 {
    exit_success = false;
@@ -504,6 +517,11 @@ bool Parameter::ManageDefaultOptions(int next_option, char* optarg_param, bool&
          setOption(OPT_seed, optarg_param);
          break;
       }
+      case INPUT_OPT_PROFILE_STEPS:
+      {
+         setOption(OPT_profile_steps, optarg_param ? optarg_param : "");
+         break;
+      }
       case OPT_OUTPUT_TEMPORARY_DIRECTORY:
       {
          const auto path =
@@ -918,6 +936,26 @@ bool Parameter::ManageGccOptions(int next_option, char* optarg_param)
          setOption(OPT_gcc_write_xml, std::string(optarg));
          break;
       }
+      case INPUT_OPT_FRONTEND_JOBS:
+      {
+         setOption(OPT_frontend_jobs, CheckPositiveInteger("frontend-jobs", optarg_param));
+         break;
+      }
+      case INPUT_OPT_FRONTEND_CACHE:
+      {
+         setOption(OPT_frontend_cache, std::filesystem::absolute(optarg_param).string());
+         break;
+      }
+      case INPUT_OPT_FRONTEND_FUNCTION_JOBS:
+      {
+         setOption(OPT_frontend_function_jobs, CheckPositiveInteger("frontend-function-jobs", optarg_param));
+         break;
+      }
+      case INPUT_OPT_FRONTEND_BINARY_IR:
+      {
+         setOption(OPT_frontend_binary_ir, true);
+         break;
+      }
       default:
       {
          /// next_option is not a GCC/CLANG parameter
@@ -1164,6 +1202,10 @@ void Parameter::PrintOutputOptionsUsage(std::ostream& os) const
       << "    --print-dot\n"
       << "        Dump to file several different graphs used in the IR of the tool.\n"
       << "        The graphs are saved in .dot files, in graphviz format\n\n"
+      << "    --profile-steps[=<file>]\n"
+      << "        Print wall time, CPU time, peak memory growth and number of executions\n"
+      << "        of each step of the design flow at the end of the run. If <file> is\n"
+      << "        given, also write the executed steps in Chrome trace-event format.\n\n"
 #if !RELEASE
       << "    --error-on-warning\n"
       << "        Convert all runtime warnings to errors.\n\n"
@@ -1284,6 +1326,17 @@ void Parameter::PrintGccOptionsUsage(std::ostream& os) const
 #endif
       << "    --extra-gcc-options\n"
       << "        Specify custom extra options to the compiler.\n\n"
+      << "    --frontend-jobs=<N>\n"
+      << "        Compile up to <N> source files concurrently (default 1).\n\n"
+      << "    --frontend-cache=<dir>\n"
+      << "        Store the intermediate representation produced by the front-end compiler\n"
+      << "        in <dir> and reuse it when sources and compiler options are unchanged.\n\n"
+      << "    --frontend-function-jobs=<N>\n"
+      << "        Run up to <N> function-local frontend analyses and transformations\n"
+      << "        concurrently on different functions (default 1).\n\n"
+      << "    --frontend-binary-ir\n"
+      << "        Let the clang plugin write the intermediate representation as a compact\n"
+      << "        binary token stream instead of text (the text format is kept for debugging).\n\n"
       << std::endl;
 }
 #endif
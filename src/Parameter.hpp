@@ -121,23 +121,25 @@ enum class CompilerWrapper_CompilerTarget;
        mentor_root)(mentor_modelsim_bin)(mentor_optimizer)(verilator)(verilator_timescale_override)(                   \
        verilator_parallel)(altera_root)(quartus_settings)(quartus_13_settings)(quartus_13_64bit)(nanoxplore_root)(     \
        nanoxplore_settings)(nanoxplore_bypass)(shared_input_registers)(inline_functions)(constraints_functions)(       \
-       axi_burst_type)
+       axi_burst_type)(hls_jobs)(technology_cache)(simulation_shards)(hls_cache)(module_binding_jobs)
 
 #define FRAMEWORK_OPTIONS                                                                                            \
    (benchmark_name)(cat_args)(find_max_transformations)(max_transformations)(compatible_compilers)(compute_size_of)( \
        configuration_name)(debug_level)(default_compiler)(dot_directory)(host_compiler)(ilp_max_time)(ilp_solver)(   \
        input_file)(input_format)(no_clean)(no_parse_files)(no_return_zero)(output_file)(output_level)(               \
        output_temporary_directory)(output_directory)(panda_parameter)(parse_pragma)(pretty_print)(print_dot)(        \
-       profiling_method)(program_name)(read_parameter_xml)(revision)(seed)(test_multiple_non_deterministic_flows)(   \
-       test_single_non_deterministic_flow)(top_functions_names)(xml_input_configuration)(xml_output_configuration)(  \
-       write_parameter_xml)(ignore_parallelism)(ignore_mapping)(mapping)(sequence_length)(without_transformation)(   \
-       blackbox)(input_libraries)(frontend_statistics)(exec_argv)(path)
+       profile_steps)(profiling_method)(program_name)(read_parameter_xml)(revision)(seed)(                           \
+       test_multiple_non_deterministic_flows)(test_single_non_deterministic_flow)(top_functions_names)(              \
+       xml_input_configuration)(xml_output_configuration)(write_parameter_xml)(ignore_parallelism)(ignore_mapping)(  \
+       mapping)(sequence_length)(without_transformation)(blackbox)(input_libraries)(frontend_statistics)(exec_argv)( \
+       path)
 
 #define COMPILER_OPTIONS                                                                                              \
    (gcc_config)(gcc_costs)(gcc_defines)(gcc_extra_options)(gcc_include_sysdir)(gcc_includes)(gcc_libraries)(          \
        gcc_library_directories)(gcc_openmp_simd)(compiler_opt_level)(gcc_m_env)(gcc_optimizations)(                   \
        gcc_optimization_set)(gcc_parameters)(gcc_plugindir)(gcc_read_xml)(gcc_standard)(gcc_undefines)(gcc_warnings)( \
-       gcc_c)(gcc_E)(gcc_S)(gcc_write_xml)
+       gcc_c)(gcc_E)(gcc_S)(gcc_write_xml)(frontend_jobs)(frontend_cache)(frontend_function_jobs)(                    \
+       frontend_binary_ir)
 
 #define SYNTHESIS_OPTIONS                                                                                            \
    (clock_period)(clock_name)(reset_name)(start_name)(done_name)(device_string)(synthesis_flow)(target_device_file)( \
@@ -196,6 +198,7 @@ class OptionMap : public std::map<std::string, std::string>
 #define INPUT_OPT_MAX_TRANSFORMATIONS (1 + INPUT_OPT_CONFIGURATION_NAME)
 #define INPUT_OPT_FIND_MAX_TRANSFORMATIONS (1 + INPUT_OPT_MAX_TRANSFORMATIONS)
 #define INPUT_OPT_PANDA_PARAMETER (1 + INPUT_OPT_FIND_MAX_TRANSFORMATIONS)
+#define INPUT_OPT_PROFILE_STEPS (1 + INPUT_OPT_PANDA_PARAMETER)
 
 /// define the default tool short option string
 #define COMMON_SHORT_OPTIONS_STRING "hVv:d:"
@@ -216,6 +219,7 @@ class OptionMap : public std::map<std::string, std::string>
        {"print-dot", no_argument, nullptr, INPUT_OPT_PRINT_DOT}, {"seed", required_argument, nullptr, INPUT_OPT_SEED}, \
        {"max-transformations", required_argument, nullptr, INPUT_OPT_MAX_TRANSFORMATIONS},                             \
        {"find-max-transformations", no_argument, nullptr, INPUT_OPT_FIND_MAX_TRANSFORMATIONS},                         \
+       {"profile-steps", optional_argument, nullptr, INPUT_OPT_PROFILE_STEPS},                                         \
    {                                                                                                                   \
       "panda-parameter", required_argument, nullptr, INPUT_OPT_PANDA_PARAMETER                                         \
    }
@@ -230,7 +234,11 @@ class OptionMap : public std::map<std::string, std::string>
 #define INPUT_OPT_STD (1 + INPUT_OPT_READ_GCC_XML)
 #define INPUT_OPT_USE_RAW (1 + INPUT_OPT_STD)
 #define INPUT_OPT_WRITE_GCC_XML (1 + INPUT_OPT_USE_RAW)
-#define LAST_GCC_OPT INPUT_OPT_WRITE_GCC_XML
+#define INPUT_OPT_FRONTEND_JOBS (1 + INPUT_OPT_WRITE_GCC_XML)
+#define INPUT_OPT_FRONTEND_CACHE (1 + INPUT_OPT_FRONTEND_JOBS)
+#define INPUT_OPT_FRONTEND_FUNCTION_JOBS (1 + INPUT_OPT_FRONTEND_CACHE)
+#define INPUT_OPT_FRONTEND_BINARY_IR (1 + INPUT_OPT_FRONTEND_FUNCTION_JOBS)
+#define LAST_GCC_OPT INPUT_OPT_FRONTEND_BINARY_IR
 
 /// define the GCC short option string
 #define GCC_SHORT_OPTIONS_STRING "cf:I:D:U:O::l:L:W:Em:g::"
@@ -245,14 +253,18 @@ class OptionMap : public std::map<std::string, std::string>
 #endif
 #define GCC_LONG_OPTIONS_COMPILER {"compiler", required_argument, nullptr, INPUT_OPT_COMPILER},
 
-#define GCC_LONG_OPTIONS                                                               \
-   GCC_LONG_OPTIONS_COMPILER{"std", required_argument, nullptr, INPUT_OPT_STD},        \
-       GCC_LONG_OPTIONS_RAW_XML{"param", required_argument, nullptr, INPUT_OPT_PARAM}, \
-       {"Include-sysdir", no_argument, nullptr, INPUT_OPT_INCLUDE_SYSDIR},             \
-       {"gcc-config", no_argument, nullptr, INPUT_OPT_GCC_CONFIG},                     \
-       {"compute-sizeof", no_argument, nullptr, INPUT_OPT_COMPUTE_SIZEOF},             \
-   {                                                                                   \
-      "extra-gcc-options", required_argument, nullptr, INPUT_OPT_CUSTOM_OPTIONS        \
+#define GCC_LONG_OPTIONS                                                                         \
+   GCC_LONG_OPTIONS_COMPILER{"std", required_argument, nullptr, INPUT_OPT_STD},                  \
+       GCC_LONG_OPTIONS_RAW_XML{"param", required_argument, nullptr, INPUT_OPT_PARAM},           \
+       {"Include-sysdir", no_argument, nullptr, INPUT_OPT_INCLUDE_SYSDIR},                       \
+       {"gcc-config", no_argument, nullptr, INPUT_OPT_GCC_CONFIG},                               \
+       {"compute-sizeof", no_argument, nullptr, INPUT_OPT_COMPUTE_SIZEOF},                       \
+       {"frontend-jobs", required_argument, nullptr, INPUT_OPT_FRONTEND_JOBS},                   \
+       {"frontend-cache", required_argument, nullptr, INPUT_OPT_FRONTEND_CACHE},                 \
+       {"frontend-function-jobs", required_argument, nullptr, INPUT_OPT_FRONTEND_FUNCTION_JOBS}, \
+       {"frontend-binary-ir", no_argument, nullptr, INPUT_OPT_FRONTEND_BINARY_IR},               \
+   {                                                                                             \
+      "extra-gcc-options", required_argument, nullptr, INPUT_OPT_CUSTOM_OPTIONS                  \
    }
 
 /**
@@ -343,6 +355,14 @@ class Parameter
     */
    bool ManageDefaultOptions(int next_option, char* optarg_param, bool& exit_success);
 
+   /**
+    * Check that the argument of an option is a positive integer
+    * @param option is the name of the option (used in the error message)
+    * @param value is the argument to be checked
+    * @return the parsed value
+    */
+   static unsigned int CheckPositiveInteger(const std::string& option, const std::string& value);
+
 #if HAVE_FROM_C_BUILT
    /**
     * Manage Gcc options
@@ -285,6 +285,7 @@ int main(int argc, char* argv[])
       design_flow_manager->AddSteps(
           GetPointer<const HLSFlowStepFactory>(hls_flow_step_factory)->CreateHLSFlowSteps(hls_flow_step));
       design_flow_manager->Exec();
+      HLSMgr->get_tree_manager()->PrintFindStatistics();
       if(not(parameters->getOption<bool>(OPT_no_clean)))
       {
          std::filesystem::remove_all(parameters->getOption<std::string>(OPT_output_temporary_directory));
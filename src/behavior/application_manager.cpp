@@ -369,12 +369,12 @@ void application_manager::RegisterTransformation(const std::string&
                     tree_helper::print_function_name(get_tree_manager(), GetPointerS<const function_decl>(tn))) :
                    tn->ToString();
    }
-   THROW_ASSERT(cfg_transformations < Param->getOption<size_t>(OPT_max_transformations),
-                step + " - " + tn_str + " Transformations " + STR(cfg_transformations));
-   cfg_transformations++;
+   const size_t transformation = cfg_transformations++;
+   THROW_ASSERT(transformation < Param->getOption<size_t>(OPT_max_transformations),
+                step + " - " + tn_str + " Transformations " + STR(transformation));
    if(Param->getOption<size_t>(OPT_max_transformations) != std::numeric_limits<size_t>::max())
    {
-      INDENT_OUT_MEX(0, 0, "---Transformation " + STR(cfg_transformations) + " - " + step + " - " + tn_str);
+      INDENT_OUT_MEX(0, 0, "---Transformation " + STR(transformation + 1) + " - " + step + " - " + tn_str);
    }
 #endif
 }
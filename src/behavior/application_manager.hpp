@@ -48,6 +48,7 @@
 #include "refcount.hpp"
 #include "tree_node.hpp"
 
+#include <atomic>
 #include <cstddef>
 #include <string>
 
@@ -92,8 +93,9 @@ class application_manager
    pragma_managerRef PM;
 #endif
 
-   /// The number of cfg transformations applied to this function
-   size_t cfg_transformations;
+   /// The number of cfg transformations applied to this function (function-local steps can register them
+   /// concurrently)
+   std::atomic<size_t> cfg_transformations;
 
    /// debugging level of the class
    const int debug_level;
@@ -75,7 +75,10 @@
 #include <boost/iterator/filter_iterator.hpp> // for filter_iterator
 #include <boost/iterator/iterator_facade.hpp> // for operator!=, operator++
 #include <boost/tuple/tuple.hpp>              // for tie
+#include <algorithm>                          // for min, max
+#include <limits>                             // for numeric_limits
 #include <list>                               // for list, _List_const_i...
+#include <memory>                             // for make_shared
 #include <ostream>                            // for operator<<, basic_o...
 #include <string>                             // for operator+, char_traits
 #include <utility>                            // for pair
@@ -157,6 +160,9 @@ FunctionBehavior::FunctionBehavior(const application_managerConstRef _AppM, cons
           _parameters->isOption(OPT_channels_number) ? _parameters->getOption<unsigned int>(OPT_channels_number) : 0),
       _channels_type(_parameters->getOption<MemoryAllocation_ChannelsType>(OPT_channels_type)),
       _allocation_policy(_parameters->getOption<MemoryAllocation_Policy>(OPT_memory_allocation_policy)),
+      op_graph_views(),
+      op_graph_views_version(0),
+      op_graph_views_mutex(),
       bb_reachability(),
       feedback_bb_reachability(),
       ogc(new operations_graph_constructor(op_graphs_collection)),
@@ -381,89 +387,121 @@ const BehavioralHelperConstRef FunctionBehavior::CGetBehavioralHelper() const
 const OpGraphConstRef FunctionBehavior::CGetOpGraph(FunctionBehavior::graph_type gt,
                                                     const OpVertexSet& statements) const
 {
-   /// This "transformation" is necessary because of graph constructor
-   CustomUnorderedSet<vertex> subset;
-   subset.insert(statements.begin(), statements.end());
+   int selector = 0;
    switch(gt)
    {
       case CFG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, CFG_SELECTOR, subset));
-
+         selector = CFG_SELECTOR;
+         break;
       case FCFG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, FCFG_SELECTOR, subset));
-
+         selector = FCFG_SELECTOR;
+         break;
       case ECFG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, CFG_SELECTOR | ECFG_SELECTOR, subset));
-
+         selector = CFG_SELECTOR | ECFG_SELECTOR;
+         break;
       case CDG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, CDG_SELECTOR, subset));
-
+         selector = CDG_SELECTOR;
+         break;
       case FCDG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, FCDG_SELECTOR, subset));
-
+         selector = FCDG_SELECTOR;
+         break;
       case DFG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, DFG_SELECTOR, subset));
-
+         selector = DFG_SELECTOR;
+         break;
       case FDFG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, FDFG_SELECTOR, subset));
-
+         selector = FDFG_SELECTOR;
+         break;
       case ADG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, ADG_SELECTOR, subset));
-
+         selector = ADG_SELECTOR;
+         break;
       case FADG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, ADG_SELECTOR | FB_ADG_SELECTOR, subset));
-
+         selector = ADG_SELECTOR | FB_ADG_SELECTOR;
+         break;
       case ODG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, ODG_SELECTOR, subset));
-
+         selector = ODG_SELECTOR;
+         break;
       case FODG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, FODG_SELECTOR, subset));
-
+         selector = FODG_SELECTOR;
+         break;
       case SDG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, SDG_SELECTOR, subset));
-
+         selector = SDG_SELECTOR;
+         break;
       case FSDG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, FSDG_SELECTOR, subset));
-
+         selector = FSDG_SELECTOR;
+         break;
       case SAODG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, SAODG_SELECTOR, subset));
-
+         selector = SAODG_SELECTOR;
+         break;
       case FSAODG:
-         return OpGraphRef(
-             new OpGraph(op_graphs_collection, FSDG_SELECTOR | FADG_SELECTOR | FODG_SELECTOR | FDFG_SELECTOR, subset));
-
+         selector = FSDG_SELECTOR | FADG_SELECTOR | FODG_SELECTOR | FDFG_SELECTOR;
+         break;
       case FLSAODG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, SAODG_SELECTOR | FLG_SELECTOR, subset));
-
+         selector = SAODG_SELECTOR | FLG_SELECTOR;
+         break;
 #ifndef NDEBUG
       case FLSAODDG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, SAODG_SELECTOR | FLG_SELECTOR | DEBUG_SELECTOR, subset));
+         selector = SAODG_SELECTOR | FLG_SELECTOR | DEBUG_SELECTOR;
+         break;
 #endif
-
       case FFLSAODG:
-         return OpGraphRef(
-             new OpGraph(op_graphs_collection, FLG_SELECTOR | FSDG_SELECTOR | FADG_SELECTOR | FODG_SELECTOR, subset));
-
+         selector = FLG_SELECTOR | FSDG_SELECTOR | FADG_SELECTOR | FODG_SELECTOR;
+         break;
       case FLAODDG:
-         return OpGraphRef(
-             new OpGraph(op_graphs_collection, DFG_SELECTOR | ADG_SELECTOR | ODG_SELECTOR | FLG_SELECTOR, subset));
-
+         selector = DFG_SELECTOR | ADG_SELECTOR | ODG_SELECTOR | FLG_SELECTOR;
+         break;
       case FFLAODDG:
-         return OpGraphRef(
-             new OpGraph(op_graphs_collection, FLG_SELECTOR | FADG_SELECTOR | FODG_SELECTOR | FDFG_SELECTOR));
-
+         /// this graph is not filtered on the operations
+         return CGetOpGraph(FFLAODDG);
       case FLG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, FLG_SELECTOR, subset));
-
+         selector = FLG_SELECTOR;
+         break;
       case SG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, SG_SELECTOR, subset));
-
+         selector = SG_SELECTOR;
+         break;
       case AGG_VIRTUALG:
-         return OpGraphRef(new OpGraph(op_graphs_collection, DFG_AGG_SELECTOR | ADG_AGG_SELECTOR, subset));
+         selector = DFG_AGG_SELECTOR | ADG_AGG_SELECTOR;
+         break;
       default:
          THROW_UNREACHABLE("");
    }
-   return OpGraphConstRef();
+   /// The subset is identified by the bitmap of the indices of its operations
+   const auto index_map = boost::get(boost::vertex_index_t(), *op_graphs_collection);
+   VertexIndexBitmap subset;
+   if(!statements.empty())
+   {
+      auto min_index = std::numeric_limits<size_t>::max();
+      size_t max_index = 0;
+      for(const auto statement : statements)
+      {
+         const auto index = index_map[statement];
+         min_index = std::min(min_index, index);
+         max_index = std::max(max_index, index);
+      }
+      subset.offset = min_index;
+      subset.bits.resize(max_index - min_index + 1, false);
+      for(const auto statement : statements)
+      {
+         subset.bits[index_map[statement] - min_index] = true;
+      }
+   }
+
+   std::lock_guard<std::mutex> lock(op_graph_views_mutex);
+   if(op_graph_views_version != op_graphs_collection->GetOperationsVersion())
+   {
+      /// views built on a different set of operations could refer to stale vertex indices
+      op_graph_views.clear();
+      op_graph_views_version = op_graphs_collection->GetOperationsVersion();
+   }
+   auto key = std::make_pair(selector, std::move(subset));
+   const auto view = op_graph_views.find(key);
+   if(view != op_graph_views.end())
+   {
+      return view->second;
+   }
+   const OpGraphConstRef op_graph(
+       new OpGraph(op_graphs_collection, selector, std::make_shared<const VertexIndexBitmap>(key.second)));
+   op_graph_views.emplace(std::move(key), op_graph);
+   return op_graph;
 }
 
 BBGraphRef FunctionBehavior::GetBBGraph(FunctionBehavior::bb_graph_type gt)
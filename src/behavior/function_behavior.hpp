@@ -58,6 +58,8 @@
 #include <deque>      // for deque
 #include <functional> // for binary_function
 #include <iosfwd>     // for ostream, size_t
+#include <map>        // for map
+#include <mutex>      // for mutex
 #include <typeindex>  // for hash
 
 /**
@@ -384,6 +386,16 @@ class FunctionBehavior
 
    MemoryAllocation_Policy _allocation_policy;
 
+   /// The views of the operation graphs over subsets of the operations built by CGetOpGraph, indexed by selector and
+   /// subset
+   mutable std::map<std::pair<int, VertexIndexBitmap>, OpGraphConstRef> op_graph_views;
+
+   /// The version of the operations of op_graphs_collection op_graph_views refers to
+   mutable size_t op_graph_views_version;
+
+   /// Mutex protecting op_graph_views
+   mutable std::mutex op_graph_views_mutex;
+
  public:
    /**
     * Constructor
@@ -528,7 +540,8 @@ class FunctionBehavior
    const OpGraphConstRef CGetOpGraph(FunctionBehavior::graph_type gt) const;
 
    /**
-    * This method returns the operation graph having as vertices the vertices of subset
+    * This method returns the operation graph having as vertices the vertices of subset.
+    * The graph is built once for each type and subset and then shared until the set of operations changes.
     * @param gt is the type of the graph to be returned
     * @param subset is the set of subgraph vertices
     * @return the refcount to the subgraph
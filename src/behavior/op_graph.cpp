@@ -250,7 +250,8 @@ OpGraphInfo::~OpGraphInfo() = default;
 
 OpGraphsCollection::OpGraphsCollection(const OpGraphInfoRef _info, const ParameterConstRef _parameters)
     : graphs_collection(RefcountCast<GraphInfo>(_info), _parameters),
-      operations(OpGraphConstRef(new OpGraph(OpGraphsCollectionRef(this, null_deleter()), 0)))
+      operations(OpGraphConstRef(new OpGraph(OpGraphsCollectionRef(this, null_deleter()), 0))),
+      operations_version(0)
 {
 }
 
@@ -265,12 +266,14 @@ void OpGraphsCollection::RemoveVertex(boost::graph_traits<boost_graphs_collectio
 {
    operations.erase(v);
    graphs_collection::RemoveVertex(v);
+   ++operations_version;
 }
 
 boost::graph_traits<boost_graphs_collection>::vertex_descriptor OpGraphsCollection::AddVertex(const NodeInfoRef info)
 {
    const auto new_vertex = graphs_collection::AddVertex(info);
    operations.insert(new_vertex);
+   ++operations_version;
    return new_vertex;
 }
 
@@ -278,6 +281,7 @@ void OpGraphsCollection::Clear()
 {
    operations.clear();
    graphs_collection::clear();
+   ++operations_version;
 }
 
 #if HAVE_UNORDERED
@@ -332,6 +336,12 @@ OpGraph::OpGraph(const OpGraphsCollectionRef _op_graphs_collection, int _selecto
 {
 }
 
+OpGraph::OpGraph(const OpGraphsCollectionRef _op_graphs_collection, int _selector,
+                 const std::shared_ptr<const VertexIndexBitmap>& _sub)
+    : graph(_op_graphs_collection.get(), _selector, _sub)
+{
+}
+
 OpGraph::~OpGraph() = default;
 
 void OpGraph::WriteDot(const std::filesystem::path& file_name, const int detail_level) const
@@ -706,6 +706,9 @@ class OpGraphsCollection : public graphs_collection
    /// The set of operations
    OpVertexSet operations;
 
+   /// Incremented every time the set of operations changes
+   size_t operations_version;
+
  public:
    /**
     * Empty Constructror
@@ -756,6 +759,15 @@ class OpGraphsCollection : public graphs_collection
     */
    const OpVertexSet CGetOperations() const;
 
+   /**
+    * Return the version of the set of operations; views built over a subset of the operations are valid only as long
+    * as it does not change
+    */
+   size_t GetOperationsVersion() const
+   {
+      return operations_version;
+   }
+
    /**
     * Remove all the edges and vertices from the graph
     */
@@ -790,6 +802,15 @@ struct OpGraph : public graph
    OpGraph(const OpGraphsCollectionRef _op_graphs_collection, int selector,
            const CustomUnorderedSet<boost::graph_traits<OpGraphsCollection>::vertex_descriptor>& sub);
 
+   /**
+    * Sub-graph constructor.
+    * @param g is the bulk graph.
+    * @param selector is the selector used to filter the bulk graph.
+    * @param sub is the set of the indices of the vertices on which the graph is filtered.
+    */
+   OpGraph(const OpGraphsCollectionRef _op_graphs_collection, int selector,
+           const std::shared_ptr<const VertexIndexBitmap>& sub);
+
    /**
     * Destructor
     */
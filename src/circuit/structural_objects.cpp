@@ -636,12 +636,12 @@ unsigned int structural_object::get_treenode() const
 
 void structural_object::set_id(const std::string& s)
 {
-   id = s;
+   id = interned_string(s);
 }
 
 const std::string& structural_object::get_id() const
 {
-   return id;
+   return id.str();
 }
 
 void structural_object::set_type(const structural_type_descriptorRef& s)
@@ -774,47 +774,53 @@ bool structural_object::get_black_box() const
 
 void structural_object::SetParameter(const std::string& name, const std::string& value)
 {
-   THROW_ASSERT(default_parameters.find(name) != default_parameters.end(),
-                "Parameter " + name + " does not exist in " + get_typeRef()->id_type);
-   parameters[name] = value;
+   THROW_ASSERT(default_parameters.find(name), "Parameter " + name + " does not exist in " + get_typeRef()->id_type);
+   parameters.insert_or_assign(name, value);
 }
 
 std::string structural_object::GetParameter(std::string name) const
 {
-   if(parameters.find(name) != parameters.end())
+   const auto value = parameters.find(name);
+   if(value)
+   {
+      return *value;
+   }
+   const auto default_value = default_parameters.find(name);
+   if(!default_value)
    {
-      return parameters.at(name);
+      THROW_ERROR("Parameter " + name + " has no value associated for unit " + get_typeRef()->id_type);
    }
-   THROW_ASSERT(default_parameters.find(name) != default_parameters.end(),
-                "Parameter " + name + " has no value associated for unit " + get_typeRef()->id_type);
-   return default_parameters.at(name);
+   return *default_value;
 }
 
 void structural_object::AddParameter(const std::string& name, const std::string& default_value)
 {
-   THROW_ASSERT(default_parameters.find(name) == default_parameters.end() or
-                    default_parameters.at(name) == default_value,
-                "Parameter " + name + " already added. Old default: " + default_parameters.at(name) +
+   THROW_ASSERT(!default_parameters.find(name) or *default_parameters.find(name) == default_value,
+                "Parameter " + name + " already added. Old default: " + *default_parameters.find(name) +
                     " New default: " + default_value);
-   default_parameters[name] = default_value;
+   default_parameters.insert_or_assign(name, default_value);
 }
 
 std::string structural_object::GetDefaultParameter(std::string name) const
 {
-   THROW_ASSERT(default_parameters.find(name) != default_parameters.end(), "Parameter " + name + " does not exist");
-   return default_parameters.at(name);
+   const auto default_value = default_parameters.find(name);
+   if(!default_value)
+   {
+      THROW_ERROR("Parameter " + name + " does not exist");
+   }
+   return *default_value;
 }
 
 CustomMap<std::string, std::string> structural_object::GetParameters() const
 {
    CustomMap<std::string, std::string> ret;
-   for(const auto& default_parameter : default_parameters)
+   for(const auto& default_parameter : default_parameters.entries())
    {
-      ret[default_parameter.first] = default_parameter.second;
+      ret[default_parameter.first.str()] = default_parameter.second;
    }
-   for(const auto& parameter : parameters)
+   for(const auto& parameter : parameters.entries())
    {
-      ret[parameter.first] = parameter.second;
+      ret[parameter.first.str()] = parameter.second;
    }
    return ret;
 }
@@ -885,7 +891,7 @@ structural_type_descriptor::s_type module::get_parameter_type(const technology_m
 
 bool structural_object::ExistsParameter(std::string name) const
 {
-   return default_parameters.count(name);
+   return default_parameters.find(name) != nullptr;
 }
 
 void structural_object::xload(const xml_element* Enode, structural_objectRef, structural_managerRef const&)
@@ -893,7 +899,9 @@ void structural_object::xload(const xml_element* Enode, structural_objectRef, st
    /// owner not managed by xload
    if(CE_XVM(id, Enode))
    {
-      LOAD_XVM(id, Enode);
+      std::string id_string;
+      LOAD_XVFM(id_string, Enode, id);
+      set_id(id_string);
    }
    if(CE_XVM(treenode, Enode))
    {
@@ -935,7 +943,14 @@ void structural_object::xload(const xml_element* Enode, structural_objectRef, st
          }
          std::string default_value = text->get_content();
          xml_node::convert_escaped(default_value);
-         default_parameters[name] = default_value;
+         default_parameters.insert_or_assign(name, default_value);
+         if(CE_XVM(value, EnodeC))
+         {
+            std::string value;
+            LOAD_XVM(value, EnodeC);
+            xml_node::convert_escaped(value);
+            parameters.insert_or_assign(name, value);
+         }
       }
    }
    THROW_ASSERT(has_structural_type_descriptor,
@@ -961,10 +976,16 @@ void structural_object::xwrite(xml_element* Enode)
    }
    if(!default_parameters.empty())
    {
-      for(const auto& default_parameter : default_parameters)
+      for(const auto& default_parameter : default_parameters.entries())
       {
          xml_element* Enode_parameter = Enode->add_child_element("parameter");
          WRITE_XNVM2("name", default_parameter.first, Enode_parameter);
+         /// the actual value of an instance parameter is kept next to its default
+         const auto value = parameters.find(default_parameter.first.str());
+         if(value)
+         {
+            WRITE_XNVM2("value", *value, Enode_parameter);
+         }
          Enode_parameter->add_child_text(STR(default_parameter.second));
       }
    }
@@ -1679,6 +1700,10 @@ void port_o::xload(const xml_element* Enode, structural_objectRef _owner, struct
    {
       LOAD_XVM(size_parameter, Enode);
    }
+   if(CE_XVM(bus_bundle, Enode))
+   {
+      LOAD_XVM(bus_bundle, Enode);
+   }
 
    structural_objectRef obj;
    auto minBit = std::numeric_limits<unsigned>::max();
@@ -1846,6 +1871,14 @@ void port_o::xwrite(xml_element* rootnode)
    {
       WRITE_XVM(is_var_args, Enode);
    }
+   if(size_parameter != "")
+   {
+      WRITE_XVM(size_parameter, Enode);
+   }
+   if(bus_bundle != "")
+   {
+      WRITE_XVM(bus_bundle, Enode);
+   }
    for(auto& port : ports)
    {
       port->xwrite(Enode);
@@ -3132,28 +3165,28 @@ void module::add_internal_object(structural_objectRef c)
    {
       case constant_o_K:
       {
-         index_constants[c->get_id()] = c;
+         index_constants.insert_or_assign(c->get_id(), c);
          break;
       }
       case signal_vector_o_K:
       case signal_o_K:
       {
-         index_signals[c->get_id()] = c;
+         index_signals.insert_or_assign(c->get_id(), c);
          break;
       }
       case component_o_K:
       {
-         index_components[c->get_id()] = c;
+         index_components.insert_or_assign(c->get_id(), c);
          break;
       }
       case channel_o_K:
       {
-         index_channels[c->get_id()] = c;
+         index_channels.insert_or_assign(c->get_id(), c);
          break;
       }
       case bus_connection_o_K:
       {
-         index_bus_connections[c->get_id()] = c;
+         index_bus_connections.insert_or_assign(c->get_id(), c);
          break;
       }
       case action_o_K:
@@ -3365,27 +3398,27 @@ structural_objectRef module::find_member(const std::string& _id, so_kind _type,
       case component_o_K:
       {
          auto it = index_components.find(_id);
-         if(it != index_components.end())
+         if(it)
          {
-            return it->second;
+            return *it;
          }
          break;
       }
       case channel_o_K:
       {
          auto it = index_channels.find(_id);
-         if(it != index_channels.end())
+         if(it)
          {
-            return it->second;
+            return *it;
          }
          break;
       }
       case constant_o_K:
       {
          auto it = index_constants.find(_id);
-         if(it != index_constants.end())
+         if(it)
          {
-            return it->second;
+            return *it;
          }
          break;
       }
@@ -3393,18 +3426,18 @@ structural_objectRef module::find_member(const std::string& _id, so_kind _type,
       case signal_o_K:
       {
          auto it = index_signals.find(_id);
-         if(it != index_signals.end())
+         if(it)
          {
-            return it->second;
+            return *it;
          }
          break;
       }
       case bus_connection_o_K:
       {
          auto it = index_bus_connections.find(_id);
-         if(it != index_bus_connections.end())
+         if(it)
          {
-            return it->second;
+            return *it;
          }
          break;
       }
@@ -3667,7 +3700,7 @@ void module::copy(structural_objectRef dest) const
       }
    }
 
-   for(const auto& index_constant : index_constants)
+   for(const auto& index_constant : index_constants.entries())
    {
       const structural_objectRef int_obj = index_constant.second;
       const structural_objectRef dest_el = dest->find_isomorphic(int_obj);
@@ -3713,7 +3746,7 @@ void module::copy(structural_objectRef dest) const
       }
    }
 
-   for(const auto& index_signal : index_signals)
+   for(const auto& index_signal : index_signals.entries())
    {
       const structural_objectRef int_obj = index_signal.second;
       std::vector<structural_objectRef> signal_objs;
@@ -3771,12 +3804,12 @@ void module::copy(structural_objectRef dest) const
       }
    }
 
-   for(auto l = index_bus_connections.begin(); l != index_bus_connections.end(); ++l)
+   if(!index_bus_connections.empty())
    {
       THROW_ERROR("Copy of bus connections is not yet supported");
    }
 
-   for(auto l = index_channels.begin(); l != index_channels.end(); ++l)
+   if(!index_channels.empty())
    {
       THROW_ERROR("Copy of bus connections is not yet supported");
    }
@@ -3910,9 +3943,9 @@ structural_objectRef module::find_isomorphic(const structural_objectRef key) con
       case component_o_K:
       {
          auto it = index_components.find(key->get_id());
-         if(it != index_components.end())
+         if(it)
          {
-            return it->second;
+            return *it;
          }
          THROW_ERROR("Something went wrong with module " + key->get_path());
          break;
@@ -3920,9 +3953,9 @@ structural_objectRef module::find_isomorphic(const structural_objectRef key) con
       case channel_o_K:
       {
          auto it = index_channels.find(key->get_id());
-         if(it != index_channels.end())
+         if(it)
          {
-            return it->second;
+            return *it;
          }
          THROW_ERROR("Something went wrong with module " + key->get_path());
          break;
@@ -3930,9 +3963,9 @@ structural_objectRef module::find_isomorphic(const structural_objectRef key) con
       case constant_o_K:
       {
          auto it = index_constants.find(key->get_id());
-         if(it != index_constants.end())
+         if(it)
          {
-            return it->second;
+            return *it;
          }
          THROW_ERROR("Something went wrong with module " + key->get_path());
          break;
@@ -3941,16 +3974,16 @@ structural_objectRef module::find_isomorphic(const structural_objectRef key) con
       case signal_o_K:
       {
          auto it = index_signals.find(key->get_id());
-         if(it != index_signals.end())
+         if(it)
          {
-            return it->second;
+            return *it;
          }
          if(key->get_owner()->get_kind() == signal_vector_o_K)
          {
             it = index_signals.find(key->get_owner()->get_id());
-            if(it != index_signals.end())
+            if(it)
             {
-               return it->second->find_isomorphic(key);
+               return (*it)->find_isomorphic(key);
             }
          }
          THROW_ERROR("Something went wrong! " + key->get_path() + " in " + get_path());
@@ -3959,9 +3992,9 @@ structural_objectRef module::find_isomorphic(const structural_objectRef key) con
       case bus_connection_o_K:
       {
          auto it = index_bus_connections.find(key->get_id());
-         if(it != index_bus_connections.end())
+         if(it)
          {
-            return it->second;
+            return *it;
          }
          break;
       }
@@ -4442,10 +4475,15 @@ void module::xwrite(xml_element* rootnode)
       xml_element* xml_specialized = rootnode->add_child_element("specialized");
       xml_specialized->add_child_text(specialized);
    }
+   if(multi_unit_multiplicity)
+   {
+      xml_element* xml_multi_unit_multiplicity = rootnode->add_child_element("multi_unit_multiplicity");
+      xml_multi_unit_multiplicity->add_child_text(STR(multi_unit_multiplicity));
+   }
    if(keep_hierarchy)
    {
       xml_element* xml_keep_hierarchy = rootnode->add_child_element("keep_hierarchy");
-      xml_keep_hierarchy->add_child_text("true");
+      xml_keep_hierarchy->add_child_text("1");
    }
 
    if(in_ports.size())
@@ -52,6 +52,7 @@
 #include "NP_functionality.hpp"
 #include "custom_map.hpp"
 #include "exceptions.hpp"
+#include "interned_string.hpp"
 #include "refcount.hpp"
 #include "simple_indent.hpp"
 
@@ -337,8 +338,8 @@ class structural_object
    /// The owner  of the object
    Wrefcount<structural_object> owner;
 
-   /// Identifier for this component
-   std::string id;
+   /// Identifier for this component; identifiers are pooled since the same names recur in every instance of a module
+   interned_string id;
 
    /// The description of the type.
    structural_type_descriptorRef type;
@@ -350,10 +351,10 @@ class structural_object
    bool black_box;
 
    /// Map between parameter string and related values of an instance
-   CustomMap<std::string, std::string> parameters;
+   interned_string_map<std::string> parameters;
 
    /// Map between parameter string and its default value
-   CustomMap<std::string, std::string> default_parameters;
+   interned_string_map<std::string> default_parameters;
 
  protected:
    friend structural_manager;
@@ -1800,23 +1801,23 @@ class module : public structural_object
 
    /// index for signals
    /// this table is used to quickly search internal signals used by find_member and find_isomorphic
-   std::map<std::string, structural_objectRef> index_signals;
+   interned_string_map<structural_objectRef> index_signals;
 
    /// index for constants
    /// this table is used to quickly search internal constants used by find_member and find_isomorphic
-   std::map<std::string, structural_objectRef> index_constants;
+   interned_string_map<structural_objectRef> index_constants;
 
    /// index for components
    /// this table is used to quickly search internal components used by find_member and find_isomorphic
-   std::map<std::string, structural_objectRef> index_components;
+   interned_string_map<structural_objectRef> index_components;
 
    /// index for channels
    /// this table is used to quickly search internal channels used by find_member and find_isomorphic
-   std::map<std::string, structural_objectRef> index_channels;
+   interned_string_map<structural_objectRef> index_channels;
 
    /// index for bus_connections
    /// this table is used to quickly search internal bus_connections used by find_member and find_isomorphic
-   std::map<std::string, structural_objectRef> index_bus_connections;
+   interned_string_map<structural_objectRef> index_bus_connections;
 
    /// Store the module description
    std::string description;
@@ -73,7 +73,7 @@ std::string CBackendInformation::GetKindText() const
    return "";
 }
 
-std::string CBackendInformation::GetSignature() const
+unsigned int CBackendInformation::GetSignatureContext() const
 {
-   return "CBackend::" + GetKindText();
+   return static_cast<unsigned int>(type);
 }
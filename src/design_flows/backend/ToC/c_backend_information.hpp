@@ -82,7 +82,7 @@ class CBackendInformation : public HLSFlowStepSpecialization
 
    std::string GetKindText() const override;
 
-   std::string GetSignature() const override;
+   unsigned int GetSignatureContext() const override;
 };
 using CBackendInformationConstRef = refcount<const CBackendInformation>;
 using CBackendInformationRef = refcount<CBackendInformation>;
@@ -64,8 +64,6 @@ class CBackendStepFactory : public DesignFlowStepFactory
    CBackendStepFactory(const DesignFlowManagerConstRef design_flow_manager,
                        const application_managerConstRef application_manager, const ParameterConstRef _parameters);
 
-   const std::string GetPrefix() const override;
-
    /**
     * Create a backend c step
     * @param c_backend_information is the information about the frontend to be generated
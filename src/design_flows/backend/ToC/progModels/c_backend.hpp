@@ -108,7 +108,7 @@ class CBackend : public DesignFlowStep
 
    DesignFlowStep_Status Exec() override;
 
-   std::string GetSignature() const final;
+   signature_t GetSignature() const final;
 
    std::string GetName() const final;
 
@@ -117,7 +117,7 @@ class CBackend : public DesignFlowStep
    /**
     * Compute the signature for a c backend step
     */
-   static std::string ComputeSignature(const CBackendInformationConstRef type);
+   static signature_t ComputeSignature(const CBackendInformationConstRef type);
 };
 using CBackendRef = refcount<CBackend>;
 using CBackendConstRef = refcount<const CBackend>;
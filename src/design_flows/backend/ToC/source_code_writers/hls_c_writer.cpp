@@ -483,10 +483,17 @@ void HLSCWriter::InternalWriteFile()
       }
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Written parameters declaration");
       // ---- WRITE PARAMETERS INITIALIZATION AND FUNCTION CALLS ----
+      const auto is_sharded = Param->isOption(OPT_simulation_shards) &&
+                              Param->getOption<unsigned int>(OPT_simulation_shards) > 1;
       for(unsigned int v_idx = 0; v_idx < test_vectors.size(); v_idx++)
       {
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
                         "-->Writing initialization for test vector " + STR(v_idx));
+         if(is_sharded)
+         {
+            // each simulation shard only runs the test vectors assigned to it
+            indented_output_stream->Append("if(m_shard_selected(" + STR(v_idx) + "))\n");
+         }
          indented_output_stream->Append("{\n");
          const auto& curr_test_vector = test_vectors.at(v_idx);
          // write parameter initialization
@@ -106,9 +106,9 @@ void GenerateFuList::ComputeRelationships(DesignFlowStepSet& relationship,
       {
          const DesignFlowGraphConstRef design_flow_graph = design_flow_manager.lock()->CGetDesignFlowGraph();
          const auto* technology_flow_step_factory = GetPointer<const TechnologyFlowStepFactory>(
-             design_flow_manager.lock()->CGetDesignFlowStepFactory("Technology"));
+             design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::TECHNOLOGY));
          {
-            const std::string technology_flow_signature =
+            const auto technology_flow_signature =
                 TechnologyFlowStep::ComputeSignature(TechnologyFlowStep_Type::LOAD_FILE_TECHNOLOGY);
             const vertex technology_flow_step =
                 design_flow_manager.lock()->GetDesignFlowStep(technology_flow_signature);
@@ -120,7 +120,7 @@ void GenerateFuList::ComputeRelationships(DesignFlowStepSet& relationship,
             relationship.insert(technology_design_flow_step);
          }
          {
-            const std::string technology_flow_signature =
+            const auto technology_flow_signature =
                 TechnologyFlowStep::ComputeSignature(TechnologyFlowStep_Type::LOAD_DEVICE_TECHNOLOGY);
             const vertex technology_flow_step =
                 design_flow_manager.lock()->GetDesignFlowStep(technology_flow_signature);
@@ -133,7 +133,7 @@ void GenerateFuList::ComputeRelationships(DesignFlowStepSet& relationship,
          }
          if(debug_level >= DEBUG_LEVEL_VERY_PEDANTIC)
          {
-            const std::string technology_flow_signature =
+            const auto technology_flow_signature =
                 TechnologyFlowStep::ComputeSignature(TechnologyFlowStep_Type::WRITE_TECHNOLOGY);
             const vertex technology_flow_step =
                 design_flow_manager.lock()->GetDesignFlowStep(technology_flow_signature);
@@ -163,7 +163,7 @@ bool GenerateFuList::HasToBeExecuted() const
    return ToDataFileStep::HasToBeExecuted();
 }
 
-std::string GenerateFuList::GetSignature() const
+DesignFlowStep::signature_t GenerateFuList::GetSignature() const
 {
    return ToDataFileStep::GetSignature();
 }
@@ -95,7 +95,7 @@ class GenerateFuList : public ToDataFileStep, public FunctionalUnitStep
     * Return a unified identifier of this design step
     * @return the signature of the design step
     */
-   std::string GetSignature() const override;
+   signature_t GetSignature() const override;
 
    /**
     * Return the name of this design step
@@ -49,9 +49,9 @@ ToDataFileStep::ToDataFileStep(const DesignFlowManagerConstRef _design_flow_mana
 {
 }
 
-const std::string ToDataFileStep::ComputeSignature(const ToDataFileStep_Type to_data_file_step_type)
+DesignFlowStep::signature_t ToDataFileStep::ComputeSignature(const ToDataFileStep_Type to_data_file_step_type)
 {
-   return "ToDataFile::" + EnumToName(to_data_file_step_type);
+   return DesignFlowStep::ComputeSignature(TO_DATA_FILE, static_cast<unsigned short>(to_data_file_step_type), 0);
 }
 
 const std::string ToDataFileStep::EnumToName(const ToDataFileStep_Type to_data_file_step)
@@ -96,7 +96,7 @@ bool ToDataFileStep::HasToBeExecuted() const
    return true;
 }
 
-std::string ToDataFileStep::GetSignature() const
+DesignFlowStep::signature_t ToDataFileStep::GetSignature() const
 {
    return ComputeSignature(to_data_file_step_type);
 }
@@ -108,5 +108,5 @@ std::string ToDataFileStep::GetName() const
 
 DesignFlowStepFactoryConstRef ToDataFileStep::CGetDesignFlowStepFactory() const
 {
-   return design_flow_manager.lock()->CGetDesignFlowStepFactory("ToDataFile");
+   return design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::TO_DATA_FILE);
 }
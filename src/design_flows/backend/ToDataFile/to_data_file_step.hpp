@@ -80,7 +80,7 @@ class ToDataFileStep : public virtual DesignFlowStep
     * Return a unified identifier of this design step
     * @return the signature of the design step
     */
-   std::string GetSignature() const override;
+   signature_t GetSignature() const override;
 
    /**
     * Given a to data file step type, return the name of the type
@@ -101,7 +101,7 @@ class ToDataFileStep : public virtual DesignFlowStep
     * @param to_data_file_step_type is the type of the step
     * @return the corresponding signature
     */
-   static const std::string ComputeSignature(const ToDataFileStep_Type to_data_file_step_type);
+   static signature_t ComputeSignature(const ToDataFileStep_Type to_data_file_step_type);
 
    /**
     * Return the name of this design step
@@ -42,6 +42,7 @@
 
 /// utility include
 #include "exceptions.hpp"
+#include "string_manipulation.hpp"
 
 /// design_flows/ToDataFile include
 #include "to_data_file_step.hpp"
@@ -52,22 +53,16 @@
 ToDataFileStepFactory::ToDataFileStepFactory(const generic_deviceRef _device,
                                              const DesignFlowManagerConstRef _design_flow_manager,
                                              const ParameterConstRef _parameters)
-    : DesignFlowStepFactory(_design_flow_manager, _parameters), device(_device)
+    : DesignFlowStepFactory(DesignFlowStep::TO_DATA_FILE, _design_flow_manager, _parameters), device(_device)
 {
 }
 
 ToDataFileStepFactory::~ToDataFileStepFactory() = default;
 
-const std::string ToDataFileStepFactory::GetPrefix() const
+const DesignFlowStepRef ToDataFileStepFactory::CreateStep(DesignFlowStep::signature_t signature) const
 {
-   return "ToDataFile";
-}
-
-const DesignFlowStepRef ToDataFileStepFactory::CreateStep(const std::string& signature) const
-{
-   THROW_ASSERT(signature.compare(0, std::string("ToDataFile::").size(), "ToDataFile::") == 0,
-                "Wrong signature " + signature);
-   const auto to_data_file_step_type = ToDataFileStep::NameToEnum(signature.substr(std::string("ToDataFile::").size()));
+   THROW_ASSERT(DesignFlowStep::GetStepClass(signature) == GetClass(), "Wrong signature " + STR(signature));
+   const auto to_data_file_step_type = static_cast<ToDataFileStep_Type>(DesignFlowStep::GetStepType(signature));
    switch(to_data_file_step_type)
    {
       case ToDataFileStep_Type::UNKNOWN:
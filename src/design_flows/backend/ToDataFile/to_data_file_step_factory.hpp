@@ -66,16 +66,12 @@ class ToDataFileStepFactory : public DesignFlowStepFactory
     */
    ~ToDataFileStepFactory() override;
 
-   /**
-    * Return the prefix of the steps created by the factory
-    */
-   const std::string GetPrefix() const override;
 
    /**
     * Creates a step
     * @param signature is the signature of the step to be created
     * @return the created step
     */
-   const DesignFlowStepRef CreateStep(const std::string& signature) const;
+   const DesignFlowStepRef CreateStep(DesignFlowStep::signature_t signature) const;
 };
 #endif
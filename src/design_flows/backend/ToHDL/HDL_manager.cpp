@@ -67,8 +67,13 @@
 #include "exceptions.hpp"
 
 #include <boost/tokenizer.hpp>
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iosfwd>
+#include <sstream>
+#include <vector>
 
 /// boost include
 #include <boost/algorithm/string.hpp>
@@ -82,6 +87,8 @@
 #include "verilog_writer.hpp"
 
 /// HLS include
+#include "call_graph_manager.hpp"
+#include "hls.hpp"
 #include "hls_manager.hpp"
 
 /// STL include
@@ -94,6 +101,7 @@
 #include "string_manipulation.hpp" // for GET_CLASS
 #include "technology_manager.hpp"
 #include "technology_node.hpp"
+#include "utility.hpp"
 
 HDL_manager::HDL_manager(const HLS_managerRef _HLSMgr, const generic_deviceRef _device, const structural_managerRef _SM,
                          const ParameterConstRef _parameters)
@@ -126,6 +134,51 @@ HDL_manager::HDL_manager(const HLS_managerRef _HLSMgr, const generic_deviceRef _
 
 HDL_manager::~HDL_manager() = default;
 
+size_t HDL_manager::get_emission_jobs() const
+{
+   /// debug messages share the global indentation and would be interleaved
+   if(debug_level >= DEBUG_LEVEL_VERY_PEDANTIC ||
+      parameters->getOption<int>(OPT_debug_level) >= DEBUG_LEVEL_VERY_PEDANTIC || !parameters->isOption(OPT_hls_jobs))
+   {
+      return 1;
+   }
+   return std::max<size_t>(1, parameters->getOption<size_t>(OPT_hls_jobs));
+}
+
+structural_objectRef HDL_manager::get_module_definition(const structural_objectRef& c) const
+{
+   const auto library = TM->get_library(c->get_typeRef()->id_type);
+   /// we write the definition of the object stored in library
+   if(library.empty())
+   {
+      return c;
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                  "---Component " + c->get_typeRef()->id_type + " is in library " + library);
+   technology_nodeRef tn = TM->get_fu(c->get_typeRef()->id_type, library);
+   if(GetPointer<functional_unit>(tn))
+   {
+      THROW_ASSERT(GetPointer<functional_unit>(tn)->CM, tn->get_name());
+      return GetPointer<functional_unit>(tn)->CM->get_circ();
+   }
+   else if(GetPointer<functional_unit_template>(tn))
+   {
+      technology_nodeRef FU = GetPointer<functional_unit_template>(tn)->FU;
+      return GetPointer<functional_unit>(FU)->CM->get_circ();
+   }
+   THROW_ERROR("unexpected condition");
+   return c;
+}
+
+/**
+ * Returns true if the module is generated by FloPoCo
+ */
+static bool IsFlopocoModule(const structural_objectRef& cir)
+{
+   const auto npf = GetPointer<module>(cir)->get_NP_functionality();
+   return npf && npf->get_NP_functionality(NP_functionality::FLOPOCO_PROVIDED) != "";
+}
+
 std::string HDL_manager::write_components(const std::string& filename, HDLWriter_Language language,
                                           const std::list<structural_objectRef>& components,
                                           std::list<std::string>& aux_files) const
@@ -148,6 +201,12 @@ std::string HDL_manager::write_components(const std::string& filename, HDLWriter
    /// write the header of the file
    writer->write_header();
 
+   /// modules are written into private buffers, concatenated in order once all of them are ready; FloPoCo modules
+   /// are still written in place, since they do not contribute to the stream but go through the shared FloPoCo wrapper
+   const auto jobs = get_emission_jobs();
+   const auto buffered = jobs > 1 || !module_fingerprints.empty();
+   std::vector<structural_objectRef> buffered_modules;
+
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Writing components");
    /// write all modules
    for(const auto& c : components)
@@ -201,30 +260,33 @@ std::string HDL_manager::write_components(const std::string& filename, HDLWriter
          }
          continue;
       }
-      std::string library = TM->get_library(c->get_typeRef()->id_type);
-      structural_objectRef obj = c;
-      /// we write the definition of the object stored in library
-      if(library.size())
+      const auto obj = get_module_definition(c);
+      if(buffered && !IsFlopocoModule(obj))
       {
-         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                        "---Component " + c->get_typeRef()->id_type + " is in library " + library);
-         technology_nodeRef tn = TM->get_fu(c->get_typeRef()->id_type, library);
-         if(GetPointer<functional_unit>(tn))
-         {
-            THROW_ASSERT(GetPointer<functional_unit>(tn)->CM, tn->get_name());
-            obj = GetPointer<functional_unit>(tn)->CM->get_circ();
-         }
-         else if(GetPointer<functional_unit_template>(tn))
-         {
-            technology_nodeRef FU = GetPointer<functional_unit_template>(tn)->FU;
-            obj = GetPointer<functional_unit>(FU)->CM->get_circ();
-         }
-         else
+         buffered_modules.push_back(obj);
+         continue;
+      }
+      write_module(writer, obj, aux_files);
+   }
+   if(!buffered_modules.empty())
+   {
+      std::vector<std::string> texts(buffered_modules.size());
+      std::vector<unsigned char> reused(buffered_modules.size(), 0);
+      ParallelFor(buffered_modules.size(), jobs, [&](size_t index) {
+         bool module_reused = false;
+         texts[index] = write_module_text(language, buffered_modules[index], module_reused);
+         reused[index] = module_reused;
+      });
+      const auto output_level = parameters->getOption<int>(OPT_output_level);
+      for(size_t index = 0; index < buffered_modules.size(); ++index)
+      {
+         writer->write_indented(texts[index]);
+         if(reused[index])
          {
-            THROW_ERROR("unexpected condition");
+            INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level,
+                           "---Module " + GET_TYPE_NAME(buffered_modules[index]) + " reused from HLS cache");
          }
       }
-      write_module(writer, obj, aux_files);
    }
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Written components");
    const auto filename_ext = filename + writer->get_extension();
@@ -357,14 +419,15 @@ void HDL_manager::write_components(const std::string& filename, const std::list<
       if(multiFileP)
       {
          language_writerRef writer = language_writer::create_writer(l->first, TM, parameters);
+         std::vector<std::string> mod_names;
          for(const auto& c : component_language[l->first])
          {
-            std::list<structural_objectRef> singletonList;
-            singletonList.push_back(c);
-            std::string mod_name = convert_to_identifier(writer.get(), GET_TYPE_NAME(c));
-            std::string generated_filename = write_components(mod_name, l->first, singletonList, aux_files);
-            aux_files.push_back(generated_filename);
+            mod_names.push_back(convert_to_identifier(writer.get(), GET_TYPE_NAME(c)));
          }
+         write_component_files(mod_names, l->first, component_language[l->first], aux_files,
+                               [&](size_t, const std::string& generated_filename) {
+                                  aux_files.push_back(generated_filename);
+                               });
       }
       else
       {
@@ -377,27 +440,27 @@ void HDL_manager::write_components(const std::string& filename, const std::list<
    {
       language_writerRef writer = language_writer::create_writer(language, TM, parameters);
 
-      auto counter = component_language[language].size();
+      std::vector<std::string> mod_names;
       for(const auto& c : component_language[language])
       {
-         --counter;
-         std::list<structural_objectRef> singletonList;
-         singletonList.push_back(c);
-         std::string mod_name = convert_to_identifier(writer.get(), GET_TYPE_NAME(c));
-         if(counter == 0)
-         {
-            mod_name = filename;
-         }
-         std::string generated_filename = write_components(mod_name, language, singletonList, aux_files);
-         if(counter == 0)
-         {
-            hdl_files.push_back(generated_filename);
-         }
-         else
-         {
-            aux_files.push_back(generated_filename);
-         }
+         mod_names.push_back(convert_to_identifier(writer.get(), GET_TYPE_NAME(c)));
+      }
+      /// the last component is the top one and is written in the main file
+      if(!mod_names.empty())
+      {
+         mod_names.back() = filename;
       }
+      write_component_files(mod_names, language, component_language[language], aux_files,
+                            [&](size_t index, const std::string& generated_filename) {
+                               if(index + 1 == mod_names.size())
+                               {
+                                  hdl_files.push_back(generated_filename);
+                               }
+                               else
+                               {
+                                  aux_files.push_back(generated_filename);
+                               }
+                            });
    }
    else
    {
@@ -439,10 +502,190 @@ void HDL_manager::hdl_gen(const std::string& filename, const std::list<structura
       return;
    }
 
+   module_fingerprints.clear();
+   if(HLSMgr && !tb && parameters->isOption(OPT_hls_cache))
+   {
+      compute_module_fingerprints();
+   }
+
    /// generate the HDL descriptions for all the components
    write_components(filename, list_of_com, hdl_files, aux_files, tb);
 }
 
+void HDL_manager::compute_module_fingerprints()
+{
+   std::map<std::string, unsigned int> function_modules;
+   for(const auto funId : HLSMgr->CGetCallGraphManager()->GetReachedBodyFunctions())
+   {
+      const auto HLS = HLSMgr->get_HLS(funId);
+      if(HLS && HLS->top)
+      {
+         function_modules[GET_TYPE_NAME(HLS->top->get_circ())] = funId;
+      }
+   }
+   /// the modules owned by each function are the ones reachable from its top without crossing library components or
+   /// the top modules of other functions
+   std::map<std::string, unsigned int> module_owner;
+   std::map<std::string, structural_objectRef> owned_modules;
+   CustomSet<std::string> shared_modules;
+   for(const auto& function_module : function_modules)
+   {
+      const auto funId = function_module.second;
+      std::list<structural_objectRef> to_visit = {HLSMgr->get_HLS(funId)->top->get_circ()};
+      CustomSet<std::string> visited;
+      while(!to_visit.empty())
+      {
+         const auto cir = to_visit.front();
+         to_visit.pop_front();
+         const auto type_name = GET_TYPE_NAME(cir);
+         if(!visited.insert(type_name).second)
+         {
+            continue;
+         }
+         owned_modules.insert(std::make_pair(type_name, cir));
+         const auto owner = module_owner.insert(std::make_pair(type_name, funId));
+         if(!owner.second && owner.first->second != funId)
+         {
+            shared_modules.insert(type_name);
+         }
+         const auto mod = GetPointer<module>(cir);
+         for(unsigned int i = 0; i < mod->get_internal_objects_size(); ++i)
+         {
+            const auto internal_object = mod->get_internal_object(i);
+            if(internal_object->get_kind() != component_o_K && internal_object->get_kind() != channel_o_K)
+            {
+               continue;
+            }
+            const auto internal_type_name = GET_TYPE_NAME(internal_object);
+            if(!internal_object->get_black_box() && !function_modules.count(internal_type_name) &&
+               TM->get_library(internal_type_name).empty())
+            {
+               to_visit.push_back(internal_object);
+            }
+         }
+      }
+   }
+   for(const auto& owner : module_owner)
+   {
+      if(!shared_modules.count(owner.first))
+      {
+         /// the function fingerprint does not depend on the node indices, while the names of the instantiated modules
+         /// and the values of their parameters (e.g., the memory initialization files) may do, so they are part of the
+         /// fingerprint of the module text
+         std::stringstream references;
+         references << HLSMgr->GetFunctionFingerprint(owner.second) << "\n";
+         const auto cir = owned_modules.at(owner.first);
+         for(const auto& parameter : cir->GetParameters())
+         {
+            references << parameter.first << "=" << parameter.second << "\n";
+         }
+         const auto mod = GetPointer<module>(cir);
+         for(unsigned int i = 0; i < mod->get_internal_objects_size(); ++i)
+         {
+            const auto internal_object = mod->get_internal_object(i);
+            if(internal_object->get_kind() == component_o_K || internal_object->get_kind() == channel_o_K)
+            {
+               references << internal_object->get_id() << ": " << GET_TYPE_NAME(internal_object) << "\n";
+               for(const auto& parameter : internal_object->GetParameters())
+               {
+                  references << parameter.first << "=" << parameter.second << "\n";
+               }
+            }
+         }
+         module_fingerprints[owner.first] = HLS_manager::ComputeFingerprint(references);
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                        "---Fingerprint of module " + owner.first + ": " + module_fingerprints.at(owner.first));
+      }
+   }
+}
+
+void HDL_manager::write_component_files(const std::vector<std::string>& mod_names, const HDLWriter_Language language,
+                                        const std::list<structural_objectRef>& components,
+                                        std::list<std::string>& aux_files,
+                                        const std::function<void(size_t, const std::string&)>& add_file) const
+{
+   THROW_ASSERT(mod_names.size() == components.size(), "");
+   const std::vector<structural_objectRef> file_components(components.begin(), components.end());
+   /// FloPoCo modules go through the shared FloPoCo wrapper, so they are always written sequentially
+   const auto has_flopoco = std::any_of(file_components.begin(), file_components.end(), [&](const structural_objectRef& c) {
+      return IsFlopocoModule(c) || IsFlopocoModule(get_module_definition(c));
+   });
+   const auto jobs = has_flopoco ? 1 : get_emission_jobs();
+   if(jobs <= 1 || file_components.size() <= 1)
+   {
+      for(size_t index = 0; index < file_components.size(); ++index)
+      {
+         add_file(index, write_components(mod_names[index], language, {file_components[index]}, aux_files));
+      }
+      return;
+   }
+
+   /// each file collects its own auxiliary files, merged afterwards in the same order the sequential loop would follow
+   std::vector<std::string> generated_filenames(file_components.size());
+   std::vector<std::list<std::string>> file_aux_files(file_components.size());
+   ParallelFor(file_components.size(), jobs, [&](size_t index) {
+      generated_filenames[index] =
+          write_components(mod_names[index], language, {file_components[index]}, file_aux_files[index]);
+   });
+   for(size_t index = 0; index < file_components.size(); ++index)
+   {
+      for(const auto& aux_file : file_aux_files[index])
+      {
+         if(std::find(aux_files.begin(), aux_files.end(), aux_file) == aux_files.end())
+         {
+            aux_files.push_back(aux_file);
+         }
+      }
+      add_file(index, generated_filenames[index]);
+   }
+}
+
+std::string HDL_manager::write_module_text(const HDLWriter_Language language, const structural_objectRef& cir,
+                                           bool& reused) const
+{
+   /// the module is written on its own, so that its description does not depend on the modules preceding it
+   const auto module_writer = language_writer::create_writer(language, TM, parameters);
+   const auto fingerprint = module_fingerprints.find(GET_TYPE_NAME(cir));
+   std::filesystem::path entry;
+   if(fingerprint != module_fingerprints.end())
+   {
+      entry = parameters->getOption<std::filesystem::path>(OPT_hls_cache) /
+              (fingerprint->second + "_" + get_mod_typename(module_writer.get(), cir) + module_writer->get_extension());
+      std::ifstream entry_file(entry, std::ios::binary);
+      if(entry_file)
+      {
+         reused = true;
+         return std::string((std::istreambuf_iterator<char>(entry_file)), std::istreambuf_iterator<char>());
+      }
+   }
+
+   std::list<std::string> module_aux_files;
+   write_module(module_writer, cir, module_aux_files);
+   THROW_ASSERT(module_aux_files.empty(), "Unexpected auxiliary files for module " + GET_TYPE_NAME(cir));
+   auto text = module_writer->WriteString();
+   if(entry.empty())
+   {
+      return text;
+   }
+
+   /// the entry is written to a private file and then renamed, so that concurrent runs sharing the same cache never
+   /// observe a partially written entry
+   std::filesystem::create_directories(entry.parent_path());
+   const auto staging = unique_path(entry.string() + "-%%%%-%%%%");
+   {
+      std::ofstream staging_file(staging, std::ios::binary);
+      staging_file << text;
+   }
+   std::error_code ec;
+   std::filesystem::rename(staging, entry, ec);
+   if(ec)
+   {
+      std::filesystem::remove(staging, ec);
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Module " + GET_TYPE_NAME(cir) + " stored in HLS cache");
+   return text;
+}
+
 /**
  * Used to test if a component has been already inserted into the component list
  */
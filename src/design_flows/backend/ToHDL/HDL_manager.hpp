@@ -51,7 +51,9 @@
 /// Superclass include
 #include "design_flow_step.hpp"
 
+#include <functional>
 #include <list>
+#include <map>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -100,6 +102,16 @@ class HDL_manager
    /// The debug level
    const int debug_level;
 
+   /// map between the type name of the modules generated for a function and the fingerprint of their text
+   std::map<std::string, std::string> module_fingerprints;
+
+   /**
+    * Associates the modules generated for each synthesized function with a fingerprint combining the fingerprint of
+    * the function with the names and the parameters of the instantiated modules.
+    * Modules shared by different functions and library components are not associated with any fingerprint.
+    */
+   void compute_module_fingerprints();
+
    /**
     * Returns the list of components that have a structural-based description.
     * This list of components is relative sorted such that if a component C_i uses a component C_j then C_j is before
@@ -133,6 +145,41 @@ class HDL_manager
    void write_module(const language_writerRef writer, const structural_objectRef cir,
                      std::list<std::string>& aux_files) const;
 
+   /**
+    * Writes the module description with a private writer, reusing the one stored in the HLS cache when available.
+    * Since it does not touch any shared state, it can be called concurrently on different modules.
+    * @param language is the language of the description.
+    * @param cir is the module to be written.
+    * @param reused is set to true when the description has been restored from the HLS cache.
+    * @return the module description.
+    */
+   std::string write_module_text(const HDLWriter_Language language, const structural_objectRef& cir,
+                                 bool& reused) const;
+
+   /**
+    * Writes each component in a file on its own, concurrently when no FloPoCo module is involved.
+    * @param mod_names is the name of the file of each component.
+    * @param language is the language of the descriptions.
+    * @param components is the list of components.
+    * @param aux_files is the list of auxiliary files.
+    * @param add_file is called on the index of each component and the corresponding generated file, in the order of
+    * components.
+    */
+   void write_component_files(const std::vector<std::string>& mod_names, const HDLWriter_Language language,
+                              const std::list<structural_objectRef>& components, std::list<std::string>& aux_files,
+                              const std::function<void(size_t, const std::string&)>& add_file) const;
+
+   /**
+    * Returns the object whose description has to be written for the component: the library definition when the
+    * component comes from a library, the component itself otherwise.
+    */
+   structural_objectRef get_module_definition(const structural_objectRef& c) const;
+
+   /**
+    * Returns the number of threads the HDL descriptions can be written with.
+    */
+   size_t get_emission_jobs() const;
+
    /**
     * Writes the FloPoCo module description to a VHDL file.
     * @param cir is the module to be fixed.
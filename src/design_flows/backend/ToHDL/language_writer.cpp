@@ -111,6 +111,11 @@ void language_writer::write(const std::string& rawString)
    indented_output_stream->Append(rawString);
 }
 
+void language_writer::write_indented(const std::string& indentedString)
+{
+   indented_output_stream->AppendIndented(indentedString);
+}
+
 void language_writer::write_header()
 {
 }
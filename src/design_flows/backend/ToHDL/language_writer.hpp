@@ -149,6 +149,12 @@ class language_writer
     */
    virtual void write(const std::string& rawString);
 
+   /**
+    * Writes an already indented string into the stream.
+    * @param indentedString is the string to be written.
+    */
+   void write_indented(const std::string& indentedString);
+
    /**
     * Writes the header part of the file. Write some lines of comments and possibly global libraries.
     */
@@ -55,7 +55,7 @@ void DesignFlow::ComputeRelationships(DesignFlowStepSet&, const DesignFlowStep::
 {
 }
 
-std::string DesignFlow::GetSignature() const
+DesignFlowStep::signature_t DesignFlow::GetSignature() const
 {
    return ComputeSignature(design_flow_type);
 }
@@ -80,7 +80,7 @@ const std::string DesignFlow::EnumToKindText(const DesignFlow_Type design_flow_t
 
 DesignFlowStepFactoryConstRef DesignFlow::CGetDesignFlowStepFactory() const
 {
-   return design_flow_manager.lock()->CGetDesignFlowStepFactory("DF");
+   return design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::DESIGN_FLOW);
 }
 
 DesignFlow_Type DesignFlow::KindTextToEnum(const std::string& name)
@@ -101,7 +101,7 @@ bool DesignFlow::HasToBeExecuted() const
    return true;
 }
 
-std::string DesignFlow::ComputeSignature(const DesignFlow_Type design_flow_type)
+DesignFlowStep::signature_t DesignFlow::ComputeSignature(const DesignFlow_Type design_flow_type)
 {
-   return "DF::" + STR(static_cast<int>(design_flow_type));
+   return DesignFlowStep::ComputeSignature(DESIGN_FLOW, static_cast<unsigned short>(design_flow_type), 0);
 }
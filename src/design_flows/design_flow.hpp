@@ -83,12 +83,12 @@ class DesignFlow : public DesignFlowStep
     * @param design_flow_type is the type of design flow
     * @return the signature corresponding to the design flow
     */
-   static std::string ComputeSignature(const DesignFlow_Type design_flow_type);
+   static signature_t ComputeSignature(const DesignFlow_Type design_flow_type);
 
    /**
     * Return the signature of this step
     */
-   std::string GetSignature() const override;
+   signature_t GetSignature() const override;
 
    /**
     * Return the name of this design step
@@ -60,9 +60,10 @@ void AuxDesignFlowStep::ComputeRelationships(DesignFlowStepSet&, const DesignFlo
 {
 }
 
-const std::string AuxDesignFlowStep::ComputeSignature(const std::string& name, const AuxDesignFlowStepType type)
+DesignFlowStep::signature_t AuxDesignFlowStep::ComputeSignature(const std::string& name,
+                                                                const AuxDesignFlowStepType type)
 {
-   return "AUX::" + STR(type) + "::" + name;
+   return DesignFlowStep::ComputeSignature(AUX, static_cast<unsigned short>(type), GetSignatureContext(name));
 }
 
 DesignFlowStep_Status AuxDesignFlowStep::Exec()
@@ -75,7 +76,7 @@ std::string AuxDesignFlowStep::GetName() const
    return name;
 }
 
-std::string AuxDesignFlowStep::GetSignature() const
+DesignFlowStep::signature_t AuxDesignFlowStep::GetSignature() const
 {
    return ComputeSignature(name, type);
 }
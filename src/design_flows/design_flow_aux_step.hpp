@@ -97,7 +97,7 @@ class AuxDesignFlowStep : public DesignFlowStep
     * Return a unified identifier of this design step
     * @return the signature of the design step
     */
-   std::string GetSignature() const override;
+   signature_t GetSignature() const override;
 
    /**
     * Return the name of this design step
@@ -120,7 +120,7 @@ class AuxDesignFlowStep : public DesignFlowStep
     * @param type is the type of auxiliary step
     * @return the signature corresponding to the analysis/transformation
     */
-   static const std::string ComputeSignature(const std::string& name, const AuxDesignFlowStepType type);
+   static signature_t ComputeSignature(const std::string& name, const AuxDesignFlowStepType type);
 
    /**
     * Write the label for a dot graph
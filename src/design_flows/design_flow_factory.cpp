@@ -42,25 +42,20 @@
 #include "design_flow_step.hpp"        // for DesignFlowStepRef, DesignFlo...
 #include "exceptions.hpp"              // for THROW_UNREACHABLE, THROW_ASSERT
 #include "non_deterministic_flows.hpp" // for NonDeterministicFlows
+#include "string_manipulation.hpp"     // for STR
 
 DesignFlowFactory::DesignFlowFactory(const DesignFlowManagerConstRef _design_flow_manager,
                                      const ParameterConstRef _parameters)
-    : DesignFlowStepFactory(_design_flow_manager, _parameters)
+    : DesignFlowStepFactory(DesignFlowStep::DESIGN_FLOW, _design_flow_manager, _parameters)
 {
 }
 
 DesignFlowFactory::~DesignFlowFactory() = default;
 
-const std::string DesignFlowFactory::GetPrefix() const
+DesignFlowStepRef DesignFlowFactory::CreateFlowStep(DesignFlowStep::signature_t signature) const
 {
-   return "DF";
-}
-
-DesignFlowStepRef DesignFlowFactory::CreateFlowStep(const std::string& signature) const
-{
-   THROW_ASSERT(signature.substr(0, GetPrefix().size() + 2) == GetPrefix() + "::", signature);
-   const auto design_flow_type = DesignFlow::KindTextToEnum(signature.substr(4));
-   return CreateDesignFlow(design_flow_type);
+   THROW_ASSERT(DesignFlowStep::GetStepClass(signature) == GetClass(), "Wrong signature " + STR(signature));
+   return CreateDesignFlow(static_cast<DesignFlow_Type>(DesignFlowStep::GetStepType(signature)));
 }
 
 const DesignFlowStepRef DesignFlowFactory::CreateDesignFlow(const DesignFlow_Type design_flow_type) const
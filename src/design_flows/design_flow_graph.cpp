@@ -80,16 +80,10 @@ vertex DesignFlowGraphsCollection::AddDesignFlowStep(const DesignFlowStepRef des
    return new_vertex;
 }
 
-vertex DesignFlowGraphsCollection::GetDesignFlowStep(const std::string& signature) const
+vertex DesignFlowGraphsCollection::GetDesignFlowStep(DesignFlowStep::signature_t signature) const
 {
-   if(signature_to_vertex.find(signature) != signature_to_vertex.end())
-   {
-      return signature_to_vertex.find(signature)->second;
-   }
-   else
-   {
-      return NULL_VERTEX;
-   }
+   const auto it = signature_to_vertex.find(signature);
+   return it != signature_to_vertex.end() ? it->second : NULL_VERTEX;
 }
 
 const int DesignFlowGraph::DEPENDENCE_SELECTOR = 1;
@@ -113,7 +107,7 @@ DesignFlowGraph::DesignFlowGraph(const DesignFlowGraphsCollectionRef design_flow
 
 DesignFlowGraph::~DesignFlowGraph() = default;
 
-vertex DesignFlowGraph::GetDesignFlowStep(const std::string& signature) const
+vertex DesignFlowGraph::GetDesignFlowStep(DesignFlowStep::signature_t signature) const
 {
    return dynamic_cast<DesignFlowGraphsCollection*>(collection)->GetDesignFlowStep(signature);
 }
@@ -44,11 +44,12 @@
 #ifndef DESIGN_FLOW_GRAPH_HPP
 #define DESIGN_FLOW_GRAPH_HPP
 
-#include "edge_info.hpp"  // for EdgeInfo, EdgeIn...
-#include "graph.hpp"      // for vertex, EdgeDesc...
-#include "graph_info.hpp" // for GraphInfo
-#include "node_info.hpp"  // for NodeInfo
-#include "refcount.hpp"   // for refcount, Refcou...
+#include "design_flow_step.hpp" // for DesignFlowStep::signature_t
+#include "edge_info.hpp"        // for EdgeInfo, EdgeIn...
+#include "graph.hpp"            // for vertex, EdgeDesc...
+#include "graph_info.hpp"       // for GraphInfo
+#include "node_info.hpp"        // for NodeInfo
+#include "refcount.hpp"         // for refcount, Refcou...
 #include <cstddef>        // for size_t
 #include <iosfwd>         // for ostream
 #include <string>         // for string
@@ -57,7 +58,6 @@
 
 CONSTREF_FORWARD_DECL(Parameter);
 REF_FORWARD_DECL(DesignFlowGraphsCollection);
-REF_FORWARD_DECL(DesignFlowStep);
 enum class DesignFlowStep_Status;
 class SdfGraph;
 
@@ -110,7 +110,7 @@ class DesignFlowGraphsCollection : public graphs_collection
 {
  protected:
    /// Map a signature of a step to the corresponding vertex
-   CustomUnorderedMap<std::string, vertex> signature_to_vertex;
+   CustomUnorderedMap<DesignFlowStep::signature_t, vertex> signature_to_vertex;
 
  public:
    /**
@@ -127,7 +127,7 @@ class DesignFlowGraphsCollection : public graphs_collection
     * Return the vertex associated with a design step if exists, NULL_VERTEX otherwise
     * @param signature is the signature of the design step
     */
-   vertex GetDesignFlowStep(const std::string& signature) const;
+   vertex GetDesignFlowStep(DesignFlowStep::signature_t signature) const;
 
    /**
     * Add a design flow dependence
@@ -204,7 +204,7 @@ class DesignFlowGraph : public graph
     * Return the vertex associated with a design step if exists, NULL_VERTEX otherwise
     * @param signature is the signature of the design step
     */
-   vertex GetDesignFlowStep(const std::string& signature) const;
+   vertex GetDesignFlowStep(DesignFlowStep::signature_t signature) const;
 
    /**
     * @param step is the vertex
@@ -45,13 +45,18 @@
 #include "config_HAVE_ASSERTS.hpp"   // for HAVE_ASSERTS
 #include "config_HAVE_UNORDERED.hpp" // for HAVE_UNORDERED
 
+#include <algorithm>                          // for any_of
 #include <boost/graph/adjacency_list.hpp>     // for adjacency_list, source
 #include <boost/graph/filtered_graph.hpp>     // for in_edges, num_vertices
 #include <boost/iterator/filter_iterator.hpp> // for filter_iterator
 #include <boost/iterator/iterator_facade.hpp> // for operator!=, operator++
 #include <boost/tuple/tuple.hpp>              // for tie
+#include <exception>                          // for exception_ptr
+#include <fstream>                            // for ofstream
 #include <iterator>                           // for advance
+#include <limits>                             // for numeric_limits
 #include <list>                               // for list
+#include <sstream>                            // for stringstream
 #if !HAVE_UNORDERED
 #ifndef NDEBUG
 #include <random> // for uniform_int_distrib...
@@ -68,7 +73,9 @@
 #include "design_flow_step_factory.hpp" // for DesignFlowStepRef
 #include "exceptions.hpp"               // for THROW_UNREACHABLE
 #include "string_manipulation.hpp"      // for STR GET_CLASS
+#include <thread>                       // for thread
 #include <utility>                      // for pair
+#include <vector>                       // for vector
 
 DesignFlowStepNecessitySorter::DesignFlowStepNecessitySorter(const DesignFlowGraphConstRef _design_flow_graph)
     : design_flow_graph(_design_flow_graph)
@@ -125,6 +132,19 @@ DesignFlowManager::DesignFlowManager(const ParameterConstRef _parameters)
       output_level(_parameters->getOption<int>(OPT_output_level))
 {
    debug_level = parameters->get_class_debug_level(GET_CLASS(*this));
+   /// Bisection of transformations requires that they are always applied in the same order
+   if(!parameters->isOption(OPT_max_transformations) or
+      parameters->getOption<size_t>(OPT_max_transformations) == std::numeric_limits<size_t>::max())
+   {
+      if(parameters->isOption(OPT_frontend_function_jobs))
+      {
+         local_jobs[DesignFlowStep::FRONTEND] = parameters->getOption<size_t>(OPT_frontend_function_jobs);
+      }
+      if(parameters->isOption(OPT_hls_jobs))
+      {
+         local_jobs[DesignFlowStep::HLS] = parameters->getOption<size_t>(OPT_hls_jobs);
+      }
+   }
    const DesignFlowGraphInfoRef design_flow_graph_info = design_flow_graph->GetDesignFlowGraphInfo();
    null_deleter nullDel;
    design_flow_graph_info->entry = design_flow_graphs_collection->AddDesignFlowStep(
@@ -132,7 +152,7 @@ DesignFlowManager::DesignFlowManager(const ParameterConstRef _parameters)
            new AuxDesignFlowStep("Entry", DESIGN_FLOW_ENTRY, DesignFlowManagerConstRef(this, nullDel), parameters)),
        false);
 #ifndef NDEBUG
-   if(debug_level >= DEBUG_LEVEL_PARANOIC or parameters->IsParameter("profile_steps"))
+   if(debug_level >= DEBUG_LEVEL_PARANOIC)
    {
       step_names[design_flow_graph_info->entry] = "Entry";
    }
@@ -144,7 +164,7 @@ DesignFlowManager::DesignFlowManager(const ParameterConstRef _parameters)
            new AuxDesignFlowStep("Exit", DESIGN_FLOW_EXIT, DesignFlowManagerConstRef(this, nullDel), parameters)),
        false);
 #ifndef NDEBUG
-   if(debug_level >= DEBUG_LEVEL_PARANOIC or parameters->IsParameter("profile_steps"))
+   if(debug_level >= DEBUG_LEVEL_PARANOIC)
    {
       step_names[design_flow_graph_info->exit] = "Exit";
    }
@@ -173,9 +193,9 @@ void DesignFlowManager::RecursivelyAddSteps(const DesignFlowStepSet& steps, cons
    const DesignFlowGraphInfoRef design_flow_graph_info = design_flow_graph->GetDesignFlowGraphInfo();
    for(const auto& design_flow_step : steps)
    {
-      const std::string signature = design_flow_step->GetSignature();
+      const auto signature = design_flow_step->GetSignature();
       INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
-                     "-->Adding design flow step " + design_flow_step->GetName() + " - Signature " + signature);
+                     "-->Adding design flow step " + design_flow_step->GetName() + " - Signature " + STR(signature));
 
       /// Get vertex from design flow graph; there are four cases
       vertex step_vertex = GetDesignFlowStep(signature);
@@ -228,7 +248,7 @@ void DesignFlowManager::RecursivelyAddSteps(const DesignFlowStepSet& steps, cons
          INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "---This step does not exist");
          step_vertex = design_flow_graphs_collection->AddDesignFlowStep(design_flow_step, unnecessary);
 #ifndef NDEBUG
-         if(debug_level >= DEBUG_LEVEL_PARANOIC or parameters->IsParameter("profile_steps"))
+         if(debug_level >= DEBUG_LEVEL_PARANOIC)
          {
             step_names[step_vertex] = design_flow_step->GetName();
          }
@@ -243,8 +263,7 @@ void DesignFlowManager::RecursivelyAddSteps(const DesignFlowStepSet& steps, cons
       RecursivelyAddSteps(relationships, unnecessary);
       for(const auto& relationship : relationships)
       {
-         const std::string relationship_signature = relationship->GetSignature();
-         vertex relationship_vertex = GetDesignFlowStep(relationship_signature);
+         vertex relationship_vertex = GetDesignFlowStep(relationship->GetSignature());
          design_flow_graphs_collection->AddDesignFlowDependence(relationship_vertex, step_vertex,
                                                                 DesignFlowGraph::DEPENDENCE_SELECTOR);
 #ifndef NDEBUG
@@ -273,8 +292,7 @@ void DesignFlowManager::RecursivelyAddSteps(const DesignFlowStepSet& steps, cons
       RecursivelyAddSteps(relationships, true);
       for(const auto& relationship : relationships)
       {
-         const std::string relationship_signature = relationship->GetSignature();
-         vertex relationship_vertex = GetDesignFlowStep(relationship_signature);
+         vertex relationship_vertex = GetDesignFlowStep(relationship->GetSignature());
          design_flow_graphs_collection->AddDesignFlowDependence(relationship_vertex, step_vertex,
                                                                 DesignFlowGraph::PRECEDENCE_SELECTOR);
 #ifndef NDEBUG
@@ -361,7 +379,7 @@ void DesignFlowManager::RecursivelyAddSteps(const DesignFlowStepSet& steps, cons
                                                                 DesignFlowGraph::AUX_SELECTOR);
       }
       INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
-                     "<--Added design flow step " + design_flow_step->GetName() + " - Signature " + signature);
+                     "<--Added design flow step " + design_flow_step->GetName() + " - Signature " + STR(signature));
    }
 }
 
@@ -370,6 +388,178 @@ const DesignFlowGraphConstRef DesignFlowManager::CGetDesignFlowGraph() const
    return design_flow_graph;
 }
 
+bool DesignFlowManager::RecomputeRelationships(const vertex step_vertex)
+{
+   const DesignFlowStepInfoRef step_info = design_flow_graph->GetDesignFlowStepInfo(step_vertex);
+   /// First of all check if there are new dependence to add
+   INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Recomputing dependences");
+   DesignFlowStepSet pre_dependence_steps, pre_precedence_steps;
+   step_info->design_flow_step->ComputeRelationships(pre_dependence_steps, DesignFlowStep::DEPENDENCE_RELATIONSHIP);
+   RecursivelyAddSteps(pre_dependence_steps, step_info->status == DesignFlowStep_Status::UNNECESSARY);
+   INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Recomputed dependences");
+   INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Recomputing precedences");
+   step_info->design_flow_step->ComputeRelationships(pre_precedence_steps, DesignFlowStep::PRECEDENCE_RELATIONSHIP);
+   RecursivelyAddSteps(pre_precedence_steps, true);
+   INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Recomputed precedences");
+   bool current_ready = true;
+   DesignFlowStepSet::const_iterator pre_dependence_step, pre_dependence_step_end = pre_dependence_steps.end();
+   for(pre_dependence_step = pre_dependence_steps.begin(); pre_dependence_step != pre_dependence_step_end;
+       ++pre_dependence_step)
+   {
+      const vertex pre_dependence_vertex = design_flow_graph->GetDesignFlowStep((*pre_dependence_step)->GetSignature());
+      design_flow_graphs_collection->AddDesignFlowDependence(pre_dependence_vertex, step_vertex,
+                                                             DesignFlowGraph::DEPENDENCE_SELECTOR);
+      const DesignFlowStepInfoRef pre_info = design_flow_graph->GetDesignFlowStepInfo(pre_dependence_vertex);
+      switch(pre_info->status)
+      {
+         case DesignFlowStep_Status::ABORTED:
+         case DesignFlowStep_Status::EMPTY:
+         case DesignFlowStep_Status::SKIPPED:
+         case DesignFlowStep_Status::SUCCESS:
+         case DesignFlowStep_Status::UNCHANGED:
+         {
+            break;
+         }
+         case DesignFlowStep_Status::UNNECESSARY:
+         case DesignFlowStep_Status::UNEXECUTED:
+         {
+            current_ready = false;
+            break;
+         }
+         case DesignFlowStep_Status::NONEXISTENT:
+         {
+            THROW_UNREACHABLE("Step with nonexitent status");
+            break;
+         }
+         default:
+         {
+            THROW_UNREACHABLE("");
+         }
+      }
+   }
+   /// Now iterate on ingoing precedence edge
+   for(const auto& pre_precedence_step : pre_precedence_steps)
+   {
+      const vertex pre_precedence_vertex = design_flow_graph->GetDesignFlowStep((pre_precedence_step)->GetSignature());
+      design_flow_graphs_collection->AddDesignFlowDependence(pre_precedence_vertex, step_vertex,
+                                                             DesignFlowGraph::PRECEDENCE_SELECTOR);
+      const DesignFlowStepInfoRef pre_info = design_flow_graph->GetDesignFlowStepInfo(pre_precedence_vertex);
+      switch(pre_info->status)
+      {
+         case DesignFlowStep_Status::ABORTED:
+         case DesignFlowStep_Status::EMPTY:
+         case DesignFlowStep_Status::SKIPPED:
+         case DesignFlowStep_Status::SUCCESS:
+         case DesignFlowStep_Status::UNCHANGED:
+         {
+            break;
+         }
+         case DesignFlowStep_Status::UNNECESSARY:
+         case DesignFlowStep_Status::UNEXECUTED:
+         {
+            current_ready = false;
+            break;
+         }
+         case DesignFlowStep_Status::NONEXISTENT:
+         {
+            THROW_UNREACHABLE("Step with nonexitent status");
+            break;
+         }
+         default:
+         {
+            THROW_UNREACHABLE("");
+         }
+      }
+   }
+   return current_ready;
+}
+
+void DesignFlowManager::ExecuteLocalSteps(const vertex step_vertex, const size_t jobs)
+{
+   std::vector<vertex> steps(1, step_vertex);
+   std::vector<DesignFlowStepRef> design_flow_steps(
+       1, design_flow_graph->CGetDesignFlowStepInfo(step_vertex)->design_flow_step);
+   const auto step_class = DesignFlowStep::GetStepClass(design_flow_steps.front()->GetSignature());
+   const std::vector<vertex> candidates(possibly_ready.begin(), possibly_ready.end());
+   for(const auto candidate : candidates)
+   {
+      if(steps.size() >= jobs)
+      {
+         break;
+      }
+      if(preexecuted_steps.find(candidate) != preexecuted_steps.end() or
+         possibly_ready.find(candidate) == possibly_ready.end())
+      {
+         continue;
+      }
+      const DesignFlowStepInfoConstRef candidate_info = design_flow_graph->CGetDesignFlowStepInfo(candidate);
+      const auto candidate_step = candidate_info->design_flow_step;
+      if(candidate_info->status != DesignFlowStep_Status::UNEXECUTED or !candidate_step->GetLocalFunction() or
+         DesignFlowStep::GetStepClass(candidate_step->GetSignature()) != step_class or
+         candidate_step->CGetDebugLevel() >= DEBUG_LEVEL_VERY_PEDANTIC or
+         std::any_of(design_flow_steps.begin(), design_flow_steps.end(),
+                     [&](const DesignFlowStepRef& step) { return !step->IsConcurrentWith(*candidate_step); }))
+      {
+         continue;
+      }
+      if(!RecomputeRelationships(candidate))
+      {
+         /// Exactly as in the main loop, the step will be reinserted when its new predecessors are executed
+         possibly_ready.erase(candidate);
+         continue;
+      }
+      if(!candidate_step->HasToBeExecuted())
+      {
+         continue;
+      }
+      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "---Executing concurrently " + candidate_step->GetName());
+      steps.push_back(candidate);
+      design_flow_steps.push_back(candidate_step);
+   }
+   for(const auto& design_flow_step : design_flow_steps)
+   {
+      design_flow_step->Initialize();
+   }
+   std::vector<DesignFlowStep_Status> statuses(steps.size(), DesignFlowStep_Status::UNEXECUTED);
+   std::vector<std::exception_ptr> errors(steps.size());
+   std::vector<DesignFlowProfiler::Measure> measures(steps.size());
+   const auto exec = [&](size_t index) {
+      /// Steps run side by side, so only the CPU time of their own thread is charged to them
+      const auto probe = DesignFlowProfiler::Start(true);
+      try
+      {
+         statuses[index] = design_flow_steps[index]->Exec();
+      }
+      catch(...)
+      {
+         errors[index] = std::current_exception();
+      }
+      measures[index] = profiler.Stop(probe, index);
+   };
+   std::vector<std::thread> workers;
+   for(size_t index = 1; index < steps.size(); ++index)
+   {
+      workers.emplace_back(exec, index);
+   }
+   exec(0);
+   for(auto& worker : workers)
+   {
+      worker.join();
+   }
+   for(const auto& error : errors)
+   {
+      if(error)
+      {
+         std::rethrow_exception(error);
+      }
+   }
+   for(size_t index = 0; index < steps.size(); ++index)
+   {
+      preexecuted_steps[steps[index]] = statuses[index];
+      preexecuted_measures[steps[index]] = measures[index];
+   }
+}
+
 void DesignFlowManager::Exec()
 {
 #if !HAVE_UNORDERED
@@ -416,6 +606,18 @@ void DesignFlowManager::Exec()
 #endif
       INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--");
       const vertex next = [&]() -> vertex {
+         /// Steps already executed concurrently have to be committed before anything else changes the IR
+         if(preexecuted_steps.size())
+         {
+            for(const auto ready_step : possibly_ready)
+            {
+               if(preexecuted_steps.find(ready_step) != preexecuted_steps.end())
+               {
+                  return ready_step;
+               }
+            }
+            THROW_UNREACHABLE("Outcome of a concurrently executed step is not going to be committed");
+         }
 #if !HAVE_UNORDERED
 #ifndef NDEBUG
          if(parameters->isOption(OPT_test_single_non_deterministic_flow))
@@ -453,87 +655,23 @@ void DesignFlowManager::Exec()
       THROW_ASSERT(erased_elements == 1, "Number of erased elements is " + STR(erased_elements));
 
       /// Now check if next is actually ready
-      /// First of all check if there are new dependence to add
-      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Recomputing dependences");
-      DesignFlowStepSet pre_dependence_steps, pre_precedence_steps;
-      step->ComputeRelationships(pre_dependence_steps, DesignFlowStep::DEPENDENCE_RELATIONSHIP);
-      RecursivelyAddSteps(pre_dependence_steps, design_flow_step_info->status == DesignFlowStep_Status::UNNECESSARY);
-      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Recomputed dependences");
-      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "-->Recomputing precedences");
-      step->ComputeRelationships(pre_precedence_steps, DesignFlowStep::PRECEDENCE_RELATIONSHIP);
-      RecursivelyAddSteps(pre_precedence_steps, true);
-      INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Recomputed precedences");
-      bool current_ready = true;
-      DesignFlowStepSet::const_iterator pre_dependence_step, pre_dependence_step_end = pre_dependence_steps.end();
-      for(pre_dependence_step = pre_dependence_steps.begin(); pre_dependence_step != pre_dependence_step_end;
-          ++pre_dependence_step)
-      {
-         const vertex pre_dependence_vertex =
-             design_flow_graph->GetDesignFlowStep((*pre_dependence_step)->GetSignature());
-         design_flow_graphs_collection->AddDesignFlowDependence(pre_dependence_vertex, next,
-                                                                DesignFlowGraph::DEPENDENCE_SELECTOR);
-         const DesignFlowStepInfoRef pre_info = design_flow_graph->GetDesignFlowStepInfo(pre_dependence_vertex);
-         switch(pre_info->status)
-         {
-            case DesignFlowStep_Status::ABORTED:
-            case DesignFlowStep_Status::EMPTY:
-            case DesignFlowStep_Status::SKIPPED:
-            case DesignFlowStep_Status::SUCCESS:
-            case DesignFlowStep_Status::UNCHANGED:
-            {
-               break;
-            }
-            case DesignFlowStep_Status::UNNECESSARY:
-            case DesignFlowStep_Status::UNEXECUTED:
-            {
-               current_ready = false;
-               break;
-            }
-            case DesignFlowStep_Status::NONEXISTENT:
-            {
-               THROW_UNREACHABLE("Step with nonexitent status");
-               break;
-            }
-            default:
-            {
-               THROW_UNREACHABLE("");
-            }
-         }
-      }
-      /// Now iterate on ingoing precedence edge
-      for(const auto& pre_precedence_step : pre_precedence_steps)
+      const bool current_ready = RecomputeRelationships(next);
+
+      /// The outcome of a step executed concurrently can be committed only if the steps committed before it did not
+      /// add unexecuted dependences or invalidate its inputs; otherwise it is discarded and the step is executed again
+      /// once it becomes ready
+      auto preexecuted = preexecuted_steps.find(next) != preexecuted_steps.end();
+      if(preexecuted and not current_ready)
       {
-         const vertex pre_precedence_vertex =
-             design_flow_graph->GetDesignFlowStep((pre_precedence_step)->GetSignature());
-         design_flow_graphs_collection->AddDesignFlowDependence(pre_precedence_vertex, next,
-                                                                DesignFlowGraph::PRECEDENCE_SELECTOR);
-         const DesignFlowStepInfoRef pre_info = design_flow_graph->GetDesignFlowStepInfo(pre_precedence_vertex);
-         switch(pre_info->status)
+         INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
+                        "---Discarding outcome of concurrent execution of " + step->GetName());
+         if(preexecuted_steps.at(next) == DesignFlowStep_Status::SUCCESS)
          {
-            case DesignFlowStep_Status::ABORTED:
-            case DesignFlowStep_Status::EMPTY:
-            case DesignFlowStep_Status::SKIPPED:
-            case DesignFlowStep_Status::SUCCESS:
-            case DesignFlowStep_Status::UNCHANGED:
-            {
-               break;
-            }
-            case DesignFlowStep_Status::UNNECESSARY:
-            case DesignFlowStep_Status::UNEXECUTED:
-            {
-               current_ready = false;
-               break;
-            }
-            case DesignFlowStep_Status::NONEXISTENT:
-            {
-               THROW_UNREACHABLE("Step with nonexitent status");
-               break;
-            }
-            default:
-            {
-               THROW_UNREACHABLE("");
-            }
+            discarded_changes.insert(next);
          }
+         preexecuted_steps.erase(next);
+         preexecuted_measures.erase(next);
+         preexecuted = false;
       }
       if(not current_ready)
       {
@@ -575,38 +713,56 @@ void DesignFlowManager::Exec()
          STOP_TIME(before_time);
          design_flow_manager_time += before_time;
       }
-      if(design_flow_step_info->status == DesignFlowStep_Status::UNNECESSARY)
+      if(not preexecuted and design_flow_step_info->status == DesignFlowStep_Status::UNNECESSARY and
+         discarded_changes.find(next) == discarded_changes.end())
       {
          INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level,
                         "---Skipping execution of " + step->GetName() + " since unnecessary");
          design_flow_step_info->status = DesignFlowStep_Status::SKIPPED;
       }
-      else if(step->HasToBeExecuted())
+      else if(preexecuted or step->HasToBeExecuted())
       {
 #ifndef NDEBUG
          size_t indentation_before = indentation;
 #endif
          INDENT_OUT_MEX(OUTPUT_LEVEL_VERY_PEDANTIC, output_level, "-->Starting execution of " + step->GetName());
-         long step_execution_time = 0;
-         if(OUTPUT_LEVEL_VERY_PEDANTIC <= output_level || parameters->IsParameter("profile_steps"))
+         const auto probe = DesignFlowProfiler::Start();
+         const auto jobs = local_jobs.find(DesignFlowStep::GetStepClass(step->GetSignature()));
+         if(jobs != local_jobs.end() and jobs->second > 1 and not preexecuted and step->GetLocalFunction() and
+            step->CGetDebugLevel() < DEBUG_LEVEL_VERY_PEDANTIC)
          {
-            START_TIME(step_execution_time);
+            ExecuteLocalSteps(next, jobs->second);
          }
-         step->Initialize();
-         if(step->CGetDebugLevel() >= DEBUG_LEVEL_VERY_PEDANTIC)
+         DesignFlowProfiler::Measure measure;
+         const auto preexecuted_step = preexecuted_steps.find(next);
+         if(preexecuted_step != preexecuted_steps.end())
          {
-            step->PrintInitialIR();
+            design_flow_step_info->status = preexecuted_step->second;
+            preexecuted_steps.erase(preexecuted_step);
+            measure = preexecuted_measures.at(next);
+            preexecuted_measures.erase(next);
+         }
+         else
+         {
+            step->Initialize();
+            if(step->CGetDebugLevel() >= DEBUG_LEVEL_VERY_PEDANTIC)
+            {
+               step->PrintInitialIR();
+            }
+            design_flow_step_info->status = step->Exec();
+            measure = profiler.Stop(probe);
+         }
+         if(discarded_changes.erase(next) and design_flow_step_info->status == DesignFlowStep_Status::UNCHANGED)
+         {
+            /// the discarded concurrent execution already applied its changes
+            design_flow_step_info->status = DesignFlowStep_Status::SUCCESS;
          }
-         design_flow_step_info->status = step->Exec();
          executed_passes++;
+         profiler.Record(*step, design_flow_step_info->status, measure);
          if(step->CGetDebugLevel() >= DEBUG_LEVEL_VERY_PEDANTIC)
          {
             step->PrintFinalIR();
          }
-         if(OUTPUT_LEVEL_VERY_PEDANTIC <= output_level || parameters->IsParameter("profile_steps"))
-         {
-            STOP_TIME(step_execution_time);
-         }
          const std::string memory_usage =
 #ifndef NDEBUG
              std::string(" - Virtual Memory: ") + PrintVirtualDataMemoryUsage()
@@ -614,26 +770,13 @@ void DesignFlowManager::Exec()
              ""
 #endif
              ;
-#ifndef NDEBUG
-         if(parameters->IsParameter("profile_steps"))
-         {
-            accumulated_execution_time[next] += step_execution_time;
-            if(design_flow_step_info->status == DesignFlowStep_Status::SUCCESS)
-            {
-               success_executions[next]++;
-            }
-            else if(design_flow_step_info->status == DesignFlowStep_Status::UNCHANGED)
-            {
-               unchanged_executions[next]++;
-            }
-         }
-#endif
          INDENT_OUT_MEX(OUTPUT_LEVEL_VERY_PEDANTIC, output_level,
                         "<--Ended execution of " + step->GetName() +
                             (design_flow_step_info->status == DesignFlowStep_Status::UNCHANGED ?
                                  ":=" :
                                  (design_flow_step_info->status == DesignFlowStep_Status::SUCCESS ? ":+" : "")) +
-                            " in " + print_cpu_time(step_execution_time) + " seconds" + memory_usage);
+                            " in " + print_cpu_time(static_cast<long>(measure.cpu / 1000)) + " seconds" +
+                            memory_usage);
 #ifndef NDEBUG
          THROW_ASSERT(indentation_before == indentation, "Not closed indentation");
 #endif
@@ -641,14 +784,10 @@ void DesignFlowManager::Exec()
       else
       {
          INDENT_OUT_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "---Skipping execution of " + step->GetName());
-         design_flow_step_info->status = DesignFlowStep_Status::UNCHANGED;
+         design_flow_step_info->status = discarded_changes.erase(next) ? DesignFlowStep_Status::SUCCESS :
+                                                                          DesignFlowStep_Status::UNCHANGED;
          skipped_passes++;
-#ifndef NDEBUG
-         if(parameters->IsParameter("profile_steps"))
-         {
-            skipped_executions[next]++;
-         }
-#endif
+         profiler.RecordSkipped(*step);
       }
       long after_time = 0;
       if(parameters->IsParameter("dfm_statistics"))
@@ -667,9 +806,9 @@ void DesignFlowManager::Exec()
          DesignFlowStepSet::const_iterator relationship, relationship_end = relationships.end();
          for(relationship = relationships.begin(); relationship != relationship_end; ++relationship)
          {
-            const std::string relationship_signature = (*relationship)->GetSignature();
+            const auto relationship_signature = (*relationship)->GetSignature();
             vertex relationship_vertex = GetDesignFlowStep(relationship_signature);
-            THROW_ASSERT(relationship_vertex, "Missing vertex " + relationship_signature);
+            THROW_ASSERT(relationship_vertex, "Missing vertex " + STR(relationship_signature));
             if(design_flow_graph->IsReachable(relationship_vertex, next))
             {
                design_flow_graphs_collection->AddDesignFlowDependence(next, relationship_vertex,
@@ -885,6 +1024,7 @@ void DesignFlowManager::Exec()
          }
       }
    }
+   THROW_ASSERT(preexecuted_steps.empty(), "Outcome of concurrently executed steps has not been committed");
 #ifndef NDEBUG
    if(debug_level >= DEBUG_LEVEL_PARANOIC)
    {
@@ -928,40 +1068,45 @@ void DesignFlowManager::Exec()
                      "dfm_statistics - design flow manager time: " + print_cpu_time(design_flow_manager_time) +
                          " seconds");
    }
-#ifndef NDEBUG
-   if(parameters->IsParameter("profile_steps"))
+   if(parameters->isOption(OPT_profile_steps))
    {
+      std::stringstream summary;
+      profiler.WriteSummary(summary);
       INDENT_OUT_MEX(OUTPUT_LEVEL_NONE, output_level, "-->Steps execution statistics");
-      for(const auto step : accumulated_execution_time)
+      std::string line;
+      while(std::getline(summary, line))
       {
-         INDENT_OUT_MEX(OUTPUT_LEVEL_NONE, output_level,
-                        "---" + step_names.at(step.first) + ": " + print_cpu_time(step.second) +
-                            " seconds - Successes: " + STR(success_executions[step.first]) +
-                            " - Unchanged: " + STR(unchanged_executions[step.first]) +
-                            " - Skipped: " + STR(skipped_executions[step.first]));
+         INDENT_OUT_MEX(OUTPUT_LEVEL_NONE, output_level, "---" + line);
+      }
+      const auto trace_file = parameters->getOption<std::string>(OPT_profile_steps);
+      if(!trace_file.empty())
+      {
+         std::ofstream trace(trace_file);
+         profiler.WriteChromeTrace(trace);
+         INDENT_OUT_MEX(OUTPUT_LEVEL_NONE, output_level, "---Steps execution trace written to " + trace_file);
       }
       INDENT_OUT_MEX(OUTPUT_LEVEL_NONE, output_level, "<--");
    }
-#endif
    INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "---Total number of iterations: " + STR(step_counter));
    INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, debug_level, "<--Ended execution of design flow");
 }
 
-vertex DesignFlowManager::GetDesignFlowStep(const std::string& signature) const
+vertex DesignFlowManager::GetDesignFlowStep(DesignFlowStep::signature_t signature) const
 {
    return design_flow_graphs_collection->GetDesignFlowStep(signature);
 }
 
-DesignFlowStepFactoryConstRef DesignFlowManager::CGetDesignFlowStepFactory(const std::string& prefix) const
+DesignFlowStepFactoryConstRef DesignFlowManager::CGetDesignFlowStepFactory(DesignFlowStep::StepClass step_class) const
 {
-   THROW_ASSERT(design_flow_step_factories.find(prefix) != design_flow_step_factories.end(),
-                "No factory to create steps with prefix " + prefix + " found");
-   return design_flow_step_factories.find(prefix)->second;
+   const auto factory = design_flow_step_factories.find(step_class);
+   THROW_ASSERT(factory != design_flow_step_factories.end(),
+                "No factory to create steps of class " + STR(static_cast<unsigned int>(step_class)) + " found");
+   return factory->second;
 }
 
 void DesignFlowManager::RegisterFactory(const DesignFlowStepFactoryConstRef factory)
 {
-   design_flow_step_factories[factory->GetPrefix()] = factory;
+   design_flow_step_factories[factory->GetClass()] = factory;
 }
 
 void DesignFlowManager::DeExecute(const vertex starting_vertex, const bool force_execution)
@@ -1086,7 +1231,7 @@ void DesignFlowManager::DeExecute(const vertex starting_vertex, const bool force
    }
 }
 
-DesignFlowStep_Status DesignFlowManager::GetStatus(const std::string& signature) const
+DesignFlowStep_Status DesignFlowManager::GetStatus(DesignFlowStep::signature_t signature) const
 {
    const vertex step = GetDesignFlowStep(signature);
    if(step == NULL_VERTEX)
@@ -1099,11 +1244,9 @@ DesignFlowStep_Status DesignFlowManager::GetStatus(const std::string& signature)
    }
 }
 
-const DesignFlowStepRef DesignFlowManager::CreateFlowStep(const std::string& signature) const
+const DesignFlowStepRef DesignFlowManager::CreateFlowStep(DesignFlowStep::signature_t signature) const
 {
-   THROW_ASSERT(signature.find("::") != std::string::npos, signature);
-   const auto prefix = signature.substr(0, signature.find("::"));
-   return CGetDesignFlowStepFactory(prefix)->CreateFlowStep(signature);
+   return CGetDesignFlowStepFactory(DesignFlowStep::GetStepClass(signature))->CreateFlowStep(signature);
 }
 
 #ifndef NDEBUG
@@ -42,19 +42,19 @@
 #define DESIGN_FLOW_MANAGER_HPP
 
 #include "custom_map.hpp"
-#include "graph.hpp"    // for vertex, Paramete...
-#include "refcount.hpp" // for REF_FORWARD_DECL
-#include <cstddef>      // for size_t
-#include <functional>   // for binary_function
-#include <set>          // for set
-#include <string>       // for string
-
-class DesignFlowStepSet;
+#include "custom_set.hpp"
+#include "design_flow_profiler.hpp" // for DesignFlowProfiler
+#include "design_flow_step.hpp"     // for DesignFlowStep::signature_t
+#include "graph.hpp"                // for vertex, Paramete...
+#include "refcount.hpp"             // for REF_FORWARD_DECL
+#include <cstddef>                  // for size_t
+#include <functional>               // for binary_function
+#include <set>                      // for set
+#include <string>                   // for string
+
 CONSTREF_FORWARD_DECL(DesignFlowGraph);
 REF_FORWARD_DECL(DesignFlowGraph);
 REF_FORWARD_DECL(DesignFlowGraphsCollection);
-REF_FORWARD_DECL(DesignFlowStep);
-enum class DesignFlowStep_Status;
 CONSTREF_FORWARD_DECL(DesignFlowStepFactory);
 REF_FORWARD_DECL(DesignFlowStepInfo);
 REF_FORWARD_DECL(Parameter);
@@ -106,7 +106,21 @@ class DesignFlowManager final
    std::set<vertex, DesignFlowStepNecessitySorter> possibly_ready;
 
    /// The registered factories
-   CustomUnorderedMap<std::string, DesignFlowStepFactoryConstRef> design_flow_step_factories;
+   CustomUnorderedMap<DesignFlowStep::StepClass, DesignFlowStepFactoryConstRef> design_flow_step_factories;
+
+   /// The steps which have already been executed concurrently with another function-local step; their status has
+   /// still to be committed to the design flow graph, which is done when they are selected if they are still ready
+   CustomUnorderedMap<vertex, DesignFlowStep_Status> preexecuted_steps;
+
+   /// The measurements of the steps in preexecuted_steps
+   CustomUnorderedMap<vertex, DesignFlowProfiler::Measure> preexecuted_measures;
+
+   /// The steps whose concurrent execution changed the intermediate representation, but whose outcome has been
+   /// discarded since they were not ready anymore when selected; their next execution is reported as a change
+   CustomUnorderedSet<vertex> discarded_changes;
+
+   /// The execution statistics of the steps
+   DesignFlowProfiler profiler;
 
 #ifndef NDEBUG
    /// This structure stores "history of design flow graph manager - vertices"
@@ -125,18 +139,6 @@ class DesignFlowManager final
    /// The name of each vertex (we have to store since it is possible that it cannot be recomputed at the end - for
    /// example because the corresponding task graph has been deallocated)
    CustomMap<vertex, std::string> step_names;
-
-   /// The accumulated times of each step
-   CustomMap<vertex, long> accumulated_execution_time;
-
-   /// The number of times each step is executed with success
-   CustomMap<vertex, size_t> success_executions;
-
-   /// The number of times each step is executed with unchanged exit
-   CustomMap<vertex, size_t> unchanged_executions;
-
-   /// The number of times the execution of a step is skipped
-   CustomMap<vertex, size_t> skipped_executions;
 #endif
 
    /// The set of input parameters
@@ -148,6 +150,24 @@ class DesignFlowManager final
    /// The debug level
    int debug_level;
 
+   /// The maximum number of function-local steps executed concurrently for each class of steps
+   CustomUnorderedMap<DesignFlowStep::StepClass, size_t> local_jobs;
+
+   /**
+    * Add the missing dependences and precedences of a step to the design flow and check if they have been executed
+    * @param step_vertex is the step to be considered
+    * @return true if the step is ready to be executed
+    */
+   bool RecomputeRelationships(const vertex step_vertex);
+
+   /**
+    * Execute a function-local step together with other ready function-local steps of the same class which can be
+    * executed concurrently with it; the outcome of all of them is stored in preexecuted_steps
+    * @param step_vertex is the step to be executed
+    * @param jobs is the maximum number of steps to be executed concurrently
+    */
+   void ExecuteLocalSteps(const vertex step_vertex, const size_t jobs);
+
    /**
     * Recursively add steps and corresponding dependencies to the design flow
     * @param steps is the set of steps to be added
@@ -210,20 +230,20 @@ class DesignFlowManager final
     * Return the vertex associated with a design step if exists, NULL_VERTEX otherwise
     * @param signature is the signature of the design step
     */
-   vertex GetDesignFlowStep(const std::string& signature) const;
+   vertex GetDesignFlowStep(DesignFlowStep::signature_t signature) const;
 
    /**
     * Return the status of a design step (if it does not exist return NONEXISTENT)
     * @param signature is the signature of the design step
     */
-   DesignFlowStep_Status GetStatus(const std::string& signature) const;
+   DesignFlowStep_Status GetStatus(DesignFlowStep::signature_t signature) const;
 
    /**
-    * Return the factory which can create design flow step with signature beginning with prefix
-    * @param prefix is the beginning of the steps that the factory should be created
+    * Return the factory which can create design flow steps of a given class
+    * @param step_class is the class of the steps that the factory should create
     * @return the corresponding factory
     */
-   DesignFlowStepFactoryConstRef CGetDesignFlowStepFactory(const std::string& prefix) const;
+   DesignFlowStepFactoryConstRef CGetDesignFlowStepFactory(DesignFlowStep::StepClass step_class) const;
 
    /**
     * Register a design flow step factory
@@ -236,7 +256,7 @@ class DesignFlowManager final
     * @param signature is the signature of the step to be created
     * @return the created design flow step
     */
-   const DesignFlowStepRef CreateFlowStep(const std::string& signature) const;
+   const DesignFlowStepRef CreateFlowStep(DesignFlowStep::signature_t signature) const;
 };
 
 using DesignFlowManagerRef = refcount<DesignFlowManager>;
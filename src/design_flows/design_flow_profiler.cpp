@@ -0,0 +1,284 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file design_flow_profiler.cpp
+ * @brief Collection of execution statistics of design flow steps
+ *
+ * @author agent <agent@local>
+ *
+ */
+#include "design_flow_profiler.hpp"
+
+#include <algorithm>      // for sort
+#include <ctime>          // for clock_gettime
+#include <iomanip>        // for setw
+#include <ostream>        // for ostream
+#include <sstream>        // for ostringstream
+#include <sys/resource.h> // for getrusage
+
+/**
+ * Return the CPU time of the process or of the calling thread in microseconds
+ */
+static long long GetCpuTime(bool thread_cpu)
+{
+   struct timespec ts;
+   if(clock_gettime(thread_cpu ? CLOCK_THREAD_CPUTIME_ID : CLOCK_PROCESS_CPUTIME_ID, &ts))
+   {
+      return 0;
+   }
+   return static_cast<long long>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
+/**
+ * Return the peak resident set size of the process in KB
+ */
+static long long GetPeakRss()
+{
+   struct rusage usage;
+   if(getrusage(RUSAGE_SELF, &usage))
+   {
+      return 0;
+   }
+   return static_cast<long long>(usage.ru_maxrss);
+}
+
+/**
+ * Print a string as a JSON string literal
+ */
+static void WriteJSONString(std::ostream& os, const std::string& str)
+{
+   os << '"';
+   for(const auto c : str)
+   {
+      if(c == '"' || c == '\\')
+      {
+         os << '\\' << c;
+      }
+      else if(static_cast<unsigned char>(c) < 0x20)
+      {
+         os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec
+            << std::setfill(' ');
+      }
+      else
+      {
+         os << c;
+      }
+   }
+   os << '"';
+}
+
+/**
+ * Return the name of an execution outcome
+ */
+static const char* GetStatusName(DesignFlowStep_Status status)
+{
+   switch(status)
+   {
+      case DesignFlowStep_Status::ABORTED:
+         return "ABORTED";
+      case DesignFlowStep_Status::EMPTY:
+         return "EMPTY";
+      case DesignFlowStep_Status::NONEXISTENT:
+         return "NONEXISTENT";
+      case DesignFlowStep_Status::SKIPPED:
+         return "SKIPPED";
+      case DesignFlowStep_Status::SUCCESS:
+         return "SUCCESS";
+      case DesignFlowStep_Status::UNCHANGED:
+         return "UNCHANGED";
+      case DesignFlowStep_Status::UNEXECUTED:
+         return "UNEXECUTED";
+      case DesignFlowStep_Status::UNNECESSARY:
+         return "UNNECESSARY";
+      default:
+         break;
+   }
+   return "UNKNOWN";
+}
+
+DesignFlowProfiler::DesignFlowProfiler() : origin(std::chrono::steady_clock::now())
+{
+}
+
+DesignFlowProfiler::Probe DesignFlowProfiler::Start(bool thread_cpu)
+{
+   return Probe{std::chrono::steady_clock::now(), GetCpuTime(thread_cpu), GetPeakRss(), thread_cpu};
+}
+
+DesignFlowProfiler::Measure DesignFlowProfiler::Stop(const Probe& probe, size_t lane) const
+{
+   const auto now = std::chrono::steady_clock::now();
+   Measure measure;
+   measure.start = std::chrono::duration_cast<std::chrono::microseconds>(probe.wall - origin).count();
+   measure.wall = std::chrono::duration_cast<std::chrono::microseconds>(now - probe.wall).count();
+   measure.cpu = GetCpuTime(probe.thread_cpu) - probe.cpu;
+   measure.peak_rss = GetPeakRss() - probe.peak_rss;
+   measure.lane = lane;
+   return measure;
+}
+
+size_t DesignFlowProfiler::GetKey(const DesignFlowStep& step)
+{
+   auto name = step.GetName();
+   const auto it = key_index.find(name);
+   if(it != key_index.end())
+   {
+      return it->second;
+   }
+   StepKey key{name, name, ""};
+   /// Names of function steps are <class>::<type>::<function>, possibly followed by the IR versions in debug builds
+   const auto step_class = DesignFlowStep::GetStepClass(step.GetSignature());
+   const auto type_end = name.find("::", name.find("::") + 2);
+   if((step_class == DesignFlowStep::FRONTEND || step_class == DesignFlowStep::HLS) &&
+      name.find("::") != std::string::npos && type_end != std::string::npos)
+   {
+      key.type = name.substr(0, type_end);
+      key.function = name.substr(type_end + 2);
+      key.function = key.function.substr(0, key.function.find_first_of("(["));
+   }
+   const auto index = keys.size();
+   keys.push_back(key);
+   skipped.push_back(0);
+   key_index.emplace(std::move(name), index);
+   return index;
+}
+
+void DesignFlowProfiler::Record(const DesignFlowStep& step, DesignFlowStep_Status status, const Measure& measure)
+{
+   events.push_back(Event{GetKey(step), status, measure});
+}
+
+void DesignFlowProfiler::RecordSkipped(const DesignFlowStep& step)
+{
+   ++skipped[GetKey(step)];
+}
+
+void DesignFlowProfiler::WriteTable(std::ostream& os, const std::string& title,
+                                    std::vector<std::pair<std::string, Statistics>>& table)
+{
+   std::sort(table.begin(), table.end(), [](const std::pair<std::string, Statistics>& a,
+                                            const std::pair<std::string, Statistics>& b) {
+      return a.second.wall > b.second.wall || (a.second.wall == b.second.wall && a.first < b.first);
+   });
+   size_t width = title.size();
+   for(const auto& row : table)
+   {
+      width = std::max(width, row.first.size());
+   }
+   const auto seconds = [](long long us) {
+      std::ostringstream value;
+      value << std::fixed << std::setprecision(3) << static_cast<double>(us) / 1e6;
+      return value.str();
+   };
+   os << std::left << std::setw(static_cast<int>(width)) << title << std::right << std::setw(12) << "Wall (s)"
+      << std::setw(12) << "CPU (s)" << std::setw(14) << "Peak RSS (KB)" << std::setw(8) << "Calls" << std::setw(11)
+      << "Unchanged" << std::setw(9) << "Skipped"
+      << "\n";
+   for(const auto& row : table)
+   {
+      const auto& stats = row.second;
+      os << std::left << std::setw(static_cast<int>(width)) << row.first << std::right << std::setw(12)
+         << seconds(stats.wall) << std::setw(12) << seconds(stats.cpu) << std::setw(14) << stats.peak_rss
+         << std::setw(8) << stats.invocations << std::setw(11) << stats.unchanged << std::setw(9) << stats.skipped
+         << "\n";
+   }
+}
+
+void DesignFlowProfiler::WriteSummary(std::ostream& os) const
+{
+   CustomMap<std::string, Statistics> types, functions;
+   const auto accumulate = [](Statistics& stats, const Event& event) {
+      stats.wall += event.measure.wall;
+      stats.cpu += event.measure.cpu;
+      stats.peak_rss += event.measure.peak_rss;
+      stats.invocations++;
+      if(event.status == DesignFlowStep_Status::UNCHANGED)
+      {
+         stats.unchanged++;
+      }
+   };
+   for(const auto& event : events)
+   {
+      const auto& key = keys.at(event.key);
+      accumulate(types[key.type], event);
+      if(!key.function.empty())
+      {
+         accumulate(functions[key.function], event);
+      }
+   }
+   for(size_t index = 0; index < keys.size(); ++index)
+   {
+      if(skipped.at(index))
+      {
+         types[keys.at(index).type].skipped += skipped.at(index);
+         if(!keys.at(index).function.empty())
+         {
+            functions[keys.at(index).function].skipped += skipped.at(index);
+         }
+      }
+   }
+   std::vector<std::pair<std::string, Statistics>> types_table(types.begin(), types.end());
+   WriteTable(os, "Step", types_table);
+   if(functions.size())
+   {
+      os << "\n";
+      std::vector<std::pair<std::string, Statistics>> functions_table(functions.begin(), functions.end());
+      WriteTable(os, "Function", functions_table);
+   }
+}
+
+void DesignFlowProfiler::WriteChromeTrace(std::ostream& os) const
+{
+   os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+   bool first = true;
+   for(const auto& event : events)
+   {
+      const auto& key = keys.at(event.key);
+      os << (first ? "" : ",\n") << "{\"name\":";
+      WriteJSONString(os, key.name);
+      os << ",\"cat\":";
+      WriteJSONString(os, key.type);
+      os << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.measure.lane << ",\"ts\":" << event.measure.start
+         << ",\"dur\":" << event.measure.wall << ",\"args\":{\"cpu_us\":" << event.measure.cpu
+         << ",\"peak_rss_delta_kb\":" << event.measure.peak_rss << ",\"status\":\"" << GetStatusName(event.status)
+         << "\"";
+      if(!key.function.empty())
+      {
+         os << ",\"function\":";
+         WriteJSONString(os, key.function);
+      }
+      os << "}}";
+      first = false;
+   }
+   os << "\n]}\n";
+}
@@ -0,0 +1,220 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file design_flow_profiler.hpp
+ * @brief Collection of execution statistics of design flow steps
+ *
+ * @author agent <agent@local>
+ *
+ */
+#ifndef DESIGN_FLOW_PROFILER_HPP
+#define DESIGN_FLOW_PROFILER_HPP
+
+#include "custom_map.hpp"
+#include "design_flow_step.hpp" // for DesignFlowStep_Status
+
+#include <chrono>   // for steady_clock
+#include <cstddef>  // for size_t
+#include <iosfwd>   // for ostream
+#include <string>   // for string
+#include <utility>  // for pair
+#include <vector>   // for vector
+
+/**
+ * Always-on profiler of the design flow: for each executed step it records wall time, CPU time and growth of the peak
+ * resident set size. The collected samples can be summarized per step type and per function or exported as a Chrome
+ * trace-event file (chrome://tracing, Perfetto).
+ */
+class DesignFlowProfiler
+{
+ public:
+   /**
+    * Snapshot of the counters taken when a step starts
+    */
+   struct Probe
+   {
+      /// The wall clock time
+      std::chrono::steady_clock::time_point wall;
+
+      /// The CPU time in microseconds
+      long long cpu;
+
+      /// The peak resident set size in KB
+      long long peak_rss;
+
+      /// True if the CPU time is the one of the calling thread instead of the one of the whole process
+      bool thread_cpu;
+   };
+
+   /**
+    * Measurement of a single step execution
+    */
+   struct Measure
+   {
+      /// The start time in microseconds since the creation of the profiler
+      long long start;
+
+      /// The wall time in microseconds
+      long long wall;
+
+      /// The CPU time in microseconds
+      long long cpu;
+
+      /// The growth of the peak resident set size in KB
+      long long peak_rss;
+
+      /// The lane of the execution (0 for the main thread, i for the i-th concurrent worker)
+      size_t lane;
+   };
+
+   /**
+    * Constructor
+    */
+   DesignFlowProfiler();
+
+   /**
+    * Take the snapshot of the counters at the beginning of a step
+    * @param thread_cpu tells if the step is executed by a worker thread, so that only its CPU time has to be considered
+    * @return the snapshot
+    */
+   static Probe Start(bool thread_cpu = false);
+
+   /**
+    * Compute the measurement of a step started with Start
+    * @param probe is the snapshot taken at the beginning of the step
+    * @param lane is the lane of the execution
+    * @return the measurement
+    */
+   Measure Stop(const Probe& probe, size_t lane = 0) const;
+
+   /**
+    * Record the execution of a step
+    * @param step is the executed step
+    * @param status is the outcome of the execution
+    * @param measure is the measurement of the execution
+    */
+   void Record(const DesignFlowStep& step, DesignFlowStep_Status status, const Measure& measure);
+
+   /**
+    * Record a step which has not been executed since it was not necessary
+    * @param step is the skipped step
+    */
+   void RecordSkipped(const DesignFlowStep& step);
+
+   /**
+    * Print the summary tables: steps sorted by decreasing wall time, grouped per step type and per function
+    * @param os is the output stream
+    */
+   void WriteSummary(std::ostream& os) const;
+
+   /**
+    * Write the executions in Chrome trace-event JSON format
+    * @param os is the output stream
+    */
+   void WriteChromeTrace(std::ostream& os) const;
+
+ private:
+   /**
+    * The identity of a profiled step
+    */
+   struct StepKey
+   {
+      /// The name of the step
+      std::string name;
+
+      /// The type of the step, i.e., its name without the function
+      std::string type;
+
+      /// The function the step works on, empty if the step is not function-local
+      std::string function;
+   };
+
+   /**
+    * The execution of a step
+    */
+   struct Event
+   {
+      /// The index of the step in keys
+      size_t key;
+
+      /// The outcome of the execution
+      DesignFlowStep_Status status;
+
+      /// The measurement of the execution
+      Measure measure;
+   };
+
+   /**
+    * Statistics accumulated over several executions
+    */
+   struct Statistics
+   {
+      long long wall = 0;
+      long long cpu = 0;
+      long long peak_rss = 0;
+      size_t invocations = 0;
+      size_t unchanged = 0;
+      size_t skipped = 0;
+   };
+
+   /// The creation time of the profiler, used as origin of the trace
+   const std::chrono::steady_clock::time_point origin;
+
+   /// The identity of the profiled steps
+   std::vector<StepKey> keys;
+
+   /// The index in keys of each step name
+   CustomUnorderedMap<std::string, size_t> key_index;
+
+   /// The executions in order of completion
+   std::vector<Event> events;
+
+   /// The number of skipped executions of each step in keys
+   std::vector<size_t> skipped;
+
+   /**
+    * Return the index of the key of a step, adding it if missing
+    */
+   size_t GetKey(const DesignFlowStep& step);
+
+   /**
+    * Print a table of statistics sorted by decreasing wall time
+    * @param os is the output stream
+    * @param title is the header of the first column
+    * @param table is the list of rows
+    */
+   static void WriteTable(std::ostream& os, const std::string& title,
+                          std::vector<std::pair<std::string, Statistics>>& table);
+};
+
+#endif
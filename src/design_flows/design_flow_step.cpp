@@ -42,8 +42,10 @@
  */
 #include "design_flow_step.hpp"
 #include "Parameter.hpp"           // for Parameter, OPT_debug_level
+#include "custom_map.hpp"          // for CustomUnorderedMapUnstable
 #include "design_flow_manager.hpp" // for DesignFlowStepRef, DesignF...
 #include <ostream>                 // for operator<<, basic_ostream
+#include <vector>                  // for vector
 
 DesignFlowStep::DesignFlowStep(const DesignFlowManagerConstRef _design_flow_manager,
                                const ParameterConstRef _parameters)
@@ -57,10 +59,37 @@ DesignFlowStep::DesignFlowStep(const DesignFlowManagerConstRef _design_flow_mana
 
 DesignFlowStep::~DesignFlowStep() = default;
 
+/// The names interned by GetSignatureContext
+static std::vector<std::string>& signature_context_names()
+{
+   static std::vector<std::string> names;
+   return names;
+}
+
+unsigned long long DesignFlowStep::GetSignatureContext(const std::string& name)
+{
+   static CustomUnorderedMapUnstable<std::string, unsigned long long> name_to_context;
+   const auto it = name_to_context.find(name);
+   if(it != name_to_context.end())
+   {
+      return it->second;
+   }
+   auto& names = signature_context_names();
+   names.push_back(name);
+   return name_to_context[name] = names.size() - 1;
+}
+
+const std::string& DesignFlowStep::GetSignatureContextName(const unsigned long long context)
+{
+   const auto& names = signature_context_names();
+   THROW_ASSERT(context < names.size(), "Unknown signature context " + std::to_string(context));
+   return names.at(context);
+}
+
 void DesignFlowStep::WriteDot(std::ostream& out) const
 {
    out << "label=\"" << GetName() << "\\n"
-       << "Signature: " << GetSignature() << "\"";
+       << "Signature: " << std::hex << GetSignature() << std::dec << "\"";
 }
 
 bool DesignFlowStep::IsComposed() const
@@ -68,6 +97,16 @@ bool DesignFlowStep::IsComposed() const
    return composed;
 }
 
+unsigned int DesignFlowStep::GetLocalFunction() const
+{
+   return 0;
+}
+
+bool DesignFlowStep::IsConcurrentWith(const DesignFlowStep& other) const
+{
+   return GetLocalFunction() != other.GetLocalFunction();
+}
+
 void DesignFlowStep::Initialize()
 {
 }
@@ -45,10 +45,11 @@
 #define DESIGN_FLOW_STEP_HPP
 #include "config_HAVE_UNORDERED.hpp" // for HAVE_UNORDERED
 
-#include "graph.hpp"    // for vertex
-#include "refcount.hpp" // for CONSTREF_FORWARD...
-#include <iosfwd>       // for ostream
-#include <string>       // for string
+#include "exceptions.hpp" // for THROW_ASSERT
+#include "graph.hpp"      // for vertex
+#include "refcount.hpp"   // for CONSTREF_FORWARD...
+#include <iosfwd>         // for ostream
+#include <string>         // for string
 
 CONSTREF_FORWARD_DECL(DesignFlowManager);
 REF_FORWARD_DECL(DesignFlowStep);
@@ -111,6 +112,27 @@ enum class DesignFlowStep_Status
  */
 class DesignFlowStep
 {
+ public:
+   /// Compact identifier of a design flow step: the class, the type and a class specific context of the step packed in
+   /// a single integer
+   using signature_t = unsigned long long;
+
+   /**
+    * The classes of design flow steps; each class of steps is created by a different factory
+    */
+   enum StepClass : unsigned short
+   {
+      AUX,
+      C_BACKEND,
+      DESIGN_FLOW,
+      FRONTEND,
+      HLS,
+      PARSER,
+      RTL_CHARACTERIZATION,
+      TECHNOLOGY,
+      TO_DATA_FILE
+   };
+
  protected:
    /// True if this step represents a composition of design flow steps (e.g., a flow); must be set by specialized
    /// constructors
@@ -163,6 +185,20 @@ class DesignFlowStep
     */
    virtual bool HasToBeExecuted() const = 0;
 
+   /**
+    * Return the function whose body is the only part of the intermediate representation accessed by this step;
+    * steps for which this is not zero can be executed concurrently when IsConcurrentWith allows it
+    * @return the index of the function or 0 if the step may access data shared among functions
+    */
+   virtual unsigned int GetLocalFunction() const;
+
+   /**
+    * Check if this function-local step can be executed concurrently with another function-local step
+    * @param other is the other step
+    * @return true if the two steps work on different functions
+    */
+   virtual bool IsConcurrentWith(const DesignFlowStep& other) const;
+
    /**
     * Initialize the step (i.e., like a constructor, but executed just before exec
     */
@@ -172,7 +208,58 @@ class DesignFlowStep
     * Return a unified identifier of this design step
     * @return the signature of the design step
     */
-   virtual std::string GetSignature() const = 0;
+   virtual signature_t GetSignature() const = 0;
+
+   /**
+    * Compose the signature of a design flow step
+    * @param step_class is the class of the step
+    * @param step_type is the type of the step inside its class
+    * @param context is the class specific information identifying the step (e.g., the function id); it must fit in 40
+    * bits
+    * @return the signature of the step
+    */
+   static inline signature_t ComputeSignature(const StepClass step_class, const unsigned short step_type,
+                                              const unsigned long long context)
+   {
+      THROW_ASSERT(context < (1ULL << 40), "Signature context out of range: " + std::to_string(context));
+      return (static_cast<signature_t>(step_class) << 56) | (static_cast<signature_t>(step_type) << 40) | context;
+   }
+
+   /**
+    * Return the class of a step given its signature
+    */
+   static inline StepClass GetStepClass(const signature_t signature)
+   {
+      return static_cast<StepClass>(signature >> 56);
+   }
+
+   /**
+    * Return the type of a step inside its class given its signature
+    */
+   static inline unsigned short GetStepType(const signature_t signature)
+   {
+      return static_cast<unsigned short>((signature >> 40) & 0xFFFF);
+   }
+
+   /**
+    * Return the class specific context of a step given its signature
+    */
+   static inline unsigned long long GetStepContext(const signature_t signature)
+   {
+      return signature & ((1ULL << 40) - 1);
+   }
+
+   /**
+    * Intern a name (e.g., a file name) which identifies a step, so that it can be used as signature context
+    * @param name is the name to be interned
+    * @return the identifier of the name, which is the same for equal names
+    */
+   static unsigned long long GetSignatureContext(const std::string& name);
+
+   /**
+    * Return the name from which a signature context has been computed by GetSignatureContext
+    */
+   static const std::string& GetSignatureContextName(const unsigned long long context);
 
    /**
     * Return the name of this design step
@@ -50,9 +50,11 @@
 /// utility include
 #include "exceptions.hpp"
 
-DesignFlowStepFactory::DesignFlowStepFactory(const DesignFlowManagerConstRef& _design_flow_manager,
+DesignFlowStepFactory::DesignFlowStepFactory(DesignFlowStep::StepClass _step_class,
+                                             const DesignFlowManagerConstRef& _design_flow_manager,
                                              const ParameterConstRef& _parameters)
-    : design_flow_manager(_design_flow_manager),
+    : step_class(_step_class),
+      design_flow_manager(_design_flow_manager),
       parameters(_parameters),
       debug_level(_parameters->getOption<int>(OPT_debug_level))
 {
@@ -60,7 +62,7 @@ DesignFlowStepFactory::DesignFlowStepFactory(const DesignFlowManagerConstRef& _d
 
 DesignFlowStepFactory::~DesignFlowStepFactory() = default;
 
-DesignFlowStepRef DesignFlowStepFactory::CreateFlowStep(const std::string&) const
+DesignFlowStepRef DesignFlowStepFactory::CreateFlowStep(DesignFlowStep::signature_t) const
 {
    THROW_UNREACHABLE("Not yet implemented");
    return DesignFlowStepRef();
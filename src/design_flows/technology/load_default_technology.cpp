@@ -42,6 +42,7 @@
 
 #include "config_PANDA_DATA_INSTALLDIR.hpp"
 
+#include "Parameter.hpp"
 #include "custom_set.hpp"
 #include "fileIO.hpp"
 #include "string_manipulation.hpp"
@@ -70,6 +71,8 @@ LoadDefaultTechnology::ComputeTechnologyRelationships(const DesignFlowStep::Rela
 DesignFlowStep_Status LoadDefaultTechnology::Exec()
 {
    size_t i = 0;
+   const auto technology_cache =
+       parameters->isOption(OPT_technology_cache) ? parameters->getOption<std::string>(OPT_technology_cache) : "";
    try
    {
       /// Load default resources
@@ -84,7 +87,7 @@ DesignFlowStep_Status LoadDefaultTechnology::Exec()
       {
          XMLDomParser parser(relocate_compiler_path(PANDA_DATA_INSTALLDIR "/panda/design_flows/technology/", true) +
                              builtin_resources_data[i]);
-         parser.Exec();
+         parser.Exec(technology_cache);
          if(parser)
          {
             // Walk the tree:
@@ -75,12 +75,13 @@ const std::string TechnologyFlowStep::EnumToName(const TechnologyFlowStep_Type t
    return "";
 }
 
-const std::string TechnologyFlowStep::ComputeSignature(const TechnologyFlowStep_Type technology_flow_step_type)
+DesignFlowStep::signature_t
+TechnologyFlowStep::ComputeSignature(const TechnologyFlowStep_Type technology_flow_step_type)
 {
-   return "Technology::" + STR(static_cast<int>(technology_flow_step_type));
+   return DesignFlowStep::ComputeSignature(TECHNOLOGY, static_cast<unsigned short>(technology_flow_step_type), 0);
 }
 
-std::string TechnologyFlowStep::GetSignature() const
+DesignFlowStep::signature_t TechnologyFlowStep::GetSignature() const
 {
    return ComputeSignature(technology_flow_step_type);
 }
@@ -108,7 +109,7 @@ void TechnologyFlowStep::ComputeRelationships(DesignFlowStepSet& steps,
 
 DesignFlowStepFactoryConstRef TechnologyFlowStep::CGetDesignFlowStepFactory() const
 {
-   return design_flow_manager.lock()->CGetDesignFlowStepFactory("Technology");
+   return design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::TECHNOLOGY);
 }
 
 TechnologyFlowStep::TechnologyFlowStep(const technology_managerRef _TM, const generic_deviceRef _target,
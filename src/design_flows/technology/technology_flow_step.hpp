@@ -123,7 +123,7 @@ class TechnologyFlowStep : public DesignFlowStep
     * Return a unified identifier of this design step
     * @return the signature of the design step
     */
-   std::string GetSignature() const override;
+   signature_t GetSignature() const override;
 
    /**
     * Given a technology flow step type, return the name of the type
@@ -137,7 +137,7 @@ class TechnologyFlowStep : public DesignFlowStep
     * @param technology_flow_step_type is the type of the step
     * @return the corresponding signature
     */
-   static const std::string ComputeSignature(const TechnologyFlowStep_Type technology_flow_step_type);
+   static signature_t ComputeSignature(const TechnologyFlowStep_Type technology_flow_step_type);
 
    /**
     * Return the name of this design step
@@ -53,17 +53,12 @@
 TechnologyFlowStepFactory::TechnologyFlowStepFactory(const technology_managerRef _TM, const generic_deviceRef _target,
                                                      const DesignFlowManagerConstRef _design_flow_manager,
                                                      const ParameterConstRef _parameters)
-    : DesignFlowStepFactory(_design_flow_manager, _parameters), TM(_TM), target(_target)
+    : DesignFlowStepFactory(DesignFlowStep::TECHNOLOGY, _design_flow_manager, _parameters), TM(_TM), target(_target)
 {
 }
 
 TechnologyFlowStepFactory::~TechnologyFlowStepFactory() = default;
 
-const std::string TechnologyFlowStepFactory::GetPrefix() const
-{
-   return "Technology";
-}
-
 DesignFlowStepRef
 TechnologyFlowStepFactory::CreateTechnologyFlowStep(const TechnologyFlowStep_Type technology_flow_step_type) const
 {
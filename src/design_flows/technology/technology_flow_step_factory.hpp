@@ -78,10 +78,6 @@ class TechnologyFlowStepFactory : public DesignFlowStepFactory
     */
    ~TechnologyFlowStepFactory() override;
 
-   /**
-    * Return the prefix of the steps created by the factory
-    */
-   const std::string GetPrefix() const override;
 
    /**
     * Create a scheduling design flow step
@@ -64,14 +64,14 @@ bool BitLatticeManipulator::IsSignedIntegerType(const tree_nodeConstRef& tn) con
    return signed_var.count(tn->index) || tree_helper::IsSignedIntegerType(tn);
 }
 
-std::deque<bit_lattice> BitLatticeManipulator::sup(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                                                   const unsigned int output_uid) const
+bit_lattice_string BitLatticeManipulator::sup(const bit_lattice_string& a, const bit_lattice_string& b,
+                                              const unsigned int output_uid) const
 {
    return sup(a, b, TM->CGetTreeNode(output_uid));
 }
 
-std::deque<bit_lattice> BitLatticeManipulator::sup(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                                                   const tree_nodeConstRef& out_node) const
+bit_lattice_string BitLatticeManipulator::sup(const bit_lattice_string& a, const bit_lattice_string& b,
+                                              const tree_nodeConstRef& out_node) const
 {
    THROW_ASSERT(!a.empty() && !b.empty(), "a.size() = " + STR(a.size()) + " b.size() = " + STR(b.size()));
 
@@ -104,14 +104,14 @@ std::deque<bit_lattice> BitLatticeManipulator::sup(const std::deque<bit_lattice>
    return ::sup(a, b, out_type_size, out_is_signed, out_is_bool);
 }
 
-std::deque<bit_lattice> BitLatticeManipulator::inf(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                                                   const unsigned int output_uid) const
+bit_lattice_string BitLatticeManipulator::inf(const bit_lattice_string& a, const bit_lattice_string& b,
+                                              const unsigned int output_uid) const
 {
    return inf(a, b, TM->CGetTreeNode(output_uid));
 }
 
-std::deque<bit_lattice> BitLatticeManipulator::inf(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                                                   const tree_nodeConstRef& out_node) const
+bit_lattice_string BitLatticeManipulator::inf(const bit_lattice_string& a, const bit_lattice_string& b,
+                                              const tree_nodeConstRef& out_node) const
 {
    THROW_ASSERT(!(a.empty() && b.empty()), "a.size() = " + STR(a.size()) + " b.size() = " + STR(b.size()));
 
@@ -142,8 +142,8 @@ std::deque<bit_lattice> BitLatticeManipulator::inf(const std::deque<bit_lattice>
    return ::inf(a, b, out_type_size, out_is_signed, out_is_bool);
 }
 
-std::deque<bit_lattice> BitLatticeManipulator::constructor_bitstring(const tree_nodeRef& ctor_tn,
-                                                                     unsigned int ssa_node_id) const
+bit_lattice_string BitLatticeManipulator::constructor_bitstring(const tree_nodeRef& ctor_tn,
+                                                                unsigned int ssa_node_id) const
 {
    const bool ssa_is_signed = tree_helper::is_int(TM, ssa_node_id);
    THROW_ASSERT(ctor_tn->get_kind() == constructor_K, "ctor_tn is not constructor node");
@@ -152,9 +152,9 @@ std::deque<bit_lattice> BitLatticeManipulator::constructor_bitstring(const tree_
    unsigned long long elements_bitsize;
    tree_helper::get_array_dim_and_bitsize(TM, GET_INDEX_CONST_NODE(c->type), array_dims, elements_bitsize);
    unsigned int initialized_elements = 0;
-   std::deque<bit_lattice> current_inf;
+   bit_lattice_string current_inf;
    current_inf.push_back(bit_lattice::X);
-   std::deque<bit_lattice> cur_bitstring;
+   bit_lattice_string cur_bitstring;
    for(const auto& i : c->list_of_idx_valu)
    {
       const auto el = GET_CONST_NODE(i.second);
@@ -202,8 +202,8 @@ std::deque<bit_lattice> BitLatticeManipulator::constructor_bitstring(const tree_
    return current_inf;
 }
 
-std::deque<bit_lattice> BitLatticeManipulator::string_cst_bitstring(const tree_nodeRef& strcst_tn,
-                                                                    unsigned int ssa_node_id) const
+bit_lattice_string BitLatticeManipulator::string_cst_bitstring(const tree_nodeRef& strcst_tn,
+                                                               unsigned int ssa_node_id) const
 {
    THROW_ASSERT(strcst_tn->get_kind() == string_cst_K, "strcst_tn is not a string_cst node");
    auto* sc = GetPointerS<string_cst>(strcst_tn);
@@ -257,7 +257,7 @@ bool BitLatticeManipulator::mix()
    return updated;
 }
 
-bool BitLatticeManipulator::update_current(std::deque<bit_lattice>& res, const tree_nodeConstRef& tn)
+bool BitLatticeManipulator::update_current(bit_lattice_string& res, const tree_nodeConstRef& tn)
 {
    if(!res.empty())
    {
@@ -265,7 +265,7 @@ bool BitLatticeManipulator::update_current(std::deque<bit_lattice>& res, const t
       sign_reduce_bitstring(res, out_is_signed);
       if(out_is_signed && res.front() == bit_lattice::X)
       {
-         res.front() = bit_lattice::ZERO;
+         res.set(0, bit_lattice::ZERO);
       }
 
       THROW_ASSERT(best.count(tn->index), "");
@@ -61,14 +61,14 @@ class BitLatticeManipulator
     * Map storing the current bit-values of the variables at the end of each iteration of forward_transfer or
     * backward_transfer.
     */
-   CustomMap<unsigned int, std::deque<bit_lattice>> current;
+   CustomMap<unsigned int, bit_lattice_string> current;
 
    /**
     * @brief Map of the best bit-values of each variable.
     * Map storing the best bit-values of the variables at the end of all the iterations of forward_transfer or
     * backward_transfer.
     */
-   CustomMap<unsigned int, std::deque<bit_lattice>> best;
+   CustomMap<unsigned int, bit_lattice_string> best;
 
    /**
     * @brief Set storing the signed ssa
@@ -88,11 +88,11 @@ class BitLatticeManipulator
     * @param output_uid is the id of the tree node for which the bitvalue is * computed
     * @return the sup of the two bitstrings.
     */
-   std::deque<bit_lattice> sup(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                               const unsigned int output_uid) const;
+   bit_lattice_string sup(const bit_lattice_string& a, const bit_lattice_string& b,
+                          const unsigned int output_uid) const;
 
-   std::deque<bit_lattice> sup(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                               const tree_nodeConstRef& out_node) const;
+   bit_lattice_string sup(const bit_lattice_string& a, const bit_lattice_string& b,
+                          const tree_nodeConstRef& out_node) const;
 
    /**
     * Computes the inf between two bitstrings
@@ -101,25 +101,25 @@ class BitLatticeManipulator
     * @param output_uid is the id of the tree node for which the bitvalue is * computed
     * @return inf between the two bitstrings
     */
-   std::deque<bit_lattice> inf(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                               const unsigned int output_uid) const;
+   bit_lattice_string inf(const bit_lattice_string& a, const bit_lattice_string& b,
+                          const unsigned int output_uid) const;
 
-   std::deque<bit_lattice> inf(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                               const tree_nodeConstRef& out_node) const;
+   bit_lattice_string inf(const bit_lattice_string& a, const bit_lattice_string& b,
+                          const tree_nodeConstRef& out_node) const;
 
    /**
     * auxiliary function used to build the bitstring lattice for read-only arrays
     * @param ctor_tn is the tree reindex or a tree node of the contructor
     * @param ssa_node_id is the ssa node id of the lattice destination
     */
-   std::deque<bit_lattice> constructor_bitstring(const tree_nodeRef& ctor_tn, unsigned int ssa_node_id) const;
+   bit_lattice_string constructor_bitstring(const tree_nodeRef& ctor_tn, unsigned int ssa_node_id) const;
 
    /**
     * auxiliary function used to build the bitstring lattice for read-only string_cst
     * @param strcst_tn is a tree reindex or a tree node of the string_cst
     * @param ssa_node_id is the ssa node id of the lattice destination
     */
-   std::deque<bit_lattice> string_cst_bitstring(const tree_nodeRef& strcst_tn, unsigned int ssa_node_id) const;
+   bit_lattice_string string_cst_bitstring(const tree_nodeRef& strcst_tn, unsigned int ssa_node_id) const;
 
    /**
     * Returns true if the type identified by type_id is handled by bitvalue
@@ -139,7 +139,7 @@ class BitLatticeManipulator
     * functions checks if it is necessary to update the bistring stored in
     * the current map used by the bitvalue analysis algorithm.
     */
-   bool update_current(std::deque<bit_lattice>& res, const tree_nodeConstRef& tn);
+   bool update_current(bit_lattice_string& res, const tree_nodeConstRef& tn);
 
    /**
     * Clean up the internal data structures
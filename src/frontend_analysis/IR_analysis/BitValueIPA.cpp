@@ -134,7 +134,7 @@ void BitValueIPA::ComputeRelationships(DesignFlowStepSet& relationships,
       {
          const auto step_signature = FunctionFrontendFlowStep::ComputeSignature(FrontendFlowStepType::BIT_VALUE, i);
          const auto frontend_step = design_flow_manager.lock()->GetDesignFlowStep(step_signature);
-         THROW_ASSERT(frontend_step != NULL_VERTEX, "step " + step_signature + " is not present");
+         THROW_ASSERT(frontend_step != NULL_VERTEX, "step " + STR(step_signature) + " is not present");
          const auto design_flow_graph = design_flow_manager.lock()->CGetDesignFlowGraph();
          const auto design_flow_step = design_flow_graph->CGetDesignFlowStepInfo(frontend_step)->design_flow_step;
          relationships.insert(design_flow_step);
@@ -144,7 +144,7 @@ void BitValueIPA::ComputeRelationships(DesignFlowStepSet& relationships,
       {
          const auto step_signature = FunctionFrontendFlowStep::ComputeSignature(FrontendFlowStepType::BIT_VALUE, i);
          const auto frontend_step = design_flow_manager.lock()->GetDesignFlowStep(step_signature);
-         THROW_ASSERT(frontend_step != NULL_VERTEX, "step " + step_signature + " is not present");
+         THROW_ASSERT(frontend_step != NULL_VERTEX, "step " + STR(step_signature) + " is not present");
          const auto design_flow_graph = design_flow_manager.lock()->CGetDesignFlowGraph();
          const auto design_flow_step = design_flow_graph->CGetDesignFlowStepInfo(frontend_step)->design_flow_step;
          relationships.insert(design_flow_step);
@@ -483,7 +483,7 @@ DesignFlowStep_Status BitValueIPA::Exec()
                      for(const auto& i : call_edge_info->direct_call_points)
                      {
                         INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "-->examining direct call point " + STR(i));
-                        std::deque<bit_lattice> res_tmp;
+                        bit_lattice_string res_tmp;
                         THROW_ASSERT(i, "unexpected condition");
                         const auto call_node = TM->CGetTreeNode(i);
                         if(call_node->get_kind() == gimple_assign_K)
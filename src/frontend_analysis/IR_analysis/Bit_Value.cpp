@@ -86,7 +86,6 @@
 #include <string>
 
 /// STL includes
-#include <deque>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -105,717 +104,6 @@
 #include "compiler_wrapper.hpp"
 #include "string_manipulation.hpp" // for GET_CLASS
 
-const std::map<bit_lattice, std::map<bit_lattice, std::map<bit_lattice, std::deque<bit_lattice>>>>
-    Bit_Value::plus_expr_map = {
-        // a b carry
-        {
-            bit_lattice::X,
-            {
-                {
-                    bit_lattice::X,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ZERO,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ONE,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::U,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-            },
-        },
-        {
-            bit_lattice::ZERO,
-            {
-                {
-                    bit_lattice::X,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ZERO,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ONE,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::U,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-            },
-        },
-        {
-            bit_lattice::ONE,
-            {
-                {
-                    bit_lattice::X,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ZERO,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ONE,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::U,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-            },
-        },
-        {
-            bit_lattice::U,
-            {
-                {
-                    bit_lattice::X,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ZERO,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ONE,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::U,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-            },
-        },
-};
-
-const std::map<bit_lattice, std::map<bit_lattice, std::map<bit_lattice, std::deque<bit_lattice>>>>
-    Bit_Value::minus_expr_map = {
-        // a b borrow
-        {
-            bit_lattice::X,
-            {
-                {
-                    bit_lattice::X,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::X},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ZERO,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ONE,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::U,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-            },
-        },
-        {
-            bit_lattice::ZERO,
-            {
-                {
-                    bit_lattice::X,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ZERO,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ONE,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ONE, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::U,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-            },
-        },
-        {
-            bit_lattice::ONE,
-            {
-                {
-                    bit_lattice::X,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ZERO,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ONE,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::ZERO},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::ONE},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::U,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-            },
-        },
-        {
-            bit_lattice::U,
-            {
-                {
-                    bit_lattice::X,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ZERO,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::ZERO, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::ONE,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::ONE, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-                {
-                    bit_lattice::U,
-                    {
-                        {
-                            bit_lattice::ZERO,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::ONE,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                        {
-                            bit_lattice::U,
-                            {bit_lattice::U, bit_lattice::U},
-                        },
-                    },
-                },
-            },
-        },
-};
-
-const std::map<bit_lattice, std::map<bit_lattice, bit_lattice>> Bit_Value::bit_ior_expr_map = {
-    {
-        bit_lattice::ZERO,
-        {
-            {bit_lattice::ZERO, bit_lattice::ZERO},
-            {bit_lattice::ONE, bit_lattice::ONE},
-            {bit_lattice::U, bit_lattice::U},
-            {bit_lattice::X, bit_lattice::X},
-        },
-    },
-    {
-        bit_lattice::ONE,
-        {
-            {bit_lattice::ZERO, bit_lattice::ONE},
-            {bit_lattice::ONE, bit_lattice::ONE},
-            {bit_lattice::U, bit_lattice::ONE},
-            {bit_lattice::X, bit_lattice::ONE},
-        },
-    },
-    {
-        bit_lattice::U,
-        {
-            {bit_lattice::ZERO, bit_lattice::U},
-            {bit_lattice::ONE, bit_lattice::ONE},
-            {bit_lattice::U, bit_lattice::U},
-            {bit_lattice::X, bit_lattice::X},
-        },
-    },
-    {
-        bit_lattice::X,
-        {
-            {bit_lattice::ZERO, bit_lattice::X},
-            {bit_lattice::ONE, bit_lattice::ONE},
-            {bit_lattice::U, bit_lattice::X},
-            {bit_lattice::X, bit_lattice::X},
-        },
-    },
-};
-
-const std::map<bit_lattice, std::map<bit_lattice, bit_lattice>> Bit_Value::bit_xor_expr_map = {
-    {
-        bit_lattice::ZERO,
-        {
-            {bit_lattice::ZERO, bit_lattice::ZERO},
-            {bit_lattice::ONE, bit_lattice::ONE},
-            {bit_lattice::U, bit_lattice::U},
-            {bit_lattice::X, bit_lattice::X},
-        },
-    },
-    {
-        bit_lattice::ONE,
-        {
-            {bit_lattice::ZERO, bit_lattice::ONE},
-            {bit_lattice::ONE, bit_lattice::ZERO},
-            {bit_lattice::U, bit_lattice::U},
-            {bit_lattice::X, bit_lattice::X},
-        },
-    },
-    {
-        bit_lattice::U,
-        {
-            {bit_lattice::ZERO, bit_lattice::U},
-            {bit_lattice::ONE, bit_lattice::U},
-            {bit_lattice::U, bit_lattice::U},
-            {bit_lattice::X, bit_lattice::X},
-        },
-    },
-    {
-        bit_lattice::X,
-        {
-            {bit_lattice::ZERO, bit_lattice::X},
-            {bit_lattice::ONE, bit_lattice::X},
-            {bit_lattice::U, bit_lattice::X},
-            {bit_lattice::X, bit_lattice::X},
-        },
-    },
-};
-
-const std::map<bit_lattice, std::map<bit_lattice, bit_lattice>> Bit_Value::bit_and_expr_map = {
-    {
-        bit_lattice::ZERO,
-        {
-            {bit_lattice::ZERO, bit_lattice::ZERO},
-            {bit_lattice::ONE, bit_lattice::ZERO},
-            {bit_lattice::U, bit_lattice::ZERO},
-            {bit_lattice::X, bit_lattice::ZERO},
-        },
-    },
-    {
-        bit_lattice::ONE,
-        {
-            {bit_lattice::ZERO, bit_lattice::ZERO},
-            {bit_lattice::ONE, bit_lattice::ONE},
-            {bit_lattice::U, bit_lattice::U},
-            {bit_lattice::X, bit_lattice::X},
-        },
-    },
-    {
-        bit_lattice::U,
-        {
-            {bit_lattice::ZERO, bit_lattice::ZERO},
-            {bit_lattice::ONE, bit_lattice::U},
-            {bit_lattice::U, bit_lattice::U},
-            {bit_lattice::X, bit_lattice::X},
-        },
-    },
-    {
-        bit_lattice::X,
-        {
-            {bit_lattice::ZERO, bit_lattice::ZERO},
-            {bit_lattice::ONE, bit_lattice::X},
-            {bit_lattice::U, bit_lattice::X},
-            {bit_lattice::X, bit_lattice::X},
-        },
-    },
-};
-
 unsigned long long Bit_Value::pointer_resizing(unsigned int output_id) const
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
@@ -1092,7 +380,7 @@ DesignFlowStep_Status Bit_Value::InternalExec()
 }
 
 // prints the content of a bitstring map
-void Bit_Value::print_bitstring_map(const CustomMap<unsigned int, std::deque<bit_lattice>>&
+void Bit_Value::print_bitstring_map(const CustomMap<unsigned int, bit_lattice_string>&
 #ifndef NDEBUG
                                         map
 #endif
@@ -1278,7 +566,7 @@ void Bit_Value::initialize()
        * initialization. If this happens, optimizations on ROMs cannot be
        * aggressive enough, with worse cycles and DSP usage for CHStone benchmarks
        */
-      CustomMap<unsigned int, std::deque<bit_lattice>> private_variables;
+      CustomMap<unsigned int, bit_lattice_string> private_variables;
       INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "Initializing ROMs loaded ssa bitvalues");
       for(const auto& B : bb_topological)
       {
@@ -1332,7 +620,7 @@ void Bit_Value::initialize()
                            function_behavior->is_variable_mem(base_index) && hm->Rmem->is_sds_var(base_index) && vd &&
                            vd->init)
                         {
-                           std::deque<bit_lattice> current_inf;
+                           bit_lattice_string current_inf;
                            if(GET_CONST_NODE(vd->init)->get_kind() == constructor_K)
                            {
                               current_inf = constructor_bitstring(GET_CONST_NODE(vd->init), lhs_nid);
@@ -1374,7 +662,7 @@ void Bit_Value::initialize()
                            {
                               if(!private_variables.count(base_index))
                               {
-                                 std::deque<bit_lattice> current_inf;
+                                 bit_lattice_string current_inf;
                                  if(vd->init)
                                  {
                                     if(GET_CONST_NODE(vd->init)->get_kind() == constructor_K)
@@ -1415,7 +703,7 @@ void Bit_Value::initialize()
                                     INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level,
                                                    "---source node: " + STR(cur_node) + " source is signed: " +
                                                        STR(source_is_signed) + " loaded is signed: " + STR(lhs_signed));
-                                    std::deque<bit_lattice> cur_bitstring;
+                                    bit_lattice_string cur_bitstring;
                                     if(cur_node->get_kind() == ssa_name_K)
                                     {
                                        const auto ssa = GetPointerS<const ssa_name>(cur_node);
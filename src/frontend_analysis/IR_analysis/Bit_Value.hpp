@@ -78,33 +78,6 @@ REF_FORWARD_DECL(tree_manager);
 class Bit_Value : public FunctionFrontendFlowStep, public BitLatticeManipulator
 {
  private:
-   /**
-    * @brief Map storing the implementation of the forward_transfer's plus_expr.
-    */
-   static const std::map<bit_lattice, std::map<bit_lattice, std::map<bit_lattice, std::deque<bit_lattice>>>>
-       plus_expr_map;
-
-   /**
-    * @brief Map storing the implementation of the forward_transfer's minus_expr.
-    */
-   static const std::map<bit_lattice, std::map<bit_lattice, std::map<bit_lattice, std::deque<bit_lattice>>>>
-       minus_expr_map;
-
-   /**
-    * @brief Map storing the implementation of the forward_transfer's bit_ior_expr_map.
-    */
-   static const std::map<bit_lattice, std::map<bit_lattice, bit_lattice>> bit_ior_expr_map;
-
-   /**
-    * Map storing the implementation of the forward_transfer's bit_xor_expr_map.
-    */
-   static const std::map<bit_lattice, std::map<bit_lattice, bit_lattice>> bit_xor_expr_map;
-
-   /**
-    * Map storing the implementation of the forward_transfer's bit_and_expr_map.
-    */
-   static const std::map<bit_lattice, std::map<bit_lattice, bit_lattice>> bit_and_expr_map;
-
    /// True if this step is not executed in the frontend
    bool not_frontend;
 
@@ -129,7 +102,7 @@ class Bit_Value : public FunctionFrontendFlowStep, public BitLatticeManipulator
     * Debugging function used to print the contents of the current and best maps.
     * @param map map to be printed
     */
-   void print_bitstring_map(const CustomMap<unsigned int, std::deque<bit_lattice>>& map) const;
+   void print_bitstring_map(const CustomMap<unsigned int, bit_lattice_string>& map) const;
 
    unsigned long long pointer_resizing(unsigned int output_id) const;
 
@@ -191,7 +164,7 @@ class Bit_Value : public FunctionFrontendFlowStep, public BitLatticeManipulator
     * @param ga assignment to analyze
     * @return output bitstring
     */
-   std::deque<bit_lattice> forward_transfer(const gimple_assign* ga) const;
+   bit_lattice_string forward_transfer(const gimple_assign* ga) const;
 
    /**
     * Compute the inputs back propagation values, given a gimple assignment and the uid of the output variable.
@@ -199,9 +172,9 @@ class Bit_Value : public FunctionFrontendFlowStep, public BitLatticeManipulator
     * @param output_id uid of the output of the given gimple assignment.
     * @return computed backpropagation bitstring
     */
-   std::deque<bit_lattice> backward_transfer(const gimple_assign* ga, unsigned int output_id) const;
+   bit_lattice_string backward_transfer(const gimple_assign* ga, unsigned int output_id) const;
 
-   std::deque<bit_lattice> backward_chain(const tree_nodeConstRef& ssa) const;
+   bit_lattice_string backward_chain(const tree_nodeConstRef& ssa) const;
 
    /**
     * Updates the bitvalues of the intermediate representation with the values taken from the input map.
@@ -211,16 +184,16 @@ class Bit_Value : public FunctionFrontendFlowStep, public BitLatticeManipulator
    /**
     * Given an operand, returns its current bitvalue
     * @param tn Operand node
-    * @return std::deque<bit_lattice> Current bitvalue for given operand
+    * @return bit_lattice_string Current bitvalue for given operand
     */
-   std::deque<bit_lattice> get_current(const tree_nodeConstRef& tn) const;
+   bit_lattice_string get_current(const tree_nodeConstRef& tn) const;
 
    /**
     * Given an operand, returns its current bitvalue, or its best if current is not available
     * @param tn Operand node
-    * @return std::deque<bit_lattice> Current or best bitvalue for given operand
+    * @return bit_lattice_string Current or best bitvalue for given operand
     */
-   std::deque<bit_lattice> get_current_or_best(const tree_nodeConstRef& tn) const;
+   bit_lattice_string get_current_or_best(const tree_nodeConstRef& tn) const;
 
    const CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>>
    ComputeFrontendRelationships(const DesignFlowStep::RelationshipType relationship_type) const override;
@@ -58,8 +58,9 @@
 #include "math_function.hpp"  // for ceil_log2
 #include "string_manipulation.hpp"
 #include <boost/range/adaptors.hpp>
+#include <deque>
 
-std::deque<bit_lattice> Bit_Value::get_current_or_best(const tree_nodeConstRef& tn) const
+bit_lattice_string Bit_Value::get_current_or_best(const tree_nodeConstRef& tn) const
 {
    const auto nid = GET_INDEX_CONST_NODE(tn);
    const auto node = GET_CONST_NODE(tn);
@@ -71,17 +72,17 @@ std::deque<bit_lattice> Bit_Value::get_current_or_best(const tree_nodeConstRef&
    return best.at(nid);
 }
 
-std::deque<bit_lattice> Bit_Value::backward_chain(const tree_nodeConstRef& ssa_node) const
+bit_lattice_string Bit_Value::backward_chain(const tree_nodeConstRef& ssa_node) const
 {
    const auto ssa = GetPointerS<const ssa_name>(GET_CONST_NODE(ssa_node));
    const auto ssa_nid = ssa->index;
-   std::deque<bit_lattice> res = create_x_bitstring(1);
+   bit_lattice_string res = create_x_bitstring(1);
    for(const auto& stmt_use : ssa->CGetUseStmts())
    {
       const auto user_stmt = GET_CONST_NODE(stmt_use.first);
       const auto user_kind = user_stmt->get_kind();
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Analyzing use - " + STR(user_stmt));
-      std::deque<bit_lattice> user_res;
+      bit_lattice_string user_res;
       if(user_kind == gimple_assign_K)
       {
          const auto ga = GetPointerS<const gimple_assign>(user_stmt);
@@ -144,7 +145,7 @@ std::deque<bit_lattice> Bit_Value::backward_chain(const tree_nodeConstRef& ssa_n
                   const auto p_decl_id = AppM->getSSAFromParm(called_id, GET_INDEX_CONST_NODE(*f_it));
                   const auto parmssa = TM->CGetTreeNode(p_decl_id);
                   const auto pd = GetPointerS<const ssa_name>(parmssa);
-                  std::deque<bit_lattice> tmp;
+                  bit_lattice_string tmp;
                   if(pd->bit_values.empty())
                   {
                      tmp = create_u_bitstring(tree_helper::TypeSize(parmssa));
@@ -326,9 +327,9 @@ void Bit_Value::backward()
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Performed backward transfer");
 }
 
-std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, unsigned int res_nid) const
+bit_lattice_string Bit_Value::backward_transfer(const gimple_assign* ga, unsigned int res_nid) const
 {
-   std::deque<bit_lattice> res;
+   bit_lattice_string res;
    if(GetPointer<const cst_node>(TM->CGetTreeNode(res_nid)))
    {
       return res;
@@ -630,7 +631,7 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                   {
                      res.pop_front();
                   }
-                  res.front() = bit_inf(sign_bit, res.front());
+                  res.set(0, bit_inf(sign_bit, res.front()));
                }
                else
                {
@@ -788,11 +789,11 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                {
                   if(op_signed_p && (res.size() == index + log2 + 1))
                   {
-                     res[index] = bit_lattice::ZERO;
+                     res.set(index, bit_lattice::ZERO);
                   }
                   else
                   {
-                     res[index] = bit_lattice::X;
+                     res.set(index, bit_lattice::X);
                   }
                }
             }
@@ -814,11 +815,11 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                   {
                      if(op_signed_p && (res.size() == index + log2 + 1))
                      {
-                        res[index] = bit_lattice::ZERO;
+                        res.set(index, bit_lattice::ZERO);
                      }
                      else
                      {
-                        res[index] = bit_lattice::X;
+                        res.set(index, bit_lattice::X);
                      }
                   }
                }
@@ -895,11 +896,11 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                   {
                      if(op_signed_p && (res.size() == index + log2 + 1))
                      {
-                        res[index] = bit_lattice::ZERO;
+                        res.set(index, bit_lattice::ZERO);
                      }
                      else
                      {
-                        res[index] = bit_lattice::X;
+                        res.set(index, bit_lattice::X);
                      }
                   }
                }
@@ -933,7 +934,7 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                    static_cast<decltype(lhs_bitstring)::difference_type>(lhs_bitstring.size() + shift_value - lhs_size);
                if(std::find(lhs_bitstring.begin(), lhs_sign_extend_end, bit_lattice::U) != lhs_sign_extend_end)
                {
-                  res.front() = bit_lattice::U;
+                  res.set(0, bit_lattice::U);
                }
             }
          }
@@ -1224,7 +1225,7 @@ std::deque<bit_lattice> Bit_Value::backward_transfer(const gimple_assign* ga, un
                   const auto p_decl_id = AppM->getSSAFromParm(called_id, GET_INDEX_CONST_NODE(*f_it));
                   const auto parmssa = TM->CGetTreeNode(p_decl_id);
                   const auto pd = GetPointerS<const ssa_name>(parmssa);
-                  std::deque<bit_lattice> tmp;
+                  bit_lattice_string tmp;
                   if(pd->bit_values.empty())
                   {
                      tmp = create_u_bitstring(tree_helper::TypeSize(parmssa));
@@ -58,9 +58,10 @@
 #include "dbgPrintHelper.hpp" // for DEBUG_LEVEL_
 #include "string_manipulation.hpp"
 #include <boost/range/adaptors.hpp>
+#include <deque>
 #include <unordered_set>
 
-std::deque<bit_lattice> Bit_Value::get_current(const tree_nodeConstRef& tn) const
+bit_lattice_string Bit_Value::get_current(const tree_nodeConstRef& tn) const
 {
    const auto nid = GET_INDEX_CONST_NODE(tn);
    const auto node = GET_CONST_NODE(tn);
@@ -75,7 +76,7 @@ std::deque<bit_lattice> Bit_Value::get_current(const tree_nodeConstRef& tn) cons
       return best.at(nid);
    }
    THROW_UNREACHABLE("Unexpected node kind: " + node->get_kind_text());
-   return std::deque<bit_lattice>();
+   return bit_lattice_string();
 }
 
 void Bit_Value::forward()
@@ -362,9 +363,9 @@ void Bit_Value::forward()
    }
 }
 
-std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) const
+bit_lattice_string Bit_Value::forward_transfer(const gimple_assign* ga) const
 {
-   std::deque<bit_lattice> res;
+   bit_lattice_string res;
    const auto& lhs = ga->op0;
    const auto& rhs = ga->op1;
    const auto lhs_signed = IsSignedIntegerType(lhs);
@@ -452,7 +453,7 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                case bit_lattice::X:
                case bit_lattice::U:
                {
-                  std::deque<bit_lattice> negated_bitstring;
+                  bit_lattice_string negated_bitstring;
                   bit_lattice borrow = bit_lattice::ZERO;
                   for(const auto& bit : boost::adaptors::reverse(op_bitstring))
                   {
@@ -626,14 +627,7 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                op1_bitstring = sign_extend_bitstring(op1_bitstring, op1_signed, lhs_size);
             }
 
-            auto op0_it = op0_bitstring.rbegin();
-            auto op1_it = op1_bitstring.rbegin();
-            for(auto bit_index = 0u;
-                bit_index < lhs_size && op0_it != op0_bitstring.rend() && op1_it != op1_bitstring.rend();
-                ++op0_it, ++op1_it, ++bit_index)
-            {
-               res.push_front(bit_and_expr_map.at(*op0_it).at(*op1_it));
-            }
+            res = bitstring_and(op0_bitstring, op1_bitstring, lhs_size);
          }
          else if(rhs_kind == bit_ior_expr_K)
          {
@@ -656,14 +650,7 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                op0_bitstring = sign_extend_bitstring(op0_bitstring, op0_signed, lhs_size);
             }
 
-            auto op0_it = op0_bitstring.rbegin();
-            auto op1_it = op1_bitstring.rbegin();
-            for(auto bit_index = 0u;
-                bit_index < lhs_size && op0_it != op0_bitstring.rend() && op1_it != op1_bitstring.rend();
-                ++op0_it, ++op1_it, ++bit_index)
-            {
-               res.push_front(bit_ior_expr_map.at(*op0_it).at(*op1_it));
-            }
+            res = bitstring_ior(op0_bitstring, op1_bitstring, lhs_size);
          }
          else if(rhs_kind == bit_xor_expr_K)
          {
@@ -687,14 +674,7 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                op0_bitstring = sign_extend_bitstring(op0_bitstring, op0_signed, lhs_size);
             }
 
-            auto op0_it = op0_bitstring.rbegin();
-            auto op1_it = op1_bitstring.rbegin();
-            for(auto bit_index = 0u;
-                bit_index < lhs_size && op0_it != op0_bitstring.rend() && op1_it != op1_bitstring.rend();
-                ++op0_it, ++op1_it, ++bit_index)
-            {
-               res.push_front(bit_xor_expr_map.at(*op0_it).at(*op1_it));
-            }
+            res = bitstring_xor(op0_bitstring, op1_bitstring, lhs_size);
          }
          else if(rhs_kind == eq_expr_K)
          {
@@ -955,11 +935,11 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                   op0_bitstring = sign_extend_bitstring(op0_bitstring, op0_signed, lhs_size);
                }
                res = op0_bitstring;
-               for(integer_cst_t index = 0; index < arg2_value; ++index)
+               const auto rotation = static_cast<std::ptrdiff_t>(arg2_value % static_cast<integer_cst_t>(res.size()));
+               if(arg2_value > 0 && rotation)
                {
-                  bit_lattice cur_bit = res.front();
-                  res.pop_front();
-                  res.push_back(cur_bit);
+                  res.insert(res.end(), op0_bitstring.begin(), op0_bitstring.begin() + rotation);
+                  res.erase(res.begin(), res.begin() + rotation);
                }
             }
             else
@@ -998,18 +978,15 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                else
                {
                   res = op0_bitstring;
-                  while(res.size() > op0_bitsize)
+                  if(res.size() > op0_bitsize)
                   {
-                     res.pop_front();
-                  }
-                  for(integer_cst_t i = 0; i < cst_val; i++)
-                  {
-                     res.push_back(bit_lattice::ZERO);
-                     if(res.size() > lhs_size)
-                     {
-                        res.pop_front();
-                     }
+                     res.erase(res.begin(), res.end() - static_cast<std::ptrdiff_t>(op0_bitsize));
                   }
+                  /// shifted out bits are dropped as long as the result is longer than lhs_size
+                  const auto final_size =
+                      std::max(res.size(), std::min<size_t>(lhs_size, res.size() + static_cast<size_t>(cst_val)));
+                  res.insert(res.end(), static_cast<size_t>(cst_val), bit_lattice::ZERO);
+                  res.erase(res.begin(), res.end() - static_cast<std::ptrdiff_t>(final_size));
                }
             }
             else
@@ -1106,16 +1083,8 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                op0_bitstring = sign_extend_bitstring(op0_bitstring, op0_signed, arg_size_max);
             }
 
-            auto op0_it = op0_bitstring.rbegin();
-            auto op1_it = op1_bitstring.rbegin();
             auto borrow = bit_lattice::ZERO;
-            for(auto bit_index = 0u;
-                bit_index < lhs_size && op0_it != op0_bitstring.rend() && op1_it != op1_bitstring.rend();
-                ++op0_it, ++op1_it, ++bit_index)
-            {
-               res.push_front(minus_expr_map.at(*op0_it).at(*op1_it).at(borrow).back());
-               borrow = minus_expr_map.at(*op0_it).at(*op1_it).at(borrow).front();
-            }
+            res = bitstring_minus(op0_bitstring, op1_bitstring, borrow, lhs_size);
             if(lhs_signed && res.size() < lhs_size)
             {
                res.push_front(minus_expr_map.at(op0_bitstring.front()).at(op1_bitstring.front()).at(borrow).back());
@@ -1212,7 +1181,7 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
             auto op1_it = op1_bitstring.crbegin();
             for(auto pos = 0u; op1_it != op1_bitstring.crend() && pos < res_bitsize; ++op1_it, ++pos)
             {
-               std::deque<bit_lattice> temp_op1;
+               bit_lattice_string temp_op1;
                while(temp_op1.size() < pos)
                {
                   temp_op1.push_front(bit_lattice::ZERO);
@@ -1223,7 +1192,7 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                   temp_op1.push_front(bit_and_expr_map.at(*op0_it).at(*op1_it));
                }
                bit_lattice carry1 = bit_lattice::ZERO;
-               std::deque<bit_lattice> temp_res;
+               bit_lattice_string temp_res;
                auto temp_op1_it = temp_op1.crbegin();
                const auto temp_op1_end = temp_op1.crend();
                auto res_it = res.crbegin();
@@ -1288,18 +1257,8 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                op0_bitstring = sign_extend_bitstring(op0_bitstring, op0_signed, op1_bitstring.size());
             }
 
-            auto op0_it = op0_bitstring.rbegin();
-            auto op1_it = op1_bitstring.rbegin();
             auto carry1 = bit_lattice::ZERO;
-            for(auto bit_index = 0u;
-                bit_index < lhs_size && op0_it != op0_bitstring.rend() && op1_it != op1_bitstring.rend();
-                ++op0_it, ++op1_it, ++bit_index)
-            {
-               // INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "op0: "+STR(*op0_it) + "op1: "STR(*op1_it) + "carry:
-               // " + STR(carry1));
-               res.push_front(plus_expr_map.at(*op0_it).at(*op1_it).at(carry1).back());
-               carry1 = plus_expr_map.at(*op0_it).at(*op1_it).at(carry1).front();
-            }
+            res = bitstring_plus(op0_bitstring, op1_bitstring, carry1, lhs_size);
 
             if(lhs_signed && res.size() < lhs_size)
             {
@@ -1329,11 +1288,11 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                   op0_bitstring = sign_extend_bitstring(op0_bitstring, op0_signed, lhs_size);
                }
                res = op0_bitstring;
-               for(integer_cst_t index = 0; index < op1_value; ++index)
+               const auto rotation = static_cast<std::ptrdiff_t>(op1_value % static_cast<integer_cst_t>(res.size()));
+               if(op1_value > 0 && rotation)
                {
-                  const auto cur_bit = res.back();
-                  res.pop_back();
-                  res.push_front(cur_bit);
+                  res.insert(res.begin(), op0_bitstring.end() - rotation, op0_bitstring.end());
+                  res.erase(res.end() - rotation, res.end());
                }
             }
             else
@@ -1372,12 +1331,8 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
                else
                {
                   const auto new_lenght = op0_bitstring.size() - static_cast<size_t>(cst_val);
-                  auto op0_it = op0_bitstring.begin();
-                  while(res.size() < new_lenght)
-                  {
-                     res.push_back(*op0_it);
-                     ++op0_it;
-                  }
+                  res.insert(res.end(), op0_bitstring.begin(),
+                             op0_bitstring.begin() + static_cast<std::ptrdiff_t>(new_lenght));
                }
             }
             else
@@ -1654,7 +1609,7 @@ std::deque<bit_lattice> Bit_Value::forward_transfer(const gimple_assign* ga) con
             const auto op0_end = op0_bitstring.crend();
             const auto op1_end = op1_bitstring.crend();
             auto carry1 = bit_lattice::ZERO;
-            std::deque<bit_lattice> res_int;
+            bit_lattice_string res_int;
             for(auto bit_index = 0u; bit_index < lhs_size && op0_it != op0_end && op1_it != op1_end;
                 op0_it++, op1_it++, bit_index++)
             {
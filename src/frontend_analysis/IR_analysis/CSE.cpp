@@ -174,6 +174,11 @@ void CSE::Initialize()
 #endif
 }
 
+unsigned int CSE::GetLocalFunction() const
+{
+   return function_id;
+}
+
 DesignFlowStep_Status CSE::InternalExec()
 {
    if(parameters->IsParameter("disable-cse") && parameters->GetParameter<unsigned int>("disable-cse") == 1)
@@ -186,8 +191,8 @@ DesignFlowStep_Status CSE::InternalExec()
    size_t n_equiv_stmt = 0;
 #endif
    const auto IRman = tree_manipulationRef(new tree_manipulation(TM, parameters, AppM));
-   /// define a map relating variables and columns
-   std::map<vertex, CustomUnorderedMapStable<CSE_tuple_key_type, tree_nodeRef>> unique_table;
+   /// the statements available in the basic block under analysis
+   unique_table_type unique_table;
 
    const auto temp = TM->CGetTreeNode(function_id);
    const auto fd = GetPointerS<const function_decl>(temp);
@@ -248,24 +253,83 @@ DesignFlowStep_Status CSE::InternalExec()
    std::deque<vertex> sort_list;
    boost::topological_sort(*bb_domGraph, std::front_inserter(sort_list));
 
+   /// immediate dominator of each basic block; the entry is dominated by itself
+   const auto get_dominator = [&](vertex bb) -> vertex {
+      const auto dominator = bb_dominator_map.find(bb);
+      return dominator != bb_dominator_map.end() && dominator->second != bb ? dominator->second :
+                                                                              boost::graph_traits<BBGraph>::null_vertex();
+   };
+
+   /// number the dominator tree in depth first order, so that dominance can be checked in constant time
+   CustomUnorderedMap<vertex, std::vector<vertex>> dominated;
+   std::vector<vertex> roots;
+   for(const auto& bb : sort_list)
+   {
+      const auto dominator = get_dominator(bb);
+      if(dominator != boost::graph_traits<BBGraph>::null_vertex())
+      {
+         dominated[dominator].push_back(bb);
+      }
+      else
+      {
+         roots.push_back(bb);
+      }
+   }
+   CustomUnorderedMap<vertex, std::pair<size_t, size_t>> dominance_interval;
+   size_t dfs_counter = 0;
+   for(const auto& root : roots)
+   {
+      std::vector<std::pair<vertex, size_t>> dfs_stack(1, std::make_pair(root, 0));
+      dominance_interval[root].first = dfs_counter++;
+      while(!dfs_stack.empty())
+      {
+         const auto current = dfs_stack.back().first;
+         const auto& children = dominated[current];
+         if(dfs_stack.back().second < children.size())
+         {
+            const auto child = children[dfs_stack.back().second++];
+            dominance_interval[child].first = dfs_counter++;
+            dfs_stack.push_back(std::make_pair(child, 0));
+         }
+         else
+         {
+            dominance_interval[current].second = dfs_counter++;
+            dfs_stack.pop_back();
+         }
+      }
+   }
+   const auto dominates = [&](vertex dominator, vertex bb) -> bool {
+      const auto& dominator_interval = dominance_interval.at(dominator);
+      const auto& bb_interval = dominance_interval.at(bb);
+      return dominator_interval.first <= bb_interval.first && bb_interval.second <= dominator_interval.second;
+   };
+
    for(const auto& bb : sort_list)
    {
       const auto B = bb_domGraph->CGetBBNodeInfo(bb)->block;
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Considering BB " + STR(B->number));
-      /// CSE on basic blocks
-      unique_table[bb].clear();
-      if(bb_dominator_map.find(bb) != bb_dominator_map.end())
+      /// CSE on basic blocks: the unique table is moved to the dominator path of bb, by leaving the basic blocks
+      /// which do not dominate it and by entering again its dominators left before
+      while(!unique_table.CGetPath().empty() && !dominates(unique_table.CGetPath().back(), bb))
+      {
+         unique_table.Leave();
+      }
+      std::vector<vertex> dominators_to_enter;
+      auto dominator = get_dominator(bb);
+      while(dominator != boost::graph_traits<BBGraph>::null_vertex() &&
+            (unique_table.CGetPath().empty() || unique_table.CGetPath().back() != dominator))
+      {
+         dominators_to_enter.push_back(dominator);
+         dominator = get_dominator(dominator);
+      }
+      for(auto dominator_it = dominators_to_enter.rbegin(); dominator_it != dominators_to_enter.rend();
+          ++dominator_it)
       {
-         THROW_ASSERT(unique_table.find(bb_dominator_map.at(bb)) != unique_table.end(), "unexpected condition");
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                        "---Adding dominator equiv: " +
-                            STR(bb_domGraph->CGetBBNodeInfo(bb_dominator_map.at(bb))->block->number));
-
-         for(const auto& key_value_pair : unique_table.at(bb_dominator_map.at(bb)))
-         {
-            unique_table.at(bb)[key_value_pair.first] = key_value_pair.second;
-         }
+                        "---Adding dominator equiv: " + STR(bb_domGraph->CGetBBNodeInfo(*dominator_it)->block->number));
+         unique_table.Enter(*dominator_it);
       }
+      unique_table.Enter(bb);
       TreeNodeSet to_be_removed;
       for(const auto& stmt : B->CGetStmtList())
       {
@@ -274,7 +338,7 @@ DesignFlowStep_Status CSE::InternalExec()
          {
             break;
          }
-         const auto eq_tn = hash_check(GET_NODE(stmt), bb, sl, unique_table);
+         const auto eq_tn = hash_check(GET_NODE(stmt), sl, unique_table);
          if(eq_tn)
          {
             const auto ref_ga = GetPointerS<gimple_assign>(eq_tn);
@@ -477,9 +541,44 @@ bool CSE::has_memory_access(const gimple_assign* ga) const
    return skip_check;
 }
 
-tree_nodeRef
-CSE::hash_check(const tree_nodeRef& tn, vertex bb_vertex, const statement_list* sl,
-                std::map<vertex, CustomUnorderedMapStable<CSE_tuple_key_type, tree_nodeRef>>& unique_table) const
+CSE::CSE_hashed_key::CSE_hashed_key(CSE_tuple_key_type&& _key)
+    : key(std::move(_key)), hash(CustomUnorderedMap<CSE_tuple_key_type, tree_nodeRef>::hasher()(key))
+{
+}
+
+void CSE::unique_table_type::Enter(vertex bb)
+{
+   path.push_back(bb);
+   for(const auto& key_value_pair : added[bb])
+   {
+      table.insert(key_value_pair);
+   }
+}
+
+void CSE::unique_table_type::Leave()
+{
+   THROW_ASSERT(!path.empty(), "unexpected condition");
+   for(const auto& key_value_pair : added.at(path.back()))
+   {
+      table.erase(key_value_pair.first);
+   }
+   path.pop_back();
+}
+
+tree_nodeRef CSE::unique_table_type::FindOrInsert(CSE_hashed_key&& key, const tree_nodeRef& tn)
+{
+   THROW_ASSERT(!path.empty(), "unexpected condition");
+   const auto available = table.find(key);
+   if(available != table.end())
+   {
+      return available->second;
+   }
+   table.emplace(key, tn);
+   added[path.back()].emplace_back(std::move(key), tn);
+   return nullptr;
+}
+
+tree_nodeRef CSE::hash_check(const tree_nodeRef& tn, const statement_list* sl, unique_table_type& unique_table) const
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Checking: " + tn->ToString());
    if(GetPointer<const gimple_node>(tn)->keep)
@@ -663,21 +762,16 @@ CSE::hash_check(const tree_nodeRef& tn, vertex bb_vertex, const statement_list*
       signature_message.pop_back();
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, signature_message);
 #endif
-      CSE_tuple_key_type t(rhs_kind, ins);
-      if(unique_table.at(bb_vertex).find(t) != unique_table.at(bb_vertex).end())
+      const auto equivalent = unique_table.FindOrInsert(CSE_hashed_key(CSE_tuple_key_type(rhs_kind, std::move(ins))), tn);
+      if(equivalent)
       {
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "--- statement = " + tn->ToString());
-         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                        "--- equivalent with = " + unique_table.at(bb_vertex).at(t)->ToString());
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "--- equivalent with = " + equivalent->ToString());
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--");
          THROW_ASSERT(!ga->memdef, "Unexpected memdef " + ga->memdef->ToString() + " in " + tn->ToString());
          THROW_ASSERT(!ga->vdef, "Unexpected vdef " + ga->vdef->ToString() + " in " + tn->ToString());
          THROW_ASSERT(ga->vovers.empty(), "Unexpected vovers in " + tn->ToString());
-         return unique_table.at(bb_vertex).at(t);
-      }
-      else
-      {
-         unique_table.at(bb_vertex)[t] = tn;
+         return equivalent;
       }
    }
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Checked: null");
@@ -52,6 +52,9 @@
 #include "tree_common.hpp"
 
 #include "refcount.hpp"
+
+#include <utility>
+#include <vector>
 /**
  * @name forward declarations
  */
@@ -104,10 +107,76 @@ class CSE : public FunctionFrontendFlowStep
    /// define the type of the unique table key
    using CSE_tuple_key_type = std::pair<enum kind, std::vector<unsigned int>>;
 
+   /// a unique table key together with its hash value, so that it is hashed only once per statement
+   struct CSE_hashed_key
+   {
+      CSE_tuple_key_type key;
+      size_t hash;
+
+      explicit CSE_hashed_key(CSE_tuple_key_type&& _key);
+
+      bool operator==(const CSE_hashed_key& other) const
+      {
+         return hash == other.hash && key == other.key;
+      }
+   };
+
+   /// hash function of CSE_hashed_key returning the stored hash value
+   struct CSE_hashed_key_hash
+   {
+      size_t operator()(const CSE_hashed_key& hashed_key) const
+      {
+         return hashed_key.hash;
+      }
+   };
+
+   /**
+    * Unique table scoped along the dominator tree: it contains the statements computed in the basic blocks of the
+    * current dominator path, i.e., the ones available in the last entered basic block.
+    * Every basic block remembers the statements it added, so that it can be left and entered again.
+    */
+   class unique_table_type
+   {
+    private:
+      /// the statements available in the current dominator path
+      CustomUnorderedMap<CSE_hashed_key, tree_nodeRef, CSE_hashed_key_hash> table;
+
+      /// the statements added by each basic block
+      CustomUnorderedMap<vertex, std::vector<std::pair<CSE_hashed_key, tree_nodeRef>>> added;
+
+      /// the basic blocks of the current dominator path
+      std::vector<vertex> path;
+
+    public:
+      /**
+       * Enter a basic block dominated by the last entered one, restoring the statements it added if already visited
+       */
+      void Enter(vertex bb);
+
+      /**
+       * Leave the last entered basic block, removing the statements it added
+       */
+      void Leave();
+
+      /**
+       * Return the basic blocks of the current dominator path
+       */
+      const std::vector<vertex>& CGetPath() const
+      {
+         return path;
+      }
+
+      /**
+       * Look for an available statement computing key; if there is none, tn is added in the current basic block
+       * @param key is the key of tn
+       * @param tn is the statement
+       * @return the available equivalent statement, if any
+       */
+      tree_nodeRef FindOrInsert(CSE_hashed_key&& key, const tree_nodeRef& tn);
+   };
+
    /// check if the statement has an equivalent in the unique table
-   tree_nodeRef
-   hash_check(const tree_nodeRef& tn, vertex bb, const statement_list* sl,
-              std::map<vertex, CustomUnorderedMapStable<CSE_tuple_key_type, tree_nodeRef>>& unique_table) const;
+   tree_nodeRef hash_check(const tree_nodeRef& tn, const statement_list* sl, unique_table_type& unique_table) const;
 
    /// check if the gimple assignment is a load, store or a memcpy/memset
    bool has_memory_access(const gimple_assign* ga) const;
@@ -137,6 +206,12 @@ class CSE : public FunctionFrontendFlowStep
     * Initialize the step (i.e., like a constructor, but executed just before exec)
     */
    void Initialize() override;
+
+   /**
+    * Return the function transformed by this step, since only the body of that function is modified
+    * @return the index of the function
+    */
+   unsigned int GetLocalFunction() const override;
 };
 
 #endif /* CSE_HPP */
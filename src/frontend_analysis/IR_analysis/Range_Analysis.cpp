@@ -72,6 +72,7 @@
 #include "utility.hpp"
 #include "var_pp_functor.hpp"
 
+#include <deque>
 #include <filesystem>
 #include <map>
 #include <set>
@@ -1235,7 +1236,7 @@ int VarNode::updateIR(const tree_managerRef& TM,
    }
 
 #ifdef BITVALUE_UPDATE
-   auto updateBitValue = [&](ssa_name* ssa, const std::deque<bit_lattice>& bv) -> int {
+   auto updateBitValue = [&](ssa_name* ssa, const bit_lattice_string& bv) -> int {
       const auto curr_bv = string_to_bitstring(ssa->bit_values);
       if(isBetter(bitstring_to_string(bv), ssa->bit_values))
       {
@@ -6792,7 +6793,7 @@ void RangeAnalysis::ComputeRelationships(DesignFlowStepSet& relationships,
          {
             const auto bv_signature = FunctionFrontendFlowStep::ComputeSignature(BIT_VALUE, f_id);
             const auto frontend_bv = dfm->GetDesignFlowStep(bv_signature);
-            THROW_ASSERT(frontend_bv != NULL_VERTEX, "step " + bv_signature + " is not present");
+            THROW_ASSERT(frontend_bv != NULL_VERTEX, "step " + STR(bv_signature) + " is not present");
             const auto bv = design_flow_graph->CGetDesignFlowStepInfo(frontend_bv)->design_flow_step;
             relationships.insert(bv);
          }
@@ -127,7 +127,7 @@ void dead_code_eliminationIPA::ComputeRelationships(DesignFlowStepSet& relations
          {
             const auto step_signature = FunctionFrontendFlowStep::ComputeSignature(step_type, i);
             const auto frontend_step = DFM->GetDesignFlowStep(step_signature);
-            THROW_ASSERT(frontend_step != NULL_VERTEX, "step " + step_signature + " is not present");
+            THROW_ASSERT(frontend_step != NULL_VERTEX, "step " + STR(step_signature) + " is not present");
             const auto design_flow_step = DFG->CGetDesignFlowStepInfo(frontend_step)->design_flow_step;
             relationships.insert(design_flow_step);
          }
@@ -137,7 +137,7 @@ void dead_code_eliminationIPA::ComputeRelationships(DesignFlowStepSet& relations
       {
          const auto step_signature = FunctionFrontendFlowStep::ComputeSignature(FrontendFlowStepType::PARM2SSA, i);
          const auto frontend_step = DFM->GetDesignFlowStep(step_signature);
-         THROW_ASSERT(frontend_step != NULL_VERTEX, "step " + step_signature + " is not present");
+         THROW_ASSERT(frontend_step != NULL_VERTEX, "step " + STR(step_signature) + " is not present");
          const auto design_flow_step = DFG->CGetDesignFlowStepInfo(frontend_step)->design_flow_step;
          relationships.insert(design_flow_step);
       }
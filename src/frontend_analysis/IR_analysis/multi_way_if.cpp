@@ -171,6 +171,11 @@ void multi_way_if::Initialize()
 #endif
 }
 
+unsigned int multi_way_if::GetLocalFunction() const
+{
+   return function_id;
+}
+
 void multi_way_if::UpdateCfg(const blocRef& pred_bb, const blocRef& curr_bb)
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Updating control flow graph");
@@ -156,5 +156,11 @@ class multi_way_if : public FunctionFrontendFlowStep
     * @return true if the step has to be executed
     */
    bool HasToBeExecuted() const override;
+
+   /**
+    * Return the function transformed by this step, since only the body of that function is modified
+    * @return the index of the function
+    */
+   unsigned int GetLocalFunction() const override;
 };
 #endif
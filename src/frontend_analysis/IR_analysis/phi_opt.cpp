@@ -127,6 +127,11 @@ void PhiOpt::Initialize()
 #endif
 }
 
+unsigned int PhiOpt::GetLocalFunction() const
+{
+   return function_id;
+}
+
 DesignFlowStep_Status PhiOpt::InternalExec()
 {
    bool restart = true;
@@ -178,6 +178,11 @@ void RemoveEndingIf::Initialize()
 #endif
 }
 
+unsigned int RemoveEndingIf::GetLocalFunction() const
+{
+   return function_id;
+}
+
 bool RemoveEndingIf::HasToBeExecuted() const
 {
    /// If no schedule exists, this step has NOT to be executed
@@ -296,6 +296,11 @@ DesignFlowStep_Status short_circuit_taf::InternalExec()
    }
 }
 
+unsigned int short_circuit_taf::GetLocalFunction() const
+{
+   return function_id;
+}
+
 bool short_circuit_taf::check_merging_candidate(unsigned int& bb1, unsigned int& bb2, unsigned int merging_candidate,
                                                 bool& bb1_true, bool& bb2_true,
                                                 const std::map<unsigned int, blocRef>& list_of_bloc)
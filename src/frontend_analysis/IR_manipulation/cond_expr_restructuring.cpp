@@ -575,7 +575,8 @@ DesignFlowStep_Status CondExprRestructuring::InternalExec()
             next_stmt ? block.second->PushBefore(first_stmt, next_stmt, AppM) :
                         block.second->PushBack(first_stmt, AppM);
 
-            /// Recomputing schedule
+            /// Recomputing schedule; the statements have been rewritten, so cached timings are stale
+            allocation_information->InvalidateTimingCache();
             for(const auto& temp_stmt : list_of_stmt)
             {
                schedule->UpdateTime(temp_stmt->index);
@@ -64,7 +64,8 @@ ApplicationFrontendFlowStep::ApplicationFrontendFlowStep(const application_manag
 
 ApplicationFrontendFlowStep::~ApplicationFrontendFlowStep() = default;
 
-const std::string ApplicationFrontendFlowStep::ComputeSignature(const FrontendFlowStepType frontend_flow_step_type)
+DesignFlowStep::signature_t
+ApplicationFrontendFlowStep::ComputeSignature(const FrontendFlowStepType frontend_flow_step_type)
 {
    switch(frontend_flow_step_type)
    {
@@ -184,16 +185,16 @@ const std::string ApplicationFrontendFlowStep::ComputeSignature(const FrontendFl
       case(STRING_CST_FIX):
       case(SYMBOLIC_APPLICATION_FRONTEND_FLOW_STEP):
       {
-         return "Frontend::" + STR(frontend_flow_step_type);
+         return DesignFlowStep::ComputeSignature(FRONTEND, static_cast<unsigned short>(frontend_flow_step_type), 0);
       }
 
       default:
          THROW_UNREACHABLE("Frontend flow step type does not exist");
    }
-   return "";
+   return 0;
 }
 
-std::string ApplicationFrontendFlowStep::GetSignature() const
+DesignFlowStep::signature_t ApplicationFrontendFlowStep::GetSignature() const
 {
    return ComputeSignature(frontend_flow_step_type);
 }
@@ -77,7 +77,7 @@ class ApplicationFrontendFlowStep : public FrontendFlowStep
    /**
     * Return the signature of this step
     */
-   std::string GetSignature() const override;
+   signature_t GetSignature() const override;
 
    /**
     * Return the name of this design step
@@ -90,7 +90,7 @@ class ApplicationFrontendFlowStep : public FrontendFlowStep
     * @param frontend_flow_step_type is the type of frontend flow
     * @return the corresponding signature
     */
-   static const std::string ComputeSignature(const FrontendFlowStepType frontend_flow_step_type);
+   static signature_t ComputeSignature(const FrontendFlowStepType frontend_flow_step_type);
 
    /**
     * Check if this step has actually to be executed
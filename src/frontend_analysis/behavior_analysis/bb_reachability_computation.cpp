@@ -57,6 +57,7 @@
 
 /// graph includes
 #include "graph.hpp"
+#include "graph_snapshot.hpp"
 
 /// tree includes
 #include "tree_basic_block.hpp"
@@ -121,20 +122,29 @@ DesignFlowStep_Status BBReachabilityComputation::InternalExec()
    auto& bb_reachability = function_behavior->bb_reachability;
    auto& feedback_bb_reachability = function_behavior->feedback_bb_reachability;
 
-   std::deque<vertex> container;
-   boost::topological_sort(*ecfg, std::back_inserter(container));
-   std::deque<vertex>::const_iterator it, it_end;
-   it_end = container.end();
-   for(it = container.begin(); it != it_end; ++it)
+   /// Basic blocks are visited in reverse topological order, so that successors are completed before predecessors
+   const GraphSnapshot snapshot(*ecfg);
+   const auto sorted = snapshot.TopologicalOrder();
+   for(auto it = sorted.rbegin(); it != sorted.rend(); ++it)
    {
+      const auto current = snapshot.GetVertex(*it);
       PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
-                    "  Examining basic block " + std::to_string(ecfg->CGetBBNodeInfo(*it)->block->number));
-      OutEdgeIterator eo, eo_end;
-      for(boost::tie(eo, eo_end) = boost::out_edges(*it, *ecfg); eo != eo_end; eo++)
+                    "  Examining basic block " + std::to_string(ecfg->CGetBBNodeInfo(current)->block->number));
+      const auto successors = snapshot.OutArcs(*it);
+      if(successors.empty())
       {
-         vertex previous = boost::target(*eo, *ecfg);
-         bb_reachability[*it].insert(previous);
-         bb_reachability[*it].insert(bb_reachability[previous].begin(), bb_reachability[previous].end());
+         continue;
+      }
+      auto& current_reachability = bb_reachability[current];
+      for(const auto& arc : successors)
+      {
+         const auto previous = snapshot.GetVertex(arc.vertex);
+         current_reachability.insert(previous);
+         const auto previous_reachability = bb_reachability.find(previous);
+         if(previous_reachability != bb_reachability.end())
+         {
+            current_reachability.insert(previous_reachability->second.begin(), previous_reachability->second.end());
+         }
       }
    }
 
@@ -80,8 +80,8 @@ void FrontendFlowStep::CreateSteps(
     const application_managerConstRef application_manager, DesignFlowStepSet& relationships)
 {
    const DesignFlowGraphConstRef design_flow_graph = design_flow_manager->CGetDesignFlowGraph();
-   const auto* frontend_flow_step_factory =
-       GetPointer<const FrontendFlowStepFactory>(design_flow_manager->CGetDesignFlowStepFactory("Frontend"));
+   const auto* frontend_flow_step_factory = GetPointer<const FrontendFlowStepFactory>(
+       design_flow_manager->CGetDesignFlowStepFactory(DesignFlowStep::FRONTEND));
    CustomUnorderedSet<std::pair<FrontendFlowStepType, FunctionRelationship>>::const_iterator frontend_relationship,
        frontend_relationship_end = frontend_relationships.end();
    for(frontend_relationship = frontend_relationships.begin(); frontend_relationship != frontend_relationship_end;
@@ -374,7 +374,7 @@ const std::string FrontendFlowStep::EnumToKindText(const FrontendFlowStepType fr
 
 DesignFlowStepFactoryConstRef FrontendFlowStep::CGetDesignFlowStepFactory() const
 {
-   return design_flow_manager.lock()->CGetDesignFlowStepFactory("Frontend");
+   return design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::FRONTEND);
 }
 
 void FrontendFlowStep::PrintTreeManager(const bool before) const
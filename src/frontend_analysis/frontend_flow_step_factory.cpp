@@ -161,7 +161,7 @@
 FrontendFlowStepFactory::FrontendFlowStepFactory(const application_managerRef _AppM,
                                                  const DesignFlowManagerConstRef _design_flow_manager,
                                                  const ParameterConstRef _parameters)
-    : DesignFlowStepFactory(_design_flow_manager, _parameters), AppM(_AppM)
+    : DesignFlowStepFactory(DesignFlowStep::FRONTEND, _design_flow_manager, _parameters), AppM(_AppM)
 {
 }
 
@@ -880,8 +880,3 @@ FrontendFlowStepFactory::CreateFunctionFrontendFlowStep(const FrontendFlowStepTy
    }
    return DesignFlowStepRef();
 }
-
-const std::string FrontendFlowStepFactory::GetPrefix() const
-{
-   return "Frontend";
-}
@@ -107,9 +107,5 @@ class FrontendFlowStepFactory : public DesignFlowStepFactory
    const DesignFlowStepRef CreateFunctionFrontendFlowStep(const FrontendFlowStepType design_flow_step_type,
                                                           const unsigned int function_id) const;
 
-   /**
-    * Return the prefix of the steps created by the factory
-    */
-   const std::string GetPrefix() const override;
 };
 #endif
@@ -90,15 +90,16 @@ FunctionFrontendFlowStep::FunctionFrontendFlowStep(const application_managerRef
 
 FunctionFrontendFlowStep::~FunctionFrontendFlowStep() = default;
 
-std::string FunctionFrontendFlowStep::GetSignature() const
+DesignFlowStep::signature_t FunctionFrontendFlowStep::GetSignature() const
 {
    return ComputeSignature(frontend_flow_step_type, function_id);
 }
 
-const std::string FunctionFrontendFlowStep::ComputeSignature(const FrontendFlowStepType frontend_flow_step_type,
-                                                             const unsigned int function_id)
+DesignFlowStep::signature_t
+FunctionFrontendFlowStep::ComputeSignature(const FrontendFlowStepType frontend_flow_step_type,
+                                           const unsigned int function_id)
 {
-   return "Frontend::" + STR(frontend_flow_step_type) + "::" + std::to_string(function_id);
+   return DesignFlowStep::ComputeSignature(FRONTEND, static_cast<unsigned short>(frontend_flow_step_type), function_id);
 }
 
 std::string FunctionFrontendFlowStep::GetName() const
@@ -293,6 +294,19 @@ bool FunctionFrontendFlowStep::HasToBeExecuted() const
    return bb_version != function_behavior->GetBBVersion();
 }
 
+bool FunctionFrontendFlowStep::IsConcurrentWith(const DesignFlowStep& other) const
+{
+   if(!FrontendFlowStep::IsConcurrentWith(other))
+   {
+      return false;
+   }
+   /// a transformation of a function may change the information about it used by its callers and by its callees
+   const auto other_function = other.GetLocalFunction();
+   const auto call_graph_manager = AppM->CGetCallGraphManager();
+   return !call_graph_manager->GetReachedFunctionsFrom(function_id).count(other_function) and
+          !call_graph_manager->GetReachedFunctionsFrom(other_function).count(function_id);
+}
+
 void FunctionFrontendFlowStep::WriteBBGraphDot(const std::string& filename) const
 {
    auto bb_graph_info = BBGraphInfoRef(new BBGraphInfo(AppM, function_id));
@@ -122,7 +122,7 @@ class FunctionFrontendFlowStep : public FrontendFlowStep
    /**
     * Return the signature of this step
     */
-   std::string GetSignature() const override;
+   signature_t GetSignature() const override;
 
    /**
     * Return the name of this design step
@@ -142,7 +142,7 @@ class FunctionFrontendFlowStep : public FrontendFlowStep
     * @param function_id is the index of the function
     * @return the corresponding signature
     */
-   static const std::string ComputeSignature(const FrontendFlowStepType frontend_flow_step_type,
+   static signature_t ComputeSignature(const FrontendFlowStepType frontend_flow_step_type,
                                              const unsigned int function_id);
 
    /**
@@ -151,6 +151,13 @@ class FunctionFrontendFlowStep : public FrontendFlowStep
     */
    bool HasToBeExecuted() const override;
 
+   /**
+    * Check if this step can be executed concurrently with another function-local step
+    * @param other is the other step
+    * @return true if the two steps work on functions which do not call each other
+    */
+   bool IsConcurrentWith(const DesignFlowStep& other) const override;
+
    /**
     * @return on which bb version this step has been executed last time
     */
@@ -101,14 +101,15 @@ std::string SymbolicApplicationFrontendFlowStep::GetKindText() const
    return "SymbolicApplicationFrontendFlowStep(" + EnumToKindText(represented_frontend_flow_step_type) + ")";
 }
 
-const std::string
+DesignFlowStep::signature_t
 SymbolicApplicationFrontendFlowStep::ComputeSignature(const FrontendFlowStepType represented_frontend_flow_step_type)
 {
-   return "Frontend::" + STR(SYMBOLIC_APPLICATION_FRONTEND_FLOW_STEP) + "(" + STR(represented_frontend_flow_step_type) +
-          ")";
+   return DesignFlowStep::ComputeSignature(FRONTEND,
+                                           static_cast<unsigned short>(SYMBOLIC_APPLICATION_FRONTEND_FLOW_STEP),
+                                           static_cast<unsigned long long>(represented_frontend_flow_step_type));
 }
 
-std::string SymbolicApplicationFrontendFlowStep::GetSignature() const
+DesignFlowStep::signature_t SymbolicApplicationFrontendFlowStep::GetSignature() const
 {
    return ComputeSignature(represented_frontend_flow_step_type);
 }
@@ -96,14 +96,14 @@ class SymbolicApplicationFrontendFlowStep : public ApplicationFrontendFlowStep
    /**
     * Return the signature of this step
     */
-   std::string GetSignature() const override;
+   signature_t GetSignature() const override;
 
    /**
     * Compute the signature of a symbolic application frontend flow step
     * @param frontend_flow_step_type is the type of frontend flow
     * @return the corresponding signature
     */
-   static const std::string ComputeSignature(const FrontendFlowStepType frontend_flow_step_type);
+   static signature_t ComputeSignature(const FrontendFlowStepType frontend_flow_step_type);
 
    /**
     * Check if this step has actually to be executed
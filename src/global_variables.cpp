@@ -50,8 +50,8 @@
 /// Exit code
 int exit_code = EXIT_FAILURE;
 
-/// The current indentation for debug messages
-size_t indentation = 0;
+/// The current indentation for debug messages (each thread executing steps keeps its own)
+thread_local size_t indentation = 0;
 
 /// Mull stream
 std::ostream null_stream(nullptr);
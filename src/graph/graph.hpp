@@ -61,8 +61,10 @@
 #include <filesystem>
 #include <fstream>
 #include <list>
+#include <memory>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 /**
  * @name forward declarations
@@ -639,6 +641,99 @@ const info_object* Cget_edge_info(typename boost::graph_traits<Graph>::edge_desc
 
 #define CGET_EDGE_INFO(data, edge_info, edge_index) Cget_edge_info<edge_info>(edge_index, *(data))
 
+/**
+ * Set of vertex indices stored as a bitmap over the range [offset, offset + bits.size())
+ */
+struct VertexIndexBitmap
+{
+   /// The index of the vertex associated with the first bit
+   size_t offset;
+
+   /// The membership bits
+   std::vector<bool> bits;
+
+   VertexIndexBitmap() : offset(0)
+   {
+   }
+
+   /**
+    * @param index is the index of a vertex
+    * @return true if the vertex belongs to the set
+    */
+   bool contains(const size_t index) const
+   {
+      return index >= offset && index - offset < bits.size() && bits[index - offset];
+   }
+
+   bool operator<(const VertexIndexBitmap& other) const
+   {
+      return offset < other.offset || (offset == other.offset && bits < other.bits);
+   }
+};
+
+/**
+ * Set of vertices considered by a filtered graph.
+ * boost copies the predicates of a filtered graph into each of its iterators, so the set is shared among the copies.
+ * It is stored either as a set of vertex descriptors or as a bitmap over the vertex indices of the bulk graph: the
+ * latter is cheaper to query, but it is valid only until a vertex is removed from the bulk graph, since removal
+ * renumbers the vertices.
+ */
+template <typename Graph>
+class VertexSubset
+{
+ private:
+   using vertex_descriptor = typename boost::graph_traits<Graph>::vertex_descriptor;
+
+   /// The set of vertices, if stored as descriptors
+   std::shared_ptr<const CustomUnorderedSet<vertex_descriptor>> vertices;
+
+   /// The bulk graph, used to retrieve the indices of the vertices
+   const Graph* g;
+
+   /// The set of vertices, if stored as a bitmap
+   std::shared_ptr<const VertexIndexBitmap> bitmap;
+
+ public:
+   /**
+    * Constructor of the empty set
+    */
+   VertexSubset() : vertices(), g(nullptr), bitmap()
+   {
+   }
+
+   /**
+    * Constructor
+    * @param _vertices is the set of vertices
+    */
+   explicit VertexSubset(const CustomUnorderedSet<vertex_descriptor>& _vertices)
+       : vertices(new CustomUnorderedSet<vertex_descriptor>(_vertices)), g(nullptr), bitmap()
+   {
+   }
+
+   /**
+    * Constructor
+    * @param _g is the bulk graph
+    * @param _bitmap is the set of the indices of the vertices
+    */
+   VertexSubset(const Graph* _g, const std::shared_ptr<const VertexIndexBitmap>& _bitmap)
+       : vertices(), g(_g), bitmap(_bitmap)
+   {
+   }
+
+   /**
+    * @param v is the vertex to be checked
+    * @return true if v belongs to the set
+    */
+   bool contains(const vertex_descriptor v) const
+   {
+      if(bitmap)
+      {
+         return bitmap->contains(boost::get(boost::vertex_index_t(), *g, v));
+      }
+      return vertices && vertices->find(v) != vertices->end();
+   }
+};
+
 /**
  * Predicate functor object used to select the proper set of vertexes
  */
@@ -650,7 +745,7 @@ struct SelectVertex
    bool all;
 
    /// The set of vertices to be considered
-   CustomUnorderedSet<typename boost::graph_traits<Graph>::vertex_descriptor> subset;
+   VertexSubset<Graph> subset;
 
  public:
    /**
@@ -664,8 +759,7 @@ struct SelectVertex
     * Constructor
     * @param _subset is the set of vertices to be considered
     */
-   explicit SelectVertex(const CustomUnorderedSet<typename boost::graph_traits<Graph>::vertex_descriptor>& _subset)
-       : all(false), subset(_subset)
+   explicit SelectVertex(const VertexSubset<Graph>& _subset) : all(false), subset(_subset)
    {
    }
 
@@ -682,7 +776,7 @@ struct SelectVertex
       }
       else
       {
-         return (subset.find(v) != subset.end());
+         return subset.contains(v);
       }
    }
 };
@@ -701,7 +795,7 @@ struct SelectEdge
    Graph* g;
 
    /// The vertices of subgraph
-   CustomUnorderedSet<typename boost::graph_traits<Graph>::vertex_descriptor> subgraph_vertices;
+   VertexSubset<Graph> subgraph_vertices;
 
    /// true when the subvertices set is empty
    bool empty;
@@ -729,8 +823,7 @@ struct SelectEdge
     * @param _g is the graph
     * @param _subgraph_vertices is the set of vertices of the filtered graph
     */
-   SelectEdge(const int _selector, Graph* _g,
-              const CustomUnorderedSet<typename boost::graph_traits<Graph>::vertex_descriptor>& _subgraph_vertices)
+   SelectEdge(const int _selector, Graph* _g, const VertexSubset<Graph>& _subgraph_vertices)
        : selector(_selector), g(_g), subgraph_vertices(_subgraph_vertices), empty(false)
    {
    }
@@ -744,18 +837,8 @@ struct SelectEdge
       }
       else
       {
-         typename boost::graph_traits<Graph>::vertex_descriptor u, v;
-         u = boost::source(e, *g);
-         v = boost::target(e, *g);
-         if((selector & (*g)[e].selector) && subgraph_vertices.find(v) != subgraph_vertices.end() &&
-            subgraph_vertices.find(u) != subgraph_vertices.end())
-         {
-            return true;
-         }
-         else
-         {
-            return false;
-         }
+         return (selector & (*g)[e].selector) && subgraph_vertices.contains(boost::target(e, *g)) &&
+                subgraph_vertices.contains(boost::source(e, *g));
       }
    }
 };
@@ -885,6 +968,29 @@ struct graph : public boost::filtered_graph<boost_graphs_collection, SelectEdge<
     */
    graph(graphs_collection* g, const int _selector,
          const CustomUnorderedSet<boost::graph_traits<graphs_collection>::vertex_descriptor>& vertices)
+       : graph(g, _selector, VertexSubset<boost_graphs_collection>(vertices))
+   {
+   }
+
+   /**
+    * Sub-graph constructor.
+    * @param g is the bulk graph.
+    * @param _selector is the selector used to filter the bulk graph.
+    * @param vertices is the set of the indices of the vertexes on which the graph is filtered; the graph must not be
+    * used after a vertex has been removed from the bulk graph.
+    */
+   graph(graphs_collection* g, const int _selector, const std::shared_ptr<const VertexIndexBitmap>& vertices)
+       : graph(g, _selector, VertexSubset<boost_graphs_collection>(g, vertices))
+   {
+   }
+
+   /**
+    * Sub-graph constructor.
+    * @param g is the bulk graph.
+    * @param _selector is the selector used to filter the bulk graph.
+    * @param vertices is the set of vertexes on which the graph is filtered.
+    */
+   graph(graphs_collection* g, const int _selector, const VertexSubset<boost_graphs_collection>& vertices)
        : boost::filtered_graph<boost_graphs_collection, SelectEdge<boost_graphs_collection>,
                                SelectVertex<boost_graphs_collection>>(
              *g, SelectEdge<boost_graphs_collection>(_selector, g, vertices),
@@ -1206,8 +1312,11 @@ struct ugraph
        const CustomUnorderedSet<boost::graph_traits<undirected_boost_graphs_collection>::vertex_descriptor>& vertices)
        : boost::filtered_graph<undirected_boost_graphs_collection, SelectEdge<undirected_boost_graphs_collection>,
                                SelectVertex<undirected_boost_graphs_collection>>(
-             *g, SelectEdge<undirected_boost_graphs_collection>(_selector, g, vertices),
-             SelectVertex<undirected_boost_graphs_collection>(vertices)),
+             *g,
+             SelectEdge<undirected_boost_graphs_collection>(
+                 _selector, g, VertexSubset<undirected_boost_graphs_collection>(vertices)),
+             SelectVertex<undirected_boost_graphs_collection>(
+                 VertexSubset<undirected_boost_graphs_collection>(vertices))),
          collection(g),
          selector(_selector)
 
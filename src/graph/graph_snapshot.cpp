@@ -0,0 +1,113 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file graph_snapshot.cpp
+ * @brief Immutable compressed sparse row snapshot of a graph
+ *
+ */
+
+/// Header include
+#include "graph_snapshot.hpp"
+
+GraphSnapshot::GraphSnapshot(const graph& g)
+{
+   const auto n_vertices = boost::num_vertices(g);
+   index_to_vertex.reserve(n_vertices);
+   vertex_to_index.reserve(n_vertices);
+   VertexIterator v_it, v_it_end;
+   for(boost::tie(v_it, v_it_end) = boost::vertices(g); v_it != v_it_end; ++v_it)
+   {
+      vertex_to_index.emplace(*v_it, index_to_vertex.size());
+      index_to_vertex.push_back(*v_it);
+   }
+
+   out_offsets.reserve(index_to_vertex.size() + 1);
+   out_offsets.push_back(0);
+   in_offsets.reserve(index_to_vertex.size() + 1);
+   in_offsets.push_back(0);
+   for(const auto v : index_to_vertex)
+   {
+      OutEdgeIterator oe, oe_end;
+      for(boost::tie(oe, oe_end) = boost::out_edges(v, g); oe != oe_end; ++oe)
+      {
+         out_arcs.push_back(Arc{vertex_to_index.at(boost::target(*oe, g)), g.GetSelector(*oe)});
+      }
+      out_offsets.push_back(out_arcs.size());
+      InEdgeIterator ie, ie_end;
+      for(boost::tie(ie, ie_end) = boost::in_edges(v, g); ie != ie_end; ++ie)
+      {
+         in_arcs.push_back(Arc{vertex_to_index.at(boost::source(*ie, g)), g.GetSelector(*ie)});
+      }
+      in_offsets.push_back(in_arcs.size());
+   }
+   THROW_ASSERT(out_arcs.size() == in_arcs.size(), "Inconsistent number of edges in graph snapshot");
+}
+
+size_t GraphSnapshot::GetIndex(vertex v) const
+{
+   const auto it = vertex_to_index.find(v);
+   THROW_ASSERT(it != vertex_to_index.end(), "Vertex not in graph snapshot");
+   return it->second;
+}
+
+std::vector<size_t> GraphSnapshot::TopologicalOrder() const
+{
+   const auto n_vertices = index_to_vertex.size();
+   std::vector<size_t> pending_predecessors(n_vertices);
+   std::vector<size_t> sorted;
+   sorted.reserve(n_vertices);
+   for(size_t index = 0; index < n_vertices; ++index)
+   {
+      pending_predecessors[index] = in_offsets[index + 1] - in_offsets[index];
+      if(!pending_predecessors[index])
+      {
+         sorted.push_back(index);
+      }
+   }
+   /// sorted is used as the work list of Kahn's algorithm
+   for(size_t position = 0; position < sorted.size(); ++position)
+   {
+      for(const auto& arc : OutArcs(sorted[position]))
+      {
+         if(!--pending_predecessors[arc.vertex])
+         {
+            sorted.push_back(arc.vertex);
+         }
+      }
+   }
+   if(sorted.size() != n_vertices)
+   {
+      THROW_ERROR("Topological order requested on a cyclic graph");
+   }
+   return sorted;
+}
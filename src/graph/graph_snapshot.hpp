@@ -0,0 +1,185 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file graph_snapshot.hpp
+ * @brief Immutable compressed sparse row snapshot of a graph
+ *
+ */
+#ifndef GRAPH_SNAPSHOT_HPP
+#define GRAPH_SNAPSHOT_HPP
+
+#include "custom_map.hpp"
+#include "graph.hpp"
+#include "refcount.hpp"
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Immutable compressed sparse row snapshot of a (filtered) graph.
+ * Vertices are numbered densely in the order of boost::vertices and their successors and predecessors are stored in
+ * two flat arrays, together with the selectors of the edges. Read-only analyses on large graphs can build it once
+ * and traverse it by index instead of chasing the nodes of the list based boost graph.
+ * The snapshot is not updated when the graph is modified.
+ */
+class GraphSnapshot
+{
+ public:
+   /// An edge seen from one of its ends
+   struct Arc
+   {
+      /// the index of the vertex at the other end of the edge
+      size_t vertex;
+
+      /// the selectors of the edge, restricted to the selector of the snapshot graph
+      int selector;
+   };
+
+   /// A contiguous range of arcs
+   class ArcRange
+   {
+    private:
+      const Arc* first;
+      const Arc* last;
+
+    public:
+      ArcRange(const Arc* _first, const Arc* _last) : first(_first), last(_last)
+      {
+      }
+
+      const Arc* begin() const
+      {
+         return first;
+      }
+
+      const Arc* end() const
+      {
+         return last;
+      }
+
+      size_t size() const
+      {
+         return static_cast<size_t>(last - first);
+      }
+
+      bool empty() const
+      {
+         return first == last;
+      }
+   };
+
+   /**
+    * Constructor
+    * @param g is the graph to be snapshotted; only its selected vertices and edges are considered
+    */
+   explicit GraphSnapshot(const graph& g);
+
+   /**
+    * @return the number of vertices of the snapshot
+    */
+   size_t NumVertices() const
+   {
+      return index_to_vertex.size();
+   }
+
+   /**
+    * @return the number of edges of the snapshot
+    */
+   size_t NumEdges() const
+   {
+      return out_arcs.size();
+   }
+
+   /**
+    * @param index is the index of a vertex of the snapshot
+    * @return the corresponding vertex of the graph
+    */
+   vertex GetVertex(size_t index) const
+   {
+      THROW_ASSERT(index < index_to_vertex.size(), "Vertex index " + std::to_string(index) + " out of range");
+      return index_to_vertex[index];
+   }
+
+   /**
+    * @param v is a vertex of the graph
+    * @return the index of v in the snapshot
+    */
+   size_t GetIndex(vertex v) const;
+
+   /**
+    * @param index is the index of a vertex of the snapshot
+    * @return the arcs toward the successors of the vertex
+    */
+   ArcRange OutArcs(size_t index) const
+   {
+      THROW_ASSERT(index < index_to_vertex.size(), "Vertex index " + std::to_string(index) + " out of range");
+      return ArcRange(out_arcs.data() + out_offsets[index], out_arcs.data() + out_offsets[index + 1]);
+   }
+
+   /**
+    * @param index is the index of a vertex of the snapshot
+    * @return the arcs toward the predecessors of the vertex
+    */
+   ArcRange InArcs(size_t index) const
+   {
+      THROW_ASSERT(index < index_to_vertex.size(), "Vertex index " + std::to_string(index) + " out of range");
+      return ArcRange(in_arcs.data() + in_offsets[index], in_arcs.data() + in_offsets[index + 1]);
+   }
+
+   /**
+    * Compute a topological order of the vertices; the snapshot must be acyclic
+    * @return the indices of the vertices sorted so that every edge goes from an earlier to a later vertex
+    */
+   std::vector<size_t> TopologicalOrder() const;
+
+ private:
+   /// the vertices of the graph sorted by index
+   std::vector<vertex> index_to_vertex;
+
+   /// the index of each vertex
+   CustomUnorderedMap<vertex, size_t> vertex_to_index;
+
+   /// the position in out_arcs of the first successor of each vertex; it has NumVertices() + 1 elements
+   std::vector<size_t> out_offsets;
+
+   /// the arcs toward the successors of all the vertices
+   std::vector<Arc> out_arcs;
+
+   /// the position in in_arcs of the first predecessor of each vertex; it has NumVertices() + 1 elements
+   std::vector<size_t> in_offsets;
+
+   /// the arcs toward the predecessors of all the vertices
+   std::vector<Arc> in_arcs;
+};
+using GraphSnapshotConstRef = refcount<const GraphSnapshot>;
+#endif
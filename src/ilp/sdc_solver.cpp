@@ -0,0 +1,375 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file sdc_solver.cpp
+ * @brief Solver for systems of difference constraints, as the ones produced by SDC scheduling
+ *
+ * @author agent <agent@local>
+ * $Revision$
+ * $Date$
+ * Last modified by $Author$
+ *
+ */
+#include "sdc_solver.hpp"
+
+#include "dbgPrintHelper.hpp"
+#include "exceptions.hpp"
+
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <utility>
+
+/// tolerance used when comparing the values of the variables
+#define SDC_EPSILON 1e-9
+
+sdc_solver::sdc_solver() : direction(min), solved(false), integer_solution(false)
+{
+}
+
+sdc_solver::~sdc_solver() = default;
+
+void sdc_solver::make(int nvars)
+{
+   THROW_ASSERT(nvars >= 0, "expected a non-negative number of variables");
+   /// node 0 represents the constant zero, variable i is node i + 1
+   successors.assign(static_cast<size_t>(nvars) + 1, std::vector<edge>());
+   integer_vars.assign(static_cast<size_t>(nvars) + 1, false);
+   col_names.assign(static_cast<size_t>(nvars), std::string());
+   rows.clear();
+   objective.clear();
+   direction = min;
+   potentials.clear();
+   applied_lower_bounds.clear();
+   pending.clear();
+   lower_bounds.clear();
+   upper_bounds.clear();
+   solved = false;
+   integer_solution = false;
+}
+
+int sdc_solver::add_empty_column()
+{
+   successors.emplace_back();
+   integer_vars.push_back(false);
+   col_names.emplace_back();
+   return static_cast<int>(col_names.size()) - 1;
+}
+
+void sdc_solver::add_edge(size_t source, size_t target, double weight)
+{
+   successors[source].push_back(edge{target, weight});
+   if(solved)
+   {
+      pending.push_back(source);
+   }
+}
+
+void sdc_solver::add_row(std::map<int, double>& i_coeffs, double i_rhs, ilp_sign i_sign, const std::string& name)
+{
+   std::vector<std::pair<size_t, double>> terms;
+   for(const auto& coeff : i_coeffs)
+   {
+      THROW_ASSERT(coeff.first >= 0 && static_cast<size_t>(coeff.first) < col_names.size(),
+                   "Variable " + std::to_string(coeff.first) + " does not exist");
+      if(coeff.second != 0.0)
+      {
+         terms.push_back(std::make_pair(static_cast<size_t>(coeff.first) + 1, coeff.second));
+      }
+   }
+   if(terms.empty())
+   {
+      return;
+   }
+   if(terms.size() > 2 ||
+      (terms.size() == 2 && std::fabs(terms.front().second + terms.back().second) > SDC_EPSILON))
+   {
+      THROW_ERROR("Constraint " + name + " is not a difference constraint: use a general purpose ilp solver");
+   }
+   rows.push_back(row{i_coeffs, i_rhs, i_sign, name});
+   /// the constraint is normalized as x_source - x_target (sign) c; a bound on a single variable is a difference with
+   /// the constant zero
+   const auto source = terms.front().first;
+   const auto target = terms.size() == 2 ? terms.back().first : 0;
+   const auto a = terms.front().second;
+   if(a < 0)
+   {
+      i_sign = i_sign == G ? L : (i_sign == L ? G : E);
+   }
+   const auto c = i_rhs / a;
+   if(i_sign == G || i_sign == E)
+   {
+      /// x_source >= x_target + c
+      add_edge(target, source, c);
+   }
+   if(i_sign == L || i_sign == E)
+   {
+      /// x_target >= x_source - c
+      add_edge(source, target, -c);
+   }
+}
+
+void sdc_solver::objective_add(std::map<int, double>& i_coeffs, ilp_dir dir)
+{
+   direction = dir;
+   for(const auto& coeff : i_coeffs)
+   {
+      objective[coeff.first] = coeff.second;
+   }
+}
+
+void sdc_solver::set_int(int i)
+{
+   THROW_ASSERT(i >= 0 && static_cast<size_t>(i) < col_names.size(), "Variable " + std::to_string(i) + " does not exist");
+   if(!integer_vars[static_cast<size_t>(i) + 1])
+   {
+      integer_vars[static_cast<size_t>(i) + 1] = true;
+      /// the previous value of the variable may not be integer
+      solved = false;
+   }
+}
+
+void sdc_solver::set_all_bounds()
+{
+   THROW_ASSERT(!successors.empty(), "the problem must exist");
+   const auto n_nodes = successors.size();
+   potentials.resize(n_nodes, -std::numeric_limits<double>::infinity());
+   applied_lower_bounds.resize(n_nodes, -std::numeric_limits<double>::infinity());
+   potentials[0] = 0.0;
+   for(size_t var = 0; var + 1 < n_nodes; ++var)
+   {
+      const auto lower_bound = lower_bounds.find(static_cast<int>(var));
+      if(lower_bound == lower_bounds.end())
+      {
+         THROW_ERROR("Variable " + get_col_name(static_cast<int>(var)) + " has no lower bound");
+      }
+      /// a relaxed bound may lower the least solution, which has to be computed again
+      if(lower_bound->second < applied_lower_bounds[var + 1])
+      {
+         solved = false;
+      }
+   }
+}
+
+int sdc_solver::compute_solution(bool integer)
+{
+   for(const auto& coeff : objective)
+   {
+      if((direction == min && coeff.second < 0.0) || (direction == max && coeff.second > 0.0))
+      {
+         THROW_ERROR("Objective function not supported by the SDC solver: use a general purpose ilp solver");
+      }
+   }
+   set_all_bounds();
+   if(integer != integer_solution)
+   {
+      solved = false;
+   }
+   const auto n_nodes = successors.size();
+   if(!solved)
+   {
+      std::fill(potentials.begin() + 1, potentials.end(), -std::numeric_limits<double>::infinity());
+      pending.clear();
+      pending.push_back(0);
+   }
+   integer_solution = integer;
+
+   std::deque<size_t> queue;
+   std::vector<bool> queued(n_nodes, false);
+   const auto enqueue = [&](size_t node) {
+      if(!queued[node])
+      {
+         queued[node] = true;
+         queue.push_back(node);
+      }
+   };
+   for(size_t node = 1; node < n_nodes; ++node)
+   {
+      auto lower_bound = lower_bounds.at(static_cast<int>(node - 1));
+      applied_lower_bounds[node] = lower_bound;
+      if(integer && integer_vars[node])
+      {
+         lower_bound = std::ceil(lower_bound - SDC_EPSILON);
+      }
+      if(lower_bound > potentials[node])
+      {
+         potentials[node] = lower_bound;
+         enqueue(node);
+      }
+   }
+   for(const auto node : pending)
+   {
+      enqueue(node);
+   }
+   pending.clear();
+
+   /// queue based Bellman-Ford: without positive cycles no variable is updated more than once per node
+   std::vector<size_t> updates(n_nodes, 0);
+   solved = false;
+   while(!queue.empty())
+   {
+      const auto source = queue.front();
+      queue.pop_front();
+      queued[source] = false;
+      for(const auto& e : successors[source])
+      {
+         auto candidate = potentials[source] + e.weight;
+         if(integer && integer_vars[e.target])
+         {
+            candidate = std::ceil(candidate - SDC_EPSILON);
+         }
+         if(candidate <= potentials[e.target] + SDC_EPSILON)
+         {
+            continue;
+         }
+         /// the constant zero cannot be raised and a positive cycle has no solution
+         if(e.target == 0 || ++updates[e.target] > n_nodes)
+         {
+            INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level, "---SDC problem has no feasible solution");
+            return 1;
+         }
+         potentials[e.target] = candidate;
+         enqueue(e.target);
+      }
+   }
+   solved = true;
+
+   /// the least solution violates an upper bound, so no other solution can satisfy it
+   for(const auto& upper_bound : upper_bounds)
+   {
+      if(potentials[static_cast<size_t>(upper_bound.first) + 1] > upper_bound.second + SDC_EPSILON)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_PEDANTIC, debug_level,
+                        "---Variable " + get_col_name(upper_bound.first) + " exceeds its upper bound");
+         return 1;
+      }
+   }
+   if(debug_level >= DEBUG_LEVEL_VERBOSE)
+   {
+      print(std::cerr);
+   }
+   return 0;
+}
+
+int sdc_solver::solve()
+{
+   return compute_solution(false);
+}
+
+int sdc_solver::solve_ilp()
+{
+   return compute_solution(true);
+}
+
+void sdc_solver::get_vars_solution(std::map<int, double>& vars) const
+{
+   vars.clear();
+   for(size_t node = 1; node < potentials.size(); ++node)
+   {
+      vars[static_cast<int>(node - 1)] = potentials[node];
+   }
+}
+
+int sdc_solver::get_number_constraints() const
+{
+   return static_cast<int>(rows.size());
+}
+
+int sdc_solver::get_number_variables() const
+{
+   return static_cast<int>(col_names.size());
+}
+
+void sdc_solver::set_col_name(int var, const std::string& name)
+{
+   col_names.at(static_cast<size_t>(var)) = name + "_" + std::to_string(var);
+}
+
+std::string sdc_solver::get_col_name(int var)
+{
+   const auto& name = col_names.at(static_cast<size_t>(var));
+   return name.empty() ? "x" + std::to_string(var) : name;
+}
+
+void sdc_solver::print(std::ostream& os)
+{
+   os << (direction == min ? "Minimize" : "Maximize") << "\n obj:";
+   for(const auto& coeff : objective)
+   {
+      os << " " << (coeff.second < 0.0 ? "- " : "+ ") << std::fabs(coeff.second) << " " << get_col_name(coeff.first);
+   }
+   os << "\nSubject To\n";
+   for(const auto& r : rows)
+   {
+      os << " " << r.name << ":";
+      for(const auto& coeff : r.coeffs)
+      {
+         os << " " << (coeff.second < 0.0 ? "- " : "+ ") << std::fabs(coeff.second) << " " << get_col_name(coeff.first);
+      }
+      os << (r.sign == G ? " >= " : (r.sign == L ? " <= " : " = ")) << r.rhs << "\n";
+   }
+   os << "Bounds\n";
+   for(int var = 0; var < get_number_variables(); ++var)
+   {
+      const auto lower_bound = lower_bounds.find(var);
+      const auto upper_bound = upper_bounds.find(var);
+      os << " ";
+      if(lower_bound != lower_bounds.end())
+      {
+         os << lower_bound->second << " <= ";
+      }
+      os << get_col_name(var);
+      if(upper_bound != upper_bounds.end())
+      {
+         os << " <= " << upper_bound->second;
+      }
+      os << "\n";
+   }
+   os << "General\n";
+   for(int var = 0; var < get_number_variables(); ++var)
+   {
+      if(integer_vars[static_cast<size_t>(var) + 1])
+      {
+         os << " " << get_col_name(var) << "\n";
+      }
+   }
+   os << "End\n";
+}
+
+void sdc_solver::print_to_file(const std::string& file_name)
+{
+   std::ofstream os(file_name + ".lp");
+   print(os);
+}
@@ -0,0 +1,187 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file sdc_solver.hpp
+ * @brief Solver for systems of difference constraints, as the ones produced by SDC scheduling
+ *
+ * @author agent <agent@local>
+ * $Revision$
+ * $Date$
+ * Last modified by $Author$
+ *
+ */
+#ifndef SDC_SOLVER_HPP
+#define SDC_SOLVER_HPP
+
+#include "meilp_solver.hpp"
+
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Solver for linear problems whose constraints have all the form x_i - x_j <= c (or a bound on a single variable)
+ * and whose objective function has non-negative coefficients when minimized.
+ * The constraints are represented as a graph where the constraint x_i - x_j >= c is an edge from j to i with weight
+ * c; since the componentwise least feasible assignment of such a system minimizes every objective function with
+ * non-negative coefficients, the problem is solved by computing the longest paths from the lower bounds of the
+ * variables with a queue based Bellman-Ford algorithm, instead of going through a general simplex.
+ * The solver is incremental: constraints added after a solution has been computed (or tighter lower bounds) only
+ * raise the least solution, so the next solve starts from the previous solution and visits only the variables
+ * affected by the new constraints.
+ */
+class sdc_solver : public meilp_solver
+{
+ private:
+   /// A constraint x_target >= x_source + weight, stored in the list of the source
+   struct edge
+   {
+      /// the variable constrained by the edge
+      size_t target;
+
+      /// the minimum distance between the source and the target
+      double weight;
+   };
+
+   /// A constraint as specified by add_row, kept to print the problem
+   struct row
+   {
+      /// the coefficients of the constraint
+      std::map<int, double> coeffs;
+
+      /// the right part of the constraint
+      double rhs;
+
+      /// the operator of the constraint
+      ilp_sign sign;
+
+      /// the name of the constraint
+      std::string name;
+   };
+
+   /// for each variable, the constraints which have it as source
+   std::vector<std::vector<edge>> successors;
+
+   /// for each variable, true if it has to assume only integer values
+   std::vector<bool> integer_vars;
+
+   /// the names of the variables
+   std::vector<std::string> col_names;
+
+   /// the constraints of the problem
+   std::vector<row> rows;
+
+   /// the coefficients of the objective function
+   std::map<int, double> objective;
+
+   /// the direction of the objective function
+   ilp_dir direction;
+
+   /// the current value of the variables
+   std::vector<double> potentials;
+
+   /// the lower bounds the current value of the variables has been computed with
+   std::vector<double> applied_lower_bounds;
+
+   /// the variables whose successors have to be visited again by the next solve
+   std::vector<size_t> pending;
+
+   /// true if potentials is the least solution of the problem solved by the last solve
+   bool solved;
+
+   /// true if the last solve has been solve_ilp
+   bool integer_solution;
+
+   /**
+    * Adds the constraint x_target >= x_source + weight
+    */
+   void add_edge(size_t source, size_t target, double weight);
+
+   /**
+    * Computes the least solution of the problem, starting from the previous one when possible
+    * @param integer tells if integer variables have to assume integer values
+    * @return 0 if the problem is feasible, 1 otherwise
+    */
+   int compute_solution(bool integer);
+
+   /**
+    * Check the lower bounds of the variables and update the starting point of the next solve
+    */
+   void set_all_bounds() override;
+
+   /**
+    * Print the problem in CPLEX LP format
+    * @param os is the stream on which problem has to be printed
+    */
+   void print(std::ostream& os) override;
+
+ public:
+   /**
+    * Constructor
+    */
+   sdc_solver();
+
+   /**
+    * Destructor
+    */
+   ~sdc_solver() override;
+
+   void make(int nvars) override;
+
+   int solve() override;
+
+   int solve_ilp() override;
+
+   void add_row(std::map<int, double>& i_coeffs, double i_rhs, ilp_sign i_sign, const std::string& name) override;
+
+   void objective_add(std::map<int, double>& i_coeffs, ilp_dir dir) override;
+
+   void set_int(int i) override;
+
+   void get_vars_solution(std::map<int, double>& vars) const override;
+
+   int get_number_constraints() const override;
+
+   int get_number_variables() const override;
+
+   void set_col_name(int var, const std::string& name) override;
+
+   std::string get_col_name(int var) override;
+
+   int add_empty_column() override;
+
+   void print_to_file(const std::string& file_name) override;
+};
+#endif
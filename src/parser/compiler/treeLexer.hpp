@@ -56,6 +56,15 @@
 /// Utility include
 #include "exceptions.hpp"
 
+/// STD include
+#include <deque>
+#include <string>
+#include <vector>
+
+/// magic number opening a binary IR file; keep in sync with etc/clang_plugin/plugin_includes.hpp
+#define BINARY_IR_MAGIC "\x7f" \
+                        "BIR0001"
+
 class treeVocabularyTokenTypes;
 
 struct TreeFlexLexer : public yyFlexLexer
@@ -89,4 +98,61 @@ struct TreeFlexLexer : public yyFlexLexer
    TreeVocabularyTokenTypes_TokenEnum bison2token(int) const;
 };
 
+/**
+ * Lexer for the binary token stream written by the clang plugin when -panda-binary-ir is given.
+ * Every record of the stream is one token of the textual format, so the bison parser builds the tree_manager
+ * exactly as it does from the textual dump, without scanning text and matching keywords for every token.
+ */
+struct TreeBinaryLexer : public TreeFlexLexer
+{
+   /// tags of the binary token stream; keep in sync with DumpGimpleRaw::binary_tag
+   enum binary_tag
+   {
+      BT_NODE = 1,
+      BT_KEYWORD = 2,
+      BT_INT = 3,
+      BT_NUMBER = 4,
+      BT_STRING = 5,
+      BT_DEFINE = 6
+   };
+
+   explicit TreeBinaryLexer(std::istream* argin);
+
+   int yylex() override;
+
+   void LexerError(const char* msg) override
+   {
+      std::cout << msg << " at byte offset |" << offset << "|" << std::endl;
+      THROW_ERROR("Parse error");
+   }
+
+ private:
+   /// the buffer of the binary stream
+   std::streambuf* input;
+
+   /// number of bytes read so far
+   size_t offset;
+
+   /// the interned strings; a deque keeps the token texts already handed to the parser valid
+   std::deque<std::string> strings;
+
+   /// the bison token of each interned keyword, 0 if not yet resolved
+   std::vector<int> keyword_tokens;
+
+   /**
+    * Read a byte of the stream
+    */
+   int read_byte();
+
+   /**
+    * Read an unsigned LEB128 integer
+    */
+   unsigned long long read_varint();
+
+   /**
+    * Read an index in the string table
+    */
+   size_t read_string_index();
+};
+
 #endif
@@ -56,7 +56,7 @@ ParserFlowStep::ParserFlowStep(const DesignFlowManagerConstRef _design_flow_mana
 
 ParserFlowStep::~ParserFlowStep() = default;
 
-std::string ParserFlowStep::GetSignature() const
+DesignFlowStep::signature_t ParserFlowStep::GetSignature() const
 {
    return ComputeSignature(parser_step_type, file_name);
 }
@@ -66,10 +66,11 @@ std::string ParserFlowStep::GetName() const
    return "Parser::" + GetKindText() + "::" + file_name;
 }
 
-const std::string ParserFlowStep::ComputeSignature(const ParserFlowStep_Type parser_step_type,
-                                                   const std::string& file_name)
+DesignFlowStep::signature_t ParserFlowStep::ComputeSignature(const ParserFlowStep_Type parser_step_type,
+                                                             const std::string& file_name)
 {
-   return "Parser::" + STR(parser_step_type) + "::" + file_name;
+   return DesignFlowStep::ComputeSignature(PARSER, static_cast<unsigned short>(parser_step_type),
+                                           GetSignatureContext(file_name));
 }
 
 std::string ParserFlowStep::GetKindText() const
@@ -105,5 +106,5 @@ void ParserFlowStep::ComputeRelationships(DesignFlowStepSet&, const DesignFlowSt
 
 DesignFlowStepFactoryConstRef ParserFlowStep::CGetDesignFlowStepFactory() const
 {
-   return design_flow_manager.lock()->CGetDesignFlowStepFactory("Parser");
+   return design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::PARSER);
 }
@@ -94,7 +94,7 @@ class ParserFlowStep : public DesignFlowStep
    /**
     * Return the signature of this step
     */
-   std::string GetSignature() const override;
+   signature_t GetSignature() const override;
 
    /**
     * Return the name of this design step
@@ -108,7 +108,7 @@ class ParserFlowStep : public DesignFlowStep
     * @param file_name is the file name
     * @return the corresponding signature
     */
-   static const std::string ComputeSignature(const ParserFlowStep_Type parser_step_type, const std::string& file_name);
+   static signature_t ComputeSignature(const ParserFlowStep_Type parser_step_type, const std::string& file_name);
 
    /**
     * Check if this step has actually to be executed
@@ -46,6 +46,10 @@
 /// parser include
 #include "parser_flow_step.hpp"
 
+/// utility include
+#include "exceptions.hpp"
+#include "string_manipulation.hpp"
+
 #if HAVE_FROM_AADL_ASN_BUILT
 /// parser/aadl include
 #include "aadl_parser.hpp"
@@ -56,24 +60,17 @@
 
 ParserFlowStepFactory::ParserFlowStepFactory(const DesignFlowManagerConstRef _design_flow_manager,
                                              const application_managerRef _AppM, const ParameterConstRef _parameters)
-    : DesignFlowStepFactory(_design_flow_manager, _parameters), AppM(_AppM)
+    : DesignFlowStepFactory(DesignFlowStep::PARSER, _design_flow_manager, _parameters), AppM(_AppM)
 {
 }
 
 ParserFlowStepFactory::~ParserFlowStepFactory() = default;
 
-const std::string ParserFlowStepFactory::GetPrefix() const
-{
-   return "Parser";
-}
-
-DesignFlowStepRef ParserFlowStepFactory::CreateFlowStep(const std::string& signature) const
+DesignFlowStepRef ParserFlowStepFactory::CreateFlowStep(DesignFlowStep::signature_t signature) const
 {
-   THROW_ASSERT(signature.find(GetPrefix() + "::") == 0, signature);
-   const auto step_to_be_created = signature.substr(GetPrefix().size() + 2);
-   const auto parser_flow_step_type =
-       static_cast<ParserFlowStep_Type>(std::stoi(step_to_be_created.substr(0, step_to_be_created.find("::"))));
-   const auto file_name = step_to_be_created.substr(step_to_be_created.find("::") + 2);
+   THROW_ASSERT(DesignFlowStep::GetStepClass(signature) == GetClass(), "Wrong signature " + STR(signature));
+   const auto parser_flow_step_type = static_cast<ParserFlowStep_Type>(DesignFlowStep::GetStepType(signature));
+   const auto& file_name = DesignFlowStep::GetSignatureContextName(DesignFlowStep::GetStepContext(signature));
    switch(parser_flow_step_type)
    {
 #if HAVE_FROM_AADL_ASN_BUILT
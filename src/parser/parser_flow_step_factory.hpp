@@ -71,16 +71,12 @@ class ParserFlowStepFactory : public DesignFlowStepFactory
     */
    ~ParserFlowStepFactory() override;
 
-   /**
-    * Return the prefix of the steps created by the factory
-    */
-   const std::string GetPrefix() const override;
 
    /**
     * Return a step given the signature
     * @param signature is the signature of the step to be created
     * @return the created step
     */
-   DesignFlowStepRef CreateFlowStep(const std::string& signature) const override;
+   DesignFlowStepRef CreateFlowStep(DesignFlowStep::signature_t signature) const override;
 };
 #endif
@@ -42,11 +42,41 @@
 /// Header include
 #include "xml_dom_parser.hpp"
 
+/// polixml includes
+#include "xml_document.hpp"
+#include "xml_element.hpp"
+#include "xml_text_node.hpp"
+
+/// STD includes
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <utility>
+#include <vector>
+
+/// System includes
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 /// Utility include
+#include "custom_map.hpp"
 #include "fileIO.hpp"
 
+/// Magic number at the beginning of the binary images of parsed documents
+#define XML_DOM_IMAGE_MAGIC "PXMLDOM"
+
+/// Version of the binary image format; it has to be increased whenever the format or the parser output changes
+#define XML_DOM_IMAGE_VERSION 1U
+
+/// Kinds of child records in a binary image
+#define XML_DOM_IMAGE_ELEMENT 0U
+#define XML_DOM_IMAGE_TEXT 1U
+
 XMLDomParser::XMLDomParser(const std::string& _name, const std::string& string_to_be_parsed)
     : name(_name), to_be_parsed(string_to_be_parsed)
 
@@ -71,3 +101,319 @@ const xml_documentRef XMLDomParser::get_document() const
 {
    return doc;
 }
+
+/// Header of a binary image
+struct xml_dom_image_header
+{
+   char magic[8];
+   uint32_t version;
+   uint32_t string_number;
+   uint64_t source_size;
+   uint64_t source_digest;
+};
+
+/// Serializer of a parsed document into a binary image
+class xml_dom_image_writer
+{
+ private:
+   /// the string table
+   std::vector<std::string> strings;
+
+   /// the index of each string in the table
+   CustomUnorderedMap<std::string, uint32_t> string_index;
+
+   /// the serialized tree
+   std::string tree;
+
+   template <typename T>
+   void write(std::string& out, const T value)
+   {
+      out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+   }
+
+   uint32_t intern(const std::string& str)
+   {
+      const auto it = string_index.find(str);
+      if(it != string_index.end())
+      {
+         return it->second;
+      }
+      const auto index = static_cast<uint32_t>(strings.size());
+      string_index.emplace(str, index);
+      strings.push_back(str);
+      return index;
+   }
+
+   void write_element(const xml_element* element)
+   {
+      write(tree, intern(element->get_name()));
+      write(tree, static_cast<int32_t>(element->get_line()));
+      const auto& attributes = element->get_attributes();
+      write(tree, static_cast<uint32_t>(attributes.size()));
+      for(const auto* attribute : attributes)
+      {
+         write(tree, intern(attribute->get_name()));
+         write(tree, intern(attribute->get_value()));
+      }
+      const auto& children = element->get_children();
+      write(tree, static_cast<uint32_t>(children.size()));
+      for(const auto& child : children)
+      {
+         if(const auto* child_element = GetPointer<const xml_element>(child))
+         {
+            write(tree, static_cast<uint8_t>(XML_DOM_IMAGE_ELEMENT));
+            write_element(child_element);
+         }
+         else
+         {
+            const auto* child_text = GetPointer<const xml_text_node>(child);
+            THROW_ASSERT(child_text, "Unexpected node kind in parsed document");
+            write(tree, static_cast<uint8_t>(XML_DOM_IMAGE_TEXT));
+            write(tree, intern(child_text->get_content()));
+         }
+      }
+   }
+
+ public:
+   std::string serialize(const xml_element* root, uint64_t source_size, uint64_t source_digest)
+   {
+      write_element(root);
+      xml_dom_image_header header{};
+      std::strncpy(header.magic, XML_DOM_IMAGE_MAGIC, sizeof(header.magic));
+      header.version = XML_DOM_IMAGE_VERSION;
+      header.string_number = static_cast<uint32_t>(strings.size());
+      header.source_size = source_size;
+      header.source_digest = source_digest;
+      std::string image(reinterpret_cast<const char*>(&header), sizeof(header));
+      for(const auto& str : strings)
+      {
+         write(image, static_cast<uint32_t>(str.size()));
+         image.append(str);
+      }
+      image.append(tree);
+      return image;
+   }
+};
+
+/// Reconstruction of a parsed document from a memory mapped binary image
+class xml_dom_image_reader
+{
+ private:
+   const char* cursor;
+   const char* const end;
+   std::vector<std::string> strings;
+
+   template <typename T>
+   bool read(T& value)
+   {
+      if(static_cast<size_t>(end - cursor) < sizeof(T))
+      {
+         return false;
+      }
+      std::memcpy(&value, cursor, sizeof(T));
+      cursor += sizeof(T);
+      return true;
+   }
+
+   bool read_string(const std::string*& str)
+   {
+      uint32_t index;
+      if(!read(index) || index >= strings.size())
+      {
+         return false;
+      }
+      str = &strings[index];
+      return true;
+   }
+
+   bool read_element(xml_element* element)
+   {
+      int32_t line;
+      uint32_t attribute_number;
+      if(!read(line) || !read(attribute_number))
+      {
+         return false;
+      }
+      element->set_line(line);
+      for(uint32_t i = 0; i < attribute_number; ++i)
+      {
+         const std::string* name;
+         const std::string* value;
+         if(!read_string(name) || !read_string(value))
+         {
+            return false;
+         }
+         element->set_attribute(*name, *value);
+      }
+      uint32_t child_number;
+      if(!read(child_number))
+      {
+         return false;
+      }
+      for(uint32_t i = 0; i < child_number; ++i)
+      {
+         uint8_t kind;
+         const std::string* str;
+         if(!read(kind) || !read_string(str))
+         {
+            return false;
+         }
+         if(kind == XML_DOM_IMAGE_ELEMENT)
+         {
+            if(!read_element(element->add_child_element(*str)))
+            {
+               return false;
+            }
+         }
+         else if(kind == XML_DOM_IMAGE_TEXT)
+         {
+            element->add_child_text(*str);
+         }
+         else
+         {
+            return false;
+         }
+      }
+      return true;
+   }
+
+ public:
+   xml_dom_image_reader(const char* begin, size_t size) : cursor(begin), end(begin + size)
+   {
+   }
+
+   /**
+    * Rebuild the document stored in the image
+    * @return the document or nullptr if the image is not valid for the given source
+    */
+   xml_documentRef deserialize(uint64_t source_size, uint64_t source_digest)
+   {
+      xml_dom_image_header header;
+      if(!read(header) || std::strncmp(header.magic, XML_DOM_IMAGE_MAGIC, sizeof(header.magic)) ||
+         header.version != XML_DOM_IMAGE_VERSION || header.source_size != source_size ||
+         header.source_digest != source_digest)
+      {
+         return xml_documentRef();
+      }
+      strings.reserve(header.string_number);
+      for(uint32_t i = 0; i < header.string_number; ++i)
+      {
+         uint32_t length;
+         if(!read(length) || static_cast<size_t>(end - cursor) < length)
+         {
+            return xml_documentRef();
+         }
+         strings.emplace_back(cursor, length);
+         cursor += length;
+      }
+      const std::string* root_name;
+      xml_documentRef doc(new xml_document());
+      if(!read_string(root_name) || !read_element(doc->create_root_node(*root_name)) || cursor != end)
+      {
+         return xml_documentRef();
+      }
+      return doc;
+   }
+};
+
+/**
+ * Compute the FNV-1a digest and the size of a file
+ * @return false if the file cannot be read
+ */
+static bool xml_file_digest(const std::string& filename, uint64_t& size, uint64_t& digest)
+{
+   std::ifstream file(filename, std::ios::binary);
+   if(!file)
+   {
+      return false;
+   }
+   digest = 0xcbf29ce484222325ULL;
+   size = 0;
+   char buffer[1 << 16];
+   while(file.read(buffer, sizeof(buffer)) || file.gcount())
+   {
+      for(std::streamsize i = 0; i < file.gcount(); ++i)
+      {
+         digest = (digest ^ static_cast<unsigned char>(buffer[i])) * 0x100000001b3ULL;
+      }
+      size += static_cast<uint64_t>(file.gcount());
+   }
+   return true;
+}
+
+void XMLDomParser::Exec(const std::string& cache_directory)
+{
+   if(name != to_be_parsed || cache_directory.empty())
+   {
+      Exec();
+      return;
+   }
+   /// Same lookup order of fileIO_istream_open
+   std::string source;
+   for(const auto& candidate : {to_be_parsed, to_be_parsed + ".gz", to_be_parsed + ".Z"})
+   {
+      if(std::filesystem::is_regular_file(candidate))
+      {
+         source = candidate;
+         break;
+      }
+   }
+   uint64_t source_size, source_digest;
+   if(source.empty() || !xml_file_digest(source, source_size, source_digest))
+   {
+      Exec();
+      return;
+   }
+   std::stringstream image_name;
+   image_name << std::hex << std::setw(16) << std::setfill('0') << source_digest << "-" << std::dec << source_size
+              << ".pxdom";
+   const auto image_path = std::filesystem::path(cache_directory) / image_name.str();
+
+   const auto fd = open(image_path.c_str(), O_RDONLY);
+   if(fd >= 0)
+   {
+      struct stat image_stat;
+      if(fstat(fd, &image_stat) == 0 && image_stat.st_size > 0)
+      {
+         const auto image_size = static_cast<size_t>(image_stat.st_size);
+         const auto mapped = mmap(nullptr, image_size, PROT_READ, MAP_PRIVATE, fd, 0);
+         if(mapped != MAP_FAILED)
+         {
+            doc = xml_dom_image_reader(static_cast<const char*>(mapped), image_size)
+                      .deserialize(source_size, source_digest);
+            munmap(mapped, image_size);
+         }
+      }
+      close(fd);
+      if(doc)
+      {
+         return;
+      }
+   }
+
+   Exec();
+   if(!doc || !doc->get_root_node())
+   {
+      return;
+   }
+   /// The image is written aside and then renamed, so that concurrent runs never see a partial image
+   std::error_code ec;
+   std::filesystem::create_directories(cache_directory, ec);
+   const auto temp_path = image_path.string() + "." + std::to_string(getpid()) + ".tmp";
+   {
+      std::ofstream image_file(temp_path, std::ios::binary);
+      const auto image = xml_dom_image_writer().serialize(doc->get_root_node(), source_size, source_digest);
+      image_file.write(image.data(), static_cast<std::streamsize>(image.size()));
+      if(!image_file)
+      {
+         image_file.close();
+         std::filesystem::remove(temp_path, ec);
+         return;
+      }
+   }
+   std::filesystem::rename(temp_path, image_path, ec);
+   if(ec)
+   {
+      std::filesystem::remove(temp_path, ec);
+   }
+}
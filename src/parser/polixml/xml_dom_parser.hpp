@@ -89,6 +89,14 @@ class XMLDomParser
     */
    void Exec();
 
+   /**
+    * Parse an XML document from a file, reusing the binary image of the document stored in cache_directory when the
+    * content of the file has not changed since the image was written. A new image is stored on a miss.
+    * Documents parsed from strings are never cached.
+    * @param cache_directory is the directory where the binary images are stored
+    */
+   void Exec(const std::string& cache_directory);
+
    /** Test whether a document has been parsed.
     */
    operator bool() const;
@@ -36,6 +36,10 @@
 
 #include "sig_variation.hpp"
 
+#include "exceptions.hpp"
+#include "string_manipulation.hpp"
+
+#include <cstring>
 #include <utility>
 
 sig_variation::sig_variation(unsigned long long ts, std::string val, unsigned long long d)
@@ -132,3 +136,152 @@ bool operator!=(const sig_variation& w, const sig_variation& v)
 {
    return w.time_stamp != v.time_stamp;
 }
+
+/// symbols that can be packed in a logic value; the position in the string is the code of the symbol
+static const char logic_symbols[] = "01xXzZuUwWlLhH-";
+
+vcd_signal_trace::const_iterator::const_iterator()
+    : trace(nullptr), index(0), decoded_index(std::numeric_limits<size_t>::max())
+{
+}
+
+vcd_signal_trace::const_iterator::const_iterator(const vcd_signal_trace* _trace, size_t _index)
+    : trace(_trace), index(_index), decoded_index(std::numeric_limits<size_t>::max())
+{
+}
+
+unsigned long long vcd_signal_trace::const_iterator::time_stamp() const
+{
+   THROW_ASSERT(trace && index < trace->size(), "dereferencing an invalid vcd cursor");
+   return trace->time_stamps[index];
+}
+
+unsigned long long vcd_signal_trace::const_iterator::duration() const
+{
+   THROW_ASSERT(trace && index < trace->size(), "dereferencing an invalid vcd cursor");
+   return trace->duration_at(index);
+}
+
+vcd_signal_trace::const_iterator::reference vcd_signal_trace::const_iterator::operator*() const
+{
+   THROW_ASSERT(trace && index < trace->size(), "dereferencing an invalid vcd cursor");
+   if(decoded_index != index)
+   {
+      current.time_stamp = trace->time_stamps[index];
+      current.value = trace->value_at(index);
+      current.duration = trace->duration_at(index);
+      decoded_index = index;
+   }
+   return current;
+}
+
+vcd_signal_trace::const_iterator::pointer vcd_signal_trace::const_iterator::operator->() const
+{
+   return &**this;
+}
+
+vcd_signal_trace::const_iterator& vcd_signal_trace::const_iterator::operator++()
+{
+   ++index;
+   return *this;
+}
+
+vcd_signal_trace::const_iterator vcd_signal_trace::const_iterator::operator++(int)
+{
+   const auto ret = *this;
+   ++index;
+   return ret;
+}
+
+vcd_signal_trace::const_iterator& vcd_signal_trace::const_iterator::operator--()
+{
+   THROW_ASSERT(index > 0, "moving a vcd cursor before the beginning of the trace");
+   --index;
+   return *this;
+}
+
+vcd_signal_trace::const_iterator vcd_signal_trace::const_iterator::operator--(int)
+{
+   const auto ret = *this;
+   --*this;
+   return ret;
+}
+
+vcd_signal_trace::vcd_signal_trace(size_t _width, bool _literal) : width(_width), literal(_literal)
+{
+}
+
+void vcd_signal_trace::add_variation(unsigned long long ts, const std::string& value)
+{
+   if(time_stamps.empty() || time_stamps.back() != ts)
+   {
+      THROW_ASSERT(time_stamps.empty() || time_stamps.back() < ts,
+                   "Variations are not being added in time order: " + STR(time_stamps.back()) + " > " + STR(ts));
+      time_stamps.push_back(ts);
+      if(literal)
+      {
+         literal_values.emplace_back();
+      }
+      else
+      {
+         packed_values.resize((time_stamps.size() * width + 1) / 2);
+      }
+   }
+   store_value(time_stamps.size() - 1, value);
+}
+
+std::string vcd_signal_trace::last_value() const
+{
+   THROW_ASSERT(!time_stamps.empty(), "empty vcd trace");
+   return value_at(time_stamps.size() - 1);
+}
+
+unsigned long long vcd_signal_trace::last_time_stamp() const
+{
+   THROW_ASSERT(!time_stamps.empty(), "empty vcd trace");
+   return time_stamps.back();
+}
+
+std::string vcd_signal_trace::value_at(size_t index) const
+{
+   if(literal)
+   {
+      return literal_values[index];
+   }
+   std::string value(width, '\0');
+   auto nibble = index * width;
+   for(auto& c : value)
+   {
+      const auto byte = packed_values[nibble / 2];
+      c = logic_symbols[(nibble % 2) ? (byte >> 4) : (byte & 0xF)];
+      ++nibble;
+   }
+   return value;
+}
+
+void vcd_signal_trace::store_value(size_t index, const std::string& value)
+{
+   if(literal)
+   {
+      literal_values[index] = value;
+      return;
+   }
+   if(value.size() != width)
+   {
+      THROW_ERROR("vcd value " + value + " does not match signal width " + STR(width));
+   }
+   auto nibble = index * width;
+   for(const auto c : value)
+   {
+      const auto symbol = c != '\0' ? std::strchr(logic_symbols, c) : nullptr;
+      if(symbol == nullptr)
+      {
+         THROW_ERROR("unexpected symbol '" + std::string(1, c) + "' in vcd value " + value);
+      }
+      const auto code = static_cast<uint8_t>(symbol - logic_symbols);
+      auto& byte = packed_values[nibble / 2];
+      byte = (nibble % 2) ? static_cast<uint8_t>((byte & 0x0F) | (code << 4)) :
+                            static_cast<uint8_t>((byte & 0xF0) | code);
+      ++nibble;
+   }
+}
@@ -37,8 +37,12 @@
 #ifndef VCD_DATA_HPP
 #define VCD_DATA_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <limits>
 #include <string>
+#include <vector>
 
 /**
  * This class models a single variation of a signal in vcd
@@ -90,4 +94,176 @@ bool operator>=(const sig_variation& w, const unsigned long long t);
 bool operator==(const sig_variation& w, const unsigned long long t);
 bool operator!=(const sig_variation& w, const unsigned long long t);
 
+/**
+ * Compact storage for the waveform of a single vcd signal.
+ * Time stamps are kept in a flat array, while the values are packed four bits per character in a second flat array,
+ * since a 4-state vcd value only needs a handful of distinct symbols. Signals whose values are not made of logic
+ * symbols (i.e. real signals) fall back to a table of strings.
+ * The waveform is accessed through bidirectional cursors which materialize a sig_variation on dereference.
+ */
+class vcd_signal_trace
+{
+ public:
+   /**
+    * Bidirectional cursor over the variations of a vcd_signal_trace.
+    * The referenced sig_variation is decoded on demand and is valid until the cursor is moved.
+    */
+   class const_iterator
+   {
+    public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type = sig_variation;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const sig_variation*;
+      using reference = const sig_variation&;
+
+      const_iterator();
+
+      const_iterator(const vcd_signal_trace* trace, size_t index);
+
+      /**
+       * @return the time stamp of the pointed variation, without decoding its value
+       */
+      unsigned long long time_stamp() const;
+
+      /**
+       * @return the duration of the pointed variation, without decoding its value
+       */
+      unsigned long long duration() const;
+
+      reference operator*() const;
+
+      pointer operator->() const;
+
+      const_iterator& operator++();
+
+      const_iterator operator++(int);
+
+      const_iterator& operator--();
+
+      const_iterator operator--(int);
+
+      bool operator==(const const_iterator& other) const
+      {
+         return index == other.index && trace == other.trace;
+      }
+
+      bool operator!=(const const_iterator& other) const
+      {
+         return !(*this == other);
+      }
+
+    private:
+      /// the trace this cursor is iterating on
+      const vcd_signal_trace* trace;
+
+      /// the position of the pointed variation in the trace
+      size_t index;
+
+      /// the position of the variation currently decoded in current
+      mutable size_t decoded_index;
+
+      /// the last decoded variation
+      mutable sig_variation current;
+   };
+
+   /**
+    * Constructor
+    * @param width is the number of characters of every value of the signal
+    * @param literal tells if the values have to be stored as plain strings instead of packed logic values
+    */
+   explicit vcd_signal_trace(size_t width = 0, bool literal = false);
+
+   /**
+    * Adds a variation at the end of the waveform. If the last variation has the same time stamp, its value is
+    * overridden, since the last variation in a simulation cycle is the one that holds.
+    * @param ts is the time stamp of the variation
+    * @param value is the new value of the signal
+    */
+   void add_variation(unsigned long long ts, const std::string& value);
+
+   /**
+    * @return the value of the last variation of the signal
+    */
+   std::string last_value() const;
+
+   /**
+    * @return the time stamp of the last variation of the signal
+    */
+   unsigned long long last_time_stamp() const;
+
+   /**
+    * @return the number of characters of every value
+    */
+   size_t get_width() const
+   {
+      return width;
+   }
+
+   size_t size() const
+   {
+      return time_stamps.size();
+   }
+
+   bool empty() const
+   {
+      return time_stamps.empty();
+   }
+
+   const_iterator begin() const
+   {
+      return const_iterator(this, 0);
+   }
+
+   const_iterator end() const
+   {
+      return const_iterator(this, time_stamps.size());
+   }
+
+   const_iterator cbegin() const
+   {
+      return begin();
+   }
+
+   const_iterator cend() const
+   {
+      return end();
+   }
+
+ private:
+   /// number of characters of every value
+   size_t width;
+
+   /// true if values are stored as strings in literal_values
+   bool literal;
+
+   /// the time stamps of the variations
+   std::vector<unsigned long long> time_stamps;
+
+   /// the values of the variations, four bits per character, width characters per variation
+   std::vector<uint8_t> packed_values;
+
+   /// the values of the variations when literal is true
+   std::vector<std::string> literal_values;
+
+   /**
+    * Decodes the value of the variation at the given position
+    */
+   std::string value_at(size_t index) const;
+
+   /**
+    * Encodes value as the value of the variation at the given position
+    */
+   void store_value(size_t index, const std::string& value);
+
+   /**
+    * @return the duration of the variation at the given position
+    */
+   unsigned long long duration_at(size_t index) const
+   {
+      return index + 1 < time_stamps.size() ? time_stamps[index + 1] - time_stamps[index] :
+                                              std::numeric_limits<unsigned long long>::max();
+   }
+};
+
 #endif
@@ -36,7 +36,7 @@
 
 // include class header
 #include "vcd_parser.hpp"
-#include <iostream>
+
 // include from ./
 #include "Parameter.hpp"
 
@@ -45,8 +45,108 @@
 #include "string_manipulation.hpp" // for GET_CLASS
 #include "structural_objects.hpp"
 
+#include <cctype>
+#include <charconv>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * Read only memory mapping of a whole file, released on destruction
+ */
+class vcd_file_mapping
+{
+ public:
+   explicit vcd_file_mapping(const std::string& filename) : data(nullptr), size(0)
+   {
+      const auto fd = open(filename.c_str(), O_RDONLY);
+      if(fd < 0)
+      {
+         THROW_ERROR("Unable to open VCD file: " + filename);
+      }
+      struct stat file_stat;
+      if(fstat(fd, &file_stat) != 0)
+      {
+         close(fd);
+         THROW_ERROR("Unable to stat VCD file: " + filename);
+      }
+      size = static_cast<size_t>(file_stat.st_size);
+      if(size)
+      {
+         const auto mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+         if(mapped == MAP_FAILED)
+         {
+            close(fd);
+            THROW_ERROR("Unable to map VCD file: " + filename);
+         }
+         /* the file is scanned only once from the beginning to the end */
+         madvise(mapped, size, MADV_SEQUENTIAL);
+         data = static_cast<const char*>(mapped);
+      }
+      close(fd);
+   }
+
+   vcd_file_mapping(const vcd_file_mapping&) = delete;
+
+   vcd_file_mapping& operator=(const vcd_file_mapping&) = delete;
+
+   ~vcd_file_mapping()
+   {
+      if(data)
+      {
+         munmap(const_cast<char*>(data), size);
+      }
+   }
+
+   const char* begin() const
+   {
+      return data;
+   }
+
+   const char* end() const
+   {
+      return data + size;
+   }
+
+ private:
+   const char* data;
+   size_t size;
+};
+
+/**
+ * Parses an unsigned integer covering the whole string
+ */
+static bool parse_unsigned(std::string_view str, unsigned int& value)
+{
+   const auto res = std::from_chars(str.data(), str.data() + str.size(), value);
+   return !str.empty() && res.ec == std::errc() && res.ptr == str.data() + str.size();
+}
+
+/**
+ * Parses a bit select of the form msb:lsb or lsb
+ */
+static bool parse_bit_select(std::string_view str, unsigned int& msb, unsigned int& lsb)
+{
+   const auto colon = str.find(':');
+   if(colon == std::string_view::npos)
+   {
+      if(!parse_unsigned(str, lsb))
+      {
+         return false;
+      }
+      msb = lsb;
+      return true;
+   }
+   return parse_unsigned(str.substr(0, colon), msb) && parse_unsigned(str.substr(colon + 1), lsb);
+}
+
 vcd_parser::vcd_parser(const ParameterConstRef& param)
-    : debug_level(param->get_class_debug_level(GET_CLASS(*this))), vcd_fp(nullptr), sig_n(0)
+    : debug_level(param->get_class_debug_level(GET_CLASS(*this))),
+      buffer_cursor(nullptr),
+      buffer_end(nullptr),
+      sig_n(0)
 {
 }
 
@@ -54,14 +154,11 @@ vcd_parser::vcd_trace_t vcd_parser::parse_vcd(const std::string& vcd_file_to_par
                                               const vcd_filter_t& selected_signals)
 {
    // ---- initialization ----
-   // open file
+   // map file
    INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "-->Opening VCD file to parse: " + vcd_file_to_parse);
-   vcd_fp = nullptr;
-   vcd_fp = fopen(vcd_file_to_parse.c_str(), "r");
-   if(vcd_fp == nullptr)
-   {
-      THROW_ERROR("Unable to open VCD file: " + vcd_file_to_parse);
-   }
+   const vcd_file_mapping vcd_file(vcd_file_to_parse);
+   buffer_cursor = vcd_file.begin();
+   buffer_end = vcd_file.end();
    INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "<--Opened VCD file to parse: " + vcd_file_to_parse);
    // initialize member file name
    vcd_filename = vcd_file_to_parse;
@@ -98,41 +195,43 @@ vcd_parser::vcd_trace_t vcd_parser::parse_vcd(const std::string& vcd_file_to_par
                   "Number of selected signals: " + STR(scope_and_name_to_sig_info.size()) + "/" + STR(sig_n));
    // ---- cleanup ----
    INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "-->Cleaning up VCD parser");
-   fclose(vcd_fp);
+   buffer_cursor = nullptr;
+   buffer_end = nullptr;
    filtered_signals.clear();
    vcd_filename.clear();
    scope_and_name_to_sig_info.clear();
    vcd_id_to_scope_and_name.clear();
+   vcd_id_to_index.clear();
+   index_to_targets.clear();
    INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "<--Cleaned up VCD parser");
    return std::move(parse_result);
 }
 
+std::string_view vcd_parser::next_token()
+{
+   while(buffer_cursor != buffer_end && std::isspace(static_cast<unsigned char>(*buffer_cursor)))
+   {
+      ++buffer_cursor;
+   }
+   const auto token_begin = buffer_cursor;
+   while(buffer_cursor != buffer_end && !std::isspace(static_cast<unsigned char>(*buffer_cursor)))
+   {
+      ++buffer_cursor;
+   }
+   return std::string_view(token_begin, static_cast<size_t>(buffer_cursor - token_begin));
+}
+
 /**
  * Parses specified file until $end keyword is seen, ignoring all text inbetween.
  */
 int vcd_parser::vcd_parse_skip_to_end()
 {
-   char token[256];     /* String value of current token */
-   int chars_read = -1; /* Number of characters scanned in */
-
-   while(fscanf(vcd_fp, "%255s%n", token, &chars_read) != EOF)
+   for(auto token = next_token(); !token.empty(); token = next_token())
    {
-      if(chars_read < 0)
-      {
-         continue;
-      }
-
-      if(chars_read > 256)
-      {
-         THROW_ERROR("buffer overflow. read token too long");
-      }
-
-      if(strncmp("$end", token, 4) == 0)
+      if(token.substr(0, 4) == "$end")
       {
          return 0;
       }
-
-      chars_read = -1;
    }
    return -1;
 }
@@ -142,126 +241,85 @@ int vcd_parser::vcd_parse_skip_to_end()
  */
 int vcd_parser::vcd_parse_def_var(const std::string& scope)
 {
-   char type[256];       /* Variable type */
-   unsigned int size;    /* Bit width of specified variable */
-   char id_code[256];    /* Unique variable identifier_code */
-   char ref[256];        /* Name of variable in design */
-   char tmp[15];         /* Temporary string holder */
-   unsigned int msb = 0; /* Most significant bit */
-   unsigned int lsb = 0; /* Least significant bit */
-
-   if(fscanf(vcd_fp, "%255s %u %255s %255s %14s", type, &size, id_code, ref, tmp) == 5)
+   const auto type = next_token();     /* Variable type */
+   const auto size_str = next_token(); /* Bit width of specified variable */
+   const auto id_code = next_token();  /* Unique variable identifier_code */
+   auto ref = next_token();            /* Name of variable in design */
+   const auto tmp = next_token();      /* Temporary string holder */
+   unsigned int size = 0;              /* Bit width of specified variable */
+   unsigned int msb = 0;               /* Most significant bit */
+   unsigned int lsb = 0;               /* Least significant bit */
+
+   if(type.empty() || !parse_unsigned(size_str, size) || id_code.empty() || ref.empty() || tmp.empty())
    {
-      bool isvect = false; /* check if the signal is a vector */
-      /* Make sure that we have not exceeded array boundaries */
-      if(strlen(type) > 256)
-      {
-         THROW_ERROR("Overflow. Read token too long (type var)");
-      }
-
-      if(strlen(ref) > 256)
-      {
-         THROW_ERROR("Overflow. Read token too long (name var)");
-      }
-
-      if(strlen(tmp) > 15)
+      THROW_ERROR("Unrecognized $var format");
+   }
+   bool isvect = false; /* check if the signal is a vector */
+   if(type.substr(0, 4) == "real")
+   {
+      msb = 63;
+      lsb = 0;
+      isvect = true;
+   }
+   else if(tmp.substr(0, 4) != "$end")
+   {
+      /* A bit select was specified for this signal, get the size */
+      if(tmp.size() < 3 || tmp.front() != '[' || tmp.back() != ']' ||
+         !parse_bit_select(tmp.substr(1, tmp.size() - 2), msb, lsb))
       {
-         THROW_ERROR("Overflow. Read token too long ($end token)");
+         THROW_ERROR("Unrecognized $var format");
       }
+      isvect = true;
 
-      if(strlen(id_code) > 256)
+      if(next_token().substr(0, 4) != "$end")
       {
-         THROW_ERROR("Overflow. Read token too long (id_code)");
+         THROW_ERROR("Unrecognized $var format");
       }
-
-      if(strncmp("real", type, 4) == 0)
+   }
+   else
+   {
+      const auto select_begin =
+          ref.find_first_not_of("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_");
+      if(select_begin != std::string_view::npos && select_begin > 0 && ref[select_begin] == '[' &&
+         select_begin + 1 < ref.size())
       {
-         msb = 63;
-         lsb = 0;
+         auto select = ref.substr(select_begin + 1);
+         if(select.back() == ']')
+         {
+            select.remove_suffix(1);
+         }
+         if(!parse_bit_select(select, msb, lsb))
+         {
+            THROW_ERROR("Unrecognized $var format");
+         }
+         ref = ref.substr(0, select_begin);
          isvect = true;
       }
       else
       {
-         char reftmp[256]; /* Temporary variable name */
-         if(strncmp("$end", tmp, 4) != 0)
+         msb = size - 1;
+         lsb = 0;
+         /* this is the case of signal (like integer) that are defined in the VCD in the same way of bit but they are
+          * arrays */
+         if(msb > 0)
          {
-            /* A bit select was specified for this signal, get the size */
-            if(sscanf(tmp, "[%u:%u]", &msb, &lsb) != 2)
-            {
-               if(sscanf(tmp, "[%u]", &lsb) != 1)
-               {
-                  THROW_ERROR("Unrecognized $var format");
-               }
-               else
-               {
-                  msb = lsb;
-               }
-            }
             isvect = true;
-
-            if((fscanf(vcd_fp, "%14s", tmp) != 1) || (strncmp("$end", tmp, 4) != 0))
-            {
-               THROW_ERROR("Unrecognized $var format");
-            }
-         }
-         else if(sscanf(ref, "%*[a-zA-Z0-9_][%*s].") == 2)
-         {
-            /* This is a hierarchical reference so we shouldn't modify ref -- quirky behavior from VCS */
-            msb = size - 1;
-            lsb = 0;
-            /* this is the case of signal (like integer) that are defined in the VCD in the same way of bit but they are
-             * arrays */
-            if(msb > 0)
-            {
-               isvect = true;
-            }
-         }
-         else if(sscanf(ref, "%255[a-zA-Z0-9_][%14s]", reftmp, tmp) == 2)
-         {
-            strcpy(ref, reftmp);
-
-            if(sscanf(tmp, "%u:%u", &msb, &lsb) != 2)
-            {
-               if(sscanf(tmp, "%u", &lsb) != 1)
-               {
-                  THROW_ERROR("Unrecognized $var format");
-               }
-               else
-               {
-                  msb = lsb;
-               }
-            }
-            isvect = true;
-         }
-         else
-         {
-            msb = size - 1;
-            lsb = 0;
-            /* this is the case of signal (like integer) that are defined in the VCD in the same way of bit but they are
-             * arrays */
-            if(msb > 0)
-            {
-               isvect = true;
-            }
          }
       }
+   }
 
-      sig_n++;
+   sig_n++;
 
-      /* if check fails do nothing: this signal is useless */
-      if(!check_filter_list(scope, ref))
-      {
-         PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Filtered SIGNAL: " + scope + ref);
-         return 0;
-      }
-      PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "SELECTED SIGNAL: " + scope + ref);
-
-      vcd_add_signal(scope, ref, id_code, type, isvect, msb, lsb);
-   }
-   else
+   const std::string name(ref);
+   /* if check fails do nothing: this signal is useless */
+   if(!check_filter_list(scope, name))
    {
-      THROW_ERROR("Unrecognized $var format");
+      PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Filtered SIGNAL: " + scope + name);
+      return 0;
    }
+   PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "SELECTED SIGNAL: " + scope + name);
+
+   vcd_add_signal(scope, name, std::string(id_code), std::string(type), isvect, msb, lsb);
    return 0;
 }
 
@@ -270,49 +328,36 @@ int vcd_parser::vcd_parse_def_var(const std::string& scope)
  */
 void vcd_parser::vcd_push_def_scope(std::stack<std::string>& scope)
 {
-   char new_scope[256]; /* scope name */
-
-   if(fscanf(vcd_fp, " %*s %255s $end ", new_scope) == 1)
+   const auto scope_type = next_token();
+   const auto new_scope = next_token(); /* scope name */
+   if(scope_type.empty() || new_scope.empty())
    {
-      /* Make sure that we have not exceeded any array boundaries */
-      if(strlen(new_scope) > 256)
-      {
-         THROW_ERROR("Overflow. Read token too long.");
-      }
+      THROW_ERROR("Unrecognized $scope format");
    }
-   else
+   /* the closing $end is optional */
+   const auto after_scope = buffer_cursor;
+   if(next_token() != "$end")
    {
-      THROW_ERROR("Unrecognized $scope format");
+      buffer_cursor = after_scope;
    }
-   scope.push(scope.top() + new_scope + STR(HIERARCHY_SEPARATOR));
+   scope.push(scope.top() + std::string(new_scope) + STR(HIERARCHY_SEPARATOR));
    PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "NEW_SCOPE: " + scope.top());
    return;
 }
 
 void vcd_parser::vcd_pop_def_scope(std::stack<std::string>& scope)
 {
-   char token[256];
-
-   if(fscanf(vcd_fp, " %255s ", token) == 1)
+   const auto token = next_token();
+   if(token.empty())
    {
-      /* Make sure that we have not exceeded any array boundaries */
-      if(strlen(token) > 256)
-      {
-         THROW_ERROR("Overflow. Read token too long");
-      }
-
-      if(strncmp(token, "$end", 4) == 0)
-      {
-         scope.pop();
-         PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "UP_SCOPE: " + scope.top());
-         return;
-      }
-      else
-      {
-         THROW_ERROR("missing $end after $upscope token");
-      }
+      THROW_ERROR("Unrecognized $upscope format");
+   }
+   if(token.substr(0, 4) != "$end")
+   {
+      THROW_ERROR("missing $end after $upscope token");
    }
-   THROW_ERROR("Unrecognized $upscope format");
+   scope.pop();
+   PRINT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "UP_SCOPE: " + scope.top());
 }
 
 /*
@@ -329,32 +374,31 @@ int vcd_parser::vcd_parse_def()
    scope.push("");
 
    bool enddef_found = false; /* If set to true, definition section is finished */
-   char keyword[256];         /* Holds keyword value */
-   int chars_read;            /* Number of characters scanned in */
 
-   while(!enddef_found && (fscanf(vcd_fp, "%255s%n", keyword, &chars_read) == 1))
+   while(!enddef_found)
    {
-      if(chars_read > 256)
+      const auto keyword = next_token();
+      if(keyword.empty())
       {
-         THROW_ERROR("Overflow. Read token too long");
+         break;
       }
 
       /* check the token and chose the right action */
       if(keyword[0] == '$')
       {
-         if(strncmp("var", (keyword + 1), 3) == 0)
+         if(keyword.substr(1, 3) == "var")
          {
             vcd_parse_def_var(scope.top());
          }
-         else if(strncmp("scope", (keyword + 1), 5) == 0)
+         else if(keyword.substr(1, 5) == "scope")
          {
             vcd_push_def_scope(scope);
          }
-         else if(strncmp("upscope", (keyword + 1), 7) == 0)
+         else if(keyword.substr(1, 7) == "upscope")
          {
             vcd_pop_def_scope(scope);
          }
-         else if(strncmp("enddefinitions", (keyword + 1), 14) == 0)
+         else if(keyword.substr(1, 14) == "enddefinitions")
          {
             enddef_found = true;
             if(vcd_parse_skip_to_end())
@@ -369,7 +413,7 @@ int vcd_parser::vcd_parse_def()
       }
       else
       {
-         THROW_ERROR("undefined token '" + STR(keyword) + "' in parsed vcd file: " + vcd_filename);
+         THROW_ERROR("undefined token '" + std::string(keyword) + "' in parsed vcd file: " + vcd_filename);
       }
    }
 
@@ -387,53 +431,17 @@ int vcd_parser::vcd_parse_def()
 }
 
 /**
- * Reads the next token from the file and calls the appropriate fuction
- */
-int vcd_parser::vcd_parse_sim_vector(char* value, unsigned long timestamp)
-{
-   char sym[256];  /* String value of signal symbol */
-   int chars_read; /* Number of characters scanned in */
-
-   if(fscanf(vcd_fp, "%255s%n", sym, &chars_read) == 1)
-   {
-      if(chars_read > 256)
-      {
-         THROW_ERROR("Overflow. Read token too long");
-      }
-
-      /* add variation to signal list -> normal vector */
-      add_variation(sym, value, timestamp);
-   }
-   else
-   {
-      THROW_ERROR("Bad file format");
-   }
-
-   return 0;
-}
-
-/**
- * Reads the next token from the file and calls the appropriate function
+ * Reads the signal identifier following a vector or real value and records the variation
  */
-int vcd_parser::vcd_parse_sim_real(char* value, unsigned long timestamp)
+int vcd_parser::vcd_parse_sim_vector(std::string_view value, unsigned long long timestamp)
 {
-   char sym[256];  /* String value of signal symbol */
-   int chars_read; /* Number of characters scanned in */
-
-   if(fscanf(vcd_fp, "%255s%n", sym, &chars_read) == 1)
-   {
-      if(chars_read > 256)
-      {
-         THROW_ERROR("Overflow. Read token too long");
-      }
-
-      /* add variation to signal list */
-      add_variation(sym, value, timestamp);
-   }
-   else
+   const auto sym = next_token(); /* String value of signal symbol */
+   if(sym.empty())
    {
       THROW_ERROR("Bad file format");
    }
+   /* add variation to signal list -> normal vector */
+   add_variation(sym, value, timestamp);
    return 0;
 }
 
@@ -442,65 +450,47 @@ int vcd_parser::vcd_parse_sim_real(char* value, unsigned long timestamp)
  */
 int vcd_parser::vcd_parse_sim()
 {
-   char token[4100];                /* Current token from VCD file */
-   unsigned long last_timestep = 0; /* Value of last timestamp from file */
-   int chars_read;                  /* Number of characters scanned in */
-   bool carry_over = false;         /* Specifies if last string was too long */
+   unsigned long long last_timestep = 0; /* Value of last timestamp from file */
 
    // initialize the waveforms
    init_variations();
-   while(!feof(vcd_fp) && (fscanf(vcd_fp, "%4099s%n", token, &chars_read) == 1))
+   for(auto token = next_token(); !token.empty(); token = next_token())
    {
-      if(chars_read < 4099)
+      if(token[0] == '$')
       {
-         if(token[0] == '$')
+         /* Maybe could be a comment area */
+         if(token.substr(1, 7) == "comment")
          {
-            /* Maybe could be a comment area */
-            if(strncmp("comment", (token + 1), 7) == 0)
-            {
-               if(vcd_parse_skip_to_end())
-               {
-                  THROW_ERROR("missing $end token in parsed vcd file: " + vcd_filename);
-               }
-            }
-         }
-         else if((token[0] == 'b') || (token[0] == 'B'))
-         {
-            if(vcd_parse_sim_vector((token + 1), last_timestep))
-            {
-               THROW_ERROR("can't parse binary value change for signal: " + STR(token));
-            }
-         }
-         else if((token[0] == 'r') || (token[0] == 'R') || carry_over)
-         {
-            if(vcd_parse_sim_real((token + 1), last_timestep))
+            if(vcd_parse_skip_to_end())
             {
-               THROW_ERROR("can't parse real value change for signal: " + STR(token));
+               THROW_ERROR("missing $end token in parsed vcd file: " + vcd_filename);
             }
-            carry_over = false;
          }
-         else if(token[0] == '#')
-         {
-            last_timestep = std::stoul(token + 1, nullptr, 10);
-         }
-         else if((token[0] == '0') || (token[0] == '1') || (token[0] == 'x') || (token[0] == 'X') ||
-                 (token[0] == 'z') || (token[0] == 'Z'))
+      }
+      else if((token[0] == 'b') || (token[0] == 'B') || (token[0] == 'r') || (token[0] == 'R'))
+      {
+         if(vcd_parse_sim_vector(token.substr(1), last_timestep))
          {
-            /* normal signal -> add to vector */
-            char tmp[2];
-            tmp[0] = token[0];
-            tmp[1] = '\0';
-
-            add_variation(token + 1, tmp, last_timestep);
+            THROW_ERROR("can't parse value change for signal: " + std::string(token));
          }
-         else
+      }
+      else if(token[0] == '#')
+      {
+         const auto res = std::from_chars(token.data() + 1, token.data() + token.size(), last_timestep);
+         if(res.ec != std::errc())
          {
-            THROW_ERROR("Badly placed token in simulation part");
+            THROW_ERROR("Bad time stamp " + std::string(token) + " in parsed vcd file: " + vcd_filename);
          }
       }
+      else if((token[0] == '0') || (token[0] == '1') || (token[0] == 'x') || (token[0] == 'X') || (token[0] == 'z') ||
+              (token[0] == 'Z'))
+      {
+         /* normal signal -> add to vector */
+         add_variation(token.substr(1), token.substr(0, 1), last_timestep);
+      }
       else
       {
-         carry_over = true;
+         THROW_ERROR("Badly placed token in simulation part");
       }
    }
 
@@ -536,7 +526,7 @@ void vcd_parser::vcd_add_signal(const std::string& scope, const std::string& nam
       scope_and_name_to_sig_info.insert(std::make_pair(key, vcd_sig_info(type, isvect, msb, lsb)));
       scope_and_name_to_sig_info.at(key).vcd_id_to_bit[vcd_id] = lsb;
       vcd_id_to_scope_and_name[vcd_id].insert(key);
-      parse_result.at(scope)[name] = std::list<sig_variation>();
+      parse_result.at(scope)[name];
    }
    else
    { // some bits of the signal have already been declared
@@ -576,50 +566,60 @@ bool vcd_parser::check_signals() const
 
 void vcd_parser::init_variations()
 {
+   for(const auto& si : scope_and_name_to_sig_info)
+   {
+      const vcd_sig_info& siginfo = si.second;
+      const auto width = siginfo.msb - siginfo.lsb + 1;
+      vcd_signal_trace& vars = parse_result.at(si.first.first).at(si.first.second);
+      vars = vcd_signal_trace(width, siginfo.type.substr(0, 4) == "real");
+      vars.add_variation(0, std::string(width, 'x'));
+   }
+   /* intern the selected vcd ids, so that the simulation part does not look up signals by name */
+   vcd_id_to_index.reserve(vcd_id_to_scope_and_name.size());
+   index_to_targets.reserve(vcd_id_to_scope_and_name.size());
    for(const auto& vcd2sn : vcd_id_to_scope_and_name)
    {
+      vcd_id_to_index.emplace(vcd2sn.first, index_to_targets.size());
+      auto& targets = index_to_targets.emplace_back();
       for(const auto& sn : vcd2sn.second)
       {
          const vcd_sig_info& siginfo = scope_and_name_to_sig_info.at(sn);
-         std::list<sig_variation>& vars = parse_result.at(sn.first).at(sn.second);
-         vars.emplace_back(0, std::string(siginfo.msb - siginfo.lsb + 1, 'x'));
+         THROW_ASSERT(!siginfo.vcd_id_to_bit.empty(),
+                      "signal " + sn.first + STR(HIERARCHY_SEPARATOR) + sn.second + " has no mapped vcd_id");
+         THROW_ASSERT(siginfo.vcd_id_to_bit.find(vcd2sn.first) != siginfo.vcd_id_to_bit.end(),
+                      "vcd id " + vcd2sn.first + " is not assigned to any bit of port" + sn.first +
+                          STR(HIERARCHY_SEPARATOR) + sn.second);
+         targets.push_back({&parse_result.at(sn.first).at(sn.second), siginfo.vcd_id_to_bit.size() > 1,
+                            siginfo.vcd_id_to_bit.at(vcd2sn.first)});
       }
    }
 }
 
-void vcd_parser::add_variation(const std::string& sig_id, const std::string& value, unsigned long long ts)
+void vcd_parser::add_variation(std::string_view sig_id, std::string_view value, unsigned long long ts)
 {
-   THROW_ASSERT(!value.empty(), "trying to add an empty variation for vcd id " + sig_id + " at time " + STR(ts));
+   THROW_ASSERT(!value.empty(), "trying to add an empty variation for vcd id " + std::string(sig_id) + " at time " +
+                                    STR(ts));
    THROW_ASSERT(!sig_id.empty(), "adding a variation to unspecified vcd signal");
-   auto it = vcd_id_to_scope_and_name.find(sig_id);
-   if(it != vcd_id_to_scope_and_name.end())
+   /* heterogeneous lookup: the string keyed abseil map hashes the view without copying it */
+   const auto it = vcd_id_to_index.find(sig_id);
+   if(it != vcd_id_to_index.end())
    {
-      for(const auto& sn : it->second)
+      for(const auto& target : index_to_targets[it->second])
       {
-         const vcd_sig_info& siginfo = scope_and_name_to_sig_info.at(sn);
-         std::list<sig_variation>& vars = parse_result.at(sn.first).at(sn.second);
-         THROW_ASSERT(vars.back().time_stamp <= ts, "Variations are not being added in time order: id = '" + sig_id +
-                                                        "', ts = " + STR(vars.back().time_stamp) + " > " + STR(ts));
-         THROW_ASSERT(!siginfo.vcd_id_to_bit.empty(),
-                      "signal " + sn.first + STR(HIERARCHY_SEPARATOR) + sn.second + " has no mapped vcd_id");
+         vcd_signal_trace& vars = *target.trace;
          /* prepare the new value for variation to insert */
          std::string new_value;
-         if(siginfo.vcd_id_to_bit.size() > 1)
+         if(target.is_bit)
          {
             /*
              * the signal is a port vector with a separate id for every bit,
              * so we must keep all the previous bits and change only the new
              */
             THROW_ASSERT(value.size() == 1, "variation of a bit is larger than a bit");
-            new_value = std::string(vars.back().value);
-            THROW_ASSERT(siginfo.vcd_id_to_bit.find(sig_id) != siginfo.vcd_id_to_bit.end(),
-                         "vcd id " + sig_id + " is not assigned to any bit of port" + sn.first +
-                             STR(HIERARCHY_SEPARATOR) + sn.second);
-            size_t idx = siginfo.vcd_id_to_bit.at(sig_id);
-            THROW_ASSERT(idx < new_value.size(), "vcd_id " + sig_id + " for signal " + sn.first +
-                                                     STR(HIERARCHY_SEPARATOR) + sn.second +
-                                                     " is mapped to a bit higher than port size");
-            new_value.at(new_value.size() - idx - 1) = value.front();
+            new_value = vars.last_value();
+            THROW_ASSERT(target.bit < new_value.size(),
+                         "vcd_id " + std::string(sig_id) + " is mapped to a bit higher than port size");
+            new_value.at(new_value.size() - target.bit - 1) = value.front();
          }
          else
          {
@@ -629,36 +629,23 @@ void vcd_parser::add_variation(const std::string& sig_id, const std::string& val
              */
             new_value = value;
             /* check bit extension */
-            if((siginfo.msb - siginfo.lsb + 1) > value.size())
+            if(vars.get_width() > value.size())
             {
-               char leading = *new_value.begin();
+               const char leading = new_value.front();
                char to_prepend = '0';
                if(leading != '0' && leading != '1')
                {
                   to_prepend = leading;
                }
-               while(new_value.size() < (siginfo.msb - siginfo.lsb + 1))
-               {
-                  new_value.insert(0, 1, to_prepend);
-               }
+               new_value.insert(0, vars.get_width() - value.size(), to_prepend);
             }
          }
-
-         if(vars.back().time_stamp == ts)
-         {
-            /*
-             * another variation for this signal was already added in this
-             * cycle. this can happen, especially in vcds produced by event
-             * based simulators. in this case the last variation must
-             * override the others
-             */
-            vars.back().value = new_value;
-         }
-         else
-         {
-            vars.back().duration = ts - vars.back().time_stamp;
-            vars.emplace_back(ts, new_value);
-         }
+         /*
+          * if another variation for this signal was already added in this
+          * cycle, the last variation overrides the others. this can happen,
+          * especially in vcds produced by event based simulators
+          */
+         vars.add_variation(ts, new_value);
       }
    }
 }
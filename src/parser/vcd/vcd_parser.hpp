@@ -38,10 +38,11 @@
 #define VCD_PARSER_HPP
 
 // include from STL
-#include <list>
 #include <stack>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "custom_map.hpp"
 #include "custom_set.hpp"
@@ -104,9 +105,9 @@ class vcd_parser
     * this type is the result of a parse.
     * the primary key is the scope.
     * the secondary key is the name of the signal.
-    * the value type is std::list of sig_variation representing the waveform
+    * the value type is the compact vcd_signal_trace representing the waveform
     */
-   using vcd_trace_t = UnorderedMapStd<std::string, CustomUnorderedMapStable<std::string, std::list<sig_variation>>>;
+   using vcd_trace_t = UnorderedMapStd<std::string, CustomUnorderedMapStable<std::string, vcd_signal_trace>>;
 
    /**
     * parses a file selecting only a predefined set of signals.
@@ -131,9 +132,14 @@ class vcd_parser
    std::string vcd_filename;
 
    /**
-    * file pointer to the vcd file to parse
+    * current position in the memory mapped vcd file
     */
-   FILE* vcd_fp;
+   const char* buffer_cursor;
+
+   /**
+    * end of the memory mapped vcd file
+    */
+   const char* buffer_end;
 
    /**
     * total number of signals in the vcd file
@@ -164,6 +170,33 @@ class vcd_parser
     */
    std::map<std::string, CustomUnorderedSet<std::pair<std::string, std::string>>> vcd_id_to_scope_and_name;
 
+   /**
+    * a selected signal affected by the variations of a vcd id
+    */
+   struct vcd_id_target
+   {
+      /// the waveform of the signal
+      vcd_signal_trace* trace;
+      /// true if the vcd id drives a single bit of the signal
+      bool is_bit;
+      /// the bit driven by the vcd id. valid only if is_bit == true
+      size_t bit;
+   };
+
+   /**
+    * maps every selected vcd id to the integer used to identify it during the simulation part;
+    * the default abseil string hash is transparent, so it can be searched with the std::string_view tokens
+    */
+   CustomUnorderedMap<std::string, size_t> vcd_id_to_index;
+
+   /**
+    * for every interned vcd id, the signals affected by its variations
+    */
+   std::vector<std::vector<vcd_id_target>> index_to_targets;
+
+   /* Returns the next whitespace separated token in the file, or an empty token at the end of the file */
+   std::string_view next_token();
+
    /* Parses the simulation part in the vcd_file */
    int vcd_parse_sim();
 
@@ -180,11 +213,8 @@ class vcd_parser
 
    void vcd_pop_def_scope(std::stack<std::string>& scope);
 
-   /* Parses vector in simulation part */
-   int vcd_parse_sim_vector(char* value, unsigned long timestamp);
-
-   /* Parses real in sumlation part (actually unused)*/
-   int vcd_parse_sim_real(char* value, unsigned long timestamp);
+   /* Parses vector or real in simulation part */
+   int vcd_parse_sim_vector(std::string_view value, unsigned long long timestamp);
 
    /**
     * Checks if a signal is to be monitored
@@ -221,6 +251,6 @@ class vcd_parser
    void init_variations();
 
    /* add the parsed variation to the proper signal */
-   void add_variation(const std::string& id, const std::string& value, unsigned long long ts);
+   void add_variation(std::string_view id, std::string_view value, unsigned long long ts);
 };
 #endif
@@ -253,7 +253,7 @@ int main(int argc, char* argv[])
                 new TechnologyFlowStepFactory(TM, device, design_flow_manager, parameters));
             design_flow_manager->RegisterFactory(technology_flow_step_factory);
 
-            const std::string load_technology_flow_signature =
+            const auto load_technology_flow_signature =
                 TechnologyFlowStep::ComputeSignature(TechnologyFlowStep_Type::LOAD_DEVICE_TECHNOLOGY);
             const vertex load_technology_flow_step =
                 design_flow_manager->GetDesignFlowStep(load_technology_flow_signature);
@@ -264,7 +264,7 @@ int main(int argc, char* argv[])
                         ->CreateTechnologyFlowStep(TechnologyFlowStep_Type::LOAD_DEVICE_TECHNOLOGY);
             design_flow_manager->AddStep(load_technology_design_flow_step);
 
-            const std::string fix_technology_flow_signature =
+            const auto fix_technology_flow_signature =
                 TechnologyFlowStep::ComputeSignature(TechnologyFlowStep_Type::FIX_CHARACTERIZATION);
             const vertex fix_technology_flow_step =
                 design_flow_manager->GetDesignFlowStep(fix_technology_flow_signature);
@@ -275,7 +275,7 @@ int main(int argc, char* argv[])
                         ->CreateTechnologyFlowStep(TechnologyFlowStep_Type::FIX_CHARACTERIZATION);
             design_flow_manager->AddStep(fix_technology_design_flow_step);
 
-            const std::string technology_flow_signature =
+            const auto technology_flow_signature =
                 TechnologyFlowStep::ComputeSignature(TechnologyFlowStep_Type::WRITE_TECHNOLOGY);
             const vertex technology_flow_step = design_flow_manager->GetDesignFlowStep(technology_flow_signature);
             const DesignFlowStepRef technology_design_flow_step =
@@ -308,7 +308,7 @@ int main(int argc, char* argv[])
                 new ToDataFileStepFactory(device, design_flow_manager, parameters));
             design_flow_manager->RegisterFactory(to_data_file_step_factory);
 
-            const std::string to_data_file_step_signature =
+            const auto to_data_file_step_signature =
                 ToDataFileStep::ComputeSignature(ToDataFileStep_Type::GENERATE_FU_LIST);
             const vertex to_data_file_vertex = design_flow_manager->GetDesignFlowStep(to_data_file_step_signature);
             const DesignFlowStepRef to_data_file_step =
@@ -726,9 +726,9 @@ bool RTLCharacterization::HasToBeExecuted() const
    return true;
 }
 
-std::string RTLCharacterization::GetSignature() const
+DesignFlowStep::signature_t RTLCharacterization::GetSignature() const
 {
-   return "RTLCharacterization";
+   return ComputeSignature(RTL_CHARACTERIZATION, 0, 0);
 }
 
 std::string RTLCharacterization::GetName() const
@@ -745,8 +745,8 @@ void RTLCharacterization::ComputeRelationships(DesignFlowStepSet& relationship,
       {
          const DesignFlowGraphConstRef design_flow_graph = design_flow_manager.lock()->CGetDesignFlowGraph();
          const auto* technology_flow_step_factory = GetPointer<const TechnologyFlowStepFactory>(
-             design_flow_manager.lock()->CGetDesignFlowStepFactory("Technology"));
-         const std::string technology_flow_signature =
+             design_flow_manager.lock()->CGetDesignFlowStepFactory(DesignFlowStep::TECHNOLOGY));
+         const auto technology_flow_signature =
              TechnologyFlowStep::ComputeSignature(TechnologyFlowStep_Type::LOAD_TECHNOLOGY);
          const vertex technology_flow_step = design_flow_manager.lock()->GetDesignFlowStep(technology_flow_signature);
          const DesignFlowStepRef technology_design_flow_step =
@@ -208,9 +208,11 @@ void generic_device::load_devices()
          return ret;
       }();
 
+      const auto technology_cache =
+          Param->isOption(OPT_technology_cache) ? Param->getOption<std::string>(OPT_technology_cache) : "";
       for(const auto& parser : parsers)
       {
-         parser->Exec();
+         parser->Exec(technology_cache);
          if(parser and *parser)
          {
             const xml_element* node = parser->get_document()->get_root_node(); // deleted by DomParser.
@@ -56,7 +56,7 @@ void read_technology_File(const std::string& fn, const technology_managerRef& TM
    try
    {
       XMLDomParser parser(fn);
-      parser.Exec();
+      parser.Exec(Param->isOption(OPT_technology_cache) ? Param->getOption<std::string>(OPT_technology_cache) : "");
       if(parser)
       {
          // Walk the tree:
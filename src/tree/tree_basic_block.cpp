@@ -205,6 +205,8 @@ void bloc::manageCallGraph(const application_managerRef& AppM, const tree_nodeRe
       const auto cg_man = AppM->GetCallGraphManager();
       THROW_ASSERT(cg_man, "");
       THROW_ASSERT(GetPointerS<const gimple_node>(GET_NODE(statement))->scpe, "statement " + statement->ToString());
+      /// the call graph is shared by the function-local steps executed concurrently
+      const auto lock = AppM->get_tree_manager()->LockNodes();
       unsigned int called_function_id;
       if(check_function_call(statement, ga, called_function_id))
       {
@@ -429,6 +431,8 @@ void bloc::RemoveStmt(const tree_nodeRef statement, const application_managerRef
    {
       const auto cg_man = AppM->GetCallGraphManager();
       THROW_ASSERT(cg_man, "");
+      /// the call graph is shared by the function-local steps executed concurrently
+      const auto lock = AppM->get_tree_manager()->LockNodes();
       unsigned int called_function_id;
       if(check_function_call(statement, ga, called_function_id))
       {
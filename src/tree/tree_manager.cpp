@@ -51,11 +51,12 @@
 #include "exceptions.hpp"          // for THROW_ASSERT, THROW...
 #include "string_manipulation.hpp" // for STR GET_CLASS
 #include "tree_manager.hpp"
-#include <cstring>  // for strlen, size_t
-#include <fstream>  // for operator<<, basic_o...
-#include <iostream> // for operator<<, basic_o...
-#include <list>     // for list
-#include <vector>   // for vector, allocator
+#include <algorithm> // for find, remove_if
+#include <cstring>   // for strlen, size_t
+#include <fstream>   // for operator<<, basic_o...
+#include <iostream>  // for operator<<, basic_o...
+#include <list>      // for list
+#include <vector>    // for vector, allocator
 #if !HAVE_HEXFLOAT
 #include <cstdio>
 #endif
@@ -84,8 +85,31 @@
 #include "dbgPrintHelper.hpp"
 #include "utility.hpp"
 
+#include <boost/functional/hash/hash.hpp>
+
+/**
+ * Compute the structural hash of a tree node kind and of the values of a subset of its fields
+ */
+static size_t SchemaHash(enum kind tree_node_type,
+                         const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>& tree_node_schema)
+{
+   size_t hash_value = 0;
+   boost::hash_combine(hash_value, static_cast<int>(tree_node_type));
+   for(const auto& field : tree_node_schema)
+   {
+      boost::hash_combine(hash_value, static_cast<int>(field.first));
+      boost::hash_combine(hash_value, field.second);
+   }
+   return hash_value;
+}
+
 tree_manager::tree_manager(const ParameterConstRef& _Param)
-    : n_pl(0),
+    : find_index(),
+      find_index_pending(),
+      find_hits(0),
+      find_index_builds(0),
+      find_misses(0),
+      n_pl(0),
       added_goto(0),
       removed_pointer_plus(0),
       removable_pointer_plus(0),
@@ -94,12 +118,21 @@ tree_manager::tree_manager(const ParameterConstRef& _Param)
       last_node_id(1),
       Param(_Param),
       next_vers(0),
-      collapse_into_counter(0)
+      collapse_into_counter(0),
+      concurrent_access((_Param->isOption(OPT_frontend_function_jobs) and
+                         _Param->getOption<size_t>(OPT_frontend_function_jobs) > 1) or
+                        (_Param->isOption(OPT_hls_jobs) and _Param->getOption<size_t>(OPT_hls_jobs) > 1))
 {
 }
 
 tree_manager::~tree_manager() = default;
 
+std::unique_lock<std::recursive_mutex> tree_manager::LockNodes() const
+{
+   return concurrent_access ? std::unique_lock<std::recursive_mutex>(nodes_mutex) :
+                              std::unique_lock<std::recursive_mutex>();
+}
+
 unsigned int tree_manager::get_implementation_node(unsigned int decl_node) const
 {
    THROW_ASSERT(GetPointer<function_decl>(get_tree_node_const(decl_node)),
@@ -117,6 +150,7 @@ unsigned int tree_manager::get_implementation_node(unsigned int decl_node) const
 
 void tree_manager::AddTreeNode(unsigned int i, const tree_nodeRef& curr)
 {
+   const auto lock = LockNodes();
    THROW_ASSERT(i > 0, "Expected a positive index");
    THROW_ASSERT(curr, "Invalid tree node: " + STR(i));
    if(i >= last_node_id)
@@ -124,10 +158,15 @@ void tree_manager::AddTreeNode(unsigned int i, const tree_nodeRef& curr)
       last_node_id = i + 1;
    }
    tree_nodes[i] = curr;
+   if(find_index.find(curr->get_kind()) != find_index.end())
+   {
+      find_index_pending.push_back(i);
+   }
 }
 
 tree_nodeRef tree_manager::GetTreeReindex(unsigned int index)
 {
+   const auto lock = LockNodes();
    THROW_ASSERT(index > 0, "Expected a positive index (" + STR(index) + ")");
    if(index >= last_node_id)
    {
@@ -138,6 +177,7 @@ tree_nodeRef tree_manager::GetTreeReindex(unsigned int index)
 
 const tree_nodeRef tree_manager::CGetTreeReindex(const unsigned int i) const
 {
+   const auto lock = LockNodes();
    THROW_ASSERT(i > 0 and i < last_node_id, "(C) Expected a positive index less than the total number of tree nodes (" +
                                                 STR(i) + ") (" + STR(last_node_id) + ")");
    THROW_ASSERT(tree_nodes.find(i) != tree_nodes.end(), "Tree node " + STR(i) + " does not exist");
@@ -146,12 +186,14 @@ const tree_nodeRef tree_manager::CGetTreeReindex(const unsigned int i) const
 
 tree_nodeRef tree_manager::GetTreeNode(const unsigned int index) const
 {
+   const auto lock = LockNodes();
    THROW_ASSERT(tree_nodes.find(index) != tree_nodes.end(), "Tree node with index " + STR(index) + " not found");
    return tree_nodes.find(index)->second;
 }
 
 const tree_nodeRef tree_manager::get_tree_node_const(unsigned int i) const
 {
+   const auto lock = LockNodes();
    THROW_ASSERT(i > 0 and i < last_node_id, "(C) Expected a positive index less than the total number of tree nodes (" +
                                                 STR(i) + ") (" + STR(last_node_id) + ")");
    THROW_ASSERT(tree_nodes.find(i) != tree_nodes.end(), "Tree node " + STR(i) + " does not exist");
@@ -161,6 +203,7 @@ const tree_nodeRef tree_manager::get_tree_node_const(unsigned int i) const
 
 const tree_nodeConstRef tree_manager::CGetTreeNode(const unsigned int i) const
 {
+   const auto lock = LockNodes();
    THROW_ASSERT(i > 0 and i < last_node_id, "(C) Expected a positive index less than the total number of tree nodes (" +
                                                 STR(i) + ") (" + STR(last_node_id) + ")");
    THROW_ASSERT(tree_nodes.find(i) != tree_nodes.end(), "Tree node " + STR(i) + " does not exist");
@@ -170,6 +213,7 @@ const tree_nodeConstRef tree_manager::CGetTreeNode(const unsigned int i) const
 
 bool tree_manager::is_tree_node(unsigned int i) const
 {
+   const auto lock = LockNodes();
    return tree_nodes.find(i) != tree_nodes.end();
 }
 
@@ -314,6 +358,7 @@ void tree_manager::PrintGimple(std::ostream& os, const bool use_uid) const
 void tree_manager::create_tree_node(const unsigned int node_id, enum kind tree_node_type,
                                     std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>& tree_node_schema)
 {
+   const auto lock = LockNodes();
    tree_node_factory TNF(tree_node_schema, *this);
    TNF.create_tree_node(node_id, tree_node_type);
    INDENT_DBG_MEX(DEBUG_LEVEL_PARANOIC, GET_FUNCTION_DEBUG_LEVEL(Param),
@@ -322,6 +367,7 @@ void tree_manager::create_tree_node(const unsigned int node_id, enum kind tree_n
 
 unsigned int tree_manager::new_tree_node_id(const unsigned int ask)
 {
+   const auto lock = LockNodes();
    if(ask && !tree_nodes.count(ask))
    {
       GetTreeReindex(ask);
@@ -334,6 +380,7 @@ unsigned int tree_manager::new_tree_node_id(const unsigned int ask)
 
 unsigned int tree_manager::get_next_available_tree_node_id() const
 {
+   const auto lock = LockNodes();
    return last_node_id;
 }
 
@@ -350,6 +397,7 @@ unsigned long tree_manager::get_function_decl_node_n() const
 unsigned int tree_manager::find(enum kind tree_node_type,
                                 const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>& tree_node_schema)
 {
+   const auto lock = LockNodes();
    if(tree_node_type == identifier_node_K)
    {
       std::string id;
@@ -367,37 +415,136 @@ unsigned int tree_manager::find(enum kind tree_node_type,
       }
       return find_identifier_nodeID(id);
    }
-   std::string key = tree_node::GetString(tree_node_type);
-   const auto tns_end = tree_node_schema.end();
-   for(auto tns = tree_node_schema.begin(); tns != tns_end; ++tns)
+   /// Index the nodes added since the last lookup
+   for(const auto node_id : find_index_pending)
    {
-      key += ";" + STOK2(tns->first) + "=" + tns->second;
+      const auto tn = tree_nodes.find(node_id);
+      if(tn == tree_nodes.end() || !tn->second)
+      {
+         continue;
+      }
+      const auto kind_tables = find_index.find(tn->second->get_kind());
+      if(kind_tables != find_index.end())
+      {
+         for(auto& fields_table : kind_tables->second)
+         {
+            std::map<TreeVocabularyTokenTypes_TokenEnum, std::string> fields;
+            for(const auto field : fields_table.first)
+            {
+               fields[field];
+            }
+            IndexTreeNode(fields_table.second, fields, node_id);
+         }
+      }
    }
-   // std::cout << "KEY: " + key + "[" << (find_cache.find(key) != find_cache.end() ? find_cache.find(key)->second : 0)
-   // << "]" << std::endl;
-   if(find_cache.find(key) != find_cache.end())
+   find_index_pending.clear();
+
+   std::vector<TreeVocabularyTokenTypes_TokenEnum> fields;
+   fields.reserve(tree_node_schema.size());
+   for(const auto& field : tree_node_schema)
    {
-      return find_cache.find(key)->second;
+      fields.push_back(field.first);
    }
-   tree_node_finder TNF(tree_node_schema);
-   for(const auto& ti : tree_nodes)
+   auto& kind_tables = find_index[tree_node_type];
+   auto table = kind_tables.find(fields);
+   if(table == kind_tables.end())
    {
-      unsigned int node_id = ti.first;
-      /// check if the corresponding tree node has been already created or not
-      if(!ti.second)
+      /// First lookup on this set of fields: index all the existing nodes of the kind
+      table = kind_tables.emplace(fields, find_index_table()).first;
+      ++find_index_builds;
+      for(const auto& tn : tree_nodes)
       {
-         continue;
+         if(tn.second && tn.second->get_kind() == tree_node_type)
+         {
+            IndexTreeNode(table->second, tree_node_schema, tn.first);
+         }
       }
+   }
 
-      if(ti.second->get_kind() == tree_node_type and TNF.check(ti.second))
+   const auto key = SchemaHash(tree_node_type, tree_node_schema);
+   const auto candidates = table->second.find(key);
+   if(candidates == table->second.end())
+   {
+      ++find_misses;
+      return 0;
+   }
+   tree_node_finder TNF(tree_node_schema);
+   unsigned int found = 0;
+   std::vector<unsigned int> moved;
+   for(const auto node_id : candidates->second)
+   {
+      const auto tn = tree_nodes.find(node_id);
+      if(tn != tree_nodes.end() && tn->second && tn->second->get_kind() == tree_node_type && TNF.check(tn->second))
+      {
+         /// Return the node with the smallest index, as a visit of all the nodes would
+         if(!found || node_id < found)
+         {
+            found = node_id;
+         }
+      }
+      else if(tn != tree_nodes.end() && tn->second)
       {
-         find_cache[key] = node_id;
-         return node_id;
+         /// The node has been modified or replaced since it was indexed
+         moved.push_back(node_id);
       }
    }
+   if(moved.size())
+   {
+      auto& bucket = candidates->second;
+      bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                                  [&](unsigned int node_id) {
+                                     return std::find(moved.begin(), moved.end(), node_id) != moved.end() ||
+                                            tree_nodes.find(node_id) == tree_nodes.end();
+                                  }),
+                   bucket.end());
+      for(const auto node_id : moved)
+      {
+         if(tree_nodes.at(node_id)->get_kind() == tree_node_type)
+         {
+            IndexTreeNode(table->second, tree_node_schema, node_id);
+         }
+         else
+         {
+            find_index_pending.push_back(node_id);
+         }
+      }
+   }
+   if(found)
+   {
+      ++find_hits;
+      return found;
+   }
+   ++find_misses;
    return 0;
 }
 
+void tree_manager::IndexTreeNode(find_index_table& table,
+                                 const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>& fields,
+                                 unsigned int node_id)
+{
+   const auto& tn = tree_nodes.at(node_id);
+   std::map<TreeVocabularyTokenTypes_TokenEnum, std::string> values;
+   tree_node_finder extractor(fields, values);
+   /// A node without some of the fields cannot be compatible with any lookup on them
+   if(extractor.extract(tn))
+   {
+      auto& bucket = table[SchemaHash(tn->get_kind(), values)];
+      if(std::find(bucket.begin(), bucket.end(), node_id) == bucket.end())
+      {
+         bucket.push_back(node_id);
+      }
+   }
+}
+
+void tree_manager::PrintFindStatistics() const
+{
+   const auto output_level = Param->getOption<int>(OPT_output_level);
+   const auto lookups = find_hits + find_misses;
+   INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level,
+                  "---Tree node lookups: " + STR(lookups) + " (hits: " + STR(find_hits) + ", misses: " +
+                      STR(find_misses) + ", indexes built: " + STR(find_index_builds) + ")");
+}
+
 void tree_manager::collapse_into(const unsigned int& funID,
                                  CustomUnorderedMapUnstable<unsigned int, unsigned int>& stmt_to_bloc,
                                  const tree_nodeRef& tn, CustomUnorderedSet<unsigned int>& removed_nodes,
@@ -952,6 +1099,7 @@ void tree_manager::collapse_into(const unsigned int& funID,
 
 void tree_manager::ReplaceTreeNode(const tree_nodeRef& stmt, const tree_nodeRef& old_node, const tree_nodeRef& new_node)
 {
+   const auto lock = LockNodes();
    THROW_ASSERT(GetPointer<const gimple_node>(GET_NODE(stmt)), "Replacing ssa name starting from " + stmt->ToString());
    THROW_ASSERT(!GetPointer<const gimple_node>(GET_NODE(new_node)), "new node cannot be a gimple_node");
    THROW_ASSERT(!GetPointer<const gimple_node>(GET_NODE(old_node)),
@@ -2685,6 +2833,7 @@ bool tree_manager::check_for_type(const tree_nodeRef& tn, const tree_managerRef&
 
 unsigned int tree_manager::find_identifier_nodeID(const std::string& str) const
 {
+   const auto lock = LockNodes();
    auto it = identifiers_unique_table.find(str);
    if(it == identifiers_unique_table.end())
    {
@@ -2698,6 +2847,7 @@ unsigned int tree_manager::find_identifier_nodeID(const std::string& str) const
 
 void tree_manager::add_identifier_node(unsigned int nodeID, const bool& ASSERT_PARAMETER(op))
 {
+   const auto lock = LockNodes();
    THROW_ASSERT(op, "improper use of add_identifier_node");
    identifiers_unique_table[STOK(TOK_OPERATOR)] = nodeID;
 }
@@ -2715,6 +2865,7 @@ const CustomUnorderedSet<unsigned int> tree_manager::GetAllFunctions() const
 
 unsigned int tree_manager::get_next_vers()
 {
+   const auto lock = LockNodes();
    if(next_vers == 0)
    {
       for(const auto& ti : tree_nodes)
@@ -2779,6 +2930,7 @@ unsigned int tree_manager::get_unremoved_pointer_plus() const
 
 tree_nodeRef tree_manager::create_unique_const(const std::string& val, const tree_nodeConstRef& type)
 {
+   const auto lock = LockNodes();
    const auto key = std::make_pair(val, type->index);
    const auto unique_cst = unique_cst_map.find(key);
    if(unique_cst != unique_cst_map.end())
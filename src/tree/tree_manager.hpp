@@ -58,8 +58,10 @@
 /// STL include
 #include <deque>
 #include <iosfwd>
+#include <mutex>
 #include <string>  // for string
 #include <utility> // for pair
+#include <vector>
 
 /**
  * @name forward declarations
@@ -84,8 +86,35 @@ enum class TreeVocabularyTokenTypes_TokenEnum;
 class tree_manager
 {
  private:
-   /// cache for tree_manager::find
-   CustomUnorderedMapUnstable<std::string, unsigned int> find_cache;
+   /// structural index of the nodes with respect to a set of fields: hash of node kind and field values -> node ids
+   using find_index_table = CustomUnorderedMapUnstable<size_t, std::vector<unsigned int>>;
+
+   /// structural index for tree_manager::find: for each node kind, one table for each set of fields used by lookups
+   CustomUnorderedMapUnstable<enum kind, std::map<std::vector<TreeVocabularyTokenTypes_TokenEnum>, find_index_table>>
+       find_index;
+
+   /// nodes added or replaced since the last lookup whose kind is indexed; they are inserted into find_index lazily,
+   /// since their fields are usually filled after they are added
+   std::vector<unsigned int> find_index_pending;
+
+   /// number of tree_manager::find calls which found a compatible node
+   size_t find_hits;
+
+   /// number of tables built in find_index
+   size_t find_index_builds;
+
+   /// number of tree_manager::find calls which did not find any compatible node
+   size_t find_misses;
+
+   /**
+    * Insert a node into a table of find_index
+    * @param table is the table
+    * @param fields is a schema whose keys are the fields of the table
+    * @param node_id is the index of the node
+    */
+   void IndexTreeNode(find_index_table& table,
+                      const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>& fields,
+                      unsigned int node_id);
 
    /**
     * Variable containing set of tree_nodes.
@@ -144,6 +173,12 @@ class tree_manager
    /// Index of current call of collapse_into_counter
    unsigned int collapse_into_counter;
 
+   /// Serializes the accesses to the node tables when function-local steps are executed concurrently
+   mutable std::recursive_mutex nodes_mutex;
+
+   /// True if the node tables can be accessed by more than one thread
+   const bool concurrent_access;
+
    /**
     * check for decl_node and return true if not suitable for symbol table or otherwise its symbol_name and
     * symbol_scope.
@@ -216,6 +251,13 @@ class tree_manager
 
    // ************************+ handlers for tree_nodes structure **************************
 
+   /**
+    * Lock the node tables until the returned object is destroyed; nothing is locked when the tree manager is not
+    * shared among concurrent steps
+    * @return the lock
+    */
+   std::unique_lock<std::recursive_mutex> LockNodes() const;
+
    /**
     * Add to the tree manager the current node.
     * @param i position in the tree_vector. Note that the raw file start from 1
@@ -278,12 +320,19 @@ class tree_manager
 
    /**
     * if there exist return the node id of a tree node compatible with the tree_node_schema and of type tree_node_type.
+    * Lookups go through find_index, so the values in tree_node_schema must be written as STR writes them; fields
+    * changed in place after a node has been indexed are noticed only when the node is met again as a candidate.
     * @param tree_node_type is the type of the node added to the tree_manager expressed as a treeVocabularyTokenTypes.
     * @param tree_node_schema expresses the value of the field of the tree node created.
     */
    unsigned int find(enum kind tree_node_type,
                      const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>& tree_node_schema);
 
+   /**
+    * Print the hit/miss statistics of tree_manager::find at verbose output level
+    */
+   void PrintFindStatistics() const;
+
    /**
     * Return a new node id in the intermediate representation.
     * @param ask is the requested id; if it is not used will be returned otherwise a new id
@@ -456,6 +505,7 @@ class tree_manager
     */
    void add_identifier_node(unsigned int nodeID, const std::string& str)
    {
+      const auto lock = LockNodes();
       identifiers_unique_table[str] = nodeID;
    }
    void add_identifier_node(unsigned int nodeID, const bool& op);
@@ -745,6 +745,8 @@ tree_nodeRef tree_manipulation::CreateIntegerCst(const tree_nodeConstRef& type,
 /// Create an identifier node
 tree_nodeRef tree_manipulation::create_identifier_node(const std::string& strg) const
 {
+   /// look-up and creation of shared nodes must not be interleaved with other concurrent steps
+   const auto lock = TreeM->LockNodes();
    THROW_ASSERT(!strg.empty(), "It requires a non empty string");
 
    ///@37     identifier_node  strg: "int" lngt: 3
@@ -847,6 +849,7 @@ tree_nodeRef tree_manipulation::create_var_decl(
 
 tree_nodeRef tree_manipulation::create_translation_unit_decl() const
 {
+   const auto lock = TreeM->LockNodes();
    tree_nodeRef translation_unit_decl_node;
    std::map<TreeVocabularyTokenTypes_TokenEnum, std::string> IR_schema;
    IR_schema[TOK(TOK_SRCP)] = BUILTIN_SRCP;
@@ -997,6 +1000,7 @@ tree_nodeRef tree_manipulation::create_parm_decl(const tree_nodeRef& name, const
 /// Create a void type
 tree_nodeRef tree_manipulation::GetVoidType() const
 {
+   const auto lock = TreeM->LockNodes();
    ///@41     void_type        name: @58      algn: 8
    ///@58     type_decl        name: @63      type: @41      srcp:
    ///"<built-in>:0:0"
@@ -1046,6 +1050,7 @@ tree_nodeRef tree_manipulation::GetVoidType() const
 /// Create a bit_size type
 tree_nodeRef tree_manipulation::GetBitsizeType() const
 {
+   const auto lock = TreeM->LockNodes();
    ///@32    identifier_node  strg: "bitsizetype"  lngt: 13
    ///@18    integer_type   name: @32   size: @33   algn: 64    prec: 64 unsigned
    /// min : @34   max : @35
@@ -1108,6 +1113,7 @@ tree_nodeRef tree_manipulation::GetBitsizeType() const
 /// Create a size type
 tree_nodeRef tree_manipulation::GetSizeType() const
 {
+   const auto lock = TreeM->LockNodes();
    //@124    identifier_node  strg: "sizetype"             lngt: 8
    //@96     integer_type     name: @124     size: @15      algn: 32
    //                         prec: 32       unsigned       min : @125
@@ -1172,6 +1178,7 @@ tree_nodeRef tree_manipulation::GetSizeType() const
 /// Create a boolean type
 tree_nodeRef tree_manipulation::GetBooleanType() const
 {
+   const auto lock = TreeM->LockNodes();
    ///@48 boolean_type name: @55 size: @7 algn: 8
    ///@55 type_decl name: @58 type: @48 srcp: "<built-in>:0:0"
    ///@58 identifier_node strg: "_Bool" lngt: 5
@@ -1238,6 +1245,7 @@ tree_nodeRef tree_manipulation::GetBooleanType() const
 /// Create an unsigned integer type
 tree_nodeRef tree_manipulation::GetUnsignedIntegerType() const
 {
+   const auto lock = TreeM->LockNodes();
    ///@41     identifier_node  strg: "unsigned int"         lngt: 12
    ///@8      integer_type     name: @20      size: @12      algn: 32      prec:
    /// 32       unsigned       min : @21    max : @22
@@ -1321,6 +1329,7 @@ tree_nodeRef tree_manipulation::GetUnsignedIntegerType() const
 
 tree_nodeRef tree_manipulation::GetUnsignedLongLongType() const
 {
+   const auto lock = TreeM->LockNodes();
    std::map<TreeVocabularyTokenTypes_TokenEnum, std::string> IR_schema;
    tree_nodeRef integer_type_node;
 
@@ -1385,6 +1394,7 @@ tree_nodeRef tree_manipulation::GetUnsignedLongLongType() const
 /// Create an integer type
 tree_nodeRef tree_manipulation::GetSignedIntegerType() const
 {
+   const auto lock = TreeM->LockNodes();
    ///@36     identifier_node  strg: "int" lngt: 3
    ///@19     type_decl        name: @36      type: @8       srcp:
    ///"<built-in>:0:0"
@@ -1473,6 +1483,7 @@ tree_nodeRef tree_manipulation::GetSignedIntegerType() const
 /// Create a pointer type
 tree_nodeRef tree_manipulation::GetPointerType(const tree_nodeConstRef& ptd, unsigned long long algn) const
 {
+   const auto lock = TreeM->LockNodes();
    ///@15     pointer_type     size: @12      algn: 32       ptd : @9     @9 type
    /// of the pointer
    ///@12     integer_cst      type: @26      low : 32       @26 is bit_size_type
@@ -1512,6 +1523,7 @@ tree_nodeRef tree_manipulation::GetPointerType(const tree_nodeConstRef& ptd, uns
 
 tree_nodeRef tree_manipulation::GetCustomIntegerType(unsigned long long prec, bool unsigned_p) const
 {
+   const auto lock = TreeM->LockNodes();
    std::map<TreeVocabularyTokenTypes_TokenEnum, std::string> IR_schema;
 
    IR_schema[TOK(TOK_ALGN)] = STR(get_aligned_bitsize(prec));
@@ -2060,6 +2072,7 @@ void tree_manipulation::bb_set_true_edge(blocRef& bb, const unsigned int& true_e
 
 void tree_manipulation::create_label(const blocRef& block, const unsigned int function_decl_nid) const
 {
+   const auto lock = TreeM->LockNodes();
    std::map<TreeVocabularyTokenTypes_TokenEnum, std::string> IR_schema;
    /// check if the first statement is a gimple_label but with a unnamed
    /// label_decl.
@@ -2185,6 +2198,7 @@ void tree_manipulation::create_label(const blocRef& block, const unsigned int fu
 void tree_manipulation::create_goto(const blocRef& block, const unsigned int function_decl_nid,
                                     const unsigned int label_expr_nid) const
 {
+   const auto lock = TreeM->LockNodes();
    TreeM->add_goto();
    /// compute the label_decl_nid
    auto* le = GetPointer<gimple_label>(TreeM->get_tree_node_const(label_expr_nid));
@@ -2268,6 +2282,7 @@ tree_nodeRef tree_manipulation::create_function_decl(const std::string& function
                                                      const tree_nodeConstRef& returnType, const std::string& srcp,
                                                      bool with_body) const
 {
+   const auto lock = TreeM->LockNodes();
    const auto fd_node = TreeM->GetFunction(function_name);
    if(fd_node)
    {
@@ -2553,6 +2568,7 @@ tree_nodeRef tree_manipulation::CreateNopExpr(const tree_nodeConstRef& operand,
 
 tree_nodeRef tree_manipulation::CreateUnsigned(const tree_nodeConstRef& signed_type) const
 {
+   const auto lock = TreeM->LockNodes();
    const auto int_signed_type = GetPointer<const integer_type>(signed_type);
    if(not int_signed_type)
    {
@@ -2752,6 +2768,7 @@ tree_nodeRef tree_manipulation::CreateGimpleAssignAddrExpr(const tree_nodeConstR
 tree_nodeRef tree_manipulation::CreateVectorType(const tree_nodeConstRef& elt_type,
                                                  integer_cst_t number_of_elements) const
 {
+   const auto lock = TreeM->LockNodes();
    const auto size = TreeM->CreateUniqueIntegerCst(number_of_elements, GetSizeType());
 
    std::map<TreeVocabularyTokenTypes_TokenEnum, std::string> IR_schema;
@@ -41,9 +41,10 @@
  *
  */
 #include "tree_node_finder.hpp"
-#include "exceptions.hpp"         // for THROW_ASSERT
-#include "token_interface.hpp"    // for TOK, STOK, TreeV...
-#include <boost/lexical_cast.hpp> // for lexical_cast
+#include "exceptions.hpp"          // for THROW_ASSERT
+#include "string_manipulation.hpp" // for STR
+#include "token_interface.hpp"     // for TOK, STOK, TreeV...
+#include <boost/lexical_cast.hpp>  // for lexical_cast
 
 #include "ext_tree_node.hpp"
 #include "tree_basic_block.hpp"
@@ -51,33 +52,74 @@
 #include "tree_reindex.hpp"
 
 template <class type>
-static bool check_value_opt(const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>::const_iterator& it_element,
-                            const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>::const_iterator& it_end,
-                            const type& value)
-{
-   return it_element == it_end || value == boost::lexical_cast<type>(it_element->second);
-}
-
-static bool check_value_opt(const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>::const_iterator& it_element,
-                            const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>::const_iterator& it_end,
-                            const TreeVocabularyTokenTypes_TokenEnum& value)
-{
-   return it_element == it_end ||
-          value == static_cast<TreeVocabularyTokenTypes_TokenEnum>(std::stoull(it_element->second));
-}
-
-#define CHECK_VALUE_OPT(token, value) check_value_opt(tree_node_schema.find(TOK(token)), tree_node_schema.end(), value)
-
-static bool
-check_tree_node_opt(const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>::const_iterator& it_element,
-                    const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>::const_iterator& it_end,
-                    const tree_nodeRef& tn, const std::string&)
-{
-   return it_element == it_end || (tn && GET_INDEX_NODE(tn) == std::stoull(it_element->second));
-}
-
-#define CHECK_TREE_NODE_OPT(token, treeN) \
-   check_tree_node_opt(tree_node_schema.find(TOK(token)), tree_node_schema.end(), treeN, STOK(token))
+bool tree_node_finder::check_value_opt(TreeVocabularyTokenTypes_TokenEnum token, const type& value)
+{
+   const auto it_element = tree_node_schema.find(token);
+   if(it_element == tree_node_schema.end())
+   {
+      return true;
+   }
+   if(extracted_schema)
+   {
+      (*extracted_schema)[token] = STR(value);
+      return true;
+   }
+   return value == boost::lexical_cast<type>(it_element->second);
+}
+
+bool tree_node_finder::check_value_opt(TreeVocabularyTokenTypes_TokenEnum token,
+                                       const TreeVocabularyTokenTypes_TokenEnum& value)
+{
+   const auto it_element = tree_node_schema.find(token);
+   if(it_element == tree_node_schema.end())
+   {
+      return true;
+   }
+   if(extracted_schema)
+   {
+      (*extracted_schema)[token] = STR(static_cast<int>(value));
+      return true;
+   }
+   return value == static_cast<TreeVocabularyTokenTypes_TokenEnum>(std::stoull(it_element->second));
+}
+
+bool tree_node_finder::check_string_opt(TreeVocabularyTokenTypes_TokenEnum token, const std::string& value)
+{
+   const auto it_element = tree_node_schema.find(token);
+   if(it_element == tree_node_schema.end())
+   {
+      return true;
+   }
+   if(extracted_schema)
+   {
+      (*extracted_schema)[token] = value;
+      return true;
+   }
+   return it_element->second == value;
+}
+
+bool tree_node_finder::check_tree_node_opt(TreeVocabularyTokenTypes_TokenEnum token, const tree_nodeRef& tn)
+{
+   const auto it_element = tree_node_schema.find(token);
+   if(it_element == tree_node_schema.end())
+   {
+      return true;
+   }
+   if(!tn)
+   {
+      return false;
+   }
+   if(extracted_schema)
+   {
+      (*extracted_schema)[token] = STR(GET_INDEX_NODE(tn));
+      return true;
+   }
+   return GET_INDEX_NODE(tn) == std::stoull(it_element->second);
+}
+
+#define CHECK_VALUE_OPT(token, value) check_value_opt(TOK(token), value)
+
+#define CHECK_TREE_NODE_OPT(token, treeN) check_tree_node_opt(TOK(token), treeN)
 
 #define TREE_NOT_YET_IMPLEMENTED(token)                                      \
    THROW_ASSERT(tree_node_schema.find(TOK(token)) == tree_node_schema.end(), \
@@ -107,10 +149,8 @@ void tree_node_finder::operator()(const attr* obj, unsigned int& mask)
 void tree_node_finder::operator()(const srcp* obj, unsigned int& mask)
 {
    tree_node_mask::operator()(obj, mask);
-   find_res = find_res && (tree_node_schema.find(TOK(TOK_SRCP)) == tree_node_schema.end() ||
-                           tree_node_schema.find(TOK(TOK_SRCP))->second == obj->include_name + ":" +
-                                                                               std::to_string(obj->line_number) + ":" +
-                                                                               std::to_string(obj->column_number));
+   find_res = find_res && check_string_opt(TOK(TOK_SRCP), obj->include_name + ":" + std::to_string(obj->line_number) +
+                                                              ":" + std::to_string(obj->column_number));
 }
 
 void tree_node_finder::operator()(const decl_node* obj, unsigned int& mask)
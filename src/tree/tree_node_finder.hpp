@@ -67,7 +67,18 @@ struct tree_node_finder : public tree_node_mask
 {
    /// default constructor
    explicit tree_node_finder(const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>& _tree_node_schema)
-       : find_res(true), tree_node_schema(_tree_node_schema)
+       : find_res(true), tree_node_schema(_tree_node_schema), extracted_schema(nullptr)
+   {
+   }
+
+   /**
+    * Constructor used to extract the values of a set of fields of tree nodes
+    * @param _tree_node_schema gives the fields to be extracted; the values are ignored
+    * @param _extracted_schema is where the values of the fields are stored, in the same format used by check
+    */
+   tree_node_finder(const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>& _tree_node_schema,
+                    std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>& _extracted_schema)
+       : find_res(true), tree_node_schema(_tree_node_schema), extracted_schema(&_extracted_schema)
    {
    }
    /// tree_node visitors
@@ -83,11 +94,49 @@ struct tree_node_finder : public tree_node_mask
       return find_res;
    }
 
+   /**
+    * Store the values of the fields of a tree node into the extracted schema
+    * @param t is the tree node
+    * @return false if some of the fields are not set in t, so that t cannot be compatible with any schema on them
+    */
+   bool extract(const tree_nodeRef& t)
+   {
+      THROW_ASSERT(extracted_schema, "Finder not built for extraction");
+      extracted_schema->clear();
+      return check(t);
+   }
+
  private:
    /// result of the search
    bool find_res;
    /// tree_node_schema expresses the value of the fields of the tree node we are looking for.
    const std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>& tree_node_schema;
+   /// when not null, the values of the fields of tree_node_schema are stored here instead of being checked
+   std::map<TreeVocabularyTokenTypes_TokenEnum, std::string>* extracted_schema;
+
+   /**
+    * Check (or extract) a field storing a value
+    * @param token is the token of the field
+    * @param value is the value of the field
+    * @return true if the field is compatible with the schema
+    */
+   template <class type>
+   bool check_value_opt(TreeVocabularyTokenTypes_TokenEnum token, const type& value);
+
+   /**
+    * Check (or extract) a field storing a token
+    */
+   bool check_value_opt(TreeVocabularyTokenTypes_TokenEnum token, const TreeVocabularyTokenTypes_TokenEnum& value);
+
+   /**
+    * Check (or extract) a field storing a string which is compared as is
+    */
+   bool check_string_opt(TreeVocabularyTokenTypes_TokenEnum token, const std::string& value);
+
+   /**
+    * Check (or extract) a field referring to a tree node
+    */
+   bool check_tree_node_opt(TreeVocabularyTokenTypes_TokenEnum token, const tree_nodeRef& tn);
 };
 
 #endif
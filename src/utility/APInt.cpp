@@ -49,46 +49,135 @@ using namespace boost::multiprecision;
 
 using bw_t = APInt::bw_t;
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wzero-as-null-pointer-constant"
-APInt::APInt() : _data(57)
+namespace
+{
+   __extension__ typedef __int128 small_t;
+   __extension__ typedef unsigned __int128 usmall_t;
+
+   constexpr small_t small_min = static_cast<small_t>(static_cast<usmall_t>(1) << 127);
+
+   /**
+    * Return the number of significant bits of a non-negative value
+    */
+   bw_t bitLength(usmall_t v)
+   {
+      const auto hi = static_cast<unsigned long long>(v >> 64);
+      if(hi)
+      {
+         return static_cast<bw_t>(128 - __builtin_clzll(hi));
+      }
+      const auto lo = static_cast<unsigned long long>(v);
+      return static_cast<bw_t>(lo ? 64 - __builtin_clzll(lo) : 0);
+   }
+} // namespace
+
+APInt::APInt() : _val(57)
 {
 }
-#pragma GCC diagnostic pop
+
+APInt::APInt(const APInt& other) : _val(other._val), _big(other._big ? new number(*other._big) : nullptr)
+{
+}
+
+APInt& APInt::operator=(const APInt& other)
+{
+   if(this != &other)
+   {
+      _val = other._val;
+      _big.reset(other._big ? new number(*other._big) : nullptr);
+   }
+   return *this;
+}
+
+APInt::number APInt::getNumber() const
+{
+   if(_big)
+   {
+      return *_big;
+   }
+   return number(_val);
+}
+
+void APInt::setNumber(const number& v)
+{
+   const auto& v_backend = v.backend();
+   if(v_backend.size() * backend::limb_bits <= 128)
+   {
+      const auto limbs = v_backend.limbs();
+      usmall_t mag = 0;
+      for(auto i = v_backend.size(); i > 0; --i)
+      {
+         mag = (mag << backend::limb_bits) | limbs[i - 1];
+      }
+      const auto limit = static_cast<usmall_t>(1) << small_digits;
+      if(mag < limit || (v_backend.isneg() && mag == limit))
+      {
+         _val = static_cast<small_t>(v_backend.isneg() ? -mag : mag);
+         _big.reset();
+         return;
+      }
+   }
+   if(_big)
+   {
+      *_big = v;
+   }
+   else
+   {
+      _big.reset(new number(v));
+   }
+}
+
+int APInt::compare(const APInt& lhs, const APInt& rhs)
+{
+   if(!lhs._big && !rhs._big)
+   {
+      return (lhs._val > rhs._val) - (lhs._val < rhs._val);
+   }
+   /// a value stored in the arbitrary precision representation is always wider than any inline value
+   if(!lhs._big)
+   {
+      return rhs._big->sign() < 0 ? 1 : -1;
+   }
+   if(!rhs._big)
+   {
+      return lhs._big->sign() < 0 ? -1 : 1;
+   }
+   return lhs._big->compare(*rhs._big);
+}
 
 bool operator<(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data < rhs._data;
+   return APInt::compare(lhs, rhs) < 0;
 }
 
 bool operator>(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data > rhs._data;
+   return APInt::compare(lhs, rhs) > 0;
 }
 
 bool operator<=(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data <= rhs._data;
+   return APInt::compare(lhs, rhs) <= 0;
 }
 
 bool operator>=(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data >= rhs._data;
+   return APInt::compare(lhs, rhs) >= 0;
 }
 
 bool operator==(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data == rhs._data;
+   return APInt::compare(lhs, rhs) == 0;
 }
 
 bool operator!=(const APInt& lhs, const APInt& rhs)
 {
-   return lhs._data != rhs._data;
+   return APInt::compare(lhs, rhs) != 0;
 }
 
 APInt::operator bool() const
 {
-   return _data != 0;
+   return _big || _val != 0;
 }
 
 /*
@@ -146,61 +235,131 @@ APInt operator>>(const APInt& lhs, const APInt& rhs)
 
 APInt& APInt::operator+=(const APInt& rhs)
 {
-   _data += rhs._data;
+   small_t res;
+   if(!_big && !rhs._big && !__builtin_add_overflow(_val, rhs._val, &res))
+   {
+      _val = res;
+      return *this;
+   }
+   setNumber(getNumber() + rhs.getNumber());
    return *this;
 }
 
 APInt& APInt::operator-=(const APInt& rhs)
 {
-   _data -= rhs._data;
+   small_t res;
+   if(!_big && !rhs._big && !__builtin_sub_overflow(_val, rhs._val, &res))
+   {
+      _val = res;
+      return *this;
+   }
+   setNumber(getNumber() - rhs.getNumber());
    return *this;
 }
 
 APInt& APInt::operator*=(const APInt& rhs)
 {
-   _data *= rhs._data;
+   small_t res;
+   if(!_big && !rhs._big && !__builtin_mul_overflow(_val, rhs._val, &res))
+   {
+      _val = res;
+      return *this;
+   }
+   setNumber(getNumber() * rhs.getNumber());
    return *this;
 }
 
 APInt& APInt::operator/=(const APInt& rhs)
 {
-   _data /= rhs._data;
+   if(!_big && !rhs._big && rhs._val != 0 && (_val != small_min || rhs._val != -1))
+   {
+      _val /= rhs._val;
+      return *this;
+   }
+   setNumber(getNumber() / rhs.getNumber());
    return *this;
 }
 
 APInt& APInt::operator%=(const APInt& rhs)
 {
-   _data %= rhs._data;
+   if(!_big && !rhs._big && rhs._val != 0)
+   {
+      _val = rhs._val == -1 ? 0 : _val % rhs._val;
+      return *this;
+   }
+   setNumber(getNumber() % rhs.getNumber());
    return *this;
 }
 
 APInt& APInt::operator&=(const APInt& rhs)
 {
-   _data &= rhs._data;
+   if(!_big && !rhs._big)
+   {
+      _val &= rhs._val;
+      return *this;
+   }
+   setNumber(getNumber() & rhs.getNumber());
    return *this;
 }
 
 APInt& APInt::operator|=(const APInt& rhs)
 {
-   _data |= rhs._data;
+   if(!_big && !rhs._big)
+   {
+      _val |= rhs._val;
+      return *this;
+   }
+   setNumber(getNumber() | rhs.getNumber());
    return *this;
 }
 
 APInt& APInt::operator^=(const APInt& rhs)
 {
-   _data ^= rhs._data;
+   if(!_big && !rhs._big)
+   {
+      _val ^= rhs._val;
+      return *this;
+   }
+   setNumber(getNumber() ^ rhs.getNumber());
    return *this;
 }
 
 APInt& APInt::operator<<=(const APInt& rhs)
 {
-   _data <<= static_cast<bw_t>(rhs._data);
+   if(!_big && !rhs._big && rhs._val >= 0 && rhs._val <= std::numeric_limits<bw_t>::max())
+   {
+      const auto shift = static_cast<bw_t>(rhs._val);
+      if(_val == 0)
+      {
+         return *this;
+      }
+      if(shift < small_digits)
+      {
+         const auto res = static_cast<small_t>(static_cast<usmall_t>(_val) << shift);
+         if((res >> shift) == _val)
+         {
+            _val = res;
+            return *this;
+         }
+      }
+   }
+   auto data = getNumber();
+   data <<= static_cast<bw_t>(rhs.getNumber());
+   setNumber(data);
    return *this;
 }
 
 APInt& APInt::operator>>=(const APInt& rhs)
 {
-   _data >>= static_cast<bw_t>(rhs._data);
+   if(!_big && !rhs._big && rhs._val >= 0 && rhs._val <= std::numeric_limits<bw_t>::max())
+   {
+      const auto shift = static_cast<bw_t>(rhs._val);
+      _val = shift < 128 ? (_val >> shift) : (_val < 0 ? -1 : 0);
+      return *this;
+   }
+   auto data = getNumber();
+   data >>= static_cast<bw_t>(rhs.getNumber());
+   setNumber(data);
    return *this;
 }
 
@@ -210,35 +369,56 @@ APInt& APInt::operator>>=(const APInt& rhs)
 APInt APInt::abs() const
 {
    APInt abs;
-   abs._data = boost::multiprecision::abs(_data);
+   if(!_big && _val != small_min)
+   {
+      abs._val = _val < 0 ? -_val : _val;
+   }
+   else
+   {
+      abs.setNumber(boost::multiprecision::abs(getNumber()));
+   }
    return abs;
 }
 
 APInt APInt::operator-() const
 {
    APInt neg;
-   neg._data = -_data;
+   if(!_big && _val != small_min)
+   {
+      neg._val = -_val;
+   }
+   else
+   {
+      neg.setNumber(-getNumber());
+   }
    return neg;
 }
 
 APInt APInt::operator~() const
 {
    APInt _not;
-   _not._data = ~_data;
+   if(!_big)
+   {
+      _not._val = ~_val;
+   }
+   else
+   {
+      _not.setNumber(~*_big);
+   }
    return _not;
 }
 
 APInt APInt::operator++(int)
 {
    APInt t = *this;
-   ++_data;
+   operator+=(1LL);
    return t;
 }
 
 APInt APInt::operator--(int)
 {
    APInt t = *this;
-   --_data;
+   operator-=(1LL);
    return t;
 }
 
@@ -254,22 +434,40 @@ APInt& APInt::operator--()
 
 void APInt::bit_set(bw_t i)
 {
-   _data |= 0x1_apint << i;
+   if(!_big && i < small_digits)
+   {
+      _val |= static_cast<small_t>(1) << i;
+      return;
+   }
+   setNumber(getNumber() | (0x1_apint << i));
 }
 
 void APInt::bit_clr(bw_t i)
 {
-   _data &= ~(0x1_apint << i);
+   if(!_big && i < small_digits)
+   {
+      _val &= ~(static_cast<small_t>(1) << i);
+      return;
+   }
+   setNumber(getNumber() & ~(0x1_apint << i));
 }
 
 bool APInt::bit_tst(bw_t i) const
 {
-   return ((_data >> i) & 1) != 0;
+   if(!_big)
+   {
+      return i < 128 ? ((_val >> i) & 1) != 0 : _val < 0;
+   }
+   return ((*_big >> i) & 1) != 0;
 }
 
 bool APInt::sign() const
 {
-   return _data < 0;
+   if(!_big)
+   {
+      return _val < 0;
+   }
+   return _big->sign() < 0;
 }
 
 #ifdef __clang__
@@ -285,27 +483,32 @@ bool APInt::sign() const
 APInt& APInt::extOrTrunc(bw_t bw, bool sign)
 {
    THROW_ASSERT(bw, "Minimum bitwidth of 1 is required");
+   if(!_big && bw <= small_digits)
+   {
+      const auto mask = (static_cast<usmall_t>(1) << bw) - 1;
+      auto val = static_cast<usmall_t>(_val) & mask;
+      if(sign && ((val >> (bw - 1U)) & 1))
+      {
+         val |= ~mask;
+      }
+      _val = static_cast<small_t>(val);
+      return *this;
+   }
    const number mask = (0x1_apint << bw) - 1;
-   _data &= mask;
-   if(sign && bit_tst(bw - 1U))
+   auto data = getNumber() & mask;
+   if(sign && ((data >> (bw - 1U)) & 1) != 0)
    {
-      _data += (-0x1_apint << bw);
+      data += (-0x1_apint << bw);
    }
+   setNumber(data);
    return *this;
 }
 
 APInt APInt::extOrTrunc(bw_t bw, bool sign) const
 {
-   THROW_ASSERT(bw, "Minimum bitwidth of 1 is required");
-   const number mask = (0x1_apint << bw) - 1;
-   APInt val(_data & mask);
-   if(sign && val.bit_tst(bw - 1U))
-   {
-      val += (-0x1_apint << bw);
-   }
-   return APInt(val);
+   APInt val(*this);
+   return val.extOrTrunc(bw, sign);
 }
-
 bw_t APInt::trailingZeros(bw_t bw) const
 {
    bw_t i = 0;
@@ -334,29 +537,40 @@ bw_t APInt::trailingOnes(bw_t bw) const
 
 bw_t APInt::leadingZeros(bw_t bw) const
 {
-   if(_data < 0)
+   if(!_big)
    {
-      return 0;
+      if(_val < 0)
+      {
+         return 0;
+      }
+      if(_val == 0)
+      {
+         return bw;
+      }
+      const auto bit_length = bitLength(static_cast<usmall_t>(_val));
+      THROW_ASSERT(bit_length <= bw, "unexpected condition");
+      return bw - bit_length;
    }
-   if(_data == 0)
+   const auto& data = *_big;
+   if(data < 0)
    {
-      return bw;
+      return 0;
    }
-   THROW_ASSERT(_data.backend().size() > 0, "unexpected condition");
-   const auto limbs = _data.backend().limbs();
+   THROW_ASSERT(data.backend().size() > 0, "unexpected condition");
+   const auto limbs = data.backend().limbs();
    auto nchunks = bw / backend::limb_bits + ((bw % backend::limb_bits) ? 1 : 0);
-   THROW_ASSERT(_data.backend().size() <= nchunks, "unexpected condition");
+   THROW_ASSERT(data.backend().size() <= nchunks, "unexpected condition");
    bw_t lzc = 0;
    bw_t offset = 0;
-   if(_data.backend().size() < nchunks)
+   if(data.backend().size() < nchunks)
    {
-      lzc += bw - _data.backend().size() * backend::limb_bits;
+      lzc += bw - data.backend().size() * backend::limb_bits;
    }
    else
    {
       offset += (bw % backend::limb_bits) ? backend::limb_bits - (bw % backend::limb_bits) : 0;
    }
-   for(int i = _data.backend().size() - 1; i >= 0; --i)
+   for(int i = data.backend().size() - 1; i >= 0; --i)
    {
       const auto& val = limbs[i];
       if(val != 0)
@@ -394,16 +608,29 @@ bw_t APInt::leadingOnes(bw_t bw) const
 
 APInt::bw_t APInt::minBitwidth(bool sign) const
 {
-   if(_data.backend().isneg())
+   if(!_big)
+   {
+      if(_val < 0)
+      {
+         return sign ? bitLength(static_cast<usmall_t>(~_val)) + 1 : std::numeric_limits<number>::digits;
+      }
+      else if(_val == 0)
+      {
+         return 1U;
+      }
+      return bitLength(static_cast<usmall_t>(_val)) + sign;
+   }
+   const auto& data = *_big;
+   if(data.backend().isneg())
    {
       if(!sign)
       {
          return std::numeric_limits<number>::digits;
       }
       return std::numeric_limits<number>::digits + 1 -
-             APInt(-_data - 1).leadingZeros(std::numeric_limits<number>::digits);
+             APInt(-data - 1).leadingZeros(std::numeric_limits<number>::digits);
    }
-   else if(_data.is_zero())
+   else if(data.is_zero())
    {
       return 1U;
    }
@@ -438,12 +665,14 @@ APInt APInt::getSignedMinValue(bw_t bw)
 
 std::ostream& operator<<(std::ostream& str, const APInt& v)
 {
-   str << v._data;
+   str << v.getNumber();
    return str;
 }
 
 std::istream& operator>>(std::istream& str, APInt& v)
 {
-   str >> v._data;
+   APInt::number data;
+   str >> data;
+   v.setNumber(data);
    return str;
 }
@@ -44,6 +44,7 @@
 #define APINT_HPP
 
 #include <iostream>
+#include <memory>
 #include <string>
 #include <type_traits>
 
@@ -59,24 +60,69 @@ class APInt
    using bw_t = uint16_t;
 
  private:
-   number _data;
+   __extension__ typedef __int128 small_t;
+   __extension__ typedef unsigned __int128 usmall_t;
+
+   /// Number of value bits of the inline representation
+   static constexpr bw_t small_digits = 127;
+
+   /// Inline value, valid when _big is not allocated
+   small_t _val;
+
+   /// Arbitrary precision value, allocated only when the value does not fit the inline representation
+   std::unique_ptr<number> _big;
+
+   /**
+    * Return the value as an arbitrary precision number
+    */
+   number getNumber() const;
+
+   /**
+    * Set the value from an arbitrary precision number, using the inline representation when possible
+    * @param v is the new value
+    */
+   void setNumber(const number& v);
+
+   /**
+    * Three-way comparison of two values
+    * @return a negative value if lhs < rhs, zero if lhs == rhs, a positive value otherwise
+    */
+   static int compare(const APInt& lhs, const APInt& rhs);
 
  public:
    APInt();
 
+   APInt(const APInt& other);
+
+   APInt(APInt&& other) noexcept = default;
+
+   APInt& operator=(const APInt& other);
+
+   APInt& operator=(APInt&& other) noexcept = default;
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wzero-as-null-pointer-constant"
    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
-   APInt(T val) : _data(val)
+   APInt(T val) : _val(0)
    {
+      if constexpr(std::is_integral<T>::value)
+      {
+         _val = val;
+      }
+      else
+      {
+         setNumber(number(val));
+      }
    }
 
-   APInt(const number& v) : _data(v)
+   APInt(const number& v) : _val(0)
    {
+      setNumber(v);
    }
 
-   APInt(const std::string& str) : _data(boost::lexical_cast<number>(str))
+   APInt(const std::string& str) : _val(0)
    {
+      setNumber(boost::lexical_cast<number>(str));
    }
 #pragma GCC diagnostic pop
 
@@ -142,7 +188,11 @@ class APInt
    explicit operator T() const
    {
       using U = typename std::make_unsigned<T>::type;
-      return static_cast<T>(static_cast<U>(_data & std::numeric_limits<U>::max()));
+      if(!_big)
+      {
+         return static_cast<T>(static_cast<U>(_val));
+      }
+      return static_cast<T>(static_cast<U>(*_big & std::numeric_limits<U>::max()));
    }
 
    static APInt getMaxValue(bw_t bw);
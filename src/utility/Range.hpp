@@ -91,7 +91,7 @@ class Range
    APInt getUnsignedMax() const;
    APInt getUnsignedMin() const;
    APInt getSpan() const;
-   virtual std::deque<bit_lattice> getBitValues(bool isSigned) const;
+   virtual bit_lattice_string getBitValues(bool isSigned) const;
    virtual RangeRef getAnti() const;
 
    virtual bool isUnknown() const;
@@ -160,7 +160,7 @@ class Range
    static const APInt Max;
    static const APInt MinDelta;
    static bw_t neededBits(const APInt& a, const APInt& b, bool sign);
-   static RangeRef fromBitValues(const std::deque<bit_lattice>& bv, bw_t bitwidth, bool isSigned);
+   static RangeRef fromBitValues(const bit_lattice_string& bv, bw_t bitwidth, bool isSigned);
 };
 
 std::ostream& operator<<(std::ostream& OS, const Range& R);
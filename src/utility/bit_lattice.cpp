@@ -41,19 +41,972 @@
 
 #include "exceptions.hpp"
 
-std::deque<bit_lattice> create_u_bitstring(size_t lenght)
+#include <algorithm>
+
+const bit_lattice_adder_table plus_expr_map = {
+        // a b carry
+        {
+            bit_lattice::X,
+            {
+                {
+                    bit_lattice::X,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::X},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ZERO, bit_lattice::X},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::ZERO, bit_lattice::X},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ZERO,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ZERO, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ONE,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::U,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+            },
+        },
+        {
+            bit_lattice::ZERO,
+            {
+                {
+                    bit_lattice::X,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ZERO, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ZERO,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ZERO, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ONE,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::U,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+            },
+        },
+        {
+            bit_lattice::ONE,
+            {
+                {
+                    bit_lattice::X,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ZERO,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ONE,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ONE, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::ONE, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::U,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+            },
+        },
+        {
+            bit_lattice::U,
+            {
+                {
+                    bit_lattice::X,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ZERO,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ONE,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::U,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+            },
+        },
+};
+
+const bit_lattice_adder_table minus_expr_map = {
+        // a b borrow
+        {
+            bit_lattice::X,
+            {
+                {
+                    bit_lattice::X,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::X},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ZERO, bit_lattice::X},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::ZERO, bit_lattice::X},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ZERO,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ONE,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::U,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+            },
+        },
+        {
+            bit_lattice::ZERO,
+            {
+                {
+                    bit_lattice::X,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ZERO, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ZERO,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ONE,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ONE, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::ONE, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::U,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+            },
+        },
+        {
+            bit_lattice::ONE,
+            {
+                {
+                    bit_lattice::X,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ZERO,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ONE,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::ZERO},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::ONE},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::U,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+            },
+        },
+        {
+            bit_lattice::U,
+            {
+                {
+                    bit_lattice::X,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ZERO,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::ZERO, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::ONE,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::ONE, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+                {
+                    bit_lattice::U,
+                    {
+                        {
+                            bit_lattice::ZERO,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::ONE,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                        {
+                            bit_lattice::U,
+                            {bit_lattice::U, bit_lattice::U},
+                        },
+                    },
+                },
+            },
+        },
+};
+
+const bit_lattice_table<bit_lattice_table<bit_lattice>> bit_ior_expr_map = {
+    {
+        bit_lattice::ZERO,
+        {
+            {bit_lattice::ZERO, bit_lattice::ZERO},
+            {bit_lattice::ONE, bit_lattice::ONE},
+            {bit_lattice::U, bit_lattice::U},
+            {bit_lattice::X, bit_lattice::X},
+        },
+    },
+    {
+        bit_lattice::ONE,
+        {
+            {bit_lattice::ZERO, bit_lattice::ONE},
+            {bit_lattice::ONE, bit_lattice::ONE},
+            {bit_lattice::U, bit_lattice::ONE},
+            {bit_lattice::X, bit_lattice::ONE},
+        },
+    },
+    {
+        bit_lattice::U,
+        {
+            {bit_lattice::ZERO, bit_lattice::U},
+            {bit_lattice::ONE, bit_lattice::ONE},
+            {bit_lattice::U, bit_lattice::U},
+            {bit_lattice::X, bit_lattice::X},
+        },
+    },
+    {
+        bit_lattice::X,
+        {
+            {bit_lattice::ZERO, bit_lattice::X},
+            {bit_lattice::ONE, bit_lattice::ONE},
+            {bit_lattice::U, bit_lattice::X},
+            {bit_lattice::X, bit_lattice::X},
+        },
+    },
+};
+
+const bit_lattice_table<bit_lattice_table<bit_lattice>> bit_xor_expr_map = {
+    {
+        bit_lattice::ZERO,
+        {
+            {bit_lattice::ZERO, bit_lattice::ZERO},
+            {bit_lattice::ONE, bit_lattice::ONE},
+            {bit_lattice::U, bit_lattice::U},
+            {bit_lattice::X, bit_lattice::X},
+        },
+    },
+    {
+        bit_lattice::ONE,
+        {
+            {bit_lattice::ZERO, bit_lattice::ONE},
+            {bit_lattice::ONE, bit_lattice::ZERO},
+            {bit_lattice::U, bit_lattice::U},
+            {bit_lattice::X, bit_lattice::X},
+        },
+    },
+    {
+        bit_lattice::U,
+        {
+            {bit_lattice::ZERO, bit_lattice::U},
+            {bit_lattice::ONE, bit_lattice::U},
+            {bit_lattice::U, bit_lattice::U},
+            {bit_lattice::X, bit_lattice::X},
+        },
+    },
+    {
+        bit_lattice::X,
+        {
+            {bit_lattice::ZERO, bit_lattice::X},
+            {bit_lattice::ONE, bit_lattice::X},
+            {bit_lattice::U, bit_lattice::X},
+            {bit_lattice::X, bit_lattice::X},
+        },
+    },
+};
+
+const bit_lattice_table<bit_lattice_table<bit_lattice>> bit_and_expr_map = {
+    {
+        bit_lattice::ZERO,
+        {
+            {bit_lattice::ZERO, bit_lattice::ZERO},
+            {bit_lattice::ONE, bit_lattice::ZERO},
+            {bit_lattice::U, bit_lattice::ZERO},
+            {bit_lattice::X, bit_lattice::ZERO},
+        },
+    },
+    {
+        bit_lattice::ONE,
+        {
+            {bit_lattice::ZERO, bit_lattice::ZERO},
+            {bit_lattice::ONE, bit_lattice::ONE},
+            {bit_lattice::U, bit_lattice::U},
+            {bit_lattice::X, bit_lattice::X},
+        },
+    },
+    {
+        bit_lattice::U,
+        {
+            {bit_lattice::ZERO, bit_lattice::ZERO},
+            {bit_lattice::ONE, bit_lattice::U},
+            {bit_lattice::U, bit_lattice::U},
+            {bit_lattice::X, bit_lattice::X},
+        },
+    },
+    {
+        bit_lattice::X,
+        {
+            {bit_lattice::ZERO, bit_lattice::ZERO},
+            {bit_lattice::ONE, bit_lattice::X},
+            {bit_lattice::U, bit_lattice::X},
+            {bit_lattice::X, bit_lattice::X},
+        },
+    },
+};
+
+/**
+ * Flatten a full adder/subtractor table in the format used by bit_lattice_string::ripple
+ */
+static std::array<unsigned char, 64> flatten_adder_table(const bit_lattice_adder_table& table)
+{
+   std::array<unsigned char, 64> res{};
+   for(const auto a : {bit_lattice::U, bit_lattice::ZERO, bit_lattice::ONE, bit_lattice::X})
+   {
+      for(const auto b : {bit_lattice::U, bit_lattice::ZERO, bit_lattice::ONE, bit_lattice::X})
+      {
+         /// carry and borrow are never <X>
+         for(const auto c : {bit_lattice::U, bit_lattice::ZERO, bit_lattice::ONE})
+         {
+            const auto& cell = table.at(a).at(b).at(c);
+            res[(static_cast<unsigned int>(a) << 4) | (static_cast<unsigned int>(b) << 2) |
+                static_cast<unsigned int>(c)] =
+                static_cast<unsigned char>(static_cast<unsigned int>(cell.back()) |
+                                           (static_cast<unsigned int>(cell.front()) << 2));
+         }
+      }
+   }
+   return res;
+}
+
+bit_lattice_string::bit_lattice_string(size_t count, bit_lattice b) : words(), length(0)
+{
+   resize_front(count);
+   fill(0, count, b);
+}
+
+bit_lattice_string::bit_lattice_string(const_iterator first, const_iterator last) : words(), length(0)
+{
+   THROW_ASSERT(first <= last, "invalid range");
+   if(first != last)
+   {
+      *this = first.str->extract(first.str->length - last.index, last.index - first.index);
+   }
+}
+
+void bit_lattice_string::resize_front(size_t new_length)
+{
+   words.resize((new_length + word_size - 1) / word_size, plane_word{0, 0});
+   const auto shrink = new_length < length;
+   length = new_length;
+   if(shrink)
+   {
+      clear_unused_bits();
+   }
+}
+
+void bit_lattice_string::fill(size_t pos, size_t count, bit_lattice b)
+{
+   THROW_ASSERT(pos + count <= length, "bit range out of bitstring");
+   const auto zero = (static_cast<unsigned int>(b) & 1) ? ~std::uint64_t(0) : std::uint64_t(0);
+   const auto one = (static_cast<unsigned int>(b) & 2) ? ~std::uint64_t(0) : std::uint64_t(0);
+   while(count)
+   {
+      const auto shift = pos % word_size;
+      const auto bits = std::min(count, word_size - shift);
+      const auto mask = low_mask(bits) << shift;
+      auto& w = words[pos / word_size];
+      w.zero = (w.zero & ~mask) | (zero & mask);
+      w.one = (w.one & ~mask) | (one & mask);
+      pos += bits;
+      count -= bits;
+   }
+}
+
+bit_lattice_string bit_lattice_string::extract(size_t pos, size_t count) const
+{
+   THROW_ASSERT(pos + count <= length, "bit range out of bitstring");
+   bit_lattice_string res;
+   res.resize_front(count);
+   const auto first_word = pos / word_size;
+   const auto shift = pos % word_size;
+   for(size_t i = 0; i < res.words.size(); ++i)
+   {
+      const auto& src = words[first_word + i];
+      auto& w = res.words[i];
+      w.zero = src.zero >> shift;
+      w.one = src.one >> shift;
+      if(shift && first_word + i + 1 < words.size())
+      {
+         w.zero |= words[first_word + i + 1].zero << (word_size - shift);
+         w.one |= words[first_word + i + 1].one << (word_size - shift);
+      }
+   }
+   res.clear_unused_bits();
+   return res;
+}
+
+void bit_lattice_string::merge(const bit_lattice_string& source, size_t pos)
+{
+   THROW_ASSERT(pos + source.length <= length, "bit range out of bitstring");
+   const auto first_word = pos / word_size;
+   const auto shift = pos % word_size;
+   for(size_t i = 0; i < source.words.size(); ++i)
+   {
+      const auto& src = source.words[i];
+      auto& w = words[first_word + i];
+      w.zero |= src.zero << shift;
+      w.one |= src.one << shift;
+      if(shift && first_word + i + 1 < words.size())
+      {
+         words[first_word + i + 1].zero |= src.zero >> (word_size - shift);
+         words[first_word + i + 1].one |= src.one >> (word_size - shift);
+      }
+   }
+}
+
+void bit_lattice_string::splice(size_t index, const bit_lattice_string& source)
+{
+   THROW_ASSERT(index <= length, "bit index " + std::to_string(index) + " out of range");
+   const auto low_count = length - index;
+   const auto high = extract(low_count, index);
+   resize_front(low_count);
+   resize_front(low_count + source.length + index);
+   merge(source, low_count);
+   merge(high, low_count + source.length);
+}
+
+void bit_lattice_string::push_back(bit_lattice b)
+{
+   resize_front(length + 1);
+   for(auto i = words.size(); i-- > 0;)
+   {
+      words[i].zero = (words[i].zero << 1) | (i ? words[i - 1].zero >> (word_size - 1) : 0);
+      words[i].one = (words[i].one << 1) | (i ? words[i - 1].one >> (word_size - 1) : 0);
+   }
+   set_bit(0, b);
+}
+
+void bit_lattice_string::pop_back()
+{
+   THROW_ASSERT(length, "empty bitstring");
+   for(size_t i = 0; i < words.size(); ++i)
+   {
+      words[i].zero = (words[i].zero >> 1) | (i + 1 < words.size() ? words[i + 1].zero << (word_size - 1) : 0);
+      words[i].one = (words[i].one >> 1) | (i + 1 < words.size() ? words[i + 1].one << (word_size - 1) : 0);
+   }
+   resize_front(length - 1);
+}
+
+bit_lattice_string::const_iterator bit_lattice_string::insert(const_iterator pos, size_t count, bit_lattice b)
+{
+   const auto index = pos.index;
+   if(index == 0)
+   {
+      const auto old_length = length;
+      resize_front(length + count);
+      fill(old_length, count, b);
+   }
+   else
+   {
+      splice(index, bit_lattice_string(count, b));
+   }
+   return const_iterator(this, index);
+}
+
+bit_lattice_string::const_iterator bit_lattice_string::insert(const_iterator pos, const_iterator first,
+                                                              const_iterator last)
+{
+   const auto index = pos.index;
+   splice(index, bit_lattice_string(first, last));
+   return const_iterator(this, index);
+}
+
+bit_lattice_string::const_iterator bit_lattice_string::erase(const_iterator first, const_iterator last)
+{
+   THROW_ASSERT(first <= last && last.index <= length, "invalid range");
+   const auto low_count = length - last.index;
+   const auto high = extract(length - first.index, first.index);
+   resize_front(low_count);
+   resize_front(low_count + first.index);
+   merge(high, low_count);
+   return const_iterator(this, first.index);
+}
+
+bool bit_lattice_string::operator==(const bit_lattice_string& other) const
+{
+   return length == other.length &&
+          std::equal(words.begin(), words.end(), other.words.begin(), [](const plane_word& a, const plane_word& b) {
+             return a.zero == b.zero && a.one == b.one;
+          });
+}
+
+template <typename F>
+bit_lattice_string bit_lattice_string::combine(const bit_lattice_string& a, const bit_lattice_string& b, size_t size,
+                                               F op)
+{
+   bit_lattice_string res;
+   res.resize_front(std::min({size, a.length, b.length}));
+   for(size_t i = 0; i < res.words.size(); ++i)
+   {
+      res.words[i] = op(a.words[i], b.words[i]);
+   }
+   res.clear_unused_bits();
+   return res;
+}
+
+template <typename F>
+bit_lattice_string bit_lattice_string::ripple(const bit_lattice_string& a, const bit_lattice_string& b,
+                                              bit_lattice& carry, size_t size, const std::array<unsigned char, 64>& cells,
+                                              F constant_op)
 {
-   return std::deque<bit_lattice>(lenght, bit_lattice::U);
+   bit_lattice_string res;
+   res.resize_front(std::min({size, a.length, b.length}));
+   auto c = static_cast<unsigned int>(carry);
+   for(size_t i = 0; i < res.words.size(); ++i)
+   {
+      const auto bits = std::min(word_size, res.length - i * word_size);
+      const auto mask = low_mask(bits);
+      const auto& wa = a.words[i];
+      const auto& wb = b.words[i];
+      auto& w = res.words[i];
+      if((c == static_cast<unsigned int>(bit_lattice::ZERO) || c == static_cast<unsigned int>(bit_lattice::ONE)) &&
+         ((wa.zero ^ wa.one) & mask) == mask && ((wb.zero ^ wb.one) & mask) == mask)
+      {
+         /// all the bits are constant, so the one plane holds the value of the operands
+         const auto result_carries = constant_op(wa.one, wb.one, c == static_cast<unsigned int>(bit_lattice::ONE));
+         w.one = result_carries.first & mask;
+         w.zero = ~result_carries.first & mask;
+         c = static_cast<unsigned int>(((result_carries.second >> (bits - 1)) & 1) ? bit_lattice::ONE :
+                                                                                     bit_lattice::ZERO);
+      }
+      else
+      {
+         for(size_t k = 0; k < bits; ++k)
+         {
+            const auto a_bit = ((wa.zero >> k) & 1) | (((wa.one >> k) & 1) << 1);
+            const auto b_bit = ((wb.zero >> k) & 1) | (((wb.one >> k) & 1) << 1);
+            const unsigned int cell = cells[(a_bit << 4) | (b_bit << 2) | c];
+            w.zero |= std::uint64_t(cell & 1) << k;
+            w.one |= std::uint64_t((cell >> 1) & 1) << k;
+            c = cell >> 2;
+         }
+      }
+   }
+   carry = static_cast<bit_lattice>(c);
+   return res;
 }
 
-std::deque<bit_lattice> create_x_bitstring(size_t lenght)
+bit_lattice_string create_u_bitstring(size_t lenght)
 {
-   return std::deque<bit_lattice>(lenght, bit_lattice::X);
+   return bit_lattice_string(lenght, bit_lattice::U);
 }
 
-std::deque<bit_lattice> create_bitstring_from_constant(integer_cst_t value, unsigned long long len, bool signed_value)
+bit_lattice_string create_x_bitstring(size_t lenght)
 {
-   std::deque<bit_lattice> res;
+   return bit_lattice_string(lenght, bit_lattice::X);
+}
+
+bit_lattice_string create_bitstring_from_constant(integer_cst_t value, unsigned long long len, bool signed_value)
+{
+   bit_lattice_string res;
    if(value == 0)
    {
       res.push_front(bit_lattice::ZERO);
@@ -71,9 +1024,10 @@ std::deque<bit_lattice> create_bitstring_from_constant(integer_cst_t value, unsi
    return res;
 }
 
-std::string bitstring_to_string(const std::deque<bit_lattice>& bitstring)
+std::string bitstring_to_string(const bit_lattice_string& bitstring)
 {
    std::string res;
+   res.reserve(bitstring.size());
    for(const auto bit : bitstring)
    {
       switch(bit)
@@ -98,87 +1052,128 @@ std::string bitstring_to_string(const std::deque<bit_lattice>& bitstring)
    return res;
 }
 
-std::deque<bit_lattice> string_to_bitstring(const std::string& s)
+bit_lattice_string string_to_bitstring(const std::string& s)
 {
-   std::deque<bit_lattice> res;
-   for(const auto bit : s)
+   bit_lattice_string res;
+   for(auto it = s.rbegin(); it != s.rend(); ++it)
    {
-      switch(bit)
+      switch(*it)
       {
          case('U'):
-            res.push_back(bit_lattice::U);
+            res.push_front(bit_lattice::U);
             break;
          case('X'):
-            res.push_back(bit_lattice::X);
+            res.push_front(bit_lattice::X);
             break;
          case('0'):
-            res.push_back(bit_lattice::ZERO);
+            res.push_front(bit_lattice::ZERO);
             break;
          case('1'):
-            res.push_back(bit_lattice::ONE);
+            res.push_front(bit_lattice::ONE);
             break;
          default:
-            THROW_ERROR(std::string("unexpected char in bitvalue string: ") + bit);
+            THROW_ERROR(std::string("unexpected char in bitvalue string: ") + *it);
             break;
       }
    }
    return res;
 }
 
-bool bitstring_constant(const std::deque<bit_lattice>& a)
+bool bitstring_constant(const bit_lattice_string& a)
 {
-   bool res = true;
-   for(const auto i : a)
+   for(size_t i = 0; i < a.words.size(); ++i)
    {
-      if(i == bit_lattice::U || i == bit_lattice::X)
+      /// <U> and <X> bits have the same value on both the planes
+      const auto mask = bit_lattice_string::low_mask(a.length - i * bit_lattice_string::word_size);
+      if(((a.words[i].zero ^ a.words[i].one) & mask) != mask)
       {
-         res = false;
-         break;
+         return false;
       }
    }
-   return res;
+   return true;
 }
 
-bit_lattice bit_sup(const bit_lattice a, const bit_lattice b)
+bit_lattice_string bitstring_sup(const bit_lattice_string& a, const bit_lattice_string& b, size_t size)
 {
-   if(a == b)
-   {
-      return a;
-   }
-   else if(a == bit_lattice::X || b == bit_lattice::X)
-   {
-      return bit_lattice::X;
-   }
-   else if(a == bit_lattice::U)
-   {
-      return b;
-   }
-   else if(b == bit_lattice::U)
-   {
-      return a;
-   }
-   else
-   {
-      return bit_lattice::X;
-   }
+   return bit_lattice_string::combine(a, b, size, [](const auto& x, const auto& y) {
+      return bit_lattice_string::plane_word{x.zero | y.zero, x.one | y.one};
+   });
+}
+
+bit_lattice_string bitstring_inf(const bit_lattice_string& a, const bit_lattice_string& b, size_t size)
+{
+   return bit_lattice_string::combine(a, b, size, [](const auto& x, const auto& y) {
+      return bit_lattice_string::plane_word{x.zero & y.zero, x.one & y.one};
+   });
 }
 
-std::deque<bit_lattice> sup(const std::deque<bit_lattice>& _a, const std::deque<bit_lattice>& _b,
-                            const size_t out_type_size, const bool out_is_signed, const bool out_is_bool)
+bit_lattice_string bitstring_and(const bit_lattice_string& a, const bit_lattice_string& b, size_t size)
+{
+   return bit_lattice_string::combine(a, b, size, [](const auto& x, const auto& y) {
+      /// <0> on any operand gives <0>, <1> is neutral, otherwise the sup of the operands
+      const auto zero = (x.zero & ~x.one) | (y.zero & ~y.one);
+      return bit_lattice_string::plane_word{x.zero | y.zero, ~zero & ((x.one & y.one) | x.zero | y.zero)};
+   });
+}
+
+bit_lattice_string bitstring_ior(const bit_lattice_string& a, const bit_lattice_string& b, size_t size)
+{
+   return bit_lattice_string::combine(a, b, size, [](const auto& x, const auto& y) {
+      /// <1> on any operand gives <1>, <0> is neutral, otherwise the sup of the operands
+      const auto one = (x.one & ~x.zero) | (y.one & ~y.zero);
+      return bit_lattice_string::plane_word{~one & ((x.zero & y.zero) | x.one | y.one), x.one | y.one};
+   });
+}
+
+bit_lattice_string bitstring_xor(const bit_lattice_string& a, const bit_lattice_string& b, size_t size)
+{
+   return bit_lattice_string::combine(a, b, size, [](const auto& x, const auto& y) {
+      /// <X> on any operand gives <X>, otherwise <U> on any operand gives <U>
+      const auto any_x = (x.zero & x.one) | (y.zero & y.one);
+      const auto constant = (x.zero | x.one) & (y.zero | y.one);
+      const auto value = x.one ^ y.one;
+      return bit_lattice_string::plane_word{any_x | (constant & ~value), any_x | (constant & value)};
+   });
+}
+
+bit_lattice_string bitstring_plus(const bit_lattice_string& a, const bit_lattice_string& b, bit_lattice& carry,
+                                  size_t size)
+{
+   static const auto cells = flatten_adder_table(plus_expr_map);
+   return bit_lattice_string::ripple(a, b, carry, size, cells,
+                                     [](std::uint64_t x, std::uint64_t y, std::uint64_t carry_in) {
+                                        const auto sum = x + y + carry_in;
+                                        return std::make_pair(sum, (x & y) | ((x | y) & ~sum));
+                                     });
+}
+
+bit_lattice_string bitstring_minus(const bit_lattice_string& a, const bit_lattice_string& b, bit_lattice& borrow,
+                                   size_t size)
+{
+   static const auto cells = flatten_adder_table(minus_expr_map);
+   return bit_lattice_string::ripple(a, b, borrow, size, cells,
+                                     [](std::uint64_t x, std::uint64_t y, std::uint64_t borrow_in) {
+                                        const auto difference = x - y - borrow_in;
+                                        return std::make_pair(difference, (~x & y) | ((~x | y) & difference));
+                                     });
+}
+
+bit_lattice_string sup(const bit_lattice_string& _a, const bit_lattice_string& _b, const size_t out_type_size,
+                       const bool out_is_signed, const bool out_is_bool)
 {
    THROW_ASSERT(!_a.empty() && !_b.empty(), "a = " + std::string(_a.empty() ? "empty" : bitstring_to_string(_a)) +
                                                 ", b = " + (_b.empty() ? "empty" : bitstring_to_string(_b)));
    THROW_ASSERT(out_type_size, "Size can not be zero");
    THROW_ASSERT(!out_is_bool || (out_type_size == 1), "boolean with type size != 1");
-   std::deque<bit_lattice> res;
+   bit_lattice_string res;
    if(out_is_bool)
    {
       res.push_back(bit_sup(_a.back(), _b.back()));
       return res;
    }
 
-   std::deque<bit_lattice> longer = (_a.size() >= _b.size()) ? _a : _b;
-   std::deque<bit_lattice> shorter = (_a.size() >= _b.size()) ? _b : _a;
+   bit_lattice_string longer = (_a.size() >= _b.size()) ? _a : _b;
+   bit_lattice_string shorter = (_a.size() >= _b.size()) ? _b : _a;
    while(longer.size() > out_type_size)
    {
       longer.pop_front();
@@ -222,14 +1217,7 @@ std::deque<bit_lattice> sup(const std::deque<bit_lattice>& _a, const std::deque<
    //       }
    //    }
 
-   auto a_it = longer.crbegin();
-   auto b_it = shorter.crbegin();
-   const auto a_end = longer.crend();
-   const auto b_end = shorter.crend();
-   for(; a_it != a_end && b_it != b_end; a_it++, b_it++)
-   {
-      res.push_front(bit_sup(*a_it, *b_it));
-   }
+   res = bitstring_sup(longer, shorter, out_type_size);
 
    if(res.empty())
    {
@@ -279,66 +1267,35 @@ std::deque<bit_lattice> sup(const std::deque<bit_lattice>& _a, const std::deque<
    return res;
 }
 
-bit_lattice bit_inf(const bit_lattice a, const bit_lattice b)
-{
-   if(a == b)
-   {
-      return a;
-   }
-   else if(a == bit_lattice::U || b == bit_lattice::U)
-   {
-      return bit_lattice::U;
-   }
-   else if(a == bit_lattice::X)
-   {
-      return b;
-   }
-   else if(b == bit_lattice::X)
-   {
-      return a;
-   }
-   else
-   {
-      return bit_lattice::U;
-   }
-}
-
-std::deque<bit_lattice> inf(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                            const size_t out_type_size, const bool out_is_signed, const bool out_is_bool)
+bit_lattice_string inf(const bit_lattice_string& a, const bit_lattice_string& b, const size_t out_type_size,
+                       const bool out_is_signed, const bool out_is_bool)
 {
    THROW_ASSERT(!(a.empty() && b.empty()),
                 "a.size() = " + std::to_string(a.size()) + " b.size() = " + std::to_string(b.size()));
    THROW_ASSERT(out_type_size, "");
    THROW_ASSERT(!out_is_bool || (out_type_size == 1), "boolean with type size != 1");
-   std::deque<bit_lattice> res;
+   bit_lattice_string res;
    if(out_is_bool)
    {
       res.push_back(bit_inf(a.back(), b.back()));
       return res;
    }
 
-   std::deque<bit_lattice> a_copy = a;
-   std::deque<bit_lattice> b_copy = b;
+   bit_lattice_string a_copy = a;
+   bit_lattice_string b_copy = b;
    sign_reduce_bitstring(a_copy, out_is_signed);
    sign_reduce_bitstring(b_copy, out_is_signed);
 
    // a_tmp is the longer bistring
-   std::deque<bit_lattice> a_tmp = (a_copy.size() >= b_copy.size()) ? a_copy : b_copy;
-   std::deque<bit_lattice> b_tmp = (a_copy.size() >= b_copy.size()) ? b_copy : a_copy;
+   bit_lattice_string a_tmp = (a_copy.size() >= b_copy.size()) ? a_copy : b_copy;
+   bit_lattice_string b_tmp = (a_copy.size() >= b_copy.size()) ? b_copy : a_copy;
 
    if(a_tmp.size() > b_tmp.size())
    {
       b_tmp = sign_extend_bitstring(b_tmp, out_is_signed, a_tmp.size());
    }
 
-   auto a_it = a_tmp.crbegin();
-   auto b_it = b_tmp.crbegin();
-   const auto a_end = a_tmp.crend();
-   const auto b_end = b_tmp.crend();
-   for(; a_it != a_end && b_it != b_end; a_it++, b_it++)
-   {
-      res.push_front(bit_inf(*a_it, *b_it));
-   }
+   res = bitstring_inf(a_tmp, b_tmp, a_tmp.size());
 
    if(res.empty())
    {
@@ -355,7 +1312,7 @@ std::deque<bit_lattice> inf(const std::deque<bit_lattice>& a, const std::deque<b
 }
 
 /// function slightly different than tree_helper.cpp: sign_reduce_bitstring
-void sign_reduce_bitstring(std::deque<bit_lattice>& bitstring, bool bitstring_is_signed)
+void sign_reduce_bitstring(bit_lattice_string& bitstring, bool bitstring_is_signed)
 {
    THROW_ASSERT(!bitstring.empty(), "");
    while(bitstring.size() > 1)
@@ -392,21 +1349,18 @@ void sign_reduce_bitstring(std::deque<bit_lattice>& bitstring, bool bitstring_is
    }
 }
 
-std::deque<bit_lattice> sign_extend_bitstring(const std::deque<bit_lattice>& bitstring, bool bitstring_is_signed,
-                                              size_t final_size)
+bit_lattice_string sign_extend_bitstring(const bit_lattice_string& bitstring, bool bitstring_is_signed,
+                                         size_t final_size)
 {
    THROW_ASSERT(final_size, "cannot sign extend a bitstring to final_size 0");
    THROW_ASSERT(final_size > bitstring.size(), "useless sign extension");
-   std::deque<bit_lattice> res = bitstring;
+   bit_lattice_string res = bitstring;
    if(res.empty())
    {
       res.push_front(bit_lattice::X);
    }
    const auto sign_bit = (bitstring_is_signed || res.front() == bit_lattice::X) ? res.front() : bit_lattice::ZERO;
-   while(res.size() < final_size)
-   {
-      res.push_front(sign_bit);
-   }
+   res.insert(res.begin(), final_size - res.size(), sign_bit);
    return res;
 }
 
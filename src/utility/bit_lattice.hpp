@@ -40,32 +40,589 @@
 
 #ifndef _BIT_LATTICE_HPP
 #define _BIT_LATTICE_HPP
+#include "exceptions.hpp"
 #include "panda_types.hpp"
 
-#include <deque>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
 #include <string>
+#include <utility>
+#include <vector>
 
+/**
+ * Lattice of the values a single bit can assume.
+ * Values are encoded on two bit-planes: bit 0 is set when the bit may be zero, bit 1 is set when the bit may be one.
+ * With this encoding the sup of two values is their bitwise or and the inf is their bitwise and.
+ */
 enum class bit_lattice
 {
-   U,
-   ZERO,
-   ONE,
-   X
+   U = 0,
+   ZERO = 1,
+   ONE = 2,
+   X = 3
 };
 
+/**
+ * Dense table indexed by bit_lattice values.
+ * It can be initialized with the same syntax of a std::map<bit_lattice, T>, but lookups are a plain array access.
+ */
+template <typename T>
+class bit_lattice_table
+{
+ private:
+   /// The values associated with each element of the lattice
+   std::array<T, 4> values;
+
+#if HAVE_ASSERTS
+   /// Mask of the elements which have been explicitly initialized
+   unsigned int defined;
+#endif
+
+ public:
+   bit_lattice_table()
+       : values()
+#if HAVE_ASSERTS
+         ,
+         defined(0)
+#endif
+   {
+   }
+
+   bit_lattice_table(std::initializer_list<std::pair<bit_lattice, T>> init) : bit_lattice_table()
+   {
+      for(const auto& entry : init)
+      {
+         values[static_cast<size_t>(entry.first)] = entry.second;
+#if HAVE_ASSERTS
+         defined |= 1U << static_cast<unsigned int>(entry.first);
+#endif
+      }
+   }
+
+   /**
+    * Return the value associated with a lattice element
+    * @param b is the lattice element
+    * @return the associated value
+    */
+   const T& at(bit_lattice b) const
+   {
+      THROW_ASSERT(defined & (1U << static_cast<unsigned int>(b)), "bit_lattice value missing from table");
+      return values[static_cast<size_t>(b)];
+   }
+};
+
+/**
+ * Pair of bits produced by a full adder/subtractor transfer function: front is the carry/borrow, back is the result
+ */
+using bit_lattice_pair = std::array<bit_lattice, 2>;
+
+/**
+ * Table of a full adder/subtractor transfer function, indexed by the two operands and by the incoming carry/borrow
+ */
+using bit_lattice_adder_table = bit_lattice_table<bit_lattice_table<bit_lattice_table<bit_lattice_pair>>>;
+
+/**
+ * String of bit_lattice values.
+ * It provides the subset of the std::deque interface used by the bit value analysis: front() is the most significant
+ * bit and back() is the least significant one. Bits are packed on the two bit-planes of the bit_lattice encoding in
+ * 64-bit words starting from the least significant bit, so that extending or truncating the string on the most
+ * significant side never moves the other bits and the bitwise transfer functions work on whole words.
+ * Elements are returned by value: single bits are modified through set().
+ */
+class bit_lattice_string
+{
+ public:
+   using value_type = bit_lattice;
+   using size_type = size_t;
+   using difference_type = std::ptrdiff_t;
+
+   /**
+    * Random access iterator over the bits, from the most significant one
+    */
+   class const_iterator
+   {
+    public:
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type = bit_lattice;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = bit_lattice;
+
+    private:
+      friend class bit_lattice_string;
+
+      /// The iterated bitstring
+      const bit_lattice_string* str;
+
+      /// Position of the current bit starting from the most significant one
+      size_t index;
+
+      const_iterator(const bit_lattice_string* _str, size_t _index) : str(_str), index(_index)
+      {
+      }
+
+    public:
+      const_iterator() : str(nullptr), index(0)
+      {
+      }
+
+      bit_lattice operator*() const
+      {
+         return (*str)[index];
+      }
+
+      bit_lattice operator[](difference_type n) const
+      {
+         return (*str)[static_cast<size_t>(static_cast<difference_type>(index) + n)];
+      }
+
+      const_iterator& operator++()
+      {
+         ++index;
+         return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+         const auto ret = *this;
+         ++index;
+         return ret;
+      }
+
+      const_iterator& operator--()
+      {
+         --index;
+         return *this;
+      }
+
+      const_iterator operator--(int)
+      {
+         const auto ret = *this;
+         --index;
+         return ret;
+      }
+
+      const_iterator& operator+=(difference_type n)
+      {
+         index = static_cast<size_t>(static_cast<difference_type>(index) + n);
+         return *this;
+      }
+
+      const_iterator& operator-=(difference_type n)
+      {
+         index = static_cast<size_t>(static_cast<difference_type>(index) - n);
+         return *this;
+      }
+
+      const_iterator operator+(difference_type n) const
+      {
+         return const_iterator(*this) += n;
+      }
+
+      friend const_iterator operator+(difference_type n, const const_iterator& it)
+      {
+         return it + n;
+      }
+
+      const_iterator operator-(difference_type n) const
+      {
+         return const_iterator(*this) -= n;
+      }
+
+      difference_type operator-(const const_iterator& other) const
+      {
+         return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+      }
+
+      bool operator==(const const_iterator& other) const
+      {
+         return index == other.index;
+      }
+
+      bool operator!=(const const_iterator& other) const
+      {
+         return index != other.index;
+      }
+
+      bool operator<(const const_iterator& other) const
+      {
+         return index < other.index;
+      }
+
+      bool operator>(const const_iterator& other) const
+      {
+         return index > other.index;
+      }
+
+      bool operator<=(const const_iterator& other) const
+      {
+         return index <= other.index;
+      }
+
+      bool operator>=(const const_iterator& other) const
+      {
+         return index >= other.index;
+      }
+   };
+
+   using iterator = const_iterator;
+   using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+   using reverse_iterator = const_reverse_iterator;
+
+ private:
+   /// Number of bits stored in a word
+   static constexpr size_t word_size = 64;
+
+   /// The words of the two bit-planes storing the same bits
+   struct plane_word
+   {
+      /// Bits which may be zero
+      std::uint64_t zero;
+
+      /// Bits which may be one
+      std::uint64_t one;
+   };
+
+   /// The packed bits, starting from the least significant one; bits beyond length are always U
+   std::vector<plane_word> words;
+
+   /// Number of bits in the string
+   size_t length;
+
+   /**
+    * Return the mask of the valid bits of a word
+    * @param bits is the number of valid bits, starting from the least significant one
+    */
+   static std::uint64_t low_mask(size_t bits)
+   {
+      return bits >= word_size ? ~std::uint64_t(0) : ((std::uint64_t(1) << bits) - 1);
+   }
+
+   /**
+    * Return the bit at a given position
+    * @param pos is the position of the bit starting from the least significant one
+    */
+   bit_lattice get_bit(size_t pos) const
+   {
+      const auto& w = words[pos / word_size];
+      const auto shift = pos % word_size;
+      return static_cast<bit_lattice>(((w.zero >> shift) & 1) | (((w.one >> shift) & 1) << 1));
+   }
+
+   /**
+    * Set the bit at a given position
+    * @param pos is the position of the bit starting from the least significant one
+    * @param b is the new value
+    */
+   void set_bit(size_t pos, bit_lattice b)
+   {
+      auto& w = words[pos / word_size];
+      const auto bit = std::uint64_t(1) << (pos % word_size);
+      const auto value = static_cast<unsigned int>(b);
+      w.zero = (value & 1) ? (w.zero | bit) : (w.zero & ~bit);
+      w.one = (value & 2) ? (w.one | bit) : (w.one & ~bit);
+   }
+
+   /**
+    * Reset to U the bits of the last word which are beyond length
+    */
+   void clear_unused_bits()
+   {
+      if(length % word_size)
+      {
+         const auto mask = low_mask(length % word_size);
+         words.back().zero &= mask;
+         words.back().one &= mask;
+      }
+   }
+
+   /**
+    * Change the number of bits, adding or removing them on the most significant side
+    * @param new_length is the new number of bits; added bits are U
+    */
+   void resize_front(size_t new_length);
+
+   /**
+    * Set a range of bits to the same value
+    * @param pos is the position of the first bit starting from the least significant one
+    * @param count is the number of bits
+    * @param b is the value
+    */
+   void fill(size_t pos, size_t count, bit_lattice b);
+
+   /**
+    * Return a range of bits
+    * @param pos is the position of the first bit starting from the least significant one
+    * @param count is the number of bits
+    */
+   bit_lattice_string extract(size_t pos, size_t count) const;
+
+   /**
+    * Merge the bits of another string; the target bits must be U
+    * @param source is the string to be merged
+    * @param pos is the position where the least significant bit of source is placed
+    */
+   void merge(const bit_lattice_string& source, size_t pos);
+
+   /**
+    * Insert a string before a bit
+    * @param index is the position of the bit starting from the most significant one
+    * @param source is the string to be inserted
+    */
+   void splice(size_t index, const bit_lattice_string& source);
+
+   /**
+    * Apply a bitwise transfer function to the least significant bits of two strings
+    * @param op computes the resulting bit-planes from the bit-planes of the operands
+    */
+   template <typename F>
+   static bit_lattice_string combine(const bit_lattice_string& a, const bit_lattice_string& b, size_t size, F op);
+
+   /**
+    * Apply a ripple carry transfer function to the least significant bits of two strings
+    * @param carry is the incoming carry; at the end it contains the carry of the last computed bit
+    * @param cells is the transfer function of a single cell: the entry of operands a, b and carry c is at index
+    * a * 16 + b * 4 + c and it holds the result in the two least significant bits and the outgoing carry in the next two
+    * @param constant_op computes the result and the outgoing carries of a word of constant bits given the incoming carry
+    */
+   template <typename F>
+   static bit_lattice_string ripple(const bit_lattice_string& a, const bit_lattice_string& b, bit_lattice& carry,
+                                    size_t size, const std::array<unsigned char, 64>& cells, F constant_op);
+
+   friend bit_lattice_string bitstring_sup(const bit_lattice_string& a, const bit_lattice_string& b, size_t size);
+   friend bit_lattice_string bitstring_inf(const bit_lattice_string& a, const bit_lattice_string& b, size_t size);
+   friend bit_lattice_string bitstring_and(const bit_lattice_string& a, const bit_lattice_string& b, size_t size);
+   friend bit_lattice_string bitstring_ior(const bit_lattice_string& a, const bit_lattice_string& b, size_t size);
+   friend bit_lattice_string bitstring_xor(const bit_lattice_string& a, const bit_lattice_string& b, size_t size);
+   friend bit_lattice_string bitstring_plus(const bit_lattice_string& a, const bit_lattice_string& b,
+                                            bit_lattice& carry, size_t size);
+   friend bit_lattice_string bitstring_minus(const bit_lattice_string& a, const bit_lattice_string& b,
+                                             bit_lattice& borrow, size_t size);
+   friend bool bitstring_constant(const bit_lattice_string& a);
+
+ public:
+   bit_lattice_string() : words(), length(0)
+   {
+   }
+
+   /**
+    * Constructor
+    * @param count is the number of bits
+    * @param b is the value of all the bits
+    */
+   bit_lattice_string(size_t count, bit_lattice b);
+
+   /**
+    * Constructor
+    * @param first is the most significant bit to be copied
+    * @param last is the end of the copied range
+    */
+   bit_lattice_string(const_iterator first, const_iterator last);
+
+   size_t size() const
+   {
+      return length;
+   }
+
+   bool empty() const
+   {
+      return length == 0;
+   }
+
+   void clear()
+   {
+      words.clear();
+      length = 0;
+   }
+
+   /**
+    * Return a bit
+    * @param index is the position of the bit starting from the most significant one
+    */
+   bit_lattice operator[](size_t index) const
+   {
+      return get_bit(length - 1 - index);
+   }
+
+   /**
+    * Return a bit checking the bounds
+    * @param index is the position of the bit starting from the most significant one
+    */
+   bit_lattice at(size_t index) const
+   {
+      THROW_ASSERT(index < length, "bit index " + std::to_string(index) + " out of range");
+      return get_bit(length - 1 - index);
+   }
+
+   /**
+    * Set a bit
+    * @param index is the position of the bit starting from the most significant one
+    * @param b is the new value
+    */
+   void set(size_t index, bit_lattice b)
+   {
+      THROW_ASSERT(index < length, "bit index " + std::to_string(index) + " out of range");
+      set_bit(length - 1 - index, b);
+   }
+
+   /// Return the most significant bit
+   bit_lattice front() const
+   {
+      THROW_ASSERT(length, "empty bitstring");
+      return get_bit(length - 1);
+   }
+
+   /// Return the least significant bit
+   bit_lattice back() const
+   {
+      THROW_ASSERT(length, "empty bitstring");
+      return get_bit(0);
+   }
+
+   /// Add a new most significant bit
+   void push_front(bit_lattice b)
+   {
+      if(length % word_size == 0)
+      {
+         words.push_back(plane_word{0, 0});
+      }
+      set_bit(length, b);
+      ++length;
+   }
+
+   /// Remove the most significant bit
+   void pop_front()
+   {
+      THROW_ASSERT(length, "empty bitstring");
+      --length;
+      set_bit(length, bit_lattice::U);
+      if(length % word_size == 0)
+      {
+         words.pop_back();
+      }
+   }
+
+   /// Add a new least significant bit
+   void push_back(bit_lattice b);
+
+   /// Remove the least significant bit
+   void pop_back();
+
+   /**
+    * Insert copies of a bit
+    * @param pos is the bit before which the copies are inserted
+    * @param count is the number of copies
+    * @param b is the inserted value
+    * @return an iterator to the first inserted bit
+    */
+   const_iterator insert(const_iterator pos, size_t count, bit_lattice b);
+
+   /**
+    * Insert a range of bits of another string
+    * @param pos is the bit before which the range is inserted
+    * @param first is the first bit of the range
+    * @param last is the end of the range
+    * @return an iterator to the first inserted bit
+    */
+   const_iterator insert(const_iterator pos, const_iterator first, const_iterator last);
+
+   /**
+    * Remove a range of bits
+    * @param first is the first removed bit
+    * @param last is the end of the removed range
+    * @return an iterator to the bit following the removed ones
+    */
+   const_iterator erase(const_iterator first, const_iterator last);
+
+   const_iterator begin() const
+   {
+      return const_iterator(this, 0);
+   }
+
+   const_iterator end() const
+   {
+      return const_iterator(this, length);
+   }
+
+   const_iterator cbegin() const
+   {
+      return begin();
+   }
+
+   const_iterator cend() const
+   {
+      return end();
+   }
+
+   const_reverse_iterator rbegin() const
+   {
+      return const_reverse_iterator(end());
+   }
+
+   const_reverse_iterator rend() const
+   {
+      return const_reverse_iterator(begin());
+   }
+
+   const_reverse_iterator crbegin() const
+   {
+      return rbegin();
+   }
+
+   const_reverse_iterator crend() const
+   {
+      return rend();
+   }
+
+   bool operator==(const bit_lattice_string& other) const;
+
+   bool operator!=(const bit_lattice_string& other) const
+   {
+      return !(*this == other);
+   }
+};
+
+/**
+ * Transfer function of the single bit plus_expr
+ */
+extern const bit_lattice_adder_table plus_expr_map;
+
+/**
+ * Transfer function of the single bit minus_expr
+ */
+extern const bit_lattice_adder_table minus_expr_map;
+
+/**
+ * Transfer function of the single bit bit_ior_expr
+ */
+extern const bit_lattice_table<bit_lattice_table<bit_lattice>> bit_ior_expr_map;
+
+/**
+ * Transfer function of the single bit bit_xor_expr
+ */
+extern const bit_lattice_table<bit_lattice_table<bit_lattice>> bit_xor_expr_map;
+
+/**
+ * Transfer function of the single bit bit_and_expr
+ */
+extern const bit_lattice_table<bit_lattice_table<bit_lattice>> bit_and_expr_map;
+
 /**
  * Creates a bitstring containing bits initialized at <U>
  * @param lenght the lenght of the bitstring
  * @return a bitstring of the specified length containing <U> values.
  */
-std::deque<bit_lattice> create_u_bitstring(size_t lenght);
+bit_lattice_string create_u_bitstring(size_t lenght);
 
 /**
  * Create a bitstring containing bits initialized at <X>
  * @param lenght the lenght of the bitstring
  * @return a bitstring of the specified length containing <X> values.
  */
-std::deque<bit_lattice> create_x_bitstring(size_t lenght);
+bit_lattice_string create_x_bitstring(size_t lenght);
 
 /**
  * Creates a bitstring from a constant input
@@ -74,25 +631,25 @@ std::deque<bit_lattice> create_x_bitstring(size_t lenght);
  * @param signed_value specified if this bitstring can have negative values
  * @return bitstring generated from the integer constant
  */
-std::deque<bit_lattice> create_bitstring_from_constant(integer_cst_t value_int, unsigned long long length,
-                                                       bool signed_value);
+bit_lattice_string create_bitstring_from_constant(integer_cst_t value_int, unsigned long long length,
+                                                  bool signed_value);
 
 /**
- * Translates a bitstring ( expressed as an std::deque of bit_lattice ) into a string of characters.
+ * Translates a bitstring into a string of characters.
  */
-std::string bitstring_to_string(const std::deque<bit_lattice>& bitstring);
+std::string bitstring_to_string(const bit_lattice_string& bitstring);
 
 /**
  * inverse of bitstring_to_string
  */
-std::deque<bit_lattice> string_to_bitstring(const std::string& s);
+bit_lattice_string string_to_bitstring(const std::string& s);
 
 /**
  * Checks if a bitstring is constant
  * @param a the bitstring to be checked
  * @return TRUE if the bitstring contains only 1, 0 or X but not U values
  */
-bool bitstring_constant(const std::deque<bit_lattice>& a);
+bool bitstring_constant(const bit_lattice_string& a);
 
 /**
  * Extends a bitstring
@@ -101,8 +658,8 @@ bool bitstring_constant(const std::deque<bit_lattice>& a);
  * @param final_size desired length of the bitstrign
  * @return the extended bitstring
  */
-std::deque<bit_lattice> sign_extend_bitstring(const std::deque<bit_lattice>& bitstring, bool bitstring_is_signed,
-                                              size_t final_size);
+bit_lattice_string sign_extend_bitstring(const bit_lattice_string& bitstring, bool bitstring_is_signed,
+                                         size_t final_size);
 
 /**
  * @brief Reduce the size of a bitstring
@@ -111,17 +668,48 @@ std::deque<bit_lattice> sign_extend_bitstring(const std::deque<bit_lattice>& bit
  * 	@param bitstring bitstring to reduce.
  * 	@param bitstring_is_signed must be true if bitstring is signed
  */
-void sign_reduce_bitstring(std::deque<bit_lattice>& bitstring, bool bitstring_is_signed);
+void sign_reduce_bitstring(bit_lattice_string& bitstring, bool bitstring_is_signed);
+
+inline bit_lattice bit_sup(const bit_lattice a, const bit_lattice b)
+{
+   return static_cast<bit_lattice>(static_cast<unsigned int>(a) | static_cast<unsigned int>(b));
+}
 
-bit_lattice bit_sup(const bit_lattice a, const bit_lattice b);
+inline bit_lattice bit_inf(const bit_lattice a, const bit_lattice b)
+{
+   return static_cast<bit_lattice>(static_cast<unsigned int>(a) & static_cast<unsigned int>(b));
+}
 
-bit_lattice bit_inf(const bit_lattice a, const bit_lattice b);
+/**
+ * Bitwise transfer functions: they combine the least significant bits of a and b, which are aligned on the least
+ * significant one. The result contains min(size, a.size(), b.size()) bits.
+ */
+//@{
+bit_lattice_string bitstring_sup(const bit_lattice_string& a, const bit_lattice_string& b, size_t size);
+bit_lattice_string bitstring_inf(const bit_lattice_string& a, const bit_lattice_string& b, size_t size);
+bit_lattice_string bitstring_and(const bit_lattice_string& a, const bit_lattice_string& b, size_t size);
+bit_lattice_string bitstring_ior(const bit_lattice_string& a, const bit_lattice_string& b, size_t size);
+bit_lattice_string bitstring_xor(const bit_lattice_string& a, const bit_lattice_string& b, size_t size);
+//@}
+
+/**
+ * Ripple carry transfer functions: they compute the least significant bits of a + b + carry and a - b - borrow
+ * according to plus_expr_map and minus_expr_map. Words whose bits are all constant are computed with an integer
+ * addition/subtraction. The result contains min(size, a.size(), b.size()) bits; carry and borrow are updated with the
+ * ones produced by the last computed bit.
+ */
+//@{
+bit_lattice_string bitstring_plus(const bit_lattice_string& a, const bit_lattice_string& b, bit_lattice& carry,
+                                  size_t size);
+bit_lattice_string bitstring_minus(const bit_lattice_string& a, const bit_lattice_string& b, bit_lattice& borrow,
+                                   size_t size);
+//@}
 
-std::deque<bit_lattice> sup(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                            const size_t out_type_size, const bool out_is_signed, const bool out_is_bool);
+bit_lattice_string sup(const bit_lattice_string& a, const bit_lattice_string& b, const size_t out_type_size,
+                       const bool out_is_signed, const bool out_is_bool);
 
-std::deque<bit_lattice> inf(const std::deque<bit_lattice>& a, const std::deque<bit_lattice>& b,
-                            const size_t out_type_size, const bool out_is_signed, const bool out_is_bool);
+bit_lattice_string inf(const bit_lattice_string& a, const bit_lattice_string& b, const size_t out_type_size,
+                       const bool out_is_signed, const bool out_is_bool);
 
 bool isBetter(const std::string& a_string, const std::string& b_string);
 
@@ -91,7 +91,7 @@
 
 //@}
 
-extern size_t indentation;
+extern thread_local size_t indentation;
 
 extern std::ostream null_stream;
 
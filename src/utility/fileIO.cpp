@@ -48,6 +48,7 @@
 #include "file_IO_constants.hpp"
 #include "string_manipulation.hpp"
 
+#include <atomic>
 #include <cstdlib>
 #include <random>
 #include <regex>
@@ -79,7 +80,8 @@ int PandaSystem(const ParameterConstRef Param, const std::string& system_command
                 const std::filesystem::path& output, const unsigned int type, const bool background,
                 const size_t timeout)
 {
-   static size_t counter = 0;
+   /// commands may be launched concurrently (e.g., sharded simulations), so each one must get its own script
+   static std::atomic<size_t> counter(0);
    const auto run_index = counter++;
    const auto script_path = Param->getOption<std::filesystem::path>(OPT_output_temporary_directory) /
                             (STR_CST_file_IO_shell_script "_" + STR(run_index));
@@ -238,8 +240,8 @@ bool NaturalVersionOrder(const std::filesystem::path& _x, const std::filesystem:
 template <typename T>
 void array_rand(T* arr, size_t size)
 {
-   static std::random_device rd;
-   static std::mt19937_64 gen(rd());
+   /// one generator per thread, since unique paths may be requested concurrently
+   static thread_local std::mt19937_64 gen(std::random_device{}());
    uint64_t rnd = 0;
    size_t i;
 
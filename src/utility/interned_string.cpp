@@ -0,0 +1,112 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file interned_string.cpp
+ * @brief Process-wide pool of immutable strings and compact maps keyed by pooled strings
+ *
+ * @author agent <agent@local>
+ * $Revision$
+ * $Date$
+ * Last modified by $Author$
+ *
+ */
+#include "interned_string.hpp"
+
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <unordered_set>
+
+namespace
+{
+   /**
+    * The pool of the interned strings; it is shared by the concurrent synthesis steps
+    */
+   struct interned_string_pool
+   {
+      /// lock protecting strings
+      std::shared_mutex mutex;
+
+      /// the pooled strings; a node based set keeps their address stable
+      std::unordered_set<std::string> strings;
+
+      interned_string_pool() : mutex(), strings()
+      {
+      }
+   };
+
+   interned_string_pool& pool()
+   {
+      static interned_string_pool instance;
+      return instance;
+   }
+
+   /// the value shared by all the empty strings
+   const std::string empty_string;
+} // namespace
+
+interned_string::interned_string() : value(&empty_string)
+{
+}
+
+interned_string::interned_string(const std::string& str) : value(&empty_string)
+{
+   if(str.empty())
+   {
+      return;
+   }
+   auto& interned = pool();
+   {
+      std::shared_lock<std::shared_mutex> lock(interned.mutex);
+      const auto it = interned.strings.find(str);
+      if(it != interned.strings.end())
+      {
+         value = &*it;
+         return;
+      }
+   }
+   std::unique_lock<std::shared_mutex> lock(interned.mutex);
+   value = &*interned.strings.insert(str).first;
+}
+
+size_t interned_string::pool_size()
+{
+   auto& interned = pool();
+   std::shared_lock<std::shared_mutex> lock(interned.mutex);
+   return interned.strings.size();
+}
+
+std::ostream& operator<<(std::ostream& os, const interned_string& str)
+{
+   return os << str.str();
+}
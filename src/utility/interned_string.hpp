@@ -0,0 +1,391 @@
+/*
+ *
+ *                   _/_/_/    _/_/   _/    _/ _/_/_/    _/_/
+ *                  _/   _/ _/    _/ _/_/  _/ _/   _/ _/    _/
+ *                 _/_/_/  _/_/_/_/ _/  _/_/ _/   _/ _/_/_/_/
+ *                _/      _/    _/ _/    _/ _/   _/ _/    _/
+ *               _/      _/    _/ _/    _/ _/_/_/  _/    _/
+ *
+ *             ***********************************************
+ *                              PandA Project
+ *                     URL: http://panda.dei.polimi.it
+ *                       Politecnico di Milano - DEIB
+ *                        System Architectures Group
+ *             ***********************************************
+ *              Copyright (C) 2004-2024 Politecnico di Milano
+ *
+ *   This file is part of the PandA framework.
+ *
+ *   The PandA framework is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+/**
+ * @file interned_string.hpp
+ * @brief Process-wide pool of immutable strings and compact maps keyed by pooled strings
+ *
+ * @author agent <agent@local>
+ * $Revision$
+ * $Date$
+ * Last modified by $Author$
+ *
+ */
+#ifndef INTERNED_STRING_HPP
+#define INTERNED_STRING_HPP
+
+#include "custom_map.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iosfwd>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * Handle to a string stored once in a process-wide pool.
+ * Equal strings share the same storage, so a handle is as cheap to copy as a pointer and equality is a pointer
+ * comparison, while ordering follows the lexicographic order of the strings. Pooled strings are never released.
+ */
+class interned_string
+{
+   /// the pooled string
+   const std::string* value;
+
+ public:
+   /**
+    * Constructor of the empty string
+    */
+   interned_string();
+
+   /**
+    * Constructor
+    * @param str is the string to be pooled
+    */
+   explicit interned_string(const std::string& str);
+
+   /**
+    * @return the number of distinct strings in the pool
+    */
+   static size_t pool_size();
+
+   const std::string& str() const
+   {
+      return *value;
+   }
+
+   operator const std::string&() const
+   {
+      return *value;
+   }
+
+   bool empty() const
+   {
+      return value->empty();
+   }
+
+   bool operator==(const interned_string& other) const
+   {
+      return value == other.value;
+   }
+
+   bool operator!=(const interned_string& other) const
+   {
+      return value != other.value;
+   }
+
+   bool operator<(const interned_string& other) const
+   {
+      return value != other.value && *value < *other.value;
+   }
+};
+
+std::ostream& operator<<(std::ostream& os, const interned_string& str);
+
+/**
+ * Map from pooled strings to values.
+ * Entries are stored in a hash table indexed by the pooled key, so lookups cost a single hash probe. The lexicographic
+ * order of the keys, used by entries(), is kept in a sorted vector of pointers to the entries plus a short sorted tail
+ * of the ones inserted since the last merge; the tail is merged once its size reaches the square root of the map size,
+ * so that building large maps does not pay a linear shift for each insertion. Lookups and iteration never modify the
+ * map, so they can be run concurrently.
+ */
+template <typename T>
+class interned_string_map
+{
+ public:
+   using value_type = std::pair<interned_string, T>;
+
+ private:
+   /// the entries; keys are views of the pooled strings, which are never released
+   CustomUnorderedMapStable<std::string_view, value_type> index;
+
+   /// the entries sorted by key
+   std::vector<const value_type*> sorted;
+
+   /// the entries inserted since the last merge, sorted by key
+   std::vector<const value_type*> pending;
+
+   static bool compare(const value_type* first, const value_type* second)
+   {
+      return first->first < second->first;
+   }
+
+   /**
+    * Merges the pending entries into the sorted ones
+    */
+   void merge()
+   {
+      const auto middle = sorted.size();
+      sorted.insert(sorted.end(), pending.begin(), pending.end());
+      std::inplace_merge(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(middle), sorted.end(), compare);
+      pending.clear();
+   }
+
+   /**
+    * Rebuilds the ordered views of the entries after index has been copied
+    * @param other is the map index has been copied from
+    */
+   void relink(const interned_string_map& other)
+   {
+      sorted.reserve(other.sorted.size());
+      for(const auto entry : other.sorted)
+      {
+         sorted.push_back(&index.find(entry->first.str())->second);
+      }
+      pending.reserve(other.pending.size());
+      for(const auto entry : other.pending)
+      {
+         pending.push_back(&index.find(entry->first.str())->second);
+      }
+   }
+
+   /**
+    * Removes entry from an ordered view
+    * @return true if entry was in view
+    */
+   static bool unlink(std::vector<const value_type*>& view, const value_type* entry)
+   {
+      const auto it = std::lower_bound(view.begin(), view.end(), entry, compare);
+      if(it != view.end() && *it == entry)
+      {
+         view.erase(it);
+         return true;
+      }
+      return false;
+   }
+
+ public:
+   /**
+    * Forward iterator visiting the entries sorted by key
+    */
+   class const_iterator
+   {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = interned_string_map::value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const value_type*;
+      using reference = const value_type&;
+
+    private:
+      using position = typename std::vector<pointer>::const_iterator;
+
+      /// the current and the last position in the sorted entries
+      position sorted_it, sorted_end;
+
+      /// the current and the last position in the pending entries
+      position pending_it, pending_end;
+
+      bool from_pending() const
+      {
+         return sorted_it == sorted_end || (pending_it != pending_end && compare(*pending_it, *sorted_it));
+      }
+
+    public:
+      const_iterator(position _sorted_it, position _sorted_end, position _pending_it, position _pending_end)
+          : sorted_it(_sorted_it), sorted_end(_sorted_end), pending_it(_pending_it), pending_end(_pending_end)
+      {
+      }
+
+      reference operator*() const
+      {
+         return from_pending() ? **pending_it : **sorted_it;
+      }
+
+      pointer operator->() const
+      {
+         return &**this;
+      }
+
+      const_iterator& operator++()
+      {
+         if(from_pending())
+         {
+            ++pending_it;
+         }
+         else
+         {
+            ++sorted_it;
+         }
+         return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+         auto ret = *this;
+         ++*this;
+         return ret;
+      }
+
+      bool operator==(const const_iterator& other) const
+      {
+         return sorted_it == other.sorted_it && pending_it == other.pending_it;
+      }
+
+      bool operator!=(const const_iterator& other) const
+      {
+         return !(*this == other);
+      }
+   };
+
+   /**
+    * Range of the entries sorted by key; it is invalidated by any change to the map
+    */
+   class entries_view
+   {
+      /// the map
+      const interned_string_map& map;
+
+    public:
+      explicit entries_view(const interned_string_map& _map) : map(_map)
+      {
+      }
+
+      const_iterator begin() const
+      {
+         return const_iterator(map.sorted.begin(), map.sorted.end(), map.pending.begin(), map.pending.end());
+      }
+
+      const_iterator end() const
+      {
+         return const_iterator(map.sorted.end(), map.sorted.end(), map.pending.end(), map.pending.end());
+      }
+
+      size_t size() const
+      {
+         return map.size();
+      }
+
+      bool empty() const
+      {
+         return map.empty();
+      }
+   };
+
+   interned_string_map() : index(), sorted(), pending()
+   {
+   }
+
+   interned_string_map(const interned_string_map& other) : index(other.index), sorted(), pending()
+   {
+      relink(other);
+   }
+
+   interned_string_map(interned_string_map&&) noexcept = default;
+
+   interned_string_map& operator=(const interned_string_map& other)
+   {
+      if(this != &other)
+      {
+         index = other.index;
+         sorted.clear();
+         pending.clear();
+         relink(other);
+      }
+      return *this;
+   }
+
+   interned_string_map& operator=(interned_string_map&&) noexcept = default;
+
+   /**
+    * Returns the value associated with key, or nullptr when key is not in the map
+    */
+   const T* find(const std::string& key) const
+   {
+      const auto it = index.find(std::string_view(key));
+      return it != index.end() ? &it->second.second : nullptr;
+   }
+
+   /**
+    * Associates value with key, replacing the previous value if any
+    */
+   void insert_or_assign(const std::string& key, const T& value)
+   {
+      const auto it = index.find(std::string_view(key));
+      if(it != index.end())
+      {
+         it->second.second = value;
+         return;
+      }
+      const interned_string pooled(key);
+      const auto entry = &index.emplace(std::string_view(pooled.str()), value_type(pooled, value)).first->second;
+      pending.insert(std::upper_bound(pending.begin(), pending.end(), entry, compare), entry);
+      if(pending.size() >= 16 && pending.size() * pending.size() >= sorted.size())
+      {
+         merge();
+      }
+   }
+
+   /**
+    * Removes key from the map
+    * @return true if key was in the map
+    */
+   bool erase(const std::string& key)
+   {
+      const auto it = index.find(std::string_view(key));
+      if(it == index.end())
+      {
+         return false;
+      }
+      const auto entry = &it->second;
+      if(!unlink(pending, entry))
+      {
+         unlink(sorted, entry);
+      }
+      index.erase(it);
+      return true;
+   }
+
+   /**
+    * @return the entries of the map sorted by key
+    */
+   entries_view entries() const
+   {
+      return entries_view(*this);
+   }
+
+   size_t size() const
+   {
+      return index.size();
+   }
+
+   bool empty() const
+   {
+      return index.empty();
+   }
+};
+
+#endif
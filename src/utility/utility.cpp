@@ -40,9 +40,14 @@
  */
 #include "utility.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <ctime>
+#include <exception>
 #include <iomanip>
 #include <sstream>
+#include <thread>
 
 TimeStamp::TimeStamp() : timestamp("1970-01-01T00:00:00")
 {
@@ -56,13 +61,16 @@ std::string TimeStamp::GetCurrentTimeStamp()
 {
    auto now = std::chrono::system_clock::now();
    auto in_time_t = std::chrono::system_clock::to_time_t(now);
+   /// localtime_r, since time stamps may be requested concurrently
+   struct tm local_time;
+   localtime_r(&in_time_t, &local_time);
 #if !defined(__clang__) && __GNUC__ < 5
    char buffer[32];
-   strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", std::localtime(&in_time_t));
+   strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &local_time);
    return std::string(buffer);
 #else
    std::stringstream ss;
-   ss << std::put_time(std::localtime(&in_time_t), "%Y-%m-%dT%H:%M:%S");
+   ss << std::put_time(&local_time, "%Y-%m-%dT%H:%M:%S");
    return ss.str();
 #endif
 }
@@ -77,3 +85,47 @@ bool operator<=(const TimeStamp& timestamp1, const TimeStamp& timestamp2)
 {
    return timestamp1.timestamp <= timestamp2.timestamp;
 }
+
+void ParallelFor(size_t size, size_t jobs, const std::function<void(size_t)>& body)
+{
+   if(jobs <= 1 || size <= 1)
+   {
+      for(size_t index = 0; index < size; ++index)
+      {
+         body(index);
+      }
+      return;
+   }
+   std::atomic<size_t> next(0);
+   std::vector<std::exception_ptr> errors(size);
+   const auto exec = [&]() {
+      for(auto index = next++; index < size; index = next++)
+      {
+         try
+         {
+            body(index);
+         }
+         catch(...)
+         {
+            errors[index] = std::current_exception();
+         }
+      }
+   };
+   std::vector<std::thread> workers;
+   for(size_t worker = 1; worker < std::min(jobs, size); ++worker)
+   {
+      workers.emplace_back(exec);
+   }
+   exec();
+   for(auto& worker : workers)
+   {
+      worker.join();
+   }
+   for(const auto& error : errors)
+   {
+      if(error)
+      {
+         std::rethrow_exception(error);
+      }
+   }
+}
@@ -51,6 +51,7 @@
 #include <boost/iterator/iterator_facade.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <functional>
 #include <limits>
 #include <sstream>
 #include <string>
@@ -273,6 +274,15 @@ void ShuffleVector(typename std::vector<T>& shuffle, const unsigned int seed)
    }
 }
 
+/**
+ * Runs body on the indexes in [0, size) using at most jobs threads, the calling one included.
+ * The first exception raised, in index order, is rethrown once all the threads are done.
+ * @param size is the number of indexes
+ * @param jobs is the maximum number of threads
+ * @param body is the function to be executed on each index
+ */
+void ParallelFor(size_t size, size_t jobs, const std::function<void(size_t)>& body);
+
 /// The type used for timestamp
 struct TimeStamp
 {
@@ -348,9 +348,12 @@
 #include "config_NPROFILE.hpp"
 
 #include <cerrno>
+#include <fstream>
+#include <iomanip>
 #include <list>
 #include <random>
 #include <regex>
+#include <sstream>
 #include <string>
 #include <unistd.h>
 
@@ -375,6 +378,33 @@ static std::string __escape_define(const std::string& str)
    return std::regex_replace(str, std::regex("([\\(\\) ])"), "\\$1");
 }
 
+/// FNV-1a digest used to identify frontend cache entries
+static std::string __digest(std::istream& is)
+{
+   unsigned long long digest = 0xcbf29ce484222325ULL;
+   char buffer[1 << 16];
+   while(is.read(buffer, sizeof(buffer)) || is.gcount())
+   {
+      for(std::streamsize i = 0; i < is.gcount(); ++i)
+      {
+         digest = (digest ^ static_cast<unsigned char>(buffer[i])) * 0x100000001b3ULL;
+      }
+   }
+   std::stringstream ss;
+   ss << std::hex << std::setw(16) << std::setfill('0') << digest;
+   return ss.str();
+}
+
+static std::string __file_digest(const std::string& filename)
+{
+   std::ifstream file(filename, std::ios::binary);
+   if(!file)
+   {
+      THROW_ERROR("Unable to open " + filename);
+   }
+   return __digest(file);
+}
+
 std::string CompilerWrapper::bambu_ir_info;
 
 CompilerWrapper::CompilerWrapper(const ParameterConstRef _Param, const CompilerWrapper_CompilerTarget _compiler_target,
@@ -395,16 +425,15 @@ CompilerWrapper::CompilerWrapper(const ParameterConstRef _Param, const CompilerW
 // destructor
 CompilerWrapper::~CompilerWrapper() = default;
 
-void CompilerWrapper::CompileFile(std::string& input_filename, const std::string& output_filename,
-                                  const std::string& parameters_line, int cm, const std::string& costTable)
+std::string CompilerWrapper::GetCompileCommand(std::string& input_filename, const std::string& output_filename,
+                                               const std::string& parameters_line, int cm,
+                                               const std::string& costTable, std::string& actual_output_filename)
 {
-   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Compiling " + input_filename);
    THROW_ASSERT(cm == CM_EMPTY || (cm & ~CM_EMPTY) == cm,
                 "Empty compilation must not require any other compilation mode.");
 
    const auto compiler = GetCompiler();
    const auto output_temporary_directory = Param->getOption<std::string>(OPT_output_temporary_directory);
-   const auto compiler_output_filename = output_temporary_directory + "/" STR_CST_gcc_output;
 
    const auto isWholeProgram =
        Param->isOption(OPT_gcc_optimizations) &&
@@ -622,6 +651,10 @@ void CompilerWrapper::CompileFile(std::string& input_filename, const std::string
          append_arg("-panda-outputdir=" + output_temporary_directory);
          append_arg("-panda-infile=" + input_filename);
          append_arg("-panda-cost-table=\"" + costTable + "\"");
+         if(Param->isOption(OPT_frontend_binary_ir) && Param->getOption<bool>(OPT_frontend_binary_ir))
+         {
+            append_arg("-panda-binary-ir");
+         }
          if(top_fnames.size())
          {
             append_arg("-panda-topfname=" + top_fnames);
@@ -636,10 +669,10 @@ void CompilerWrapper::CompileFile(std::string& input_filename, const std::string
       }
    }
 
-   const auto _output_filename = output_filename.size() ?
-                                     output_filename :
-                                     (output_temporary_directory + "/" + unique_path(STR_CST_gcc_obj_file).string());
-   command += " -o " + _output_filename;
+   actual_output_filename = output_filename.size() ?
+                                output_filename :
+                                (output_temporary_directory + "/" + unique_path(STR_CST_gcc_obj_file).string());
+   command += " -o " + actual_output_filename;
 
    if(real_filename == "-" || real_filename == "/dev/null")
    {
@@ -659,7 +692,19 @@ void CompilerWrapper::CompileFile(std::string& input_filename, const std::string
          command += " \"" + src + "\"";
       }
    }
-   command = load_prefix + command;
+   input_filename = real_filename;
+   return load_prefix + command;
+}
+
+void CompilerWrapper::CompileFile(std::string& input_filename, const std::string& output_filename,
+                                  const std::string& parameters_line, int cm, const std::string& costTable)
+{
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Compiling " + input_filename);
+   const auto compiler_output_filename =
+       Param->getOption<std::string>(OPT_output_temporary_directory) + "/" STR_CST_gcc_output;
+   std::string _output_filename;
+   const auto command =
+       GetCompileCommand(input_filename, output_filename, parameters_line, cm, costTable, _output_filename);
    INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "---Invoke: " + command);
 #if !NPROFILE
    long int gcc_compilation_time = 0;
@@ -703,10 +748,93 @@ void CompilerWrapper::CompileFile(std::string& input_filename, const std::string
          CopyStdout(compiler_output_filename);
       }
    }
-   input_filename = real_filename;
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Compiled file");
 }
 
+void CompilerWrapper::CompileFiles(std::vector<std::string>& input_filenames,
+                                   const std::vector<std::string>& output_filenames,
+                                   const std::string& parameters_line, int cm, const std::string& costTable)
+{
+   THROW_ASSERT(input_filenames.size() == output_filenames.size(), "Each source file requires its own output file");
+   const auto jobs = Param->isOption(OPT_frontend_jobs) ? Param->getOption<size_t>(OPT_frontend_jobs) : 1U;
+   if(jobs <= 1 || input_filenames.size() <= 1)
+   {
+      for(size_t i = 0; i < input_filenames.size(); ++i)
+      {
+         CompileFile(input_filenames[i], output_filenames[i], parameters_line, cm, costTable);
+      }
+      return;
+   }
+   /// the empty compilation and the interface analysis write shared files in the output directory
+   THROW_ASSERT(!(cm & (CM_EMPTY | CM_ANALYZER_INTERFACE)), "Compilation mode cannot be run concurrently");
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level,
+                  "-->Compiling " + STR(input_filenames.size()) + " files with " + STR(jobs) + " concurrent jobs");
+   const auto output_temporary_directory = Param->getOption<std::string>(OPT_output_temporary_directory);
+
+   /// every job redirects its output and its exit status to its own files, so that the results can be inspected in
+   /// input order independently of the order in which jobs terminate
+   std::vector<std::string> job_outputs, job_statuses;
+   std::string script;
+   for(size_t i = 0; i < input_filenames.size(); ++i)
+   {
+      THROW_ASSERT(output_filenames[i].size(), "Concurrent compilation requires an explicit output file");
+      std::string actual_output_filename;
+      const auto command = GetCompileCommand(input_filenames[i], output_filenames[i], parameters_line, cm, costTable,
+                                             actual_output_filename);
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "---Invoke: " + command);
+      job_outputs.push_back(output_temporary_directory + "/" STR_CST_gcc_output "_" + STR(i));
+      job_statuses.push_back(output_temporary_directory + "/" STR_CST_gcc_output "_" + STR(i) + ".status");
+      std::remove(job_statuses.back().c_str());
+      script += "( (" + command + ") > " + job_outputs.back() + " 2>&1; echo $? > " + job_statuses.back() + " ) &\n";
+      if(i + 1 >= jobs)
+      {
+         script += "wait -n\n";
+      }
+   }
+   script += "wait";
+#if !NPROFILE
+   long int gcc_compilation_time = 0;
+   if(output_level >= OUTPUT_LEVEL_VERBOSE)
+   {
+      START_TIME(gcc_compilation_time);
+   }
+#endif
+   PandaSystem(Param, script, false, output_temporary_directory + "/" STR_CST_gcc_output);
+#if !NPROFILE
+   if(output_level >= OUTPUT_LEVEL_VERBOSE)
+   {
+      STOP_TIME(gcc_compilation_time);
+      dump_exec_time("Compilation time", gcc_compilation_time);
+   }
+#endif
+
+   for(size_t i = 0; i < input_filenames.size(); ++i)
+   {
+      int ret = -1;
+      std::ifstream status_file(job_statuses[i]);
+      if(!(status_file >> ret) || ret != 0)
+      {
+         PRINT_OUT_MEX(OUTPUT_LEVEL_NONE, 0, "Error in compilation of " + input_filenames[i]);
+         if(std::filesystem::exists(std::filesystem::path(job_outputs[i])))
+         {
+            CopyStdout(job_outputs[i]);
+            THROW_ERROR_CODE(COMPILING_EC, "Front-end compiler returns an error during compilation of " +
+                                               input_filenames[i] + " (" + STR(ret) + ")");
+            THROW_ERROR("Front-end compiler returns an error during compilation of " + input_filenames[i]);
+         }
+         else
+         {
+            THROW_ERROR("Error in front-end compiler invocation");
+         }
+      }
+      else if(output_level >= OUTPUT_LEVEL_VERBOSE)
+      {
+         CopyStdout(job_outputs[i]);
+      }
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Compiled files");
+}
+
 void CompilerWrapper::FillTreeManager(const tree_managerRef TM, std::vector<std::string>& source_files,
                                       const std::string& costTable)
 {
@@ -744,27 +872,55 @@ void CompilerWrapper::FillTreeManager(const tree_managerRef TM, std::vector<std:
       }
    }
 
+   const auto compiler_mode = [&]() -> int {
+      int flags = CM_COMPILER_STD;
+      if(preprocess_only || compile_only)
+      {
+         return flags;
+      }
+      if(compiler.is_clang)
+      {
+         flags |= CM_ANALYZER_ALL;
+      }
+      if(multi_source)
+      {
+         flags |= CM_LTO_FLAG;
+         if(!enable_LTO)
+         {
+            flags |= CM_OPT_DUMPGIMPLE;
+         }
+      }
+      else
+      {
+         flags |= CM_OPT_ALL;
+      }
+      return flags;
+   }();
+
+   /// when the frontend compiler is not clang, pragmas are analyzed by a separate clang invocation
+   const auto analyze_interface = [&]() -> bool {
 #if HAVE_I386_CLANG4_COMPILER || HAVE_I386_CLANG5_COMPILER || HAVE_I386_CLANG6_COMPILER ||    \
     HAVE_I386_CLANG7_COMPILER || HAVE_I386_CLANG8_COMPILER || HAVE_I386_CLANG9_COMPILER ||    \
     HAVE_I386_CLANG10_COMPILER || HAVE_I386_CLANG11_COMPILER || HAVE_I386_CLANG12_COMPILER || \
     HAVE_I386_CLANG13_COMPILER || HAVE_I386_CLANG16_COMPILER || HAVE_I386_CLANGVVD_COMPILER
-   if(Param->IsParameter("disable-pragma-parsing") && Param->GetParameter<int>("disable-pragma-parsing") == 1)
-   {
-      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "Pragma analysis disabled");
-   }
-   else if(!compiler.is_clang)
-   {
-      std::string analyzing_compiling_parameters;
+      return !compiler.is_clang &&
+             !(Param->IsParameter("disable-pragma-parsing") && Param->GetParameter<int>("disable-pragma-parsing") == 1);
+#else
+      return false;
+#endif
+   }();
+   const auto analyzing_compiling_parameters = [&]() -> std::string {
+      std::string parameters;
       if(Param->isOption(OPT_gcc_standard))
       {
-         analyzing_compiling_parameters += " --std=" + Param->getOption<std::string>(OPT_gcc_standard);
+         parameters += " --std=" + Param->getOption<std::string>(OPT_gcc_standard);
       }
       if(Param->isOption(OPT_gcc_defines))
       {
          const auto defines = Param->getOption<std::list<std::string>>(OPT_gcc_defines);
          for(const auto& define : defines)
          {
-            analyzing_compiling_parameters += " -D" + __escape_define(define);
+            parameters += " -D" + __escape_define(define);
          }
       }
       if(Param->isOption(OPT_gcc_undefines))
@@ -772,7 +928,7 @@ void CompilerWrapper::FillTreeManager(const tree_managerRef TM, std::vector<std:
          const auto undefines = Param->getOption<std::list<std::string>>(OPT_gcc_undefines);
          for(const auto& undefine : undefines)
          {
-            analyzing_compiling_parameters += " -U" + __escape_define(undefine);
+            parameters += " -U" + __escape_define(undefine);
          }
       }
       if(Param->isOption(OPT_gcc_warnings))
@@ -782,14 +938,69 @@ void CompilerWrapper::FillTreeManager(const tree_managerRef TM, std::vector<std:
          {
             if(!warning.empty())
             {
-               analyzing_compiling_parameters += " -W" + warning;
+               parameters += " -W" + warning;
             }
          }
       }
       if(Param->isOption(OPT_gcc_includes))
       {
-         analyzing_compiling_parameters += " " + Param->getOption<std::string>(OPT_gcc_includes);
+         parameters += " " + Param->getOption<std::string>(OPT_gcc_includes);
+      }
+      return parameters;
+   }();
+
+   /// optimization steps applied to the linked object when multiple sources are compiled with link time optimization
+   const auto lto_leaf_name = std::filesystem::path(source_files.front()).filename().string();
+   const auto ext_symbols_filename = output_temporary_directory + "/external-symbols.txt";
+   const auto lto_internalize_parameters = add_plugin_prefix(compiler_target, "1");
+   const auto lto_dump_parameters =
+       enable_LTO ? " --internalize-public-api-file=" + ext_symbols_filename + " " + add_plugin_prefix(compiler_target) +
+                        "internalize " + clang_recipes(optimization_set, "") +
+                        " -panda-infile=" + container_to_string(source_files, ",") :
+                    std::string();
+
+   /// the frontend cache is used only when the whole tree manager is produced by the compilation of the source files
+   std::filesystem::path cache_entry;
+   std::string cache_key;
+   if(Param->isOption(OPT_frontend_cache) && !(compile_only || preprocess_only) &&
+      TM->get_next_available_tree_node_id() == 1 &&
+      std::find(source_files.begin(), source_files.end(), "-") == source_files.end())
+   {
+      std::vector<std::pair<std::string, int>> source_steps, lto_steps;
+      if(analyze_interface)
+      {
+         source_steps.emplace_back(analyzing_compiling_parameters, CM_ANALYZER_INTERFACE);
+      }
+      source_steps.emplace_back(frontend_compiler_parameters, compiler_mode);
+      if(enable_LTO)
+      {
+         lto_steps.emplace_back("", CM_COMPILER_LTO);
+         lto_steps.emplace_back(lto_internalize_parameters, CM_COMPILER_OPT | CM_OPT_INTERNALIZE);
+         lto_steps.emplace_back(lto_dump_parameters, CM_COMPILER_OPT | CM_OPT_DUMPGIMPLE);
       }
+      cache_key = GetFrontendCacheKey(source_files, source_steps, lto_steps, costTable);
+      std::stringstream key_stream(cache_key);
+      cache_entry = Param->getOption<std::filesystem::path>(OPT_frontend_cache) / __digest(key_stream);
+      if(LoadFrontendCache(TM, cache_entry, cache_key))
+      {
+         INDENT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level,
+                        "---Front-end compilation skipped: loaded " + cache_entry.string());
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--");
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Front-end compiler finished");
+         return;
+      }
+   }
+
+#if HAVE_I386_CLANG4_COMPILER || HAVE_I386_CLANG5_COMPILER || HAVE_I386_CLANG6_COMPILER ||    \
+    HAVE_I386_CLANG7_COMPILER || HAVE_I386_CLANG8_COMPILER || HAVE_I386_CLANG9_COMPILER ||    \
+    HAVE_I386_CLANG10_COMPILER || HAVE_I386_CLANG11_COMPILER || HAVE_I386_CLANG12_COMPILER || \
+    HAVE_I386_CLANG13_COMPILER || HAVE_I386_CLANG16_COMPILER || HAVE_I386_CLANGVVD_COMPILER
+   if(Param->IsParameter("disable-pragma-parsing") && Param->GetParameter<int>("disable-pragma-parsing") == 1)
+   {
+      INDENT_OUT_MEX(OUTPUT_LEVEL_MINIMUM, output_level, "Pragma analysis disabled");
+   }
+   else if(analyze_interface)
+   {
       for(auto& source_file : source_files)
       {
          INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Analyze file " + source_file);
@@ -801,40 +1012,37 @@ void CompilerWrapper::FillTreeManager(const tree_managerRef TM, std::vector<std:
 #endif
 
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "Starting compilation of single files");
-   const auto compiler_mode = [&]() -> int {
-      int flags = CM_COMPILER_STD;
-      if(preprocess_only || compile_only)
-      {
-         return flags;
-      }
-      if(compiler.is_clang)
-      {
-         flags |= CM_ANALYZER_ALL;
-      }
-      if(multi_source)
-      {
-         flags |= CM_LTO_FLAG;
-         if(!enable_LTO)
-         {
-            flags |= CM_OPT_DUMPGIMPLE;
-         }
-      }
-      else
-      {
-         flags |= CM_OPT_ALL;
-      }
-      return flags;
-   }();
    std::list<std::string> obj_files;
    THROW_ASSERT(!multi_source || !(compile_only || preprocess_only), "");
-   for(auto& source_file : source_files)
+   std::vector<std::string> compiled_files;
+   for(const auto& source_file : source_files)
    {
       const auto leaf_name = source_file == "-" ? "stdin-" : std::filesystem::path(source_file).filename().string();
       INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Compiling file " + source_file);
-      const auto obj_file = ((compile_only || preprocess_only) && Param->isOption(OPT_output_file)) ?
-                                Param->getOption<std::string>(OPT_output_file) :
-                                unique_path(output_temporary_directory + "/" + leaf_name + ".%%%%%%.o").string();
-      CompileFile(source_file, obj_file, frontend_compiler_parameters, compiler_mode, costTable);
+      compiled_files.push_back(((compile_only || preprocess_only) && Param->isOption(OPT_output_file)) ?
+                                   Param->getOption<std::string>(OPT_output_file) :
+                                   unique_path(output_temporary_directory + "/" + leaf_name + ".%%%%%%.o").string());
+   }
+   const auto concurrent_compilation =
+       multi_source && Param->isOption(OPT_frontend_jobs) && Param->getOption<size_t>(OPT_frontend_jobs) > 1;
+   if(concurrent_compilation && (compiler_mode & CM_ANALYZER_INTERFACE))
+   {
+      /// interface analysis updates a single architecture file, so it is performed in order and with syntax checking
+      /// only before the concurrent compilation of the source files
+      for(auto source_file : source_files)
+      {
+         INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Analyze file " + source_file);
+         CompileFile(source_file, "", frontend_compiler_parameters + " -fsyntax-only", CM_ANALYZER_INTERFACE,
+                     costTable);
+      }
+   }
+   CompileFiles(source_files, compiled_files, frontend_compiler_parameters,
+                concurrent_compilation ? (compiler_mode & ~CM_ANALYZER_INTERFACE) : compiler_mode, costTable);
+   for(size_t i = 0; i < source_files.size(); ++i)
+   {
+      auto& source_file = source_files[i];
+      const auto leaf_name = source_file == "-" ? "stdin-" : std::filesystem::path(source_file).filename().string();
+      const auto& obj_file = compiled_files[i];
       if(enable_LTO)
       {
          obj_files.push_back(obj_file);
@@ -855,27 +1063,20 @@ void CompilerWrapper::FillTreeManager(const tree_managerRef TM, std::vector<std:
 
    if(enable_LTO)
    {
-      const auto leaf_name = std::filesystem::path(source_files.front()).filename().string();
-      const auto ext_symbols_filename = output_temporary_directory + "/external-symbols.txt";
       std::string lto_source = container_to_string(obj_files, STR_CST_string_separator);
-      std::string lto_obj = output_temporary_directory + "/" + leaf_name + ".lto.bc";
+      std::string lto_obj = output_temporary_directory + "/" + lto_leaf_name + ".lto.bc";
       CompileFile(lto_source, lto_obj, "", CM_COMPILER_LTO, "");
 
       lto_source = lto_obj;
-      lto_obj = output_temporary_directory + "/" + leaf_name + ".lto-opt.bc";
-      std::string opt_command = add_plugin_prefix(compiler_target, "1");
-
-      CompileFile(lto_source, lto_obj, opt_command, CM_COMPILER_OPT | CM_OPT_INTERNALIZE, costTable);
+      lto_obj = output_temporary_directory + "/" + lto_leaf_name + ".lto-opt.bc";
+      CompileFile(lto_source, lto_obj, lto_internalize_parameters, CM_COMPILER_OPT | CM_OPT_INTERNALIZE, costTable);
 
       lto_source = lto_obj;
-      lto_obj = output_temporary_directory + "/" + leaf_name + ".lto-dump.bc";
+      lto_obj = output_temporary_directory + "/" + lto_leaf_name + ".lto-dump.bc";
       THROW_ASSERT(std::filesystem::exists(ext_symbols_filename), "File not found: " + ext_symbols_filename);
-      const auto plugin_prefix = add_plugin_prefix(compiler_target);
-      opt_command = " --internalize-public-api-file=" + ext_symbols_filename + " " + plugin_prefix + "internalize " +
-                    clang_recipes(optimization_set, "") + " -panda-infile=" + container_to_string(source_files, ",");
-      CompileFile(lto_source, lto_obj, opt_command, CM_COMPILER_OPT | CM_OPT_DUMPGIMPLE, costTable);
+      CompileFile(lto_source, lto_obj, lto_dump_parameters, CM_COMPILER_OPT | CM_OPT_DUMPGIMPLE, costTable);
 
-      const auto gimple_obj = output_temporary_directory + "/" + leaf_name + STR_CST_bambu_ir_suffix;
+      const auto gimple_obj = output_temporary_directory + "/" + lto_leaf_name + STR_CST_bambu_ir_suffix;
       if(!std::filesystem::exists(gimple_obj))
       {
          THROW_ERROR("Object file not found: " + gimple_obj);
@@ -918,11 +1119,126 @@ void CompilerWrapper::FillTreeManager(const tree_managerRef TM, std::vector<std:
 #endif
       }
    }
+   if(!cache_entry.empty())
+   {
+      StoreFrontendCache(TM, cache_entry, cache_key);
+   }
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "Ended compilation of single files");
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--");
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "<--Front-end compiler finished");
 }
 
+std::string CompilerWrapper::GetFrontendCacheKey(const std::vector<std::string>& source_files,
+                                                 const std::vector<std::pair<std::string, int>>& source_steps,
+                                                 const std::vector<std::pair<std::string, int>>& lto_steps,
+                                                 const std::string& costTable)
+{
+   const auto output_temporary_directory = Param->getOption<std::string>(OPT_output_temporary_directory);
+   std::string key = "revision: " + Param->getOption<std::string>(OPT_revision) + "\n";
+   key += "compiler: " + STR(static_cast<int>(compiler_target)) + "\n";
+
+   /// every option reaching the compiler or its plugins is part of the command line, so the whole command is used
+   /// instead of a selection of options; output paths are dropped since they change at each run
+   const auto add_command = [&](std::string input_filename, const std::string& parameters_line, int cm) {
+      std::string object_file;
+      auto command = GetCompileCommand(input_filename, output_temporary_directory + "/frontend-cache.o",
+                                       parameters_line, cm, costTable, object_file);
+      boost::replace_all(command, " -o " + object_file, "");
+      boost::replace_all(command, output_temporary_directory, "<tmp>");
+      key += "command: " + command + "\n";
+   };
+   for(const auto& source_file : source_files)
+   {
+      for(const auto& step : source_steps)
+      {
+         add_command(source_file, step.first, step.second);
+      }
+   }
+   for(const auto& step : lto_steps)
+   {
+      add_command(output_temporary_directory + "/frontend-cache.bc", step.first, step.second);
+   }
+
+   /// sources are identified by their preprocessed content, so that changes in included headers are detected too;
+   /// the additional preprocessing run is the price paid for that
+   std::vector<std::string> preprocessed_sources(source_files), preprocessed_files;
+   for(const auto& source_file : source_files)
+   {
+      preprocessed_files.push_back(
+          unique_path(output_temporary_directory + "/" + std::filesystem::path(source_file).filename().string() +
+                      ".%%%%%%.i")
+              .string());
+   }
+   CompileFiles(preprocessed_sources, preprocessed_files, frontend_compiler_parameters + " -E", CM_COMPILER_STD,
+                costTable);
+   for(size_t i = 0; i < source_files.size(); ++i)
+   {
+      key += "source: " + source_files[i] + " " + __file_digest(preprocessed_files[i]) + "\n";
+      std::filesystem::remove(preprocessed_files[i]);
+   }
+   return key;
+}
+
+bool CompilerWrapper::LoadFrontendCache(const tree_managerRef TM, const std::filesystem::path& entry,
+                                        const std::string& key) const
+{
+   std::ifstream key_file(entry / "key");
+   if(!key_file)
+   {
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Frontend cache miss: " + entry.string());
+      return false;
+   }
+   const std::string entry_key((std::istreambuf_iterator<char>(key_file)), std::istreambuf_iterator<char>());
+   if(entry_key != key)
+   {
+      INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Frontend cache key mismatch: " + entry.string());
+      return false;
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Frontend cache hit: " + entry.string());
+   const auto output_temporary_directory = Param->getOption<std::filesystem::path>(OPT_output_temporary_directory);
+   if(std::filesystem::exists(entry / "architecture.xml"))
+   {
+      std::filesystem::copy_file(entry / "architecture.xml", output_temporary_directory / "architecture.xml",
+                                 std::filesystem::copy_options::overwrite_existing);
+   }
+   TM->merge_tree_managers(ParseTreeFile(Param, (entry / ("ir" STR_CST_bambu_ir_suffix)).string()));
+   return true;
+}
+
+void CompilerWrapper::StoreFrontendCache(const tree_managerRef TM, const std::filesystem::path& entry,
+                                         const std::string& key) const
+{
+   if(std::filesystem::exists(entry))
+   {
+      return;
+   }
+   /// the entry is populated in a private directory and then renamed, so that concurrent runs sharing the same cache
+   /// never observe a partially written entry
+   const auto staging = unique_path(entry.string() + "-%%%%-%%%%");
+   std::filesystem::create_directories(staging);
+   {
+      std::ofstream ir_file(staging / ("ir" STR_CST_bambu_ir_suffix));
+      ir_file << TM;
+   }
+   const auto arch_filename =
+       Param->getOption<std::filesystem::path>(OPT_output_temporary_directory) / "architecture.xml";
+   if(std::filesystem::exists(arch_filename))
+   {
+      std::filesystem::copy_file(arch_filename, staging / "architecture.xml");
+   }
+   {
+      std::ofstream key_file(staging / "key");
+      key_file << key;
+   }
+   std::error_code ec;
+   std::filesystem::rename(staging, entry, ec);
+   if(ec)
+   {
+      std::filesystem::remove_all(staging);
+   }
+   INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "---Frontend output stored in cache: " + entry.string());
+}
+
 void CompilerWrapper::InitializeCompilerParameters()
 {
    INDENT_DBG_MEX(DEBUG_LEVEL_VERY_PEDANTIC, debug_level, "-->Initializing gcc parameters");
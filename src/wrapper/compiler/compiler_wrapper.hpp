@@ -53,6 +53,7 @@
 
 #include <filesystem>
 #include <iosfwd>
+#include <utility>
 #include <vector>
 
 REF_FORWARD_DECL(application_manager);
@@ -209,6 +210,31 @@ class CompilerWrapper
    void CompileFile(std::string& input_filename, const std::string& output_file, const std::string& parameters_line,
                     int cm, const std::string& costTable);
 
+   /**
+    * Build the command line invoking the frontend compiler on file(s)
+    * @param input_filename is the source file name (is modified in case of empty file compilation)
+    * @param output_filename is the output file name
+    * @param parameters_line are the parameters to be passed to the frontend compiler
+    * @param cm is the mode in which we compile
+    * @param actual_output_filename is set to the file actually produced by the compiler (a temporary object file when
+    * output_filename is empty)
+    * @return the command line to be executed
+    */
+   std::string GetCompileCommand(std::string& input_filename, const std::string& output_filename,
+                                 const std::string& parameters_line, int cm, const std::string& costTable,
+                                 std::string& actual_output_filename);
+
+   /**
+    * Invoke the frontend compiler on a set of independent files, running up to OPT_frontend_jobs compilations
+    * concurrently; errors and compiler outputs are reported in input order
+    * @param input_filenames are the source file names
+    * @param output_filenames are the output file names, one for each source file
+    * @param parameters_line are the parameters to be passed to the frontend compiler
+    * @param cm is the mode in which we compile
+    */
+   void CompileFiles(std::vector<std::string>& input_filenames, const std::vector<std::string>& output_filenames,
+                     const std::string& parameters_line, int cm, const std::string& costTable);
+
    std::string GetAnalyzeCompiler() const;
 
    /**
@@ -248,6 +274,37 @@ class CompilerWrapper
 
    std::string readExternalSymbols(const std::filesystem::path& filename) const;
 
+   /**
+    * Compute the description of everything the frontend output depends on: tool revision, full command line of every
+    * compiler invocation without its output paths, and a digest of each preprocessed source file
+    * @param source_files are the source files to be compiled
+    * @param source_steps are the parameters line and the mode of each compilation applied to every source file
+    * @param lto_steps are the parameters line and the mode of each compilation applied to the linked object
+    * @param costTable is the cost table passed to the IR dumping plugin
+    * @return the key of the frontend cache entry
+    */
+   std::string GetFrontendCacheKey(const std::vector<std::string>& source_files,
+                                   const std::vector<std::pair<std::string, int>>& source_steps,
+                                   const std::vector<std::pair<std::string, int>>& lto_steps,
+                                   const std::string& costTable);
+
+   /**
+    * Fill the tree manager from a frontend cache entry
+    * @param TM is the tree manager to be filled
+    * @param entry is the cache entry directory
+    * @param key is the key of the cache entry
+    * @return true if the entry exists and matches the key
+    */
+   bool LoadFrontendCache(const tree_managerRef TM, const std::filesystem::path& entry, const std::string& key) const;
+
+   /**
+    * Store the frontend output into a frontend cache entry
+    * @param TM is the tree manager filled by the frontend
+    * @param entry is the cache entry directory
+    * @param key is the key of the cache entry
+    */
+   void StoreFrontendCache(const tree_managerRef TM, const std::filesystem::path& entry, const std::string& key) const;
+
    std::string clang_recipes(const CompilerWrapper_OptimizationSet optimization_level, const std::string& fname) const;
 
    std::string load_plugin(const std::string& plugin_obj, CompilerWrapper_CompilerTarget target) const;
@@ -126,7 +126,13 @@ void SimulationTool::CheckExecution()
    /// for default, nothing to do
 }
 
-void SimulationTool::Simulate(unsigned long long int& accum_cycles, unsigned long long& n_testcases)
+bool SimulationTool::SupportsShards() const
+{
+   return false;
+}
+
+void SimulationTool::Simulate(unsigned long long int& accum_cycles, unsigned long long& n_testcases,
+                              unsigned int shards)
 {
    if(generated_script.empty())
    {
@@ -144,8 +150,12 @@ void SimulationTool::Simulate(unsigned long long int& accum_cycles, unsigned lon
    {
       std::filesystem::remove_all(profiling_result_file);
    }
-   ToolManagerRef tool(new ToolManager(Param));
-   tool->configure("./" + generated_script, "");
+   if(shards > 1 && !SupportsShards())
+   {
+      THROW_WARNING("Selected simulator does not support concurrent simulation shards: test vectors will be simulated "
+                    "sequentially");
+      shards = 1;
+   }
    std::vector<std::string> parameters, input_files, output_files;
    // TODO: Shouldn't we populate input_files and output_files with something meaningful?
    if(Param->isOption(OPT_testbench_argv))
@@ -153,12 +163,100 @@ void SimulationTool::Simulate(unsigned long long int& accum_cycles, unsigned lon
       const auto tb_argv = Param->getOption<std::string>(OPT_testbench_argv);
       parameters.push_back(tb_argv);
    }
-   tool->execute(parameters, input_files, output_files,
-                 Param->getOption<std::string>(OPT_output_temporary_directory) + "/simulation_output", true);
+   const auto output_temporary_directory = Param->getOption<std::string>(OPT_output_temporary_directory);
+   if(shards <= 1)
+   {
+      ToolManagerRef tool(new ToolManager(Param));
+      tool->configure("./" + generated_script, "");
+      tool->execute(parameters, input_files, output_files, output_temporary_directory + "/simulation_output", true);
+   }
+   else
+   {
+      PRINT_OUT_MEX(OUTPUT_LEVEL_VERBOSE, output_level, "Simulating test vectors on " << shards << " shards");
+      /// the simulation model is built once and then shared by all the shards
+      ToolManagerRef build_tool(new ToolManager(Param));
+      build_tool->configure("./" + generated_script, "export M_SIM_BUILD_ONLY=1");
+      build_tool->execute(parameters, input_files, output_files,
+                          output_temporary_directory + "/simulation_build_output");
+
+      /// every shard gets its own IPC channel and results file, so that the instances do not interfere
+      const auto sim_dir = Param->getOption<std::filesystem::path>(OPT_output_directory) / "simulation";
+      std::vector<ToolManagerRef> shard_tools;
+      for(auto shard = 0U; shard < shards; ++shard)
+      {
+         const auto shard_result_file = result_file + "." + STR(shard);
+         if(std::filesystem::exists(shard_result_file))
+         {
+            std::filesystem::remove_all(shard_result_file);
+         }
+         ToolManagerRef shard_tool(new ToolManager(Param));
+         shard_tool->configure("./" + generated_script,
+                               "export M_SIM_SKIP_BUILD=1 M_TB_SHARD=" + STR(shard) + " M_TB_SHARDS=" + STR(shards) +
+                                   " M_IPC_FILENAME_OVERRIDE=" + (sim_dir / ("panda_sock." + STR(shard))).string() +
+                                   " M_RESULTS_FILENAME=" + shard_result_file);
+         shard_tools.push_back(shard_tool);
+      }
+      std::vector<std::thread> workers;
+      for(auto shard = 0U; shard < shards; ++shard)
+      {
+         workers.emplace_back([&, shard]() {
+            shard_tools.at(shard)->execute(parameters, input_files, output_files,
+                                           output_temporary_directory + "/simulation_output." + STR(shard), true);
+         });
+      }
+      for(auto& worker : workers)
+      {
+         worker.join();
+      }
+      MergeShardResults(shards);
+   }
 
    DetermineCycles(accum_cycles, n_testcases);
 }
 
+void SimulationTool::MergeShardResults(unsigned int shards) const
+{
+   const auto result_file = Param->getOption<std::string>(OPT_simulation_output);
+   std::vector<std::vector<std::string>> shard_runs;
+   std::string retval = "0";
+   for(auto shard = 0U; shard < shards; ++shard)
+   {
+      const auto shard_result_file = result_file + "." + STR(shard);
+      std::ifstream shard_file(shard_result_file);
+      if(!shard_file.is_open())
+      {
+         THROW_ERROR("The simulation of shard " + STR(shard) + " does not end correctly");
+      }
+      std::string values, shard_retval;
+      std::getline(shard_file, values);
+      std::getline(shard_file, shard_retval);
+      shard_runs.push_back(string_to_container<std::vector<std::string>>(values, ","));
+      /// the first shard which failed determines the overall outcome
+      if(retval == "0" && shard_retval != "0")
+      {
+         retval = shard_retval.empty() ? "A" : shard_retval;
+      }
+      shard_file.close();
+      std::filesystem::remove(shard_result_file);
+   }
+
+   /// shard k executed the test vectors k, k + shards, k + 2 * shards, ...: restore the sequential order
+   std::ofstream res_file(result_file);
+   for(size_t run = 0, written = 1; written; ++run)
+   {
+      written = 0;
+      for(const auto& runs : shard_runs)
+      {
+         if(run < runs.size())
+         {
+            res_file << runs.at(run) << ",";
+            ++written;
+         }
+      }
+   }
+   res_file << "\n" << retval << "\n";
+}
+
 void SimulationTool::DetermineCycles(unsigned long long int& accum_cycles, unsigned long long& n_testcases)
 {
    unsigned long long int num_cycles = 0;
@@ -327,11 +425,14 @@ std::string SimulationTool::GenerateSimulationScript(const std::string& top_file
           << "OUT_LVL=\"" << Param->getOption<int>(OPT_output_level) << "\"\n\n"
           << "### Do not edit below\n\n"
           << "BEH_DIR=" << beh_dir << "\n"
-          << "M_IPC_FILENAME=\"${SIM_DIR}/panda_sock\"\n";
+          << "M_IPC_FILENAME=\"${SIM_DIR}/panda_sock\"\n"
+          << "if [ -z \"${M_SIM_SKIP_BUILD}\" ]; then\n";
 
    auto sim_cmd = GenerateScript(script, top_filename, file_list);
    boost::replace_all(sim_cmd, "\"", "\\\"");
    script
+       << "fi\n"
+       << "if [ ! -z \"${M_SIM_BUILD_ONLY}\" ]; then exit 0; fi\n\n"
        << "export M_IPC_SIM_CMD=\"" << sim_cmd << "; exit \\${PIPESTATUS[0]};\"\n\n"
        << "if [ -f ${SYS_ELF} ]; then\n"
        << "  function get_class { readelf -h $1 | grep Class: | sed -E 's/.*Class:\\s*(\\w+)/\\1/'; }\n"
@@ -345,7 +446,7 @@ std::string SimulationTool::GenerateSimulationScript(const std::string& top_file
    {
       script << "LD_PRELOAD=${SIM_DIR}/libmdpi_driver.so ";
    }
-   script << "${SYS_ELF} \"$@\" 2>&1 | tee ${SIM_DIR}/$(basename ${SYS_ELF}).log\n"
+   script << "${SYS_ELF} \"$@\" 2>&1 | tee ${SIM_DIR}/$(basename ${SYS_ELF})${M_TB_SHARD:+.${M_TB_SHARD}}.log\n"
           << "  exit ${PIPESTATUS[0]}\n"
           << "fi\n"
           << "exit -1\n\n";
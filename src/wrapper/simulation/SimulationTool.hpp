@@ -107,10 +107,25 @@ class SimulationTool
     */
    virtual std::string GenerateSimulationScript(const std::string& top_filename, std::list<std::string> file_list);
 
+   /**
+    * Checks if the compiled simulation model can be run by many concurrent instances, each one executing a subset of
+    * the test vectors
+    */
+   virtual bool SupportsShards() const;
+
    /**
     * Performs the simulation and returns the number of cycles
+    * @param accum_cycles is the total number of accumulated cycles
+    * @param n_testcases is the number of testcases simulated
+    * @param shards is the number of concurrent simulations the test vectors are split into
+    */
+   virtual void Simulate(unsigned long long& accum_cycles, unsigned long long& n_testcases, unsigned int shards);
+
+   /**
+    * Merges the results files written by the simulation shards into the results file of a sequential simulation
+    * @param shards is the number of simulation shards
     */
-   virtual void Simulate(unsigned long long& accum_cycles, unsigned long long& n_testcases);
+   void MergeShardResults(unsigned int shards) const;
 
    /**
     * Determines the average number of cycles for the simulation(s)
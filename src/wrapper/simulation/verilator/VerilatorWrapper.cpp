@@ -63,6 +63,12 @@ VerilatorWrapper::VerilatorWrapper(const ParameterConstRef& _Param, const std::s
    PRINT_DBG_MEX(DEBUG_LEVEL_VERBOSE, debug_level, "Creating the VERILATOR wrapper...");
 }
 
+bool VerilatorWrapper::SupportsShards() const
+{
+   /// the model is a standalone executable which only depends on the IPC and results files it is told to use
+   return true;
+}
+
 void VerilatorWrapper::GenerateVerilatorMain(const std::filesystem::path& filename) const
 {
    std::ofstream os(filename, std::ios::out);
@@ -139,7 +145,7 @@ std::string VerilatorWrapper::GenerateScript(std::ostream& script, const std::st
                                     (Param->isOption(OPT_discrepancy_hw) && Param->getOption<bool>(OPT_discrepancy_hw));
    const auto main_filename = beh_dir / "sim_main.cpp";
    GenerateVerilatorMain(main_filename);
-   log_file = "${BEH_DIR}/" + top_filename + "_verilator.log";
+   log_file = "${BEH_DIR}/" + top_filename + "_verilator${M_TB_SHARD:+.${M_TB_SHARD}}.log";
    script << "export VM_PARALLEL_BUILDS=1\n"
           << "BEH_CC=\"${CC}\"\n"
           << "obj_dir=\"${BEH_DIR}/verilator_obj\"\n\n";
@@ -234,5 +240,5 @@ std::string VerilatorWrapper::GenerateScript(std::ostream& script, const std::st
 #endif
    script << "\n\n";
 
-   return "${obj_dir}/Vbambu_testbench 2>&1 | tee " + log_file;
+   return "${BEH_DIR}/verilator_obj/Vbambu_testbench 2>&1 | tee " + log_file;
 }
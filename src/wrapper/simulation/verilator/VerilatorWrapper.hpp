@@ -63,6 +63,8 @@ class VerilatorWrapper : public SimulationTool
     * @param Param is the set of parameters
     */
    VerilatorWrapper(const ParameterConstRef& Param, const std::string& top_fname, const std::string& inc_dirs);
+
+   bool SupportsShards() const override;
 };
 
 #endif